@@ -208,7 +208,6 @@ static struct bufline_s *remove_from_buffer (struct buffer_s *buffptr)
  * Reads the bytes from the socket, and adds them to the buffer.
  * Takes a connection and returns the number of bytes read.
  */
-#define READ_BUFFER_SIZE (1024 * 2)
 ssize_t read_buffer (int fd, struct buffer_s * buffptr)
 {
         ssize_t bytesin;
@@ -271,9 +270,19 @@ ssize_t read_buffer (int fd, struct buffer_s * buffptr)
  * Takes a connection and returns the number of bytes written.
  */
 ssize_t write_buffer (int fd, struct buffer_s * buffptr, struct buffer_s *log)
+{
+        return write_buffer_limit (fd, buffptr, log, (size_t) -1);
+}
+
+/*
+ * Like write_buffer(), but write no more than "limit" bytes.
+ */
+ssize_t write_buffer_limit (int fd, struct buffer_s * buffptr,
+                            struct buffer_s *log, size_t limit)
 {
         ssize_t bytessent;
         struct bufline_s *line;
+        size_t len;
 
         assert (fd >= 0);
         assert (buffptr != NULL);
@@ -285,14 +294,15 @@ ssize_t write_buffer (int fd, struct buffer_s * buffptr, struct buffer_s *log)
         assert (BUFFER_HEAD (buffptr) != NULL);
         line = BUFFER_HEAD (buffptr);
 
-        if (log) {
-            add_to_buffer(log, line->string + line->pos, line->length - line->pos);
-        }
-        bytessent =
-            send (fd, line->string + line->pos, line->length - line->pos,
-                  MSG_NOSIGNAL);
+        len = line->length - line->pos;
+        if (len > limit)
+                len = limit;
+        bytessent = send (fd, line->string + line->pos, len, MSG_NOSIGNAL);
 
         if (bytessent >= 0) {
+                if (log && bytessent > 0) {
+                    add_to_buffer(log, line->string + line->pos, bytessent);
+                }
                 /* bytes sent, adjust buffer */
                 line->pos += bytessent;
                 if (line->pos == line->length)
@@ -34,8 +34,13 @@ extern size_t buffer_size (struct buffer_s *buffptr);
 extern int add_to_buffer (struct buffer_s *buffptr, unsigned char *data,
                           size_t length);
 
+/* Bytes read_buffer() reads from the socket at a time */
+#define READ_BUFFER_SIZE (1024 * 2)
+
 extern ssize_t read_buffer (int fd, struct buffer_s *buffptr);
 extern ssize_t write_buffer (int fd, struct buffer_s *buffptr, struct buffer_s *log);
+extern ssize_t write_buffer_limit (int fd, struct buffer_s *buffptr,
+                                   struct buffer_s *log, size_t limit);
 
 char* buffer_get(struct buffer_s *buffptr);
 
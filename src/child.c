@@ -31,6 +31,7 @@
 #include "sock.h"
 #include "utils.h"
 #include "conf.h"
+#include "replay.h"
 
 static int listenfd;
 static socklen_t addrlen;
@@ -58,6 +59,21 @@ static struct child_config_s {
 
 static unsigned int *servers_waiting;   /* servers waiting for a connection */
 
+/*
+ * The parent bumps the shared generation each time it has reloaded the
+ * configuration.  Children are forked with the parent's already parsed
+ * configuration and never reload it themselves; a child whose generation
+ * is out of date exits between requests and is replaced by a fresh one.
+ */
+static unsigned int *config_generation;
+static unsigned int child_generation;
+
+/*
+ * How long an idle child waits for a connection before checking whether
+ * its configuration is still current.
+ */
+#define CHILD_IDLE_CHECK 5
+
 /*
  * Lock/Unlock the "servers_waiting" variable so that two children cannot
  * modify it at the same time.
@@ -163,20 +179,12 @@ short int child_configure (child_config_t type, unsigned int val)
 
 /**
  * child signal handler for sighup
+ *
+ * There is nothing to do here: the signal only interrupts the select()
+ * of an idle child, so that it notices a new configuration generation.
  */
 static void child_sighup_handler (int sig)
 {
-        if (sig == SIGHUP) {
-                /*
-                 * Ignore the return value of reload_config for now.
-                 * This should actually be handled somehow...
-                 */
-                reload_config ();
-
-#ifdef FILTER_ENABLE
-                filter_reload ();
-#endif /* FILTER_ENABLE */
-        }
 }
 
 /*
@@ -187,6 +195,8 @@ static void child_main (struct child_s *ptr)
         int connfd;
         struct sockaddr *cliaddr;
         socklen_t clilen;
+        fd_set rset;
+        struct timeval tv;
 
         cliaddr = (struct sockaddr *) safemalloc (addrlen);
         if (!cliaddr) {
@@ -200,6 +210,27 @@ static void child_main (struct child_s *ptr)
         while (!config.quit) {
                 ptr->status = T_WAITING;
 
+                if (child_generation != *config_generation) {
+                        log_message (LOG_INFO,
+                                     "Configuration was reloaded. "
+                                     "Killing idle child.");
+                        SERVER_DEC ();
+                        break;
+                }
+
+                /*
+                 * The listening socket is non-blocking, so wait for it
+                 * here where a signal or the timeout gets us back to the
+                 * generation check above.
+                 */
+                FD_ZERO (&rset);
+                FD_SET (listenfd, &rset);
+                tv.tv_sec = CHILD_IDLE_CHECK;
+                tv.tv_usec = 0;
+
+                if (select (listenfd + 1, &rset, NULL, NULL, &tv) <= 0)
+                        continue;
+
                 clilen = addrlen;
 
                 connfd = accept (listenfd, cliaddr, &clilen);
@@ -224,12 +255,23 @@ static void child_main (struct child_s *ptr)
                  * Make sure no error occurred...
                  */
                 if (connfd < 0) {
+                        /* another child was quicker */
+                        if (errno == EAGAIN
+#if EWOULDBLOCK != EAGAIN
+                            || errno == EWOULDBLOCK
+#endif
+                            || errno == EINTR || errno == ECONNABORTED)
+                                continue;
+
                         log_message (LOG_ERR,
                                      "Accept returned an error (%s) ... retrying.",
                                      strerror (errno));
                         continue;
                 }
 
+                /* Some systems pass O_NONBLOCK on to accepted sockets. */
+                socket_blocking (connfd);
+
                 ptr->status = T_CONNECTED;
 
                 SERVER_DEC ();
@@ -248,6 +290,13 @@ static void child_main (struct child_s *ptr)
                         }
                 }
 
+                if (child_generation != *config_generation) {
+                        log_message (LOG_INFO,
+                                     "Configuration was reloaded. "
+                                     "Killing child.");
+                        break;
+                }
+
                 SERVER_COUNT_LOCK ();
                 if (*servers_waiting > child_config.maxspareservers) {
                         /*
@@ -283,6 +332,8 @@ static pid_t child_make (struct child_s *ptr)
 {
         pid_t pid;
 
+        child_generation = *config_generation;
+
         if ((pid = fork ()) > 0)
                 return pid;     /* parent */
 
@@ -340,6 +391,16 @@ short int child_pool_create (void)
         }
         *servers_waiting = 0;
 
+        config_generation =
+            (unsigned int *) malloc_shared_memory (sizeof (unsigned int));
+        if (config_generation == MAP_FAILED) {
+                log_message (LOG_ERR,
+                             "Could not allocate memory for the configuration "
+                             "generation.");
+                return -1;
+        }
+        *config_generation = 0;
+
         /*
          * Create a "locking" file for use around the servers_waiting
          * variable.
@@ -384,6 +445,34 @@ short int child_pool_create (void)
         return 0;
 }
 
+/*
+ * Start one more child in an empty slot.
+ */
+static int child_spawn (void)
+{
+        unsigned int i;
+
+        for (i = 0; i != child_config.maxclients; i++) {
+                if (child_ptr[i].status == T_EMPTY) {
+                        child_ptr[i].status = T_WAITING;
+                        child_ptr[i].tid = child_make (&child_ptr[i]);
+                        if (child_ptr[i].tid < 0) {
+                                log_message (LOG_NOTICE,
+                                             "Could not create child");
+
+                                child_ptr[i].status = T_EMPTY;
+                                return -1;
+                        }
+
+                        SERVER_INC ();
+
+                        return 0;
+                }
+        }
+
+        return -1;
+}
+
 /*
  * Keep the proper number of servers running. This is the birth of the
  * servers. It monitors this at least once a second.
@@ -407,24 +496,7 @@ void child_main_loop (void)
 
                         SERVER_COUNT_UNLOCK ();
 
-                        for (i = 0; i != child_config.maxclients; i++) {
-                                if (child_ptr[i].status == T_EMPTY) {
-                                        child_ptr[i].status = T_WAITING;
-                                        child_ptr[i].tid =
-                                            child_make (&child_ptr[i]);
-                                        if (child_ptr[i].tid < 0) {
-                                                log_message (LOG_NOTICE,
-                                                             "Could not create child");
-
-                                                child_ptr[i].status = T_EMPTY;
-                                                break;
-                                        }
-
-                                        SERVER_INC ();
-
-                                        break;
-                                }
-                        }
+                        child_spawn ();
                 } else {
                         SERVER_COUNT_UNLOCK ();
                 }
@@ -433,20 +505,40 @@ void child_main_loop (void)
 
                 /* Handle log rotation if it was requested */
                 if (received_sighup) {
-                        /*
-                         * Ignore the return value of reload_config for now.
-                         * This should actually be handled somehow...
-                         */
-                        reload_config ();
+                        received_sighup = FALSE;
+
+                        if (reload_config ()) {
+                                log_message (LOG_ERR,
+                                             "Could not reload the configuration.");
+                                continue;
+                        }
 
 #ifdef FILTER_ENABLE
                         filter_reload ();
 #endif /* FILTER_ENABLE */
+                        reload_url_config ();
+                        if (replay_init ())
+                                log_message (LOG_WARNING,
+                                             "Could not read the ReplayFile.");
 
-                        /* propagate filter reload to all children */
-                        child_kill_children (SIGHUP);
+                        /*
+                         * Retire the children running the old
+                         * configuration and start a new set forked from
+                         * this one, instead of having every child parse
+                         * the files again.  The signal only wakes the
+                         * idle children up; busy ones finish their
+                         * request first.
+                         */
+                        ++(*config_generation);
+                        for (i = 0; i != child_config.maxclients; i++) {
+                                if (child_ptr[i].status == T_WAITING)
+                                        kill (child_ptr[i].tid, SIGHUP);
+                        }
 
-                        received_sighup = FALSE;
+                        for (i = 0; i != child_config.startservers; i++) {
+                                if (child_spawn () < 0)
+                                        break;
+                        }
                 }
         }
 }
@@ -467,6 +559,14 @@ void child_kill_children (int sig)
 int child_listening_sock (uint16_t port)
 {
         listenfd = listen_sock (port, &addrlen);
+
+        /*
+         * Idle children wait in select() and then race for the
+         * connection; the losers must not block in accept().
+         */
+        if (listenfd >= 0)
+                socket_nonblocking (listenfd);
+
         return listenfd;
 }
 
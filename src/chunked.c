@@ -0,0 +1,294 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Reads and writes the chunked transfer coding of HTTP/1.1 bodies.
+ *
+ * The decoder is a state machine fed with whatever was read from the
+ * socket, so a chunk size line or the CRLF after a chunk may be split
+ * across reads and nothing is buffered but the trailer fields.  It runs
+ * in one of two ways:
+ *
+ *   - chunked_scan() only follows the framing, to find where a body
+ *     that is relayed as it is ends;
+ *   - chunked_decode() also strips the framing, moving the chunk data
+ *     to the front of the bytes it was given.  The data never grows, so
+ *     this is done in place in the read buffer.
+ *
+ * Both return how many bytes belong to the body, which is fewer than
+ * were given once the last chunk and the trailers have been read.  When
+ * decoding, the trailer fields are kept in "trailers", each ending in
+ * CRLF, so they can be sent on after a rewritten body; a scanned body is
+ * relayed with its trailers, so they are only followed, whatever their
+ * size.
+ *
+ * The encoder side is just chunked_frame(), which writes the size line
+ * to go before a chunk of data.
+ */
+
+#include "main.h"
+
+#include "chunked.h"
+#include "heap.h"
+#include "log.h"
+
+#define CHUNKED_MAX_TRAILERS    8192    /* bytes of trailer fields kept */
+
+enum chunked_state {
+        CHUNKED_SIZE,           /* the hex digits of the chunk size */
+        CHUNKED_EXTENSION,      /* the rest of the size line */
+        CHUNKED_DATA,
+        CHUNKED_DATA_END,       /* the CRLF after the chunk data */
+        CHUNKED_TRAILER_START,  /* a trailer field or the final CRLF */
+        CHUNKED_TRAILER,        /* the rest of a trailer field */
+        CHUNKED_DONE,
+        CHUNKED_ERROR
+};
+
+/*
+ * Whether a message with "headers" has a chunked body: chunked has to
+ * be the last transfer coding applied.
+ */
+int chunked_wanted (hashmap_t headers)
+{
+        char *coding, *last;
+        size_t len;
+
+        if (hashmap_entry_by_key (headers, "transfer-encoding",
+                                  (void **) &coding) <= 0)
+                return 0;
+
+        last = strrchr (coding, ',');
+        last = last ? last + 1 : coding;
+        while (*last == ' ' || *last == '\t')
+                last++;
+        len = strcspn (last, " \t;");
+        return len == 7 && strncasecmp (last, "chunked", 7) == 0;
+}
+
+struct chunked *chunked_new (void)
+{
+        return (struct chunked *) safecalloc (1, sizeof (struct chunked));
+}
+
+static int hex_digit (char c)
+{
+        if (c >= '0' && c <= '9')
+                return c - '0';
+        if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+        return -1;
+}
+
+static int add_trailer (struct chunked *chunked, const char *data,
+                        size_t len)
+{
+        char *trailers;
+
+        if (chunked->trailers_len + len + 2 > CHUNKED_MAX_TRAILERS) {
+                log_message (LOG_WARNING,
+                             "Chunked body has more than %d bytes of "
+                             "trailers", CHUNKED_MAX_TRAILERS);
+                return -1;
+        }
+
+        trailers = (char *) saferealloc (chunked->trailers,
+                                         chunked->trailers_len + len + 2);
+        if (!trailers)
+                return -1;
+        memcpy (trailers + chunked->trailers_len, data, len);
+        chunked->trailers = trailers;
+        chunked->trailers_len += len;
+        return 0;
+}
+
+/* The end of the size line, or of the CRLF after a chunk */
+static void end_size_line (struct chunked *chunked)
+{
+        chunked->state = chunked->left > 0
+                ? CHUNKED_DATA : CHUNKED_TRAILER_START;
+        chunked->digits = 0;
+}
+
+/*
+ * Follow the framing through "len" bytes of "data".  If "out" is not
+ * NULL the chunk data is copied there, which may be "data" itself, and
+ * its length is stored in "out_len".
+ */
+static ssize_t chunked_run (struct chunked *chunked, const char *data,
+                            size_t len, char *out, size_t *out_len)
+{
+        const char *eol;
+        size_t i = 0, n, o = 0;
+        int digit;
+
+        while (i < len && chunked->state != CHUNKED_DONE) {
+                char c = data[i];
+
+                switch (chunked->state) {
+                case CHUNKED_SIZE:
+                        digit = hex_digit (c);
+                        if (digit >= 0) {
+                                if (chunked->left > (~0UL >> 4))
+                                        goto error;
+                                chunked->left = chunked->left * 16 + digit;
+                                chunked->digits++;
+                                i++;
+                                break;
+                        }
+                        if (chunked->digits == 0)
+                                goto error;
+                        if (c == '\n')
+                                end_size_line (chunked);
+                        else if (c == ';' || c == ' ' || c == '\t'
+                                 || c == '\r')
+                                chunked->state = CHUNKED_EXTENSION;
+                        else
+                                goto error;
+                        i++;
+                        break;
+
+                case CHUNKED_EXTENSION:
+                        eol = (const char *) memchr (data + i, '\n', len - i);
+                        if (!eol) {
+                                i = len;
+                                break;
+                        }
+                        end_size_line (chunked);
+                        i = eol - data + 1;
+                        break;
+
+                case CHUNKED_DATA:
+                        n = len - i;
+                        if (n > chunked->left)
+                                n = chunked->left;
+                        if (out)
+                                memmove (out + o, data + i, n);
+                        o += n;
+                        i += n;
+                        chunked->left -= n;
+                        if (chunked->left == 0)
+                                chunked->state = CHUNKED_DATA_END;
+                        break;
+
+                case CHUNKED_DATA_END:
+                        if (c == '\n')
+                                chunked->state = CHUNKED_SIZE;
+                        else if (c != '\r')
+                                goto error;
+                        i++;
+                        break;
+
+                case CHUNKED_TRAILER_START:
+                        i++;
+                        if (c == '\n')
+                                chunked->state = CHUNKED_DONE;
+                        else if (c != '\r') {
+                                if (out && add_trailer (chunked, &c, 1) < 0)
+                                        goto error;
+                                chunked->state = CHUNKED_TRAILER;
+                        }
+                        break;
+
+                case CHUNKED_TRAILER:
+                        eol = (const char *) memchr (data + i, '\n', len - i);
+                        n = (eol ? (size_t) (eol - data) : len) - i;
+                        if (out && add_trailer (chunked, data + i, n) < 0)
+                                goto error;
+                        i += n;
+                        if (!eol)
+                                break;
+                        if (!out) {
+                                chunked->state = CHUNKED_TRAILER_START;
+                                i++;
+                                break;
+                        }
+
+                        /* a field ends in CRLF, however it came */
+                        while (chunked->trailers_len > 0
+                               && chunked->trailers[chunked->trailers_len - 1]
+                               == '\r')
+                                chunked->trailers_len--;
+                        memcpy (chunked->trailers + chunked->trailers_len,
+                                "\r\n", 2);
+                        chunked->trailers_len += 2;
+                        chunked->state = CHUNKED_TRAILER_START;
+                        i++;
+                        break;
+
+                default:
+                        goto error;
+                }
+        }
+
+        if (out_len)
+                *out_len = o;
+        return (ssize_t) i;
+
+error:
+        if (chunked->state != CHUNKED_ERROR)
+                log_message (LOG_ERR, "Malformed chunked body");
+        chunked->state = CHUNKED_ERROR;
+        return -1;
+}
+
+/*
+ * Follow the framing of "len" bytes of a chunked body.  Returns how
+ * many of them belong to the body, or -1 if the framing is broken.
+ */
+ssize_t chunked_scan (struct chunked *chunked, const char *data, size_t len)
+{
+        return chunked_run (chunked, data, len, NULL, NULL);
+}
+
+/*
+ * Like chunked_scan(), but the framing is also taken out: the chunk
+ * data is moved to the start of "data" and its length stored in
+ * "out_len".
+ */
+ssize_t chunked_decode (struct chunked *chunked, char *data, size_t len,
+                        size_t *out_len)
+{
+        return chunked_run (chunked, data, len, data, out_len);
+}
+
+/* Whether the last chunk and the trailers have been read */
+int chunked_done (const struct chunked *chunked)
+{
+        return chunked->state == CHUNKED_DONE;
+}
+
+void chunked_free (struct chunked *chunked)
+{
+        if (!chunked)
+                return;
+        safefree (chunked->trailers);
+        safefree (chunked);
+}
+
+/*
+ * Write the size line for a chunk of "len" bytes to "frame", which has
+ * room for CHUNKED_FRAME_SIZE bytes, and return its length.  The data
+ * goes after it, followed by CRLF; the last chunk has a length of 0 and
+ * is followed by the trailers, if any, and CRLF.
+ */
+size_t chunked_frame (char *frame, size_t len)
+{
+        snprintf (frame, CHUNKED_FRAME_SIZE, "%lx\r\n", (unsigned long) len);
+        return strlen (frame);
+}
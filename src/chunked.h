@@ -0,0 +1,49 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'chunked.c' for detailed information. */
+
+#ifndef _TINYPROXY_CHUNKED_H_
+#define _TINYPROXY_CHUNKED_H_
+
+#include "common.h"
+#include "hashmap.h"
+
+/* Room for the framing of one chunk, "<hex size>\r\n" */
+#define CHUNKED_FRAME_SIZE      24
+
+/* The state of one chunked body being read */
+struct chunked {
+        int state;
+        unsigned long left;     /* bytes of chunk data still to come */
+        int digits;             /* of the chunk size read so far */
+        char *trailers;         /* trailer fields when decoding, or NULL */
+        size_t trailers_len;
+};
+
+extern int chunked_wanted (hashmap_t headers);
+extern struct chunked *chunked_new (void);
+extern ssize_t chunked_scan (struct chunked *chunked, const char *data,
+                             size_t len);
+extern ssize_t chunked_decode (struct chunked *chunked, char *data,
+                               size_t len, size_t *out_len);
+extern int chunked_done (const struct chunked *chunked);
+extern void chunked_free (struct chunked *chunked);
+
+extern size_t chunked_frame (char *frame, size_t len);
+
+#endif /* _TINYPROXY_CHUNKED_H_ */
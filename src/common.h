@@ -161,6 +161,18 @@
 #ifdef HAVE_SYS_MMAN_H
 #  include      <sys/mman.h>
 #endif
+#ifdef HAVE_SYS_SENDFILE_H
+#  include      <sys/sendfile.h>
+#endif
+#ifdef HAVE_SYS_SYSCALL_H
+#  include      <sys/syscall.h>
+#endif
+#ifdef HAVE_LINUX_FUTEX_H
+#  include      <linux/futex.h>
+#endif
+#ifdef HAVE_LIMITS_H
+#  include      <limits.h>
+#endif
 
 /*
  * If MSG_NOSIGNAL is not defined, define it to be zero so that it doesn't
@@ -0,0 +1,102 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Checks that the keyword table picks the same configuration directive
+ * for each line of the given files as trying every regex in table order
+ * does.  Lines are only matched, never handled, so any text will do.
+ *
+ *   conf-dispatch tests/config-corpus/directives.conf
+ *
+ * prints the lines the two disagree on and exits with 1 if there are
+ * any.
+ */
+
+#include "main.h"
+
+#include "conf.h"
+
+/* main.c isn't linked in */
+struct config_s config;
+unsigned int received_sighup = FALSE;
+
+int reload_config (void)
+{
+        return 0;
+}
+
+static int check_file (const char *path, unsigned long *lines,
+                       unsigned long *matched)
+{
+        char buffer[1024];
+        unsigned long lineno = 0;
+        int failed = 0, linear, dispatched;
+        FILE *f;
+
+        f = fopen (path, "r");
+        if (!f) {
+                fprintf (stderr, "conf-dispatch: can't open %s: %s\n",
+                         path, strerror (errno));
+                return -1;
+        }
+
+        while (fgets (buffer, sizeof (buffer), f)) {
+                ++lineno;
+                linear = config_directive (buffer, 1);
+                dispatched = config_directive (buffer, 0);
+                if (linear >= 0)
+                        ++*matched;
+                if (linear != dispatched) {
+                        printf ("%s:%lu: linear %d, dispatch %d: %s",
+                                path, lineno, linear, dispatched, buffer);
+                        failed = 1;
+                }
+        }
+        *lines += lineno;
+
+        fclose (f);
+        return failed;
+}
+
+int main (int argc, char **argv)
+{
+        unsigned long lines = 0, matched = 0;
+        int i, failed = 0;
+
+        if (argc < 2) {
+                fprintf (stderr, "Usage: conf-dispatch <file>...\n");
+                return 2;
+        }
+
+        if (config_compile_regex ()) {
+                fprintf (stderr, "conf-dispatch: can't compile the "
+                         "directive regexes\n");
+                return 2;
+        }
+
+        for (i = 1; i < argc; i++) {
+                switch (check_file (argv[i], &lines, &matched)) {
+                case -1:
+                        return 2;
+                case 1:
+                        failed = 1;
+                }
+        }
+
+        printf ("%lu lines, %lu matching a directive: %s\n", lines, matched,
+                failed ? "MISMATCH" : "same directive for every line");
+        return failed;
+}
@@ -31,6 +31,10 @@
 #include "filter.h"
 #include "heap.h"
 #include "html-error.h"
+#include "http-cache.h"
+#include "instrument.h"
+#include "rewrite.h"
+#include "shape.h"
 #include "log.h"
 #include "reqs.h"
 #include "reverse-proxy.h"
@@ -48,6 +52,7 @@
  */
 #define WS "[[:space:]]+"
 #define STR "\"([^\"]+)\""
+#define ESTR "\"([^\"]*)\""
 #define BOOL "(yes|on|no|off)"
 #define INT "((0x)?[[:digit:]]+)"
 #define ALNUM "([-a-z0-9._]+)"
@@ -132,6 +137,33 @@ static HANDLE_FUNC (handle_filterextended);
 static HANDLE_FUNC (handle_filterurls);
 #endif
 static HANDLE_FUNC (handle_group);
+static HANDLE_FUNC (handle_instrumentcontenttype);
+static HANDLE_FUNC (handle_instrumenturl);
+static HANDLE_FUNC (handle_instrumentmode);
+static HANDLE_FUNC (handle_instrumentsourcemap);
+static HANDLE_FUNC (handle_instrumentmaxsize);
+static HANDLE_FUNC (handle_instrumentcachesize);
+static HANDLE_FUNC (handle_instrumentcachedir);
+static HANDLE_FUNC (handle_cachesize);
+static HANDLE_FUNC (handle_cachemaxobjectsize);
+static HANDLE_FUNC (handle_cachedir);
+static HANDLE_FUNC (handle_cachedirsize);
+static HANDLE_FUNC (handle_instrumentfunction);
+static HANDLE_FUNC (handle_instrumentskipfunction);
+static HANDLE_FUNC (handle_instrumentminbodysize);
+static HANDLE_FUNC (handle_instrumentsample);
+static HANDLE_FUNC (handle_instrumenthotthreshold);
+static HANDLE_FUNC (handle_replayfile);
+static HANDLE_FUNC (handle_replaymatchheader);
+static HANDLE_FUNC (handle_replaytiming);
+static HANDLE_FUNC (handle_shapeprofile);
+static HANDLE_FUNC (handle_shapeclient);
+static HANDLE_FUNC (handle_shapeurl);
+static HANDLE_FUNC (handle_rewritereplace);
+static HANDLE_FUNC (handle_rewriteregex);
+static HANDLE_FUNC (handle_rewriteinjecthead);
+static HANDLE_FUNC (handle_rewritelookahead);
+static HANDLE_FUNC (handle_rewritecompresslevel);
 static HANDLE_FUNC (handle_listen);
 static HANDLE_FUNC (handle_logfile);
 static HANDLE_FUNC (handle_loglevel);
@@ -161,6 +193,11 @@ static HANDLE_FUNC (handle_xtinyproxy);
 #ifdef UPSTREAM_SUPPORT
 static HANDLE_FUNC (handle_upstream);
 static HANDLE_FUNC (handle_upstream_no);
+static HANDLE_FUNC (handle_upstream_group_rule);
+static HANDLE_FUNC (handle_upstreamgroup);
+static HANDLE_FUNC (handle_upstreambalance);
+static HANDLE_FUNC (handle_upstreammaxfails);
+static HANDLE_FUNC (handle_upstreamfailtimeout);
 #endif
 
 static void config_free_regex (void);
@@ -232,6 +269,46 @@ struct {
         /* other */
         STDCONF ("errorfile", INT WS STR, handle_errorfile),
         STDCONF ("addheader",  STR WS STR, handle_addheader),
+        /* JavaScript instrumentation */
+        STDCONF ("instrumentcontenttype", STR, handle_instrumentcontenttype),
+        STDCONF ("instrumenturl", STR, handle_instrumenturl),
+        STDCONF ("instrumentmode", "(log|timing)", handle_instrumentmode),
+        STDCONF ("instrumentsourcemap", BOOL, handle_instrumentsourcemap),
+        STDCONF ("instrumentmaxsize", INT, handle_instrumentmaxsize),
+        STDCONF ("instrumentcachesize", INT, handle_instrumentcachesize),
+        STDCONF ("instrumentcachedir", STR, handle_instrumentcachedir),
+        STDCONF ("cachesize", INT, handle_cachesize),
+        STDCONF ("cachemaxobjectsize", INT, handle_cachemaxobjectsize),
+        STDCONF ("cachedir", STR, handle_cachedir),
+        STDCONF ("cachedirsize", INT, handle_cachedirsize),
+        STDCONF ("instrumentfunction", STR, handle_instrumentfunction),
+        STDCONF ("instrumentskipfunction", STR,
+                 handle_instrumentskipfunction),
+        STDCONF ("instrumentminbodysize", INT, handle_instrumentminbodysize),
+        STDCONF ("instrumentsample", STR WS INT, handle_instrumentsample),
+        STDCONF ("instrumenthotthreshold", INT,
+                 handle_instrumenthotthreshold),
+
+        /* Response body rewriting */
+        STDCONF ("rewritereplace", STR WS STR WS ESTR,
+                 handle_rewritereplace),
+        STDCONF ("rewriteregex", STR WS STR WS ESTR, handle_rewriteregex),
+        STDCONF ("rewriteinjecthead", STR WS STR, handle_rewriteinjecthead),
+        STDCONF ("rewritelookahead", INT, handle_rewritelookahead),
+        STDCONF ("rewritecompresslevel", INT,
+                 handle_rewritecompresslevel),
+
+        /* Network emulation */
+        STDCONF ("shapeprofile", ALNUM WS INT WS INT WS INT WS INT,
+                 handle_shapeprofile),
+        STDCONF ("shapeclient", ALNUM WS "(" "(" IPMASK "|" IPV6MASK ")"
+                 "|" ALNUM ")", handle_shapeclient),
+        STDCONF ("shapeurl", ALNUM WS STR, handle_shapeurl),
+
+        /* Replaying recorded traffic */
+        STDCONF ("replayfile", STR, handle_replayfile),
+        STDCONF ("replaymatchheader", STR, handle_replaymatchheader),
+        STDCONF ("replaytiming", BOOL, handle_replaytiming),
 
 #ifdef FILTER_ENABLE
         /* filtering */
@@ -257,6 +334,16 @@ struct {
                 BEGIN "(upstream)" WS "(" IP "|" ALNUM ")" ":" INT "(" WS STR
                       ")?" END, handle_upstream, NULL
         },
+        {
+                BEGIN "(upstream)" WS "@" ALNUM "(" WS STR ")?" END,
+                handle_upstream_group_rule, NULL
+        },
+        STDCONF ("upstreamgroup", ALNUM WS "(" IP "|" ALNUM ")" ":" INT,
+                 handle_upstreamgroup),
+        STDCONF ("upstreambalance", ALNUM WS "(leastconn|hash)",
+                 handle_upstreambalance),
+        STDCONF ("upstreammaxfails", INT, handle_upstreammaxfails),
+        STDCONF ("upstreamfailtimeout", INT, handle_upstreamfailtimeout),
 #endif
         /* loglevel */
         STDCONF ("loglevel", "(critical|error|warning|notice|connect|info)",
@@ -265,6 +352,32 @@ struct {
 
 const unsigned int ndirectives = sizeof (directives) / sizeof (directives[0]);
 
+/*
+ * Rather than trying every directive's regex on each line, the first word
+ * of the line is looked up in a hash table built by config_compile_regex()
+ * and only the regexes of the directives starting with that word are
+ * tried, in table order.  The seed is chosen so that no two keywords share
+ * a slot, which makes a lookup one hash and one string compare.
+ *
+ * Directives whose regex does not start with a keyword (comments and
+ * blank lines) are tried for lines that do not start with a letter.
+ */
+#define DISPATCH_SLOTS 512
+#define DISPATCH_NONE ((unsigned int) -1)
+
+struct dispatch_slot {
+        const char *keyword;    /* points into the directive's regex */
+        size_t keyword_len;
+        unsigned int first;     /* index of the first directive */
+};
+
+static struct dispatch_slot dispatch[DISPATCH_SLOTS];
+static unsigned int dispatch_seed;
+static unsigned int dispatch_other = DISPATCH_NONE;
+
+/* next directive with the same keyword, in table order */
+static unsigned int dispatch_next[sizeof (directives) / sizeof (directives[0])];
+
 static void
 free_added_headers (vector_t add_headers)
 {
@@ -293,11 +406,14 @@ static void free_config (struct config_s *conf)
         safefree (conf->filter);
 #endif                          /* FILTER_ENABLE */
 #ifdef REVERSE_SUPPORT
+        reversepath_index_free (conf->reversepath_index);
         free_reversepath_list(conf->reversepath_list);
         safefree (conf->reversebaseurl);
 #endif
 #ifdef UPSTREAM_SUPPORT
+        upstream_index_free (conf->upstream_index);
         free_upstream_list (conf->upstream_list);
+        free_upstream_groups (conf->upstream_groups);
 #endif                          /* UPSTREAM_SUPPORT */
         safefree (conf->pidpath);
         safefree (conf->bind_address);
@@ -309,10 +425,106 @@ static void free_config (struct config_s *conf)
         flush_access_list (conf->access_list);
         free_connect_ports_list (conf->connect_ports);
         hashmap_delete (conf->anonymous_map);
+        instrument_free_patterns (conf->instrument_types);
+        instrument_free_patterns (conf->instrument_urls);
+        instrument_free_patterns (conf->instrument_functions);
+        instrument_free_patterns (conf->instrument_skip_functions);
+        instrument_free_patterns (conf->instrument_samples);
+        rewrite_free_rules (conf->rewrite_rules);
+        shape_free_profiles (conf->shape_profiles);
+        shape_free_rules (conf->shape_rules);
+        safefree (conf->replay_file);
+        vector_delete (conf->replay_headers);
+        safefree (conf->instrument_cache_dir);
+        safefree (conf->http_cache_dir);
 
         memset (conf, 0, sizeof(*conf));
 }
 
+static unsigned int dispatch_hash (const char *keyword, size_t len,
+                                   unsigned int seed)
+{
+        unsigned int hash = 2166136261U ^ seed;
+
+        while (len--)
+                hash = (hash ^ (unsigned char) tolower (*keyword++))
+                        * 16777619U;
+
+        return hash ^ (hash >> 15);
+}
+
+/*
+ * Find the keyword a directive's regex starts with, as in
+ * BEGIN "(keyword" ...  Returns its length, or 0 if there is none.
+ */
+static size_t directive_keyword (const char *re, const char **keyword)
+{
+        const char *p;
+
+        if (strncmp (re, BEGIN "(", strlen (BEGIN "(")) != 0)
+                return 0;
+
+        *keyword = re + strlen (BEGIN "(");
+        for (p = *keyword; isalpha ((unsigned char) *p); ++p) ;
+
+        return p - *keyword;
+}
+
+/*
+ * Try seeds until the keywords all land in different slots.
+ */
+static int build_dispatch (void)
+{
+        unsigned int i, j, seed, slot, other_last = 0;
+        const char *keyword;
+        size_t len;
+
+        for (seed = 0; seed != 10000; ++seed) {
+                memset (dispatch, 0, sizeof (dispatch));
+                dispatch_other = DISPATCH_NONE;
+
+                for (i = 0; i != ndirectives; ++i) {
+                        dispatch_next[i] = DISPATCH_NONE;
+
+                        len = directive_keyword (directives[i].re, &keyword);
+                        if (len == 0) {
+                                if (dispatch_other == DISPATCH_NONE)
+                                        dispatch_other = i;
+                                else
+                                        dispatch_next[other_last] = i;
+                                other_last = i;
+                                continue;
+                        }
+
+                        slot = dispatch_hash (keyword, len, seed)
+                                % DISPATCH_SLOTS;
+
+                        if (!dispatch[slot].keyword) {
+                                dispatch[slot].keyword = keyword;
+                                dispatch[slot].keyword_len = len;
+                                dispatch[slot].first = i;
+                        } else if (dispatch[slot].keyword_len == len
+                                   && strncasecmp (dispatch[slot].keyword,
+                                                   keyword, len) == 0) {
+                                /* same keyword: append to its chain */
+                                for (j = dispatch[slot].first;
+                                     dispatch_next[j] != DISPATCH_NONE;
+                                     j = dispatch_next[j]) ;
+                                dispatch_next[j] = i;
+                        } else {
+                                break;  /* collision, try the next seed */
+                        }
+                }
+
+                if (i == ndirectives) {
+                        dispatch_seed = seed;
+                        return 0;
+                }
+        }
+
+        return -1;
+}
+
 /*
  * Compiles the regular expressions used by the configuration file.  This
  * routine MUST be called before trying to parse the configuration file.
@@ -341,6 +553,12 @@ config_compile_regex (void)
 
         atexit (config_free_regex);
 
+        if (build_dispatch ()) {
+                fprintf (stderr, "%s: Could not build the configuration "
+                         "directive table.\n", PACKAGE);
+                return -1;
+        }
+
         return 0;
 }
 
@@ -363,30 +581,85 @@ config_free_regex (void)
 }
 
 /*
- * Attempt to match the supplied line with any of the configuration
- * regexes defined above.  If a match is found, call the handler
- * function to process the directive.
- *
- * Returns 0 if a match was found and successfully processed; otherwise,
- * a negative number is returned.
+ * Find the directive whose regex matches the supplied line, among those
+ * its first word names, filling in "match".  Returns the index of the
+ * directive, or -1 if there is none.
  */
-static int check_match (struct config_s *conf, const char *line)
+static int find_directive (const char *line, regmatch_t *match)
 {
-        regmatch_t match[RE_MAX_MATCHES];
-        unsigned int i;
+        const char *keyword, *p;
+        unsigned int i, slot;
+        size_t len;
 
         assert (ndirectives > 0);
 
-        for (i = 0; i != ndirectives; ++i) {
+        for (keyword = line; isspace ((unsigned char) *keyword); ++keyword) ;
+        for (p = keyword; isalpha ((unsigned char) *p); ++p) ;
+        len = p - keyword;
+
+        if (len == 0) {
+                i = dispatch_other;
+        } else {
+                slot = dispatch_hash (keyword, len, dispatch_seed)
+                        % DISPATCH_SLOTS;
+                if (dispatch[slot].keyword_len != len
+                    || strncasecmp (dispatch[slot].keyword, keyword, len))
+                        return -1;
+                i = dispatch[slot].first;
+        }
+
+        for (; i != DISPATCH_NONE; i = dispatch_next[i]) {
                 assert (directives[i].cre);
                 if (!regexec
                     (directives[i].cre, line, RE_MAX_MATCHES, match, 0))
-                        return (*directives[i].handler) (conf, line, match);
+                        return (int) i;
         }
 
         return -1;
 }
 
+/*
+ * The directive the supplied line selects, found through the keyword
+ * table as when the configuration is read, or by trying every regex in
+ * table order with "linear" set.  The two have to agree; the
+ * conf-dispatch program compares them over tests/config-corpus.
+ * Returns the index of the directive, or -1 if there is none.
+ */
+int config_directive (const char *line, int linear)
+{
+        regmatch_t match[RE_MAX_MATCHES];
+        unsigned int i;
+
+        if (!linear)
+                return find_directive (line, match);
+
+        for (i = 0; i != ndirectives; ++i) {
+                if (!regexec
+                    (directives[i].cre, line, RE_MAX_MATCHES, match, 0))
+                        return (int) i;
+        }
+        return -1;
+}
+
+/*
+ * Attempt to match the supplied line with the configuration regexes of
+ * the directives its first word names.  If a match is found, call the
+ * handler function to process the directive.
+ *
+ * Returns 0 if a match was found and successfully processed; otherwise,
+ * a negative number is returned.
+ */
+static int check_match (struct config_s *conf, const char *line)
+{
+        regmatch_t match[RE_MAX_MATCHES];
+        int i;
+
+        i = find_directive (line, match);
+        if (i < 0)
+                return -1;
+        return (*directives[i].handler) (conf, line, match);
+}
+
 /*
  * Parse the previously opened configuration stream.
  */
@@ -485,6 +758,7 @@ static void initialize_with_defaults (struct config_s *conf,
 
 #ifdef REVERSE_SUPPORT
         /* struct reversepath *reversepath_list; */
+        /* struct reversepath_index *reversepath_index; */
         conf->reverseonly = defaults->reverseonly;
         conf->reversemagic = defaults->reversemagic;
 
@@ -495,6 +769,10 @@ static void initialize_with_defaults (struct config_s *conf,
 
 #ifdef UPSTREAM_SUPPORT
         /* struct upstream *upstream_list; */
+        /* struct upstream_index *upstream_index; */
+        /* struct upstream_group *upstream_groups; */
+        conf->upstream_max_fails = defaults->upstream_max_fails;
+        conf->upstream_fail_timeout = defaults->upstream_fail_timeout;
 #endif                          /* UPSTREAM_SUPPORT */
 
         if (defaults->pidpath) {
@@ -526,20 +804,54 @@ static void initialize_with_defaults (struct config_s *conf,
         /* vector_t access_list; */
         /* vector_t connect_ports; */
         /* hashmap_t anonymous_map; */
+        /* vector_t instrument_types; */
+        /* vector_t instrument_urls; */
+        /* vector_t instrument_functions; */
+        /* vector_t instrument_skip_functions; */
+        /* vector_t instrument_samples; */
+        conf->instrument_min_body = defaults->instrument_min_body;
+        conf->instrument_hot_threshold = defaults->instrument_hot_threshold;
+
+        /* vector_t rewrite_rules; */
+        conf->rewrite_lookahead = defaults->rewrite_lookahead;
+        conf->rewrite_compress_level = defaults->rewrite_compress_level;
+        conf->instrument_mode = defaults->instrument_mode;
+        conf->instrument_source_map = defaults->instrument_source_map;
+        conf->instrument_maxsize = defaults->instrument_maxsize;
+        conf->instrument_cache_size = defaults->instrument_cache_size;
+
+        if (defaults->instrument_cache_dir) {
+                conf->instrument_cache_dir =
+                        safestrdup (defaults->instrument_cache_dir);
+        }
+
+        conf->http_cache_size = defaults->http_cache_size;
+        conf->http_cache_max_object = defaults->http_cache_max_object;
+        if (defaults->http_cache_dir) {
+                conf->http_cache_dir = safestrdup (defaults->http_cache_dir);
+        }
+        conf->http_cache_dir_size = defaults->http_cache_dir_size;
+
+        /* vector_t shape_profiles; */
+        /* vector_t shape_rules; */
+
+        if (defaults->replay_file)
+                conf->replay_file = safestrdup (defaults->replay_file);
+        /* vector_t replay_headers; */
+        conf->replay_timing = defaults->replay_timing;
 }
 
 /**
  * Load the configuration.
  */
-int reload_config_file (const char *config_fname, struct config_s *conf,
+/*
+ * Read the configuration file into "conf", which is empty.
+ */
+static int load_config (const char *config_fname, struct config_s *conf,
                         struct config_s *defaults)
 {
         int ret;
 
-        log_message (LOG_INFO, "Reloading config file");
-
-        free_config (conf);
-
         initialize_with_defaults (conf, defaults);
 
         ret = load_config_file (config_fname, conf);
@@ -547,6 +859,60 @@ int reload_config_file (const char *config_fname, struct config_s *conf,
                 goto done;
         }
 
+#ifdef REVERSE_SUPPORT
+        if (conf->reversepath_list) {
+                conf->reversepath_index =
+                        reversepath_index_build (conf->reversepath_list);
+                if (!conf->reversepath_index) {
+                        ret = -1;
+                        goto done;
+                }
+        }
+#endif
+
+#ifdef UPSTREAM_SUPPORT
+        /*
+         * Compile the upstream rules only once the whole file has been
+         * read, so requests never see a partially built index.
+         */
+        if (conf->upstream_list) {
+                conf->upstream_index =
+                        upstream_index_build (conf->upstream_list);
+                if (!conf->upstream_index) {
+                        ret = -1;
+                        goto done;
+                }
+        }
+
+        {
+                struct upstream_group *group;
+
+                for (group = conf->upstream_groups; group;
+                     group = group->next) {
+                        if (group->nmembers == 0)
+                                log_message (LOG_WARNING,
+                                             "Upstream group \"%s\" has no "
+                                             "members", group->name);
+                }
+        }
+
+        if (conf->upstream_max_fails == 0)
+                conf->upstream_max_fails = UPSTREAM_MAX_FAILS;
+        if (conf->upstream_fail_timeout == 0)
+                conf->upstream_fail_timeout = UPSTREAM_FAIL_TIMEOUT;
+#endif
+
+        if (conf->instrument_maxsize == 0)
+                conf->instrument_maxsize = INSTRUMENT_MAX_SIZE;
+        if (conf->rewrite_lookahead == 0)
+                conf->rewrite_lookahead = REWRITE_LOOKAHEAD;
+        if (conf->instrument_cache_size == 0)
+                conf->instrument_cache_size = INSTRUMENT_CACHE_SIZE;
+        if (conf->http_cache_max_object == 0)
+                conf->http_cache_max_object = HTTP_CACHE_MAX_OBJECT;
+        if (conf->http_cache_dir_size == 0)
+                conf->http_cache_dir_size = HTTP_CACHE_DIR_SIZE;
+
         /* Set the default values if they were not set in the config file. */
         if (conf->port == 0) {
                 /*
@@ -576,6 +942,28 @@ done:
         return ret;
 }
 
+/*
+ * Read the configuration file and replace "conf" with it.  If it can't
+ * be read "conf" is left as it was.
+ */
+int reload_config_file (const char *config_fname, struct config_s *conf,
+                        struct config_s *defaults)
+{
+        struct config_s new_conf;
+
+        log_message (LOG_INFO, "Reloading config file");
+
+        memset (&new_conf, 0, sizeof (new_conf));
+        if (load_config (config_fname, &new_conf, defaults) != 0) {
+                free_config (&new_conf);
+                return -1;
+        }
+
+        free_config (conf);
+        *conf = new_conf;
+        return 0;
+}
+
 /***********************************************************************
  *
  * The following are basic data extraction building blocks that can
@@ -907,6 +1295,285 @@ static HANDLE_FUNC (handle_errorfile)
         return 0;
 }
 
+static HANDLE_FUNC (handle_instrumentcontenttype)
+{
+        char *arg = get_string_arg (line, &match[2]);
+        int ret;
+
+        if (!arg)
+                return -1;
+
+        ret = instrument_add_pattern (&conf->instrument_types, arg);
+        safefree (arg);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_instrumenturl)
+{
+        char *arg = get_string_arg (line, &match[2]);
+        int ret;
+
+        if (!arg)
+                return -1;
+
+        ret = instrument_add_pattern (&conf->instrument_urls, arg);
+        safefree (arg);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_instrumentmode)
+{
+        char *arg = get_string_arg (line, &match[2]);
+
+        if (!arg)
+                return -1;
+
+        if (strcasecmp (arg, "timing") == 0)
+                conf->instrument_mode = INSTRUMENT_MODE_TIMING;
+        else
+                conf->instrument_mode = INSTRUMENT_MODE_LOG;
+        safefree (arg);
+
+        return 0;
+}
+
+static HANDLE_FUNC (handle_instrumentsourcemap)
+{
+        return set_bool_arg (&conf->instrument_source_map, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_instrumentmaxsize)
+{
+        return set_int_arg (&conf->instrument_maxsize, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_instrumentcachesize)
+{
+        return set_int_arg (&conf->instrument_cache_size, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_instrumentcachedir)
+{
+        return set_string_arg (&conf->instrument_cache_dir, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_cachesize)
+{
+        return set_int_arg (&conf->http_cache_size, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_cachemaxobjectsize)
+{
+        return set_int_arg (&conf->http_cache_max_object, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_cachedir)
+{
+        return set_string_arg (&conf->http_cache_dir, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_cachedirsize)
+{
+        return set_int_arg (&conf->http_cache_dir_size, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_instrumentfunction)
+{
+        char *arg = get_string_arg (line, &match[2]);
+        int ret;
+
+        if (!arg)
+                return -1;
+
+        ret = instrument_add_pattern (&conf->instrument_functions, arg);
+        safefree (arg);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_instrumentskipfunction)
+{
+        char *arg = get_string_arg (line, &match[2]);
+        int ret;
+
+        if (!arg)
+                return -1;
+
+        ret = instrument_add_pattern (&conf->instrument_skip_functions, arg);
+        safefree (arg);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_instrumentminbodysize)
+{
+        return set_int_arg (&conf->instrument_min_body, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_instrumentsample)
+{
+        char *arg = get_string_arg (line, &match[2]);
+        unsigned long int percent = get_long_arg (line, &match[3]);
+        int ret;
+
+        if (!arg)
+                return -1;
+
+        if (percent > 100) {
+                log_message (LOG_WARNING,
+                             "InstrumentSample percentage %lu is over 100",
+                             percent);
+                percent = 100;
+        }
+
+        ret = instrument_add_sample (&conf->instrument_samples, arg,
+                                     (int) percent);
+        safefree (arg);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_instrumenthotthreshold)
+{
+        return set_int_arg (&conf->instrument_hot_threshold, line, &match[2]);
+}
+
+/*
+ * The Rewrite* directives: a URL pattern, what to look for (except for
+ * RewriteInjectHead) and what to put in its place, which may be empty.
+ */
+static int add_rewrite_rule (struct config_s *conf, int kind,
+                             const char *line, regmatch_t match[])
+{
+        int last = kind == REWRITE_INJECT_HEAD ? 3 : 4;
+        char *url = get_string_arg (line, &match[2]);
+        char *find = NULL;
+        char *replace;
+        int ret = -1;
+
+        if (kind != REWRITE_INJECT_HEAD)
+                find = get_string_arg (line, &match[3]);
+        if (match[last].rm_eo > match[last].rm_so)
+                replace = get_string_arg (line, &match[last]);
+        else
+                replace = safestrdup ("");
+
+        if (url && replace && (find || kind == REWRITE_INJECT_HEAD))
+                ret = rewrite_add_rule (&conf->rewrite_rules, kind, url,
+                                        find, replace);
+        safefree (url);
+        safefree (find);
+        safefree (replace);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_rewritereplace)
+{
+        return add_rewrite_rule (conf, REWRITE_REPLACE, line, match);
+}
+
+static HANDLE_FUNC (handle_rewriteregex)
+{
+        return add_rewrite_rule (conf, REWRITE_REGEX, line, match);
+}
+
+static HANDLE_FUNC (handle_rewriteinjecthead)
+{
+        return add_rewrite_rule (conf, REWRITE_INJECT_HEAD, line, match);
+}
+
+static HANDLE_FUNC (handle_rewritelookahead)
+{
+        return set_int_arg (&conf->rewrite_lookahead, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_rewritecompresslevel)
+{
+        unsigned long int level = get_long_arg (line, &match[2]);
+
+        if (level > 9) {
+                log_message (LOG_WARNING,
+                             "RewriteCompressLevel %lu is over 9", level);
+                level = 9;
+        }
+        conf->rewrite_compress_level = (unsigned int) level;
+        return 0;
+}
+
+/*
+ * ShapeProfile name latency downstream upstream loss: milliseconds,
+ * kbit/s (0 for no limit) and percent.
+ */
+static HANDLE_FUNC (handle_shapeprofile)
+{
+        unsigned long loss = get_long_arg (line, &match[9]);
+        char *name = get_string_arg (line, &match[2]);
+        int ret = -1;
+
+        if (loss > 100) {
+                log_message (LOG_WARNING,
+                             "ShapeProfile loss %lu is over 100", loss);
+                loss = 100;
+        }
+
+        if (name)
+                ret = shape_add_profile (&conf->shape_profiles, name,
+                                         get_long_arg (line, &match[3]),
+                                         get_long_arg (line, &match[5]),
+                                         get_long_arg (line, &match[7]),
+                                         loss);
+        safefree (name);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_shapeclient)
+{
+        char *profile = get_string_arg (line, &match[2]);
+        char *location = get_string_arg (line, &match[3]);
+        int ret = -1;
+
+        if (profile && location)
+                ret = shape_add_client (&conf->shape_rules, profile,
+                                        location);
+        safefree (profile);
+        safefree (location);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_shapeurl)
+{
+        char *profile = get_string_arg (line, &match[2]);
+        char *pattern = get_string_arg (line, &match[3]);
+        int ret = -1;
+
+        if (profile && pattern)
+                ret = shape_add_url (&conf->shape_rules, profile, pattern);
+        safefree (profile);
+        safefree (pattern);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_replayfile)
+{
+        return set_string_arg (&conf->replay_file, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_replaymatchheader)
+{
+        char *name = get_string_arg (line, &match[2]);
+        int ret = -1;
+
+        if (!conf->replay_headers)
+                conf->replay_headers = vector_create ();
+        if (name && conf->replay_headers)
+                ret = vector_append (conf->replay_headers, name,
+                                     strlen (name) + 1);
+        safefree (name);
+        return ret;
+}
+
+static HANDLE_FUNC (handle_replaytiming)
+{
+        return set_bool_arg (&conf->replay_timing, line, &match[2]);
+}
+
 static HANDLE_FUNC (handle_addheader)
 {
         char *name = get_string_arg (line, &match[2]);
@@ -1057,11 +1724,12 @@ static HANDLE_FUNC (handle_upstream)
         if (match[10].rm_so != -1) {
                 domain = get_string_arg (line, &match[10]);
                 if (domain) {
-                        upstream_add (ip, port, domain, &conf->upstream_list);
+                        upstream_add (ip, port, NULL, domain,
+                                      &conf->upstream_list);
                         safefree (domain);
                 }
         } else {
-                upstream_add (ip, port, NULL, &conf->upstream_list);
+                upstream_add (ip, port, NULL, NULL, &conf->upstream_list);
         }
 
         safefree (ip);
@@ -1077,18 +1745,404 @@ static HANDLE_FUNC (handle_upstream_no)
         if (!domain)
                 return -1;
 
-        upstream_add (NULL, 0, domain, &conf->upstream_list);
+        upstream_add (NULL, 0, NULL, domain, &conf->upstream_list);
         safefree (domain);
 
         return 0;
 }
+
+static HANDLE_FUNC (handle_upstream_group_rule)
+{
+        struct upstream_group *group;
+        char *name;
+        char *domain = NULL;
+
+        name = get_string_arg (line, &match[2]);
+        if (!name)
+                return -1;
+
+        group = upstream_group_get (name, &conf->upstream_groups);
+        safefree (name);
+        if (!group)
+                return -1;
+
+        if (match[4].rm_so != -1) {
+                domain = get_string_arg (line, &match[4]);
+                if (!domain)
+                        return -1;
+        }
+
+        upstream_add (NULL, 0, group, domain, &conf->upstream_list);
+        safefree (domain);
+
+        return 0;
+}
+
+static HANDLE_FUNC (handle_upstreamgroup)
+{
+        struct upstream_group *group;
+        char *name, *host;
+        int port, ret;
+
+        name = get_string_arg (line, &match[2]);
+        if (!name)
+                return -1;
+
+        group = upstream_group_get (name, &conf->upstream_groups);
+        safefree (name);
+        if (!group)
+                return -1;
+
+        host = get_string_arg (line, &match[3]);
+        if (!host)
+                return -1;
+        port = (int) get_long_arg (line, &match[8]);
+
+        ret = upstream_group_add_member (group, host, port);
+        safefree (host);
+
+        return ret;
+}
+
+static HANDLE_FUNC (handle_upstreambalance)
+{
+        struct upstream_group *group;
+        char *name, *policy;
+
+        name = get_string_arg (line, &match[2]);
+        if (!name)
+                return -1;
+
+        group = upstream_group_get (name, &conf->upstream_groups);
+        safefree (name);
+        if (!group)
+                return -1;
+
+        policy = get_string_arg (line, &match[3]);
+        if (!policy)
+                return -1;
+
+        if (strcasecmp (policy, "hash") == 0)
+                group->balance = UPSTREAM_BALANCE_HASH;
+        else
+                group->balance = UPSTREAM_BALANCE_LEASTCONN;
+        safefree (policy);
+
+        return 0;
+}
+
+static HANDLE_FUNC (handle_upstreammaxfails)
+{
+        return set_int_arg (&conf->upstream_max_fails, line, &match[2]);
+}
+
+static HANDLE_FUNC (handle_upstreamfailtimeout)
+{
+        return set_int_arg (&conf->upstream_fail_timeout, line, &match[2]);
+}
 #endif
 
 
 struct url_conf_s *url_conf_list = NULL;
-struct url_conf_s *url_conf_end = NULL;
 
-void reload_url_config(void)
+/* 正在加载的配置，全部读完后才替换 url_conf_list */
+static struct url_conf_s *loaded_list = NULL;
+static struct url_conf_s *loaded_end = NULL;
+
+/* 启动时的工作目录下的 urls.conf 和 mocks.conf，变成守护进程后会 chdir("/") */
+static char *urls_conf_path = NULL;
+static char *mocks_conf_path = NULL;
+
+/* urls.conf 和 mocks.conf 里精确匹配的 URL 的哈希表，目录映射不在里面 */
+static struct url_conf_s **url_index = NULL;
+static size_t url_index_size = 0;   /* 2 的幂 */
+
+static void add_url_conf(struct url_conf_s *url_conf)
+{
+    url_conf->next = NULL;
+    if (!loaded_end) {
+        loaded_list = loaded_end = url_conf;
+    }
+    else {
+        loaded_end -> next = url_conf;
+        loaded_end = url_conf;
+    }
+}
+
+static void free_url_list(struct url_conf_s *url_conf)
+{
+    struct url_conf_s *next;
+
+    while (url_conf) {
+        next = url_conf->next;
+        free(url_conf->url);
+        free(url_conf->local_file);
+        free(url_conf->response);
+        free(url_conf);
+        url_conf = next;
+    }
+}
+
+/* 现在的配置里有没有模拟响应（mock 为 0 时看 URL 映射） */
+static int has_url_conf(int mock)
+{
+    struct url_conf_s *url_conf;
+
+    for (url_conf = url_conf_list; url_conf; url_conf = url_conf->next)
+        if (!url_conf->response == !mock)
+            return 1;
+    return 0;
+}
+
+/* 把相对于当前目录的 name 变成绝对路径，用 malloc 分配 */
+static char *absolute_path(const char *name)
+{
+    char cwd[PATH_MAX];
+    char *path;
+
+    if (name[0] == '/' || !getcwd(cwd, sizeof(cwd)))
+        return strdup(name);
+    path = (char*) malloc(strlen(cwd) + strlen(name) + 2);
+    if (path)
+        sprintf(path, "%s/%s", cwd, name);
+    return path;
+}
+
+static unsigned int url_hash(const char *url)
+{
+    unsigned int h = 2166136261U;
+    while (*url)
+        h = (h ^ (unsigned char) *url ++) * 16777619U;
+    return h & 0xffffffffU;
+}
+
+/* 配置加载完后建哈希表，同一个 URL 出现多次时用前面的 */
+static void build_url_index(void)
+{
+    struct url_conf_s *url_conf;
+    size_t count = 0, i;
+
+    free(url_index);
+    url_index = NULL;
+    url_index_size = 0;
+
+    for (url_conf = url_conf_list; url_conf; url_conf = url_conf->next)
+        if (!url_conf->directory)
+            count ++;
+    for (url_index_size = 16; url_index_size < count * 2; url_index_size *= 2)
+        ;
+    url_index = (struct url_conf_s**) calloc(url_index_size, sizeof(*url_index));
+    if (!url_index) {
+        url_index_size = 0;
+        return;
+    }
+
+    for (url_conf = url_conf_list; url_conf; url_conf = url_conf->next) {
+        if (url_conf->directory)
+            continue;
+        i = url_hash(url_conf->url) & (url_index_size - 1);
+        while (url_index[i] && strcmp(url_index[i]->url, url_conf->url) != 0)
+            i = (i + 1) & (url_index_size - 1);
+        if (!url_index[i])
+            url_index[i] = url_conf;
+    }
+}
+
+static struct url_conf_s *find_url_conf(const char *url)
+{
+    size_t i;
+
+    if (!url_index_size)
+        return NULL;
+    i = url_hash(url) & (url_index_size - 1);
+    while (url_index[i]) {
+        if (strcmp(url_index[i]->url, url) == 0)
+            return url_index[i];
+        i = (i + 1) & (url_index_size - 1);
+    }
+    return NULL;
+}
+
+static const char *status_reason(int status)
+{
+    static const struct {
+        int status;
+        const char *reason;
+    } reasons[] = {
+        { 200, "OK" }, { 201, "Created" }, { 202, "Accepted" },
+        { 204, "No Content" }, { 301, "Moved Permanently" },
+        { 302, "Found" }, { 304, "Not Modified" },
+        { 307, "Temporary Redirect" }, { 400, "Bad Request" },
+        { 401, "Unauthorized" }, { 403, "Forbidden" },
+        { 404, "Not Found" }, { 409, "Conflict" },
+        { 429, "Too Many Requests" }, { 500, "Internal Server Error" },
+        { 502, "Bad Gateway" }, { 503, "Service Unavailable" },
+        { 504, "Gateway Timeout" }
+    };
+    size_t i;
+
+    for (i = 0; i < sizeof(reasons) / sizeof(reasons[0]); i ++)
+        if (reasons[i].status == status)
+            return reasons[i].reason;
+    return "Mock";
+}
+
+static int append_text(char **text, size_t *len, const char *data, size_t n)
+{
+    char *p = (char*) realloc(*text, *len + n + 1);
+    if (!p)
+        return -1;
+    memcpy(p + *len, data, n);
+    *len += n;
+    p[*len] = '\0';
+    *text = p;
+    return 0;
+}
+
+/*
+ * 把一条模拟响应拼成要发送的样子：状态行、响应头、Content-Length，
+ * 然后是响应体。命中时一次 write 发出去，不读文件也不连服务器。
+ */
+static int add_mock(const char *url, int status, const char *reason,
+                     const char *headers, size_t headers_len,
+                     const char *body, size_t body_len)
+{
+    struct url_conf_s *url_conf;
+    char line[256];
+    char *response = NULL;
+    size_t len = 0;
+    int n;
+
+    n = snprintf(line, sizeof(line), "HTTP/1.0 %d %s\r\n", status,
+                 *reason ? reason : status_reason(status));
+    if (append_text(&response, &len, line, n) < 0
+        || (headers_len && append_text(&response, &len, headers, headers_len) < 0))
+        goto fail;
+    /* 204 和 304 不能带 Content-Length */
+    if (status == 204 || status == 304)
+        n = snprintf(line, sizeof(line), "Connection: close\r\n\r\n");
+    else
+        n = snprintf(line, sizeof(line), "Content-Length: %lu\r\n"
+                     "Connection: close\r\n\r\n", (unsigned long) body_len);
+    if (append_text(&response, &len, line, n) < 0)
+        goto fail;
+
+    url_conf = (struct url_conf_s*) malloc(sizeof(struct url_conf_s));
+    if (!url_conf)
+        goto fail;
+    url_conf->url = strdup(url);
+    url_conf->local_file = NULL;
+    url_conf->directory = 0;
+    url_conf->header_len = len;
+    if (status != 204 && status != 304 && body_len
+        && append_text(&response, &len, body, body_len) < 0) {
+        free(url_conf->url);
+        free(url_conf);
+        goto fail;
+    }
+    url_conf->response = response;
+    url_conf->response_len = len;
+    add_url_conf(url_conf);
+    return 0;
+
+fail:
+    free(response);
+    log_message(LOG_WARNING, "Could not add the mock response for %s", url);
+    return -1;
+}
+
+/*
+ * 读取 mocks.conf 里的模拟响应，格式：
+ *
+ *   MOCK http://api.example.com/v1/user 200 OK
+ *   Content-Type: application/json
+ *
+ *   {"id": 1}
+ *   END
+ *
+ * MOCK 行是 URL、状态码和可以省略的原因短语，之后到空行是响应头，
+ * 空行到 END 行是响应体（行之间用 \n 连接）。# 开头的行在 MOCK 之外
+ * 是注释。Content-Length 和 Connection 头由代理自己加。
+ * 文件打不开、有没写完的 MOCK 或者内存不够时返回 -1。
+ */
+static int load_mock_config(void)
+{
+    char line[4096], url[2048], reason[256];
+    char *headers = NULL, *body = NULL;
+    size_t headers_len = 0, body_len = 0, len;
+    int status = 0, state = 0;  /* 0: MOCK 行之外，1: 响应头，2: 响应体 */
+    int ret = 0;
+    FILE *file;
+
+    file = fopen(mocks_conf_path, "r");
+    if (!file) {
+        /* 一直没有 mocks.conf 不算错 */
+        if (errno == ENOENT && !has_url_conf(1))
+            return 0;
+        log_message(LOG_WARNING, "Could not open %s: %s",
+                    mocks_conf_path, strerror(errno));
+        return -1;
+    }
+
+    while (ret == 0 && fgets(line, sizeof(line), file)) {
+        len = strlen(line);
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+            line[-- len] = '\0';
+
+        if (state == 0) {
+            reason[0] = '\0';
+            if (sscanf(line, "MOCK %2047s %d %255[^\n]", url, &status,
+                       reason) >= 2) {
+                state = 1;
+                headers_len = body_len = 0;
+            }
+            else if (len > 0 && line[0] != '#')
+                log_message(LOG_WARNING, "%s: ignoring \"%s\"", mocks_conf_path,
+                            line);
+        }
+        else if (state == 1) {
+            if (len == 0)
+                state = 2;
+            else if (strcmp(line, "END") == 0) {
+                ret = add_mock(url, status, reason, headers, headers_len,
+                               NULL, 0);
+                state = 0;
+            }
+            else if (strncasecmp(line, "Content-Length:", 15) != 0
+                     && strncasecmp(line, "Connection:", 11) != 0) {
+                if (append_text(&headers, &headers_len, line, len) < 0
+                    || append_text(&headers, &headers_len, "\r\n", 2) < 0)
+                    ret = -1;
+            }
+        }
+        else if (strcmp(line, "END") == 0) {
+            ret = add_mock(url, status, reason, headers, headers_len,
+                           body, body_len);
+            state = 0;
+        }
+        else {
+            if ((body_len > 0 && append_text(&body, &body_len, "\n", 1) < 0)
+                || append_text(&body, &body_len, line, len) < 0)
+                ret = -1;
+        }
+    }
+    if (ret == 0 && state != 0) {
+        log_message(LOG_WARNING, "%s: no END after MOCK %s",
+                    mocks_conf_path, url);
+        ret = -1;
+    }
+
+    fclose(file);
+    free(headers);
+    free(body);
+    return ret;
+}
+
+/*
+ * 读取 urls.conf 到 loaded_list，每行是 URL 和本地文件（或目录）。
+ * 文件打不开或者内存不够时返回 -1。
+ */
+static int load_url_file(void)
 {
     struct field {
         int pos;
@@ -1099,67 +2153,117 @@ void reload_url_config(void)
     FILE *file;
     int pos, len;
     struct url_conf_s *url_conf;
+    struct stat st;
     memset(fields, 0, sizeof(fields));
 
-    file = fopen("urls.conf", "r");
-    if (file) {
-        /* 读取配置文件 */
-        while (fgets(line, sizeof(line), file)) {
-            field = fields;
-            pos = 0;
-            /* 读取一行 */
-            while (field < fields + sizeof(fields) / sizeof(fields[0])) {
-                /* 跳过空白 */
-                c = line[pos];
-                while (c == ' ' || c == '\t') {
-                    c = line[++ pos];
-                }
-
-                /* 读取字段 */
-                len = 0;
-                while (pos + len < (int) sizeof(line)) {
-                    c = line[pos + len];
-                    if (c == '\r' || c == '\n' || c == '\0' || c == ' ' || c == '\t')
-                        break;
-                    len ++;
-                }
+    file = fopen(urls_conf_path, "r");
+    if (!file) {
+        /* 一直没有 urls.conf 不算错 */
+        if (errno == ENOENT && !has_url_conf(0))
+            return 0;
+        log_message(LOG_WARNING, "Could not open %s: %s",
+                    urls_conf_path, strerror(errno));
+        return -1;
+    }
 
-                /* 保存字段 */
-                field->pos = pos;
-                field->len = len;
+    /* 读取配置文件 */
+    while (fgets(line, sizeof(line), file)) {
+        field = fields;
+        pos = 0;
+        /* 读取一行 */
+        while (field < fields + sizeof(fields) / sizeof(fields[0])) {
+            /* 跳过空白 */
+            c = line[pos];
+            while (c == ' ' || c == '\t') {
+                c = line[++ pos];
+            }
 
-                /* 行结束 */
-                field ++;
-                pos += len;
-                if (c == '\r' || c == '\n' || c == '\0')
+            /* 读取字段 */
+            len = 0;
+            while (pos + len < (int) sizeof(line)) {
+                c = line[pos + len];
+                if (c == '\r' || c == '\n' || c == '\0' || c == ' ' || c == '\t')
                     break;
-
+                len ++;
             }
 
-            /* 添加配置项 */
-            if (fields[0].len > 0) {
-                url_conf = (struct url_conf_s*) malloc(sizeof(struct url_conf_s));
-                url_conf->url = strndup(line + fields[0].pos, fields[0].len);
-                url_conf->local_file = strndup(line + fields[1].pos, fields[1].len);
-                url_conf->next = NULL;
-                if (!url_conf_end) {
-                    url_conf_list = url_conf_end = url_conf;
-                }
-                else {
-                    url_conf_end -> next = url_conf;
-                    url_conf_end = url_conf;
-                }
+            /* 保存字段 */
+            field->pos = pos;
+            field->len = len;
+
+            /* 行结束 */
+            field ++;
+            pos += len;
+            if (c == '\r' || c == '\n' || c == '\0')
+                break;
+
+        }
+
+        /* 添加配置项 */
+        if (fields[0].len > 0) {
+            url_conf = (struct url_conf_s*) malloc(sizeof(struct url_conf_s));
+            if (!url_conf) {
+                fclose(file);
+                return -1;
+            }
+            url_conf->url = strndup(line + fields[0].pos, fields[0].len);
+            url_conf->local_file = strndup(line + fields[1].pos, fields[1].len);
+            url_conf->response = NULL;
+            url_conf->response_len = url_conf->header_len = 0;
+            add_url_conf(url_conf);
+            if (!url_conf->url || !url_conf->local_file) {
+                fclose(file);
+                return -1;
             }
+            /* 映射到目录时，url 下的所有路径都对应到目录里的文件 */
+            url_conf->directory = stat(url_conf->local_file, &st) == 0
+                                  && S_ISDIR(st.st_mode);
         }
-        fclose(file);
     }
+    fclose(file);
+    return 0;
+}
+
+/*
+ * 读取 urls.conf 和 mocks.conf。读不了时保留原来的配置，全部读完才替换，
+ * 然后重建哈希表。
+ */
+void reload_url_config(void)
+{
+    struct url_conf_s *url_conf;
+
+    if (!urls_conf_path)
+        urls_conf_path = absolute_path("urls.conf");
+    if (!mocks_conf_path)
+        mocks_conf_path = absolute_path("mocks.conf");
+    if (!urls_conf_path || !mocks_conf_path)
+        return;
+
+    loaded_list = loaded_end = NULL;
+    if (load_url_file() < 0 || load_mock_config() < 0) {
+        log_message(LOG_WARNING,
+                    "Keeping the URL mappings and mocks loaded before");
+        free_url_list(loaded_list);
+        loaded_list = loaded_end = NULL;
+        return;
+    }
+
+    free_url_list(url_conf_list);
+    url_conf_list = loaded_list;
+    loaded_list = loaded_end = NULL;
+    build_url_index();
 
     url_conf = url_conf_list;
     printf("+---------------------------------------------------------------------------------+\n");
     printf("|URL                                     | LOCAL FILE                             |\n");
     printf("+---------------------------------------------------------------------------------+\n");
     while (url_conf) {
-        printf("|%-40s|%-40s|\n", url_conf->url, url_conf->local_file);
+        if (url_conf->response)
+            printf("|%-40s|mock %-35.3s|\n", url_conf->url,
+                   url_conf->response + strlen("HTTP/1.0 "));
+        else
+            printf("|%-40s|%-39s%c|\n", url_conf->url, url_conf->local_file,
+                   url_conf->directory ? '/' : ' ');
         url_conf = url_conf->next;
     }
     printf("+---------------------------------------------------------------------------------+\n");
@@ -1167,11 +2271,101 @@ void reload_url_config(void)
 
 char *get_local_file(char *url)
 {
-    struct url_conf_s *url_conf = url_conf_list;
-    while (url_conf) {
-        if (strcmp(url, url_conf->url) == 0)
-            return url_conf->local_file;
-        url_conf = url_conf->next;
+    struct url_conf_s *url_conf = find_url_conf(url);
+    return url_conf ? url_conf->local_file : NULL;
+}
+
+const struct url_conf_s *get_url_mock(const char *url)
+{
+    struct url_conf_s *url_conf = find_url_conf(url);
+    return url_conf && url_conf->response ? url_conf : NULL;
+}
+
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/*
+ * 在映射到目录的 url 前缀中找最长的一个，返回 url 对应的本地文件路径
+ * （用 malloc 分配，调用者 free）。没有匹配、或者路径里有 ".." 时返回 NULL。
+ * 路径以 '/' 结尾时使用目录下的 index.html。
+ */
+char *get_local_dir_file(const char *url)
+{
+    struct url_conf_s *url_conf, *best = NULL;
+    size_t prefix_len = 0, len, dir_len, i;
+    const char *rest, *end, *segment;
+    char *path, *p;
+    int hi, lo;
+
+    for (url_conf = url_conf_list; url_conf; url_conf = url_conf->next) {
+        if (!url_conf->directory)
+            continue;
+        len = strlen(url_conf->url);
+        if (len <= prefix_len || strncmp(url, url_conf->url, len) != 0)
+            continue;
+        /* "/static" 不匹配 "/staticfoo" */
+        if (url_conf->url[len - 1] != '/' && url[len] != '/'
+            && url[len] != '?' && url[len] != '#' && url[len] != '\0')
+            continue;
+        best = url_conf;
+        prefix_len = len;
+    }
+    if (!best)
+        return NULL;
+
+    /* 去掉查询参数和锚点 */
+    rest = url + prefix_len;
+    end = rest + strcspn(rest, "?#");
+    while (rest < end && *rest == '/')
+        rest ++;
+
+    dir_len = strlen(best->local_file);
+    path = (char*) malloc(dir_len + 1 + (end - rest) + sizeof("index.html"));
+    if (!path)
+        return NULL;
+    memcpy(path, best->local_file, dir_len);
+    p = path + dir_len;
+    if (dir_len == 0 || p[-1] != '/')
+        *p ++ = '/';
+
+    /* 解码 %XX，逐段检查不允许跳出目录 */
+    segment = p;
+    for (i = 0; rest + i < end; i ++) {
+        char c = rest[i];
+        if (c == '%' && rest + i + 2 < end
+            && (hi = hex_value(rest[i + 1])) >= 0
+            && (lo = hex_value(rest[i + 2])) >= 0) {
+            c = (char) (hi * 16 + lo);
+            i += 2;
+            if (c == '\0' || c == '/' || c == '\\')
+                goto reject;
+        }
+        if (c == '/') {
+            if (p - segment == 2 && segment[0] == '.' && segment[1] == '.')
+                goto reject;
+            *p ++ = c;
+            segment = p;
+            continue;
+        }
+        *p ++ = c;
     }
+    if (p - segment == 2 && segment[0] == '.' && segment[1] == '.')
+        goto reject;
+    if (p == segment)
+        strcpy(p, "index.html");
+    else
+        *p = '\0';
+    return path;
+
+reject:
+    free(path);
     return NULL;
 }
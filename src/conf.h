@@ -58,12 +58,17 @@ struct config_s {
 #endif
 #ifdef REVERSE_SUPPORT
         struct reversepath *reversepath_list;
+        struct reversepath_index *reversepath_index;
         unsigned int reverseonly;       /* boolean */
         unsigned int reversemagic;      /* boolean */
         char *reversebaseurl;
 #endif
 #ifdef UPSTREAM_SUPPORT
         struct upstream *upstream_list;
+        struct upstream_index *upstream_index;
+        struct upstream_group *upstream_groups;
+        unsigned int upstream_max_fails;
+        unsigned int upstream_fail_timeout;
 #endif                          /* UPSTREAM_SUPPORT */
         char *pidpath;
         unsigned int idletimeout;
@@ -110,11 +115,81 @@ struct config_s {
          * Extra headers to be added to outgoing HTTP requests.
          */
         vector_t add_headers;
+
+        /*
+         * JavaScript profiling instrumentation: responses whose
+         * Content-Type or URL match one of these patterns get profiling
+         * code inserted, as long as the body is at most instrument_maxsize
+         * bytes.  Instrumented bodies are cached in instrument_cache_size
+         * bytes of shared memory and, if set, in instrument_cache_dir.
+         * instrument_mode is one of the INSTRUMENT_MODE_* values.  With
+         * instrument_source_map a source map of each instrumented script
+         * is served from the StatHost.
+         *
+         * The rest choose the functions of a script that get probes:
+         * by name, by body size, a sampled percentage per URL, or those
+         * whose total time in the profile reached instrument_hot_threshold
+         * milliseconds.
+         */
+        vector_t instrument_types;
+        vector_t instrument_urls;
+        vector_t instrument_functions;
+        vector_t instrument_skip_functions;
+        vector_t instrument_samples;
+        unsigned int instrument_min_body;
+        unsigned int instrument_hot_threshold;
+
+        /*
+         * Response body rewriting (see rewrite.c): the RewriteReplace,
+         * RewriteRegex and RewriteInjectHead rules, and how many bytes
+         * RewriteRegex holds back so a match can span two reads.
+         * Compressed bodies are compressed again at
+         * rewrite_compress_level, unless it is 0.
+         */
+        vector_t rewrite_rules;
+        unsigned int rewrite_lookahead;
+        unsigned int rewrite_compress_level;
+        unsigned int instrument_mode;
+        unsigned int instrument_source_map;
+        unsigned int instrument_maxsize;
+        unsigned int instrument_cache_size;
+        char *instrument_cache_dir;
+
+        /*
+         * The response cache (see http-cache.c): http_cache_size bytes
+         * of shared memory, 0 to turn it off, for responses of at most
+         * http_cache_max_object bytes.  If http_cache_dir is set they
+         * are also kept there, up to http_cache_dir_size bytes.
+         */
+        unsigned int http_cache_size;
+        unsigned int http_cache_max_object;
+        char *http_cache_dir;
+        unsigned int http_cache_dir_size;
+
+        /*
+         * Network emulation (see shape.c): the ShapeProfile profiles,
+         * and the ShapeClient and ShapeURL rules that pick one.
+         */
+        vector_t shape_profiles;
+        vector_t shape_rules;
+
+        /*
+         * Replay mode (see replay.c): answer requests from the traffic
+         * recorded in replay_file, matching the replay_headers headers
+         * too, and with the recorded timing if replay_timing is set.
+         */
+        char *replay_file;
+        vector_t replay_headers;
+        unsigned int replay_timing;
 };
 
 struct url_conf_s {
     char *url;
     char *local_file;
+    int directory;      /* local_file 是目录，url 是前缀 */
+    char *response;     /* mocks.conf 的模拟响应，已经是要发送的样子 */
+    size_t response_len;
+    size_t header_len;  /* HEAD 请求只发响应头 */
     struct url_conf_s *next;
 };
 extern struct url_conf_s *url_conf_list;
@@ -126,6 +201,11 @@ void reload_url_config(void);
 
 char *get_local_file(char *url);
 
+char *get_local_dir_file(const char *url);
+
+const struct url_conf_s *get_url_mock(const char *url);
+
 int config_compile_regex (void);
+int config_directive (const char *line, int linear);
 
 #endif
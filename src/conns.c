@@ -25,10 +25,15 @@
 #include "main.h"
 
 #include "buffer.h"
+#include "chunked.h"
 #include "conns.h"
 #include "heap.h"
 #include "log.h"
+#include "rewrite.h"
+#include "http-cache.h"
+#include "shape.h"
 #include "stats.h"
+#include "upstream.h"
 
 struct conn_s *initialize_conn (int client_fd, const char *ipaddr,
                                 const char *string_addr,
@@ -70,6 +75,8 @@ struct conn_s *initialize_conn (int client_fd, const char *ipaddr,
 
         connptr->connect_method = FALSE;
         connptr->show_stats = FALSE;
+        connptr->profile_request = 0;
+        connptr->sourcemap_request = NULL;
 
         connptr->protocol.major = connptr->protocol.minor = 0;
 
@@ -82,6 +89,19 @@ struct conn_s *initialize_conn (int client_fd, const char *ipaddr,
         connptr->client_string_addr = safestrdup (string_addr);
 
         connptr->upstream_proxy = NULL;
+        connptr->upstream_slot = -1;
+
+        connptr->instrumented_body = NULL;
+        connptr->instrumented_len = 0;
+        connptr->rewrite = NULL;
+        connptr->rewrite_chunked = 0;
+        connptr->server_chunked = NULL;
+        connptr->dechunk_server = 0;
+        connptr->cache_fill = NULL;
+        connptr->cache_revalidated = 0;
+        connptr->local_path = NULL;
+        connptr->mock = NULL;
+        connptr->shape = NULL;
 
         update_stats (STAT_OPEN);
 
@@ -144,6 +164,21 @@ void destroy_conn (struct conn_s *connptr)
                 safefree (connptr->reversepath);
 #endif
 
+#ifdef UPSTREAM_SUPPORT
+        upstream_health_release (connptr->upstream_slot);
+#endif
+
+        if (connptr->instrumented_body)
+                free (connptr->instrumented_body);
+        rewrite_chain_free (connptr->rewrite);
+        chunked_free (connptr->server_chunked);
+        http_cache_fill_free (connptr->cache_fill);
+        if (connptr->local_path)
+                free (connptr->local_path);
+        shape_free (connptr->shape);
+        if (connptr->sourcemap_request)
+                safefree (connptr->sourcemap_request);
+
         http_log_destroy(&connptr->http_log);
 
         safefree (connptr);
@@ -25,6 +25,12 @@
 #include "hashmap.h"
 #include "log.h"
 
+struct rewrite_chain;
+struct http_cache_fill;
+struct shape;
+struct chunked;
+struct url_conf_s;
+
 /*
  * Connection Definition
  */
@@ -42,6 +48,18 @@ struct conn_s {
         unsigned int connect_method;
         unsigned int show_stats;
 
+        /*
+         * With show_stats, one of the PROFILE_* values if the request was
+         * for PROFILE_PATH (see profile.h), 0 otherwise.
+         */
+        unsigned int profile_request;
+
+        /*
+         * With show_stats, the name of the source map asked for under
+         * SOURCEMAP_PATH (see instrument.h), NULL otherwise.
+         */
+        char *sourcemap_request;
+
         /*
          * This structure stores key -> value mappings for substitution
          * in the error HTML files.
@@ -88,6 +106,67 @@ struct conn_s {
          */
         struct upstream *upstream_proxy;
 
+        /*
+         * Health table slot of the upstream group member in use, or -1.
+         */
+        int upstream_slot;
+
+        /*
+         * Response body rewritten by the JavaScript instrumenter.  When
+         * set it is sent to the client instead of relaying the server's
+         * body.  Allocated by js.c with malloc().
+         */
+        char *instrumented_body;
+        size_t instrumented_len;
+
+        /*
+         * Set instead when the body is rewritten chunk by chunk as
+         * relay_connection() reads it from the server (see rewrite.c):
+         * for the Rewrite* rules, or to instrument a body too large to
+         * buffer or whose length isn't known.  With rewrite_chunked the
+         * result is sent with chunked transfer coding.
+         */
+        struct rewrite_chain *rewrite;
+        unsigned int rewrite_chunked;
+
+        /*
+         * Follows the framing of a chunked response body, so that
+         * relay_connection() knows where it ends (see chunked.c), or
+         * NULL.  With dechunk_server the framing is taken off before the
+         * body is rewritten or sent to an HTTP/1.0 client.
+         */
+        struct chunked *server_chunked;
+        unsigned int dechunk_server;
+
+        /*
+         * Collects the response for the response cache while it is
+         * relayed, if it may be stored (see http-cache.c).  Set
+         * cache_revalidated when the server answered 304 and the stale
+         * entry was sent instead.
+         */
+        struct http_cache_fill *cache_fill;
+        unsigned int cache_revalidated;
+
+        /*
+         * File under a directory mapped in urls.conf that answers the
+         * request instead of the server (see local-file.c).  Allocated
+         * by get_local_dir_file() with malloc().
+         */
+        char *local_path;
+
+        /*
+         * Canned response from mocks.conf that answers the request
+         * instead of the server, or NULL.  Owned by the URL index in
+         * conf.c, ready to be written as it is.
+         */
+        const struct url_conf_s *mock;
+
+        /*
+         * Network emulation picked for the connection by the ShapeClient
+         * and ShapeURL rules, or NULL (see shape.c).
+         */
+        struct shape *shape;
+
         /* HTTP日志 */
         http_log_s http_log;
 };
@@ -0,0 +1,1730 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Shared cache of HTTP responses, so that a bundle fetched by one
+ * developer is served to the next from memory instead of by the origin
+ * server.  It keeps to the rules of RFC 7234 for a shared cache:
+ *
+ *   - only responses to GET are stored, and HEAD is answered from them;
+ *   - a response is kept for its freshness lifetime, taken from
+ *     s-maxage, max-age or Expires, or for the status codes that allow
+ *     it a tenth of the time since its Last-Modified date.  Responses
+ *     without one, and those with no-store, no-cache, private,
+ *     Set-Cookie or "Vary: *", are not stored, nor are responses to
+ *     requests with Authorization;
+ *   - a response with Vary is stored once for each combination of the
+ *     request headers it names;
+ *   - requests with no-cache, or a max-age that the entry exceeds, go
+ *     to the server; POST, PUT, DELETE and PATCH drop the entries for
+ *     their URL.
+ *
+ * A stale entry with an ETag or Last-Modified date is revalidated: the
+ * request goes to the server with If-None-Match or If-Modified-Since, and
+ * if the answer is 304 the entry, with the headers the 304 updates, is
+ * stored again and sent to the client.  When many clients ask at once for
+ * a URL that isn't fresh in the cache, one child fetches it and the others
+ * wait, on a futex where there is one, until it is stored or turns out
+ * not to be storable, for up to HTTP_CACHE_COLLAPSE_WAIT seconds.
+ *
+ * Responses are stored as the client got them, so only those with a
+ * Content-Length whose body is relayed unchanged are kept; rewritten and
+ * instrumented bodies, and URLs mapped to files by urls.conf, bypass the
+ * cache.
+ *
+ * The cache lives in CacheSize bytes of shared memory cut into blocks of
+ * HTTP_CACHE_BLOCK bytes.  Each response takes an object slot, found by
+ * a hash of its URL, and a chain of blocks holding its URL, headers and
+ * body.  When room is needed the CLOCK hand sweeps the objects: one used
+ * since the hand last passed gets another round, the others are dropped.
+ *
+ * With CacheDir every response stored in memory is also written to a file
+ * there, so the cache outlives restarts and can be larger than memory.
+ * The files are found through CacheDir/index, a table of
+ * HTTP_CACHE_DISK_SLOTS entries mapped into every process and searched by
+ * linear probing from the slot the URL hashes to.  Opening it costs the
+ * same however much is cached; the files themselves are never listed.
+ * Each file is named after its URL and a generation number taken from a
+ * counter in the index, so an entry can only point at the file written
+ * for it, and each entry carries a checksum.  An entry left half written
+ * by a crash, or whose file has gone, is dropped when it is next looked
+ * at.  Responses are looked for in memory first, and bodies found on disk
+ * are sent with sendfile().  CacheDirSize bounds the bytes on disk, and a
+ * second CLOCK hand sweeps the index when it is reached.
+ */
+
+#include "main.h"
+
+#include "http-cache.h"
+#include "buffer.h"
+#include "conf.h"
+#include "heap.h"
+#include "log.h"
+#include "network.h"
+#include "utils.h"
+
+#define HTTP_CACHE_BLOCK 4096
+
+/* Longest Vary header of a stored response */
+#define HTTP_CACHE_VARY 128
+
+/* Longest lifetime guessed from Last-Modified */
+#define HTTP_CACHE_HEURISTIC_MAX (24 * 60 * 60)
+
+/* Longest ETag kept in the index of CacheDir, or sent to revalidate */
+#define HTTP_CACHE_ETAG 64
+
+/* Longest Last-Modified date sent to revalidate */
+#define HTTP_CACHE_DATE 64
+
+/* URLs being fetched at once that other children can wait for */
+#define HTTP_CACHE_FETCHES 64
+
+/* Longest wait for another child's fetch, in seconds */
+#define HTTP_CACHE_COLLAPSE_WAIT 10
+
+#if defined (HAVE_LINUX_FUTEX_H) && defined (HAVE_SYS_SYSCALL_H)
+#  define HTTP_CACHE_FUTEX
+#endif
+
+/* Entries in the index of CacheDir, of which 3 in 4 may be used */
+#define HTTP_CACHE_DISK_SLOTS 65536
+
+#define HTTP_CACHE_DISK_MAGIC 0x74706863        /* "tphc" */
+#define HTTP_CACHE_DISK_VERSION 1
+
+struct cache_object {
+        int used;
+        int referenced;                 /* since the CLOCK hand passed */
+        int next;                       /* in the bucket or free list */
+        int first;                      /* block */
+        unsigned int hash;              /* of the URL */
+        size_t url_len;
+        size_t header_len;
+        size_t size;                    /* of the URL, headers and body */
+        time_t stored;                  /* when the response arrived */
+        long initial_age;
+        long lifetime;
+        unsigned int vary_hash;         /* of the request headers in vary */
+        char vary[HTTP_CACHE_VARY];     /* names from Vary, "" if none */
+};
+
+/* A URL a child is fetching from the server */
+struct cache_fetch {
+        int pid;                        /* 0 if the slot is free */
+        unsigned int hash;              /* of the URL */
+        int done;                       /* futex, bumped when it is done */
+};
+
+struct http_cache {
+        int object_count;
+        int block_count;
+        int free_object;                /* lists linked through "next" */
+        int free_block;                 /* and block_next */
+        int free_blocks;
+        int hand;
+        struct cache_fetch fetches[HTTP_CACHE_FETCHES];
+        struct http_cache_stats stats;
+};
+
+/* An entry of the index of CacheDir, all zero while the slot is free */
+struct disk_entry {
+        unsigned int used;
+        int referenced;                 /* since the CLOCK hand passed */
+        unsigned int check;             /* of the fields from here on */
+        unsigned int generation;        /* in the name of the file */
+        unsigned int hash[2];           /* of the URL */
+        unsigned int vary_hash;
+        unsigned long url_len;
+        unsigned long header_len;
+        unsigned long size;             /* of the file */
+        long stored;
+        long initial_age;
+        long lifetime;
+        char vary[HTTP_CACHE_VARY];
+        char etag[HTTP_CACHE_ETAG];     /* "" if none */
+};
+
+struct disk_index {
+        unsigned int magic;
+        unsigned int version;
+        unsigned int slot_count;
+        unsigned int entry_size;
+        unsigned int generation;        /* of the last file written */
+        unsigned int used;              /* slots */
+        unsigned int hand;
+        unsigned long bytes_used;
+};
+
+struct http_cache_fill {
+        char *url;
+        hashmap_t request_headers;      /* the client's, for Vary */
+        time_t request_time;
+        int ready;                      /* accepted by http_cache_response() */
+        long expected;                  /* the Content-Length */
+
+        char *data;                     /* URL, headers, then the body */
+        size_t len;
+        size_t size;
+        size_t url_len;
+        size_t header_len;              /* 0 until the body starts */
+
+        time_t stored;
+        long initial_age;
+        long lifetime;
+        char vary[HTTP_CACHE_VARY];
+        char etag[HTTP_CACHE_ETAG];
+
+        int fetch;                      /* slot in cache->fetches, or -1 */
+        struct http_cache_hit stale;    /* the entry being revalidated */
+        char if_none_match[HTTP_CACHE_ETAG];
+        char if_modified_since[HTTP_CACHE_DATE];
+};
+
+static struct http_cache *cache = NULL;
+static int *buckets;
+static struct cache_object *objects;
+static int *block_next;
+static char *blocks;
+static int cache_lock_fd = -1;
+
+static struct disk_index *disk = NULL;
+static struct disk_entry *disk_entries;
+static int disk_fd = -1;                /* the index, also locked */
+
+static void file_lock (int fd, short type)
+{
+        struct flock lock;
+
+        lock.l_type = type;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = 0;
+        lock.l_len = 0;
+
+        while (fcntl (fd, F_SETLKW, &lock) < 0) {
+                if (errno != EINTR)
+                        return;
+        }
+}
+
+static void cache_lock (short type)
+{
+        file_lock (cache_lock_fd, type);
+}
+
+/* When both are held, disk_lock is taken first */
+static void disk_lock (short type)
+{
+        file_lock (disk_fd, type);
+}
+
+/* Round up so that the tables after the header stay aligned */
+static size_t aligned (size_t size)
+{
+        return (size + 15) & ~(size_t) 15;
+}
+
+/*
+ * Open CacheDir/index, making it if it isn't there or was written by
+ * another version.  Nothing else in CacheDir is looked at.
+ */
+static int disk_init (void)
+{
+        struct disk_index header;
+        size_t size, len;
+        char *path, *mem;
+        int fd;
+
+        len = strlen (config.http_cache_dir) + sizeof ("/index");
+        path = (char *) safemalloc (len);
+        if (!path)
+                return -1;
+        snprintf (path, len, "%s/index", config.http_cache_dir);
+        fd = open (path, O_RDWR | O_CREAT, 0600);
+        safefree (path);
+        if (fd < 0)
+                return -1;
+
+        size = aligned (sizeof (struct disk_index))
+                + HTTP_CACHE_DISK_SLOTS * sizeof (struct disk_entry);
+
+        if (read (fd, &header, sizeof (header)) != sizeof (header)
+            || header.magic != HTTP_CACHE_DISK_MAGIC
+            || header.version != HTTP_CACHE_DISK_VERSION
+            || header.slot_count != HTTP_CACHE_DISK_SLOTS
+            || header.entry_size != sizeof (struct disk_entry)) {
+                /* start empty; the files of an older index are left */
+                if (ftruncate (fd, 0) < 0 || ftruncate (fd, size) < 0)
+                        goto fail;
+                memset (&header, 0, sizeof (header));
+                header.magic = HTTP_CACHE_DISK_MAGIC;
+                header.version = HTTP_CACHE_DISK_VERSION;
+                header.slot_count = HTTP_CACHE_DISK_SLOTS;
+                header.entry_size = sizeof (struct disk_entry);
+                if (lseek (fd, 0, SEEK_SET) < 0
+                    || write (fd, &header, sizeof (header))
+                    != sizeof (header))
+                        goto fail;
+        }
+
+        mem = (char *) mmap (NULL, size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd, 0);
+        if ((void *) mem == MAP_FAILED)
+                goto fail;
+
+        disk = (struct disk_index *) mem;
+        disk_entries = (struct disk_entry *)
+                (mem + aligned (sizeof (struct disk_index)));
+        disk_fd = fd;
+        return 0;
+
+fail:
+        close (fd);
+        return -1;
+}
+
+/*
+ * Set up the shared cache.  This has to be done before the children are
+ * created; a CacheSize or CacheDir changed by a reload only takes effect
+ * on restart.
+ */
+int http_cache_init (void)
+{
+        char lock_file[] = "/tmp/tinyproxy.cache.lock.XXXXXX";
+        size_t size = config.http_cache_size;
+        size_t tables;
+        int block_count, object_count, i;
+        char *mem;
+
+        if (size == 0 && !config.http_cache_dir)
+                return 0;
+
+        /* with CacheSize 0 only the statistics are kept in memory */
+        block_count = (int) (size / HTTP_CACHE_BLOCK);
+        object_count = block_count / 2;
+        if (size > 0 && object_count < 1)
+                return -1;
+
+        tables = aligned (sizeof (struct http_cache))
+                + aligned (object_count * sizeof (int))
+                + aligned (object_count * sizeof (struct cache_object))
+                + aligned (block_count * sizeof (int));
+        mem = (char *) malloc_shared_memory (tables
+                                             + (size_t) block_count
+                                             * HTTP_CACHE_BLOCK);
+        if ((void *) mem == MAP_FAILED)
+                return -1;
+
+        cache_lock_fd = mkstemp (lock_file);
+        if (cache_lock_fd < 0)
+                return -1;
+        unlink (lock_file);
+
+        cache = (struct http_cache *) mem;
+        mem += aligned (sizeof (struct http_cache));
+        buckets = (int *) mem;
+        mem += aligned (object_count * sizeof (int));
+        objects = (struct cache_object *) mem;
+        mem += aligned (object_count * sizeof (struct cache_object));
+        block_next = (int *) mem;
+        mem += aligned (block_count * sizeof (int));
+        blocks = mem;
+
+        memset (cache, 0, sizeof (struct http_cache));
+        cache->object_count = object_count;
+        cache->block_count = block_count;
+        for (i = 0; i < object_count; i++) {
+                buckets[i] = -1;
+                memset (&objects[i], 0, sizeof (struct cache_object));
+                objects[i].next = i + 1 < object_count ? i + 1 : -1;
+        }
+        for (i = 0; i < block_count; i++)
+                block_next[i] = i + 1 < block_count ? i + 1 : -1;
+        cache->free_object = object_count > 0 ? 0 : -1;
+        cache->free_block = block_count > 0 ? 0 : -1;
+        cache->free_blocks = block_count;
+
+        return 0;
+}
+
+/*
+ * Open the index of CacheDir.  This is done after the switch to User,
+ * so that the index belongs to the same user as the files the children
+ * write next to it, but still before the children are created.
+ */
+int http_cache_disk_init (void)
+{
+        if (!cache || !config.http_cache_dir)
+                return 0;
+
+        if (disk_init () < 0) {
+                log_message (LOG_WARNING,
+                             "Could not open the index of CacheDir \"%s\": "
+                             "%s", config.http_cache_dir, strerror (errno));
+                return -1;
+        }
+        return 0;
+}
+
+static unsigned int hash_bytes (unsigned int h, const char *data, size_t len)
+{
+        size_t i;
+
+        for (i = 0; i != len; ++i)
+                h = (h ^ (unsigned char) data[i]) * 16777619U;
+        return h & 0xffffffffU;
+}
+
+/*
+ * A hash of the values the request has for the header names in "vary",
+ * which are separated by commas.  A missing header hashes differently
+ * from an empty one.
+ */
+static unsigned int vary_hash (const char *vary, hashmap_t request_headers)
+{
+        unsigned int h = 2166136261U;
+        char name[HTTP_CACHE_VARY];
+        const char *end;
+        char *value;
+        size_t len;
+
+        while (*vary) {
+                end = strchr (vary, ',');
+                len = end ? (size_t) (end - vary) : strlen (vary);
+                memcpy (name, vary, len);
+                name[len] = '\0';
+
+                h = hash_bytes (h, name, len + 1);
+                if (hashmap_entry_by_key (request_headers, name,
+                                          (void **) &value) > 0)
+                        h = hash_bytes (h, value, strlen (value) + 1);
+                else
+                        h = hash_bytes (h, "\001", 1);
+
+                vary += len;
+                if (*vary == ',')
+                        vary++;
+        }
+        return h;
+}
+
+/*
+ * Look for the Cache-Control directive "name" in "value".  Returns 1 if
+ * it is there, with its number in "*arg" if it has one (-1 if not), and
+ * 0 if it isn't.
+ */
+static int cache_directive (const char *value, const char *name, long *arg)
+{
+        size_t len = strlen (name);
+        const char *p = value;
+
+        while (*p) {
+                while (*p == ' ' || *p == '\t' || *p == ',')
+                        p++;
+
+                /* strchr() also finds the '\0' at the end of the value */
+                if (strncasecmp (p, name, len) == 0
+                    && strchr ("=, \t", p[len])) {
+                        if (arg) {
+                                *arg = -1;
+                                p += len;
+                                if (*p == '=' && *++p == '"')
+                                        p++;
+                                if (isdigit ((unsigned char) *p))
+                                        *arg = strtol (p, NULL, 10);
+                        }
+                        return 1;
+                }
+
+                while (*p && *p != ',') {
+                        if (*p++ != '"')
+                                continue;
+                        while (*p && *p != '"')
+                                p++;
+                        if (*p)
+                                p++;
+                }
+        }
+        return 0;
+}
+
+/* Copy "len" bytes from "offset" on out of an object's blocks */
+static void object_read (const struct cache_object *obj, size_t offset,
+                         char *dest, size_t len)
+{
+        int block = obj->first;
+        size_t n;
+
+        for (; offset >= HTTP_CACHE_BLOCK; offset -= HTTP_CACHE_BLOCK)
+                block = block_next[block];
+
+        while (len > 0) {
+                n = HTTP_CACHE_BLOCK - offset;
+                if (n > len)
+                        n = len;
+                memcpy (dest, blocks + (size_t) block * HTTP_CACHE_BLOCK
+                        + offset, n);
+                dest += n;
+                len -= n;
+                offset = 0;
+                block = block_next[block];
+        }
+}
+
+/* Is the object's URL "url"? */
+static int object_is (const struct cache_object *obj, unsigned int hash,
+                      const char *url, size_t url_len)
+{
+        int block = obj->first;
+        size_t n;
+
+        if (!obj->used || obj->hash != hash || obj->url_len != url_len)
+                return 0;
+
+        while (url_len > 0) {
+                n = url_len < HTTP_CACHE_BLOCK ? url_len : HTTP_CACHE_BLOCK;
+                if (memcmp (blocks + (size_t) block * HTTP_CACHE_BLOCK,
+                            url, n) != 0)
+                        return 0;
+                url += n;
+                url_len -= n;
+                block = block_next[block];
+        }
+        return 1;
+}
+
+/* Drop an object, giving back its blocks.  The cache must be locked. */
+static void object_remove (int index)
+{
+        struct cache_object *obj = &objects[index];
+        int *link = &buckets[obj->hash % cache->object_count];
+        int block, next;
+
+        while (*link != index)
+                link = &objects[*link].next;
+        *link = obj->next;
+
+        for (block = obj->first; block >= 0; block = next) {
+                next = block_next[block];
+                block_next[block] = cache->free_block;
+                cache->free_block = block;
+                cache->free_blocks++;
+        }
+
+        cache->stats.bytes_used -= obj->size;
+        obj->used = 0;
+        obj->next = cache->free_object;
+        cache->free_object = index;
+}
+
+/*
+ * Move the CLOCK hand on until an object is dropped.  Returns -1 if
+ * there is none to drop.  The cache must be locked.
+ */
+static int evict_one (void)
+{
+        struct cache_object *obj;
+        int i, index;
+
+        for (i = 0; i < 2 * cache->object_count; i++) {
+                index = cache->hand;
+                obj = &objects[index];
+                cache->hand = (index + 1) % cache->object_count;
+
+                if (!obj->used)
+                        continue;
+                if (obj->referenced) {
+                        obj->referenced = 0;
+                        continue;
+                }
+                object_remove (index);
+                cache->stats.evictions++;
+                return 0;
+        }
+        return -1;
+}
+
+/* Drop every stored variant of "url".  The cache must be locked. */
+static void invalidate (const char *url)
+{
+        size_t len = strlen (url);
+        unsigned int hash = hash_bytes (2166136261U, url, len);
+        int index, next;
+
+        if (cache->object_count == 0)
+                return;
+
+        for (index = buckets[hash % cache->object_count]; index >= 0;
+             index = next) {
+                next = objects[index].next;
+                if (object_is (&objects[index], hash, url, len))
+                        object_remove (index);
+        }
+}
+
+/* The two hashes naming a URL in CacheDir */
+static void disk_hash (const char *url, size_t len, unsigned int *hash)
+{
+        hash[0] = hash_bytes (2166136261U, url, len);
+        hash[1] = hash_bytes (2166136261U ^ 0x5bd1e995U, url, len);
+}
+
+static unsigned int disk_check (const struct disk_entry *entry)
+{
+        return hash_bytes (2166136261U, (const char *) &entry->generation,
+                           sizeof (struct disk_entry)
+                           - offsetof (struct disk_entry, generation));
+}
+
+static int disk_valid (const struct disk_entry *entry)
+{
+        return entry->used == 1 && entry->check == disk_check (entry);
+}
+
+/* CacheDir/ab/cd/abcdef0123456789-generation */
+static char *disk_path (const unsigned int *hash, unsigned int generation)
+{
+        size_t len = strlen (config.http_cache_dir) + 40;
+        char *path = (char *) safemalloc (len);
+
+        if (path)
+                snprintf (path, len, "%s/%02x/%02x/%08x%08x-%08x",
+                          config.http_cache_dir, (hash[0] >> 24) & 0xff,
+                          (hash[0] >> 16) & 0xff, hash[0], hash[1],
+                          generation);
+        return path;
+}
+
+/*
+ * Make the directories disk_path() puts a file of "hash" in.  They are
+ * chmod()ed as the umask would leave them unsearchable.
+ */
+static void disk_make_dirs (const unsigned int *hash)
+{
+        size_t len = strlen (config.http_cache_dir) + 8;
+        char *dir = (char *) safemalloc (len);
+
+        if (!dir)
+                return;
+        snprintf (dir, len, "%s/%02x", config.http_cache_dir,
+                  (hash[0] >> 24) & 0xff);
+        if (mkdir (dir, 0755) == 0)
+                chmod (dir, 0755);
+        snprintf (dir, len, "%s/%02x/%02x", config.http_cache_dir,
+                  (hash[0] >> 24) & 0xff, (hash[0] >> 16) & 0xff);
+        if (mkdir (dir, 0755) == 0)
+                chmod (dir, 0755);
+        safefree (dir);
+}
+
+/*
+ * Drop the entry in "slot" and its file, and move the entries after it
+ * back so that every entry can still be reached from the slot its hash
+ * names without crossing a free one.  The index must be locked.
+ */
+static void disk_remove (unsigned int slot)
+{
+        struct disk_entry *entry = &disk_entries[slot];
+        unsigned int next, home;
+        char *path;
+
+        if (disk_valid (entry)) {
+                path = disk_path (entry->hash, entry->generation);
+                if (path) {
+                        unlink (path);
+                        safefree (path);
+                }
+                disk->bytes_used -= entry->size < disk->bytes_used ?
+                        entry->size : disk->bytes_used;
+        }
+        if (disk->used > 0)
+                disk->used--;
+
+        for (next = (slot + 1) % HTTP_CACHE_DISK_SLOTS;
+             disk_entries[next].used;
+             next = (next + 1) % HTTP_CACHE_DISK_SLOTS) {
+                home = disk_entries[next].hash[0] % HTTP_CACHE_DISK_SLOTS;
+                if (slot <= next ? slot < home && home <= next
+                    : slot < home || home <= next)
+                        continue;
+                memcpy (&disk_entries[slot], &disk_entries[next],
+                        sizeof (struct disk_entry));
+                slot = next;
+        }
+        memset (&disk_entries[slot], 0, sizeof (struct disk_entry));
+}
+
+/*
+ * Drop the entries for "hash", only the variant "vary" and "vary_hash"
+ * if "vary" isn't NULL.  The index must be locked.
+ */
+static void disk_drop (const unsigned int *hash, const char *vary,
+                       unsigned int vary_hash)
+{
+        struct disk_entry *entry;
+        unsigned int slot = hash[0] % HTTP_CACHE_DISK_SLOTS;
+        unsigned int steps;
+
+        for (steps = 0; disk_entries[slot].used
+             && steps < HTTP_CACHE_DISK_SLOTS; steps++) {
+                entry = &disk_entries[slot];
+                if (!disk_valid (entry)
+                    || (entry->hash[0] == hash[0]
+                        && entry->hash[1] == hash[1]
+                        && (!vary || (strcmp (entry->vary, vary) == 0
+                                      && entry->vary_hash == vary_hash)))) {
+                        /* the next entry has moved into this slot */
+                        disk_remove (slot);
+                        continue;
+                }
+                slot = (slot + 1) % HTTP_CACHE_DISK_SLOTS;
+        }
+}
+
+/*
+ * Move the CLOCK hand over the index until an entry is dropped.  Returns
+ * -1 if there is none to drop.  The index must be locked.
+ */
+static int disk_evict_one (void)
+{
+        struct disk_entry *entry;
+        unsigned int i, slot;
+
+        for (i = 0; i < 2 * HTTP_CACHE_DISK_SLOTS; i++) {
+                slot = disk->hand;
+                entry = &disk_entries[slot];
+                disk->hand = (slot + 1) % HTTP_CACHE_DISK_SLOTS;
+
+                if (!entry->used)
+                        continue;
+                if (entry->referenced && disk_valid (entry)) {
+                        entry->referenced = 0;
+                        continue;
+                }
+                disk_remove (slot);
+                cache_lock (F_WRLCK);
+                cache->stats.evictions++;
+                cache_lock (F_UNLCK);
+                return 0;
+        }
+        return -1;
+}
+
+/*
+ * Look for a response to the request in CacheDir.  Returns 1 and fills
+ * in "hit", with the file open, and "*lifetime" if there is one, fresh
+ * or not.
+ */
+static int disk_lookup (const char *url, size_t len,
+                        hashmap_t request_headers, time_t now,
+                        struct http_cache_hit *hit, long *lifetime)
+{
+        struct disk_entry *entry, found;
+        unsigned int hash[2], slot, steps;
+        struct stat st;
+        size_t head;
+        char *path;
+        long age;
+        int fd;
+
+        disk_hash (url, len, hash);
+        slot = hash[0] % HTTP_CACHE_DISK_SLOTS;
+
+        disk_lock (F_WRLCK);
+        for (steps = 0; disk_entries[slot].used
+             && steps < HTTP_CACHE_DISK_SLOTS; steps++) {
+                entry = &disk_entries[slot];
+                if (!disk_valid (entry)) {
+                        disk_remove (slot);
+                        continue;
+                }
+                if (entry->hash[0] == hash[0] && entry->hash[1] == hash[1]
+                    && (!entry->vary[0] || entry->vary_hash
+                        == vary_hash (entry->vary, request_headers)))
+                        break;
+                slot = (slot + 1) % HTTP_CACHE_DISK_SLOTS;
+        }
+        if (!disk_entries[slot].used || steps == HTTP_CACHE_DISK_SLOTS) {
+                disk_lock (F_UNLCK);
+                return 0;
+        }
+
+        entry = &disk_entries[slot];
+        age = entry->initial_age + (long) (now - entry->stored);
+        entry->referenced = 1;
+        memcpy (&found, entry, sizeof (found));
+        disk_lock (F_UNLCK);
+
+        path = disk_path (found.hash, found.generation);
+        if (!path)
+                return 0;
+        fd = open (path, O_RDONLY);
+        safefree (path);
+        if (fd < 0)
+                return 0;
+
+        /* the URL is read to rule out two with the same hashes */
+        head = found.url_len + found.header_len;
+        if (fstat (fd, &st) < 0 || (unsigned long) st.st_size != found.size
+            || found.url_len != len || head > found.size)
+                goto fail;
+        hit->data = (char *) safemalloc (head);
+        if (!hit->data)
+                goto fail;
+        if (read (fd, hit->data, head) != (ssize_t) head
+            || memcmp (hit->data, url, len) != 0) {
+                safefree (hit->data);
+                goto fail;
+        }
+
+        memmove (hit->data, hit->data + len, found.header_len);
+        hit->header_len = found.header_len;
+        hit->len = found.size - found.url_len;
+        hit->age = age;
+        hit->fd = fd;
+        hit->offset = head;
+        *lifetime = found.lifetime;
+        return 1;
+
+fail:
+        close (fd);
+        return 0;
+}
+
+#ifdef HTTP_CACHE_FUTEX
+static void fetch_sleep (int *word, int value)
+{
+        struct timespec timeout;
+
+        timeout.tv_sec = 1;
+        timeout.tv_nsec = 0;
+        syscall (SYS_futex, word, FUTEX_WAIT, value, &timeout, NULL, 0);
+}
+
+static void fetch_wake (int *word)
+{
+        syscall (SYS_futex, word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+}
+#else
+static void fetch_sleep (int *word, int value)
+{
+        struct timeval timeout;
+
+        timeout.tv_sec = 0;
+        timeout.tv_usec = 50000;
+        select (0, NULL, NULL, NULL, &timeout);
+}
+
+static void fetch_wake (int *word)
+{
+}
+#endif
+
+static int fetch_alive (const struct cache_fetch *fetch)
+{
+        return fetch->pid != 0
+                && (kill (fetch->pid, 0) == 0 || errno == EPERM);
+}
+
+/*
+ * Find the child fetching the URL of "hash".  Returns 1 if there is one
+ * and "may_wait" is set, with its slot in "*slot" and the value to wait
+ * on in "*done".  Otherwise the slot is taken for this child, and "*slot"
+ * is -1 if there is none free.
+ */
+static int fetch_claim (unsigned int hash, int may_wait, int *slot,
+                        int *done)
+{
+        struct cache_fetch *fetch;
+        int i, idle = -1;
+
+        cache_lock (F_WRLCK);
+        for (i = 0; i < HTTP_CACHE_FETCHES; i++) {
+                fetch = &cache->fetches[i];
+                if (!fetch_alive (fetch)) {
+                        if (idle < 0)
+                                idle = i;
+                        continue;
+                }
+                if (fetch->hash != hash || fetch->pid == (int) getpid ())
+                        continue;
+                if (may_wait) {
+                        *slot = i;
+                        *done = fetch->done;
+                        cache->stats.collapsed++;
+                        cache_lock (F_UNLCK);
+                        return 1;
+                }
+                idle = -1;
+                break;
+        }
+
+        *slot = idle;
+        if (idle >= 0) {
+                cache->fetches[idle].pid = (int) getpid ();
+                cache->fetches[idle].hash = hash;
+        }
+        cache_lock (F_UNLCK);
+        return 0;
+}
+
+/* Wait until the fetch in "slot" is done, or looks like it won't be */
+static void fetch_wait (int slot, int done)
+{
+        struct cache_fetch *fetch = &cache->fetches[slot];
+        time_t until = time (NULL) + HTTP_CACHE_COLLAPSE_WAIT;
+
+        while (*(volatile int *) &fetch->done == done
+               && time (NULL) < until && fetch_alive (fetch))
+                fetch_sleep (&fetch->done, done);
+}
+
+/* Let the children waiting for the fetch in "slot" go */
+static void fetch_release (int slot)
+{
+        struct cache_fetch *fetch = &cache->fetches[slot];
+
+        cache_lock (F_WRLCK);
+        if (fetch->pid == (int) getpid ()) {
+                fetch->pid = 0;
+                fetch->done++;
+        }
+        cache_lock (F_UNLCK);
+        fetch_wake (&fetch->done);
+}
+
+/*
+ * Read the status line and headers of a stored response, "len" bytes
+ * ending with the blank line, into a new hashmap.  "*status" is set to
+ * the status code and "*status_line" to a copy of the line, which the
+ * caller frees.
+ */
+static hashmap_t parse_headers (const char *data, size_t len, int *status,
+                                char **status_line)
+{
+        hashmap_t headers;
+        char *text, *line, *end, *value;
+
+        text = (char *) safemalloc (len + 1);
+        if (!text)
+                return NULL;
+        memcpy (text, data, len);
+        text[len] = '\0';
+
+        headers = hashmap_create (32);
+        end = strstr (text, "\r\n");
+        if (!headers || !end) {
+                if (headers)
+                        hashmap_delete (headers);
+                safefree (text);
+                return NULL;
+        }
+        *end = '\0';
+        *status = 0;
+        sscanf (text, "HTTP/%*u.%*u %d", status);
+
+        for (line = end + 2; (end = strstr (line, "\r\n")) && end != line;
+             line = end + 2) {
+                *end = '\0';
+                value = strchr (line, ':');
+                if (!value)
+                        continue;
+                *value++ = '\0';
+                while (*value == ' ' || *value == '\t')
+                        value++;
+                hashmap_insert (headers, line, value, strlen (value) + 1);
+        }
+
+        *status_line = safestrdup (text);
+        safefree (text);
+        return headers;
+}
+
+/*
+ * Keep a stale entry found for a GET in the fill, with the validators
+ * to send to the server.  Entries without any are dropped.
+ */
+static void fill_stale (struct http_cache_fill *fill,
+                        struct http_cache_hit *stale)
+{
+        hashmap_t headers;
+        char *status_line, *value;
+        int status;
+
+        headers = parse_headers (stale->data, stale->header_len, &status,
+                                 &status_line);
+        if (!headers) {
+                http_cache_hit_free (stale);
+                return;
+        }
+
+        if (hashmap_entry_by_key (headers, "etag", (void **) &value) > 0
+            && strlen (value) < HTTP_CACHE_ETAG)
+                strcpy (fill->if_none_match, value);
+        if (hashmap_entry_by_key (headers, "last-modified",
+                                  (void **) &value) > 0
+            && strlen (value) < HTTP_CACHE_DATE)
+                strcpy (fill->if_modified_since, value);
+        hashmap_delete (headers);
+        safefree (status_line);
+
+        if (fill->if_none_match[0] || fill->if_modified_since[0])
+                fill->stale = *stale;
+        else
+                http_cache_hit_free (stale);
+}
+
+/*
+ * Look for a fresh response to a "method" request for "request_url" in
+ * the cache.  The URL is the absolute one, with the host, even when the
+ * request line only had the path, as for transparent and reverse
+ * proxying; it is the key in memory and on disk.  On a hit the
+ * response is copied to "hit", which the caller frees with
+ * http_cache_hit_free(), and 1 is returned.  Otherwise 0 is returned and,
+ * if the response may be stored, "*fill" is set up to collect it; the
+ * caller frees it with http_cache_fill_free().  If another child is
+ * already fetching the URL this waits for it first.
+ */
+int http_cache_lookup (const char *method, const char *request_url,
+                       hashmap_t request_headers,
+                       struct http_cache_hit *hit,
+                       struct http_cache_fill **fill)
+{
+        struct cache_object *obj;
+        struct http_cache_hit stale;
+        char *url, *value;
+        long max_age = -1, lifetime = 0;
+        unsigned int hash, hash2[2];
+        size_t len;
+        int get, index, found, lookup = 1, conditional = 0;
+        int waited = 0, slot, done;
+        time_t now;
+
+        *fill = NULL;
+        if (!cache)
+                return 0;
+
+        get = strcmp (method, "GET") == 0;
+        if (!get && strcmp (method, "HEAD") != 0) {
+                if (strcmp (method, "POST") != 0
+                    && strcmp (method, "PUT") != 0
+                    && strcmp (method, "DELETE") != 0
+                    && strcmp (method, "PATCH") != 0)
+                        return 0;
+
+                /* the response may change what the URL returns */
+                cache_lock (F_WRLCK);
+                invalidate (request_url);
+                cache_lock (F_UNLCK);
+                if (disk) {
+                        disk_hash (request_url, strlen (request_url), hash2);
+                        disk_lock (F_WRLCK);
+                        disk_drop (hash2, NULL, 0);
+                        disk_lock (F_UNLCK);
+                }
+                return 0;
+        }
+
+        if (hashmap_entry_by_key (request_headers, "authorization",
+                                  (void **) &value) > 0)
+                return 0;
+        if (hashmap_entry_by_key (request_headers, "cache-control",
+                                  (void **) &value) > 0) {
+                if (cache_directive (value, "no-store", NULL))
+                        return 0;
+                if (cache_directive (value, "no-cache", NULL))
+                        lookup = 0;
+                cache_directive (value, "max-age", &max_age);
+        } else if (hashmap_entry_by_key (request_headers, "pragma",
+                                         (void **) &value) > 0
+                   && cache_directive (value, "no-cache", NULL)) {
+                lookup = 0;
+        }
+
+        /* the client's own conditions go to the server as they are */
+        if (hashmap_entry_by_key (request_headers, "if-none-match",
+                                  (void **) &value) > 0
+            || hashmap_entry_by_key (request_headers, "if-modified-since",
+                                     (void **) &value) > 0
+            || hashmap_entry_by_key (request_headers, "if-range",
+                                     (void **) &value) > 0
+            || hashmap_entry_by_key (request_headers, "range",
+                                     (void **) &value) > 0)
+                conditional = 1;
+
+        url = safestrdup (request_url);
+        if (!url)
+                return 0;
+        len = strlen (url);
+        hash = hash_bytes (2166136261U, url, len);
+
+retry:
+        now = time (NULL);
+        found = 0;
+
+        cache_lock (F_WRLCK);
+        for (index = cache->object_count > 0 ?
+                     buckets[hash % cache->object_count] : -1;
+             index >= 0; index = obj->next) {
+                obj = &objects[index];
+                if (!object_is (obj, hash, url, len)
+                    || (obj->vary[0] && obj->vary_hash
+                        != vary_hash (obj->vary, request_headers)))
+                        continue;
+
+                hit->age = obj->initial_age + (long) (now - obj->stored);
+                lifetime = obj->lifetime;
+                hit->len = obj->size - obj->url_len;
+                hit->data = (char *) safemalloc (hit->len);
+                if (!hit->data)
+                        break;
+                object_read (obj, obj->url_len, hit->data, hit->len);
+                hit->header_len = obj->header_len;
+                hit->fd = -1;
+                obj->referenced = 1;
+                found = 1;
+                break;
+        }
+        cache_lock (F_UNLCK);
+
+        if (!found && disk)
+                found = disk_lookup (url, len, request_headers, now, hit,
+                                     &lifetime);
+
+        stale.data = NULL;
+        stale.fd = -1;
+        if (found && (!lookup || hit->age >= lifetime
+                      || (max_age >= 0 && hit->age > max_age))) {
+                /* kept to be revalidated */
+                stale = *hit;
+                found = 0;
+        }
+
+        if (found) {
+                cache_lock (F_WRLCK);
+                cache->stats.hits++;
+                if (hit->fd >= 0)
+                        cache->stats.disk_hits++;
+                cache->stats.bytes_served += hit->len;
+                cache_lock (F_UNLCK);
+                safefree (url);
+                return 1;
+        }
+
+        if (!get || conditional) {
+                http_cache_hit_free (&stale);
+                cache_lock (F_WRLCK);
+                cache->stats.misses++;
+                cache_lock (F_UNLCK);
+                safefree (url);
+                return 0;
+        }
+
+        if (fetch_claim (hash, !waited, &slot, &done)) {
+                http_cache_hit_free (&stale);
+                fetch_wait (slot, done);
+                waited = 1;
+                goto retry;
+        }
+
+        cache_lock (F_WRLCK);
+        cache->stats.misses++;
+        cache_lock (F_UNLCK);
+
+        *fill = (struct http_cache_fill *)
+                safecalloc (1, sizeof (struct http_cache_fill));
+        if (!*fill) {
+                if (slot >= 0)
+                        fetch_release (slot);
+                http_cache_hit_free (&stale);
+                safefree (url);
+                return 0;
+        }
+        (*fill)->url = url;
+        (*fill)->url_len = len;
+        (*fill)->request_headers = request_headers;
+        (*fill)->request_time = now;
+        (*fill)->fetch = slot;
+        (*fill)->stale.fd = -1;
+        if (stale.data)
+                fill_stale (*fill, &stale);
+        return 0;
+}
+
+/*
+ * The validators of the stale entry the fill revalidates, to be sent
+ * with the request to the server.  Returns 0 if there is none.
+ */
+int http_cache_validators (const struct http_cache_fill *fill,
+                           const char **if_none_match,
+                           const char **if_modified_since)
+{
+        if (!fill->stale.data)
+                return 0;
+        *if_none_match = fill->if_none_match[0] ? fill->if_none_match : NULL;
+        *if_modified_since = fill->if_modified_since[0] ?
+                fill->if_modified_since : NULL;
+        return 1;
+}
+
+static int fill_add (struct http_cache_fill *fill, const char *data,
+                     size_t len)
+{
+        size_t size;
+        char *p;
+
+        if (fill->len + len > fill->size) {
+                size = fill->size ? fill->size : READ_BUFFER_SIZE;
+                while (size < fill->len + len)
+                        size *= 2;
+                p = (char *) saferealloc (fill->data, size);
+                if (!p)
+                        return -1;
+                fill->data = p;
+                fill->size = size;
+        }
+        memcpy (fill->data + fill->len, data, len);
+        fill->len += len;
+        return 0;
+}
+
+/* Lower case the names in a Vary header and drop the blanks */
+static int vary_names (const char *value, char *names)
+{
+        size_t len = 0;
+
+        for (; *value; value++) {
+                if (*value == ' ' || *value == '\t')
+                        continue;
+                if (len + 1 >= HTTP_CACHE_VARY)
+                        return -1;
+                names[len++] = (char) tolower ((unsigned char) *value);
+        }
+        names[len] = '\0';
+        return 0;
+}
+
+/*
+ * Decide from the status and headers of a response whether it may be
+ * stored, and how long it stays fresh.  Returns 0 if it may, -1 if not.
+ */
+static int response_storable (struct http_cache_fill *fill, int status,
+                              hashmap_t response_headers)
+{
+        char *cc = NULL, *value;
+        long max_age = -1, s_maxage = -1, lifetime = -1, age = 0;
+        long apparent, corrected;
+        time_t now = time (NULL), date, when;
+        int heuristic;
+
+        switch (status) {
+        case 200: case 203: case 300: case 301: case 404: case 405:
+        case 410: case 414: case 501:
+                heuristic = 1;
+                break;
+        default:
+                heuristic = 0;
+                if (status < 200 || status == 206 || status == 304)
+                        return -1;
+        }
+
+        if (hashmap_entry_by_key (response_headers, "cache-control",
+                                  (void **) &cc) > 0) {
+                if (cache_directive (cc, "no-store", NULL)
+                    || cache_directive (cc, "no-cache", NULL)
+                    || cache_directive (cc, "private", NULL))
+                        return -1;
+                cache_directive (cc, "s-maxage", &s_maxage);
+                cache_directive (cc, "max-age", &max_age);
+        } else if (hashmap_entry_by_key (response_headers, "pragma",
+                                         (void **) &value) > 0
+                   && cache_directive (value, "no-cache", NULL)) {
+                return -1;
+        }
+
+        /* whose cookie would the next client get? */
+        if (hashmap_entry_by_key (response_headers, "set-cookie",
+                                  (void **) &value) > 0
+            || hashmap_entry_by_key (response_headers, "transfer-encoding",
+                                     (void **) &value) > 0)
+                return -1;
+
+        if (hashmap_entry_by_key (response_headers, "content-length",
+                                  (void **) &value) <= 0)
+                return -1;
+        fill->expected = strtol (value, NULL, 10);
+        if (fill->expected < 0
+            || fill->expected > (long) config.http_cache_max_object)
+                return -1;
+
+        if (hashmap_entry_by_key (response_headers, "vary",
+                                  (void **) &value) > 0
+            && (strchr (value, '*') || vary_names (value, fill->vary) < 0))
+                return -1;
+
+        date = -1;
+        if (hashmap_entry_by_key (response_headers, "date",
+                                  (void **) &value) > 0)
+                date = parse_http_date (value);
+        if (date < 0)
+                date = now;
+
+        if (s_maxage >= 0)
+                lifetime = s_maxage;
+        else if (max_age >= 0)
+                lifetime = max_age;
+        else if (hashmap_entry_by_key (response_headers, "expires",
+                                       (void **) &value) > 0)
+                lifetime = (when = parse_http_date (value)) < 0 ?
+                        0 : (long) (when - date);
+        else if (heuristic
+                 && hashmap_entry_by_key (response_headers, "last-modified",
+                                          (void **) &value) > 0
+                 && (when = parse_http_date (value)) >= 0 && when < date) {
+                lifetime = (long) (date - when) / 10;
+                if (lifetime > HTTP_CACHE_HEURISTIC_MAX)
+                        lifetime = HTTP_CACHE_HEURISTIC_MAX;
+        }
+
+        /* RFC 7234, section 4.2.3 */
+        if (hashmap_entry_by_key (response_headers, "age",
+                                  (void **) &value) > 0)
+                age = strtol (value, NULL, 10);
+        apparent = now > date ? (long) (now - date) : 0;
+        corrected = (age > 0 ? age : 0) + (long) (now - fill->request_time);
+        fill->initial_age = apparent > corrected ? apparent : corrected;
+
+        if (lifetime <= fill->initial_age)
+                return -1;
+
+        if (hashmap_entry_by_key (response_headers, "etag",
+                                  (void **) &value) > 0
+            && strlen (value) < HTTP_CACHE_ETAG)
+                strcpy (fill->etag, value);
+        fill->lifetime = lifetime;
+        fill->stored = now;
+        return 0;
+}
+
+/*
+ * Decide whether the response to the request of the fill may be stored.
+ * Returns 0 if it may, -1 if it may not, in which case the caller drops
+ * the fill.  A 304 to a revalidation is handled by
+ * http_cache_not_modified() instead.
+ */
+int http_cache_response (struct http_cache_fill *fill,
+                         const char *response_line, int status,
+                         hashmap_t response_headers)
+{
+        /* a newer response replaces the stale entry */
+        http_cache_hit_free (&fill->stale);
+
+        if (response_storable (fill, status, response_headers) < 0
+            || fill_add (fill, fill->url, fill->url_len) < 0
+            || fill_add (fill, response_line, strlen (response_line)) < 0
+            || fill_add (fill, "\r\n", 2) < 0)
+                return -1;
+        fill->ready = 1;
+        return 0;
+}
+
+/*
+ * Keep a header as it was sent to the client.  Age is left out, as it
+ * is worked out again for every hit.
+ */
+int http_cache_add_header (struct http_cache_fill *fill, const char *name,
+                           const char *value)
+{
+        if (!fill->ready || strcasecmp (name, "age") == 0)
+                return 0;
+
+        if (fill_add (fill, name, strlen (name)) < 0
+            || fill_add (fill, ": ", 2) < 0
+            || fill_add (fill, value, strlen (value)) < 0
+            || fill_add (fill, "\r\n", 2) < 0)
+                return -1;
+        return 0;
+}
+
+static int end_headers (struct http_cache_fill *fill)
+{
+        if (fill->header_len > 0)
+                return 0;
+        if (fill_add (fill, "\r\n", 2) < 0)
+                return -1;
+        fill->header_len = fill->len - fill->url_len;
+        return 0;
+}
+
+/*
+ * Keep the next part of the body.  Returns -1 if the response can't be
+ * stored after all.
+ */
+int http_cache_add_body (struct http_cache_fill *fill, const char *data,
+                         size_t len)
+{
+        if (!fill->ready || end_headers (fill) < 0)
+                return -1;
+        if (fill->len - fill->url_len - fill->header_len + len
+            > (size_t) fill->expected)
+                return -1;
+        return fill_add (fill, data, len);
+}
+
+/* Add the body of the stale entry to the fill */
+static int fill_add_stale_body (struct http_cache_fill *fill)
+{
+        const struct http_cache_hit *stale = &fill->stale;
+        char buffer[READ_BUFFER_SIZE];
+        size_t left = stale->len - stale->header_len;
+        ssize_t n;
+
+        if (stale->fd < 0)
+                return fill_add (fill, stale->data + stale->header_len,
+                                 left);
+
+        if (lseek (stale->fd, (off_t) stale->offset, SEEK_SET) < 0)
+                return -1;
+        while (left > 0) {
+                n = safe_read (stale->fd, buffer, left < sizeof (buffer) ?
+                               left : sizeof (buffer));
+                if (n <= 0 || fill_add (fill, buffer, n) < 0)
+                        return -1;
+                left -= n;
+        }
+        return 0;
+}
+
+/*
+ * The server answered the revalidation of the stale entry with 304 Not
+ * Modified.  Update the entry with the headers of the 304 that describe
+ * it (RFC 7234, section 4.3.4), store it again if it still may be, and
+ * return it in "hit" to be sent to the client, freed with
+ * http_cache_hit_free().  Returns 1 if it is there, 0 if the fill was
+ * not revalidating anything.
+ */
+int http_cache_not_modified (struct http_cache_fill *fill,
+                             hashmap_t response_headers,
+                             struct http_cache_hit *hit)
+{
+        static const char *updated[] = {
+                "Cache-Control", "Content-Location", "Date", "ETag",
+                "Expires", "Last-Modified"
+        };
+        hashmap_t headers;
+        hashmap_iter iter;
+        char *status_line, *name, *value;
+        int status, storable;
+        size_t i;
+
+        if (!fill->stale.data)
+                return 0;
+
+        headers = parse_headers (fill->stale.data, fill->stale.header_len,
+                                 &status, &status_line);
+        if (!headers)
+                return 0;
+
+        for (i = 0; i != sizeof (updated) / sizeof (updated[0]); i++) {
+                if (hashmap_entry_by_key (response_headers, updated[i],
+                                          (void **) &value) <= 0)
+                        continue;
+                hashmap_remove (headers, updated[i]);
+                hashmap_insert (headers, updated[i], value,
+                                strlen (value) + 1);
+        }
+
+        fill->len = 0;
+        fill->header_len = 0;
+        fill->vary[0] = '\0';
+        fill->etag[0] = '\0';
+        storable = response_storable (fill, status, headers) == 0;
+
+        fill->ready = 0;
+        if (fill_add (fill, fill->url, fill->url_len) < 0
+            || fill_add (fill, status_line, strlen (status_line)) < 0
+            || fill_add (fill, "\r\n", 2) < 0)
+                goto fail;
+        fill->ready = 1;
+        for (iter = hashmap_first (headers);
+             iter >= 0 && !hashmap_is_end (headers, iter); ++iter) {
+                hashmap_return_entry (headers, iter, &name, (void **) &value);
+                if (http_cache_add_header (fill, name, value) < 0)
+                        goto fail;
+        }
+        if (end_headers (fill) < 0 || fill_add_stale_body (fill) < 0)
+                goto fail;
+
+        if (storable)
+                http_cache_store (fill);
+
+        cache_lock (F_WRLCK);
+        cache->stats.revalidated++;
+        cache_lock (F_UNLCK);
+
+        /* the fill's buffer, less the URL, is the hit */
+        memmove (fill->data, fill->data + fill->url_len,
+                 fill->len - fill->url_len);
+        hit->data = fill->data;
+        hit->header_len = fill->header_len;
+        hit->len = fill->len - fill->url_len;
+        hit->age = storable ? fill->initial_age : 0;
+        hit->fd = -1;
+        fill->data = NULL;
+        fill->len = fill->size = 0;
+        fill->ready = 0;
+
+        hashmap_delete (headers);
+        safefree (status_line);
+        return 1;
+
+fail:
+        fill->ready = 0;
+        hashmap_delete (headers);
+        safefree (status_line);
+        return 0;
+}
+
+/* Copy a response into the blocks of memory */
+static void memory_store (const struct http_cache_fill *fill,
+                          unsigned int vary)
+{
+        struct cache_object *obj;
+        int needed, index, next, block, *link;
+        size_t offset, n;
+        unsigned int hash;
+
+        needed = (int) ((fill->len + HTTP_CACHE_BLOCK - 1)
+                        / HTTP_CACHE_BLOCK);
+        if (needed > cache->block_count / 2)
+                return;
+
+        hash = hash_bytes (2166136261U, fill->url, fill->url_len);
+
+        cache_lock (F_WRLCK);
+
+        /* replace the variant this response is for */
+        for (index = buckets[hash % cache->object_count]; index >= 0;
+             index = next) {
+                obj = &objects[index];
+                next = obj->next;
+                if (object_is (obj, hash, fill->url, fill->url_len)
+                    && strcmp (obj->vary, fill->vary) == 0
+                    && obj->vary_hash == vary)
+                        object_remove (index);
+        }
+
+        while (cache->free_blocks < needed || cache->free_object < 0) {
+                if (evict_one () < 0) {
+                        cache_lock (F_UNLCK);
+                        return;
+                }
+        }
+
+        index = cache->free_object;
+        obj = &objects[index];
+        cache->free_object = obj->next;
+
+        /* take the blocks off the free list, copying as we go */
+        link = &obj->first;
+        for (offset = 0; offset < fill->len; offset += n) {
+                block = cache->free_block;
+                cache->free_block = block_next[block];
+                cache->free_blocks--;
+                *link = block;
+                link = &block_next[block];
+
+                n = fill->len - offset;
+                if (n > HTTP_CACHE_BLOCK)
+                        n = HTTP_CACHE_BLOCK;
+                memcpy (blocks + (size_t) block * HTTP_CACHE_BLOCK,
+                        fill->data + offset, n);
+        }
+        *link = -1;
+
+        obj->used = 1;
+        obj->referenced = 0;
+        obj->hash = hash;
+        obj->url_len = fill->url_len;
+        obj->header_len = fill->header_len;
+        obj->size = fill->len;
+        obj->stored = fill->stored;
+        obj->initial_age = fill->initial_age;
+        obj->lifetime = fill->lifetime;
+        obj->vary_hash = vary;
+        strcpy (obj->vary, fill->vary);
+
+        obj->next = buckets[hash % cache->object_count];
+        buckets[hash % cache->object_count] = index;
+
+        cache->stats.bytes_used += fill->len;
+        cache_lock (F_UNLCK);
+}
+
+/*
+ * Write a response to a new file in CacheDir and add it to the index.
+ * The file is complete before the index names it.
+ */
+static void disk_store (const struct http_cache_fill *fill,
+                        unsigned int vary)
+{
+        struct disk_entry entry;
+        unsigned int slot;
+        char *path, *tmp;
+        size_t len;
+        int fd;
+
+        if (fill->len > config.http_cache_dir_size / 2)
+                return;
+
+        memset (&entry, 0, sizeof (entry));
+        entry.used = 1;
+        disk_hash (fill->url, fill->url_len, entry.hash);
+        entry.vary_hash = vary;
+        entry.url_len = fill->url_len;
+        entry.header_len = fill->header_len;
+        entry.size = fill->len;
+        entry.stored = (long) fill->stored;
+        entry.initial_age = fill->initial_age;
+        entry.lifetime = fill->lifetime;
+        strcpy (entry.vary, fill->vary);
+        strcpy (entry.etag, fill->etag);
+
+        disk_lock (F_WRLCK);
+        entry.generation = ++disk->generation;
+        disk_lock (F_UNLCK);
+
+        path = disk_path (entry.hash, entry.generation);
+        if (!path)
+                return;
+        len = strlen (path) + 8;
+        tmp = (char *) safemalloc (len);
+        if (!tmp) {
+                safefree (path);
+                return;
+        }
+        snprintf (tmp, len, "%s.XXXXXX", path);
+
+        disk_make_dirs (entry.hash);
+        fd = mkstemp (tmp);
+        if (fd < 0) {
+                log_message (LOG_WARNING,
+                             "Could not write to CacheDir \"%s\": %s",
+                             config.http_cache_dir, strerror (errno));
+                goto done;
+        }
+        if (write (fd, fill->data, fill->len) != (ssize_t) fill->len
+            || fchmod (fd, 0644) < 0 || rename (tmp, path) < 0) {
+                log_message (LOG_WARNING, "Could not write \"%s\": %s",
+                             path, strerror (errno));
+                unlink (tmp);
+                close (fd);
+                goto done;
+        }
+        close (fd);
+
+        disk_lock (F_WRLCK);
+        disk_drop (entry.hash, entry.vary, entry.vary_hash);
+        while (disk->used >= HTTP_CACHE_DISK_SLOTS / 4 * 3
+               || disk->bytes_used + fill->len > config.http_cache_dir_size) {
+                if (disk_evict_one () < 0) {
+                        disk_lock (F_UNLCK);
+                        unlink (path);
+                        goto done;
+                }
+        }
+
+        for (slot = entry.hash[0] % HTTP_CACHE_DISK_SLOTS;
+             disk_entries[slot].used;
+             slot = (slot + 1) % HTTP_CACHE_DISK_SLOTS)
+                ;
+        entry.check = disk_check (&entry);
+        memcpy (&disk_entries[slot], &entry, sizeof (entry));
+        disk->used++;
+        disk->bytes_used += fill->len;
+        disk_lock (F_UNLCK);
+
+done:
+        safefree (tmp);
+        safefree (path);
+}
+
+/* Store a response whose body has been read completely */
+void http_cache_store (struct http_cache_fill *fill)
+{
+        unsigned int vary;
+
+        if (!cache || !fill->ready || end_headers (fill) < 0
+            || fill->len - fill->url_len - fill->header_len
+            != (size_t) fill->expected)
+                return;
+
+        vary = fill->vary[0] ? vary_hash (fill->vary,
+                                          fill->request_headers) : 0;
+
+        if (cache->object_count > 0)
+                memory_store (fill, vary);
+        if (disk)
+                disk_store (fill, vary);
+
+        cache_lock (F_WRLCK);
+        cache->stats.stores++;
+        cache_lock (F_UNLCK);
+
+        if (fill->fetch >= 0) {
+                fetch_release (fill->fetch);
+                fill->fetch = -1;
+        }
+}
+
+void http_cache_fill_free (struct http_cache_fill *fill)
+{
+        if (!fill)
+                return;
+        if (fill->fetch >= 0)
+                fetch_release (fill->fetch);
+        http_cache_hit_free (&fill->stale);
+        safefree (fill->url);
+        safefree (fill->data);
+        safefree (fill);
+}
+
+/* Release the copy or the open CacheDir file of a hit */
+void http_cache_hit_free (struct http_cache_hit *hit)
+{
+        safefree (hit->data);
+        if (hit->fd >= 0)
+                close (hit->fd);
+        hit->fd = -1;
+}
+
+void http_cache_stats (struct http_cache_stats *stats)
+{
+        if (!cache) {
+                memset (stats, 0, sizeof (*stats));
+                return;
+        }
+
+        cache_lock (F_RDLCK);
+        *stats = cache->stats;
+        cache_lock (F_UNLCK);
+
+        if (disk) {
+                disk_lock (F_RDLCK);
+                stats->disk_bytes_used = disk->bytes_used;
+                disk_lock (F_UNLCK);
+        }
+}
@@ -0,0 +1,85 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'http-cache.c' for detailed information. */
+
+#ifndef _TINYPROXY_HTTP_CACHE_H_
+#define _TINYPROXY_HTTP_CACHE_H_
+
+#include "common.h"
+#include "hashmap.h"
+
+/* Largest response kept by the response cache by default. */
+#define HTTP_CACHE_MAX_OBJECT (1024 * 1024)
+
+/* Bytes of responses kept in CacheDir by default */
+#define HTTP_CACHE_DIR_SIZE (1024 * 1024 * 1024)
+
+struct http_cache_stats {
+        unsigned long hits;             /* served from the cache */
+        unsigned long disk_hits;        /* of those, from CacheDir */
+        unsigned long misses;           /* cacheable, but sent upstream */
+        unsigned long revalidated;      /* stale, but the server said 304 */
+        unsigned long collapsed;        /* waited for another child's fetch */
+        unsigned long stores;           /* responses added */
+        unsigned long evictions;        /* dropped to make room */
+        unsigned long bytes_served;     /* sent from the cache */
+        unsigned long bytes_used;       /* held in the cache now */
+        unsigned long disk_bytes_used;  /* held in CacheDir now */
+};
+
+/*
+ * A response found in the cache.  Of one found in CacheDir only the
+ * headers are read, and the body is sent from "fd".
+ */
+struct http_cache_hit {
+        char *data;             /* status line and headers, then the body */
+        size_t header_len;      /* up to and including the blank line */
+        size_t len;             /* of the headers and body */
+        long age;               /* seconds, for the Age header */
+        int fd;                 /* the file, or -1 */
+        size_t offset;          /* of the body in the file */
+};
+
+/* A response being read from the server to be stored */
+struct http_cache_fill;
+
+extern int http_cache_init (void);
+extern int http_cache_disk_init (void);
+extern int http_cache_lookup (const char *method, const char *request_url,
+                              hashmap_t request_headers,
+                              struct http_cache_hit *hit,
+                              struct http_cache_fill **fill);
+extern int http_cache_validators (const struct http_cache_fill *fill,
+                                  const char **if_none_match,
+                                  const char **if_modified_since);
+extern int http_cache_response (struct http_cache_fill *fill,
+                                const char *response_line, int status,
+                                hashmap_t response_headers);
+extern int http_cache_not_modified (struct http_cache_fill *fill,
+                                    hashmap_t response_headers,
+                                    struct http_cache_hit *hit);
+extern int http_cache_add_header (struct http_cache_fill *fill,
+                                  const char *name, const char *value);
+extern int http_cache_add_body (struct http_cache_fill *fill,
+                                const char *data, size_t len);
+extern void http_cache_store (struct http_cache_fill *fill);
+extern void http_cache_hit_free (struct http_cache_hit *hit);
+extern void http_cache_fill_free (struct http_cache_fill *fill);
+extern void http_cache_stats (struct http_cache_stats *stats);
+
+#endif /* _TINYPROXY_HTTP_CACHE_H_ */
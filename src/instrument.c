@@ -0,0 +1,923 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Selects the responses whose JavaScript body gets profiling code
+ * inserted (see js.c) and runs the instrumenter over them.  A response
+ * is selected when its Content-Type matches one of the
+ * InstrumentContentType patterns or its URL matches one of the
+ * InstrumentURL patterns.  With "InstrumentMode timing" the inserted
+ * code reports its measurements to PROFILE_PATH on the StatHost (see
+ * profile.c).  With InstrumentSourceMap each rewritten script ends
+ * with a link to its source map under SOURCEMAP_PATH on the StatHost.
+ *
+ * Not every function of a selected script has to get probes: the
+ * InstrumentFunction and InstrumentSkipFunction patterns are matched
+ * against function names, InstrumentMinBodySize leaves out small
+ * bodies, InstrumentSample keeps a share of the functions of matching
+ * URLs, and InstrumentHotThreshold keeps only the functions that the
+ * profile shows to be expensive.
+ */
+
+#include "main.h"
+
+#include "instrument.h"
+#include "conf.h"
+#include "heap.h"
+#include "http-message.h"
+#include "js.h"
+#include "log.h"
+#include "profile.h"
+#include "utils.h"
+
+/*
+ * A compiled pattern, with its text kept for the cache key and the
+ * percentage given to InstrumentSample.
+ */
+struct instrument_pattern {
+        regex_t re;
+        int percent;
+        char text[1];
+};
+
+/*
+ * Compile "pattern" and add it to the list, creating the list if needed.
+ * Returns 0 on success, -1 if the pattern is not a valid regular
+ * expression.
+ */
+int instrument_add_sample (vector_t *patterns, const char *pattern,
+                           int percent)
+{
+        struct instrument_pattern *entry;
+        size_t size = sizeof (*entry) + strlen (pattern);
+        int ret;
+
+        entry = (struct instrument_pattern *) safemalloc (size);
+        if (!entry)
+                return -1;
+
+        ret = regcomp (&entry->re, pattern,
+                       REG_EXTENDED | REG_ICASE | REG_NOSUB);
+        if (ret != 0) {
+                log_message (LOG_ERR,
+                             "Bad instrumentation pattern \"%s\"", pattern);
+                safefree (entry);
+                return -1;
+        }
+        entry->percent = percent;
+        strcpy (entry->text, pattern);
+
+        if (!*patterns) {
+                *patterns = vector_create ();
+                if (!*patterns) {
+                        regfree (&entry->re);
+                        safefree (entry);
+                        return -1;
+                }
+        }
+
+        /* the vector keeps its own copy */
+        vector_append (*patterns, entry, size);
+        safefree (entry);
+        return 0;
+}
+
+int instrument_add_pattern (vector_t *patterns, const char *pattern)
+{
+        return instrument_add_sample (patterns, pattern, 100);
+}
+
+void instrument_free_patterns (vector_t patterns)
+{
+        struct instrument_pattern *entry;
+        ssize_t i;
+
+        for (i = 0; i < vector_length (patterns); i++) {
+                entry = (struct instrument_pattern *)
+                        vector_getentry (patterns, i, NULL);
+                regfree (&entry->re);
+        }
+
+        vector_delete (patterns);
+}
+
+/*
+ * The first pattern in the list that matches "str", or NULL.
+ */
+static struct instrument_pattern *match_first (vector_t patterns,
+                                               const char *str)
+{
+        struct instrument_pattern *entry;
+        ssize_t i;
+
+        for (i = 0; i < vector_length (patterns); i++) {
+                entry = (struct instrument_pattern *)
+                        vector_getentry (patterns, i, NULL);
+
+                if (regexec (&entry->re, str, 0, NULL, 0) == 0)
+                        return entry;
+        }
+
+        return NULL;
+}
+
+static int match_any (vector_t patterns, const char *str)
+{
+        return match_first (patterns, str) != NULL;
+}
+
+/*
+ * Decide whether the response to "request_line" with the given
+ * Content-Type (which may be NULL) should be instrumented.
+ */
+int instrument_wanted (const char *request_line, const char *content_type)
+{
+        char *url;
+        int ret;
+
+        if (content_type && match_any (config.instrument_types, content_type))
+                return 1;
+
+        if (vector_length (config.instrument_urls) <= 0)
+                return 0;
+
+        url = request_url (request_line);
+        if (!url)
+                return 0;
+
+        ret = match_any (config.instrument_urls, url);
+        safefree (url);
+        return ret;
+}
+
+static unsigned int hash_string (unsigned int h, const char *str)
+{
+        for (; *str; ++str)
+                h = (h ^ (unsigned char) *str) * 16777619U;
+        return h & 0xffffffffU;
+}
+
+/* The filter for InstrumentFunction and InstrumentSkipFunction */
+static int function_allowed (const char *name, void *data)
+{
+        (void) data;
+
+        if (vector_length (config.instrument_functions) > 0
+            && !match_any (config.instrument_functions, name))
+                return 0;
+
+        return !match_any (config.instrument_skip_functions, name);
+}
+
+/*
+ * Choose which functions of the script requested by "request_line" get
+ * probes and fill in the selection fields of "options".  A hot list
+ * taken from the profile is left in "*hot", which the caller releases
+ * with safefree() once the options have been used.  Returns a hash of
+ * the choices for the cache key, 0 if every function is instrumented.
+ */
+static unsigned int instrument_select (JsOptions *options,
+                                       const char *request_line,
+                                       char ***hot)
+{
+        struct instrument_pattern *sample;
+        unsigned int h = 2166136261U, names = 0;
+        char buf[64];
+        char *url = NULL;
+        ssize_t i;
+        int count;
+
+        *hot = NULL;
+        if (vector_length (config.instrument_samples) > 0
+            || config.instrument_hot_threshold > 0)
+                url = request_url (request_line);
+
+        if (vector_length (config.instrument_functions) > 0
+            || vector_length (config.instrument_skip_functions) > 0) {
+                options->filter = function_allowed;
+                for (i = 0; i < vector_length (config.instrument_functions);
+                     i++) {
+                        sample = (struct instrument_pattern *)
+                                vector_getentry (config.instrument_functions,
+                                                 i, NULL);
+                        h = hash_string (hash_string (h, "+"), sample->text);
+                }
+                for (i = 0;
+                     i < vector_length (config.instrument_skip_functions);
+                     i++) {
+                        sample = (struct instrument_pattern *)
+                                vector_getentry (config.
+                                                 instrument_skip_functions,
+                                                 i, NULL);
+                        h = hash_string (hash_string (h, "-"), sample->text);
+                }
+        }
+
+        if (config.instrument_min_body > 0)
+                options->min_body = (int) config.instrument_min_body;
+
+        sample = url ? match_first (config.instrument_samples, url) : NULL;
+        if (sample && sample->percent < 100)
+                options->sample = sample->percent;
+
+        if (url && config.instrument_hot_threshold > 0
+            && profile_hot_functions (url, config.instrument_hot_threshold,
+                                      hot, &count) == 0) {
+                options->only = (const char *const *) *hot;
+                options->only_count = count;
+                /* the table is in no particular order */
+                for (i = 0; i < count; i++)
+                        names += hash_string (2166136261U, (*hot)[i]);
+        }
+        safefree (url);
+
+        if (!options->filter && !options->min_body && !options->sample
+            && !options->only)
+                return 0;
+
+        snprintf (buf, sizeof (buf), " %d %d %u %x", options->min_body,
+                  options->sample, config.instrument_hot_threshold, names);
+        return hash_string (h, buf) | 1;
+}
+
+/*
+ * Fill in the js.c options for the configured InstrumentMode, with every
+ * function selected.  In timing mode "endpoint" (of "size" bytes)
+ * receives the URL the measurements are sent to; the caller still has to
+ * set the tag that tells the scripts on a page apart.
+ */
+static void instrument_options (JsOptions *options, char *endpoint,
+                                size_t size)
+{
+        memset (options, 0, sizeof (*options));
+        options->mode = config.instrument_mode == INSTRUMENT_MODE_TIMING ?
+                JS_PROFILE_TIMING : JS_PROFILE_LOG;
+        options->source_map = config.instrument_source_map
+                && config.stathost != NULL;
+        if (config.stathost) {
+                snprintf (endpoint, size, "http://%s%s", config.stathost,
+                          PROFILE_PATH);
+                options->endpoint = endpoint;
+        }
+}
+
+static int instrument_tagged (char *body, size_t len,
+                              const JsOptions *options,
+                              const char *request_line,
+                              char **new_body, size_t *new_len)
+{
+        JsStream *js;
+        char *out, *link;
+        int out_len;
+        size_t link_len;
+
+        /* js.c works with int offsets */
+        if ((int) len < 0)
+                return -1;
+
+        if (!options->source_map) {
+                if (insert_profile_codes (options, body, (int) len,
+                                          new_body, &out_len) < 0)
+                        return -1;
+
+                *new_len = (size_t) out_len;
+                return 0;
+        }
+
+        js = js_stream_new (options);
+        if (!js)
+                return -1;
+        if (js_stream_feed (js, body, (int) len, 1, &out, &out_len) < 0) {
+                js_stream_free (js);
+                return -1;
+        }
+
+        link = instrument_map_link (js, request_line);
+        link_len = link ? strlen (link) : 0;
+
+        /* allocated like the bodies made by js.c */
+        *new_body = (char *) malloc (out_len + link_len + 1);
+        if (*new_body) {
+                memcpy (*new_body, out, out_len);
+                if (link)
+                        memcpy (*new_body + out_len, link, link_len);
+                *new_len = out_len + link_len;
+        }
+        safefree (link);
+        js_stream_free (js);
+
+        return *new_body ? 0 : -1;
+}
+
+/*
+ * Insert the profiling code into "body", the response to
+ * "request_line".  On success the rewritten body is stored in
+ * "new_body", which the caller releases with free(), and 0 is returned.
+ */
+int instrument_body (char *body, size_t len, const char *request_line,
+                     char **new_body, size_t *new_len)
+{
+        unsigned int h = 2166136261U;
+        JsOptions options;
+        char endpoint[256];
+        char tag[16];
+        char **hot;
+        size_t i;
+        int ret;
+
+        for (i = 0; i != len; ++i)
+                h = (h ^ (unsigned char) body[i]) * 16777619U;
+        snprintf (tag, sizeof (tag), "%08x", h & 0xffffffffU);
+
+        instrument_options (&options, endpoint, sizeof (endpoint));
+        instrument_select (&options, request_line, &hot);
+        options.tag = tag;
+
+        ret = instrument_tagged (body, len, &options, request_line,
+                                 new_body, new_len);
+        safefree (hot);
+        return ret;
+}
+
+/*
+ * Start instrumenting a body that is relayed as it arrives.  Its tag
+ * can't be taken from the body, so it is made unique to this child and
+ * request instead.  Returns NULL if out of memory.
+ */
+JsStream *instrument_stream_new (const char *request_line)
+{
+        static unsigned int count = 0;
+        JsOptions options;
+        JsStream *js;
+        char endpoint[256];
+        char tag[32];
+        char **hot;
+
+        snprintf (tag, sizeof (tag), "%lx%lxs%x", (unsigned long) getpid (),
+                  (unsigned long) time (NULL), ++count);
+        instrument_options (&options, endpoint, sizeof (endpoint));
+        instrument_select (&options, request_line, &hot);
+        options.tag = tag;
+
+        /* js.c keeps its own copy of the hot list */
+        js = js_stream_new (&options);
+        safefree (hot);
+        return js;
+}
+
+/*
+ * Cache of instrumented bodies, shared by all the children so that each
+ * version of a script is parsed once no matter which child fetches it.
+ * Entries are keyed by a hash of the original body and the
+ * instrumentation options.  The instrumented bodies are stored one after
+ * another in a ring; storing a new body drops the entries it overwrites.
+ *
+ * With InstrumentCacheDir set every new entry is also written to disk,
+ * where it is found again after it has been dropped from memory or the
+ * proxy has been restarted.
+ */
+#define INSTRUMENT_CACHE_SETS 256
+#define INSTRUMENT_CACHE_WAYS 4
+
+/*
+ * Hashed into every key.  Change it whenever the inserted code changes,
+ * so that bodies instrumented by an older version are not served from
+ * the disk cache.
+ */
+#define INSTRUMENT_OPTIONS "profile-2"
+
+struct cache_key {
+        unsigned int hash[2];
+        size_t len;                     /* of the original body */
+};
+
+struct cache_entry {
+        struct cache_key key;
+        size_t offset;                  /* of the instrumented body */
+        size_t size;
+        unsigned long used;             /* clock of the last use, 0 if free */
+};
+
+struct instrument_cache {
+        size_t ring_size;
+        size_t head;                    /* where the next body goes */
+        unsigned long clock;
+        struct instrument_cache_stats stats;
+        struct cache_entry entries[INSTRUMENT_CACHE_SETS *
+                                   INSTRUMENT_CACHE_WAYS];
+};
+
+static struct instrument_cache *cache = NULL;
+static char *ring = NULL;
+static int cache_lock_fd = -1;
+
+static void cache_lock (short type)
+{
+        struct flock lock;
+
+        lock.l_type = type;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = 0;
+        lock.l_len = 0;
+
+        while (fcntl (cache_lock_fd, F_SETLKW, &lock) < 0) {
+                if (errno != EINTR)
+                        return;
+        }
+}
+
+/*
+ * Set up the shared cache.  This has to be done before the children
+ * are created; a cache size changed by a reload only takes effect on
+ * restart.
+ */
+int instrument_cache_init (void)
+{
+        char lock_file[] = "/tmp/tinyproxy.instrument.lock.XXXXXX";
+        size_t ring_size = config.instrument_cache_size;
+        void *mem;
+
+        if (!config.instrument_types && !config.instrument_urls)
+                return 0;
+
+        mem = malloc_shared_memory (sizeof (struct instrument_cache)
+                                    + ring_size);
+        if (mem == MAP_FAILED)
+                return -1;
+
+        cache_lock_fd = mkstemp (lock_file);
+        if (cache_lock_fd < 0)
+                return -1;
+        unlink (lock_file);
+
+        cache = (struct instrument_cache *) mem;
+        memset (cache, 0, sizeof (struct instrument_cache));
+        cache->ring_size = ring_size;
+        ring = (char *) mem + sizeof (struct instrument_cache);
+
+        return 0;
+}
+
+/*
+ * Two 32 bit FNV-1a hashes with different offset bases, computed in
+ * the same pass, so that a collision needs both to collide for a body
+ * of the same length.
+ */
+static void cache_key_make (const char *body, size_t len,
+                            unsigned int policy, struct cache_key *key)
+{
+        char timing[256];
+        const char *options = INSTRUMENT_OPTIONS;
+        unsigned int h1 = 2166136261U;
+        unsigned int h2 = 2166136261U ^ 0x5bd1e995U;
+        size_t i;
+
+        for (; *options; ++options) {
+                h1 = (h1 ^ (unsigned char) *options) * 16777619U;
+                h2 = (h2 ^ (unsigned char) *options) * 16777619U;
+        }
+
+        /* Timing probes and map links also depend on the StatHost */
+        if (config.instrument_mode == INSTRUMENT_MODE_TIMING
+            || config.instrument_source_map) {
+                snprintf (timing, sizeof (timing), " %s%s %s",
+                          config.instrument_mode == INSTRUMENT_MODE_TIMING ?
+                          "timing" : "log",
+                          config.instrument_source_map ? " sourcemap" : "",
+                          config.stathost ? config.stathost : "");
+                for (options = timing; *options; ++options) {
+                        h1 = (h1 ^ (unsigned char) *options) * 16777619U;
+                        h2 = (h2 ^ (unsigned char) *options) * 16777619U;
+                }
+        }
+
+        /* and on which functions were selected, see instrument_select() */
+        if (policy) {
+                snprintf (timing, sizeof (timing), " select %08x", policy);
+                for (options = timing; *options; ++options) {
+                        h1 = (h1 ^ (unsigned char) *options) * 16777619U;
+                        h2 = (h2 ^ (unsigned char) *options) * 16777619U;
+                }
+        }
+
+        for (i = 0; i != len; ++i) {
+                h1 = (h1 ^ (unsigned char) body[i]) * 16777619U;
+                h2 = (h2 ^ (unsigned char) body[i] ^ 0xff) * 16777619U;
+        }
+
+        key->hash[0] = h1 & 0xffffffffU;
+        key->hash[1] = h2 & 0xffffffffU;
+        key->len = len;
+}
+
+static struct cache_entry *cache_set (const struct cache_key *key)
+{
+        return &cache->entries[(key->hash[0] % INSTRUMENT_CACHE_SETS) *
+                               INSTRUMENT_CACHE_WAYS];
+}
+
+static int key_equal (const struct cache_key *a, const struct cache_key *b)
+{
+        return a->hash[0] == b->hash[0] && a->hash[1] == b->hash[1]
+            && a->len == b->len;
+}
+
+/*
+ * Copy the instrumented body for "key" out of the cache.  Returns 0 on
+ * a hit, -1 otherwise.  Must be called with the cache locked.
+ */
+static int cache_lookup (const struct cache_key *key,
+                         char **new_body, size_t *new_len)
+{
+        struct cache_entry *entry = cache_set (key);
+        int i;
+
+        for (i = 0; i != INSTRUMENT_CACHE_WAYS; ++i, ++entry) {
+                if (!entry->used || !key_equal (&entry->key, key))
+                        continue;
+
+                /* allocated like the bodies made by js.c */
+                *new_body = (char *) malloc (entry->size + 1);
+                if (!*new_body)
+                        return -1;
+                memcpy (*new_body, ring + entry->offset, entry->size);
+                *new_len = entry->size;
+                entry->used = ++cache->clock;
+                return 0;
+        }
+
+        return -1;
+}
+
+/*
+ * Add an instrumented body to the cache, dropping whatever it
+ * overwrites.  Bodies larger than half the ring are not kept in memory.
+ * Must be called with the cache locked.
+ */
+static void cache_store (const struct cache_key *key,
+                         const char *new_body, size_t new_len)
+{
+        struct cache_entry *entry, *victim;
+        size_t start, end;
+        int i;
+
+        if (new_len > cache->ring_size / 2)
+                return;
+
+        start = cache->head;
+        if (start + new_len > cache->ring_size)
+                start = 0;
+        end = start + new_len;
+
+        for (i = 0; i != INSTRUMENT_CACHE_SETS * INSTRUMENT_CACHE_WAYS; ++i) {
+                entry = &cache->entries[i];
+                if (entry->used && entry->offset < end
+                    && entry->offset + entry->size > start)
+                        entry->used = 0;
+        }
+
+        entry = victim = cache_set (key);
+        for (i = 0; i != INSTRUMENT_CACHE_WAYS; ++i, ++entry) {
+                if (!entry->used || key_equal (&entry->key, key)) {
+                        victim = entry;
+                        break;
+                }
+                if (entry->used < victim->used)
+                        victim = entry;
+        }
+
+        memcpy (ring + start, new_body, new_len);
+        victim->key = *key;
+        victim->offset = start;
+        victim->size = new_len;
+        victim->used = ++cache->clock;
+
+        cache->head = end;
+}
+
+/* "suffix" is ".js" for bodies and ".map" for source maps */
+static char *cache_file_name (const struct cache_key *key,
+                              const char *suffix)
+{
+        size_t len = strlen (config.instrument_cache_dir) + 48;
+        char *path = (char *) safemalloc (len);
+
+        if (path)
+                snprintf (path, len, "%s/%08x%08x-%lu%s",
+                          config.instrument_cache_dir, key->hash[0],
+                          key->hash[1], (unsigned long) key->len, suffix);
+        return path;
+}
+
+/*
+ * Read an instrumented body from the disk cache.  Returns 0 if it was
+ * found.
+ */
+static int disk_load (const struct cache_key *key, const char *suffix,
+                      char **new_body, size_t *new_len)
+{
+        struct stat st;
+        char *path;
+        int fd;
+        ssize_t len;
+        int ret = -1;
+
+        path = cache_file_name (key, suffix);
+        if (!path)
+                return -1;
+
+        fd = open (path, O_RDONLY);
+        safefree (path);
+        if (fd < 0)
+                return -1;
+
+        if (fstat (fd, &st) < 0 || st.st_size <= 0)
+                goto done;
+
+        *new_body = (char *) malloc (st.st_size + 1);
+        if (!*new_body)
+                goto done;
+
+        len = read (fd, *new_body, st.st_size);
+        if (len != st.st_size) {
+                free (*new_body);
+                *new_body = NULL;
+                goto done;
+        }
+
+        *new_len = len;
+        ret = 0;
+
+done:
+        close (fd);
+        return ret;
+}
+
+/*
+ * Write an instrumented body to the disk cache.  The file is written
+ * under a temporary name and renamed, so other children never read a
+ * partial file.
+ */
+static void disk_save (const struct cache_key *key, const char *suffix,
+                       const char *new_body, size_t new_len)
+{
+        char *path, *tmp;
+        size_t len;
+        int fd;
+
+        path = cache_file_name (key, suffix);
+        if (!path)
+                return;
+
+        len = strlen (path) + 8;
+        tmp = (char *) safemalloc (len);
+        if (!tmp) {
+                safefree (path);
+                return;
+        }
+        snprintf (tmp, len, "%s.XXXXXX", path);
+
+        fd = mkstemp (tmp);
+        if (fd < 0) {
+                log_message (LOG_WARNING,
+                             "Could not write to InstrumentCacheDir \"%s\": %s",
+                             config.instrument_cache_dir, strerror (errno));
+                goto done;
+        }
+
+        if (write (fd, new_body, new_len) != (ssize_t) new_len
+            || fchmod (fd, 0644) < 0 || rename (tmp, path) < 0) {
+                log_message (LOG_WARNING,
+                             "Could not write \"%s\": %s", path,
+                             strerror (errno));
+                unlink (tmp);
+        }
+        close (fd);
+
+done:
+        safefree (tmp);
+        safefree (path);
+}
+
+/*
+ * Like instrument_body(), but served from the cache when the same body
+ * has been instrumented before.
+ */
+int instrument_cached (char *body, size_t len, const char *request_line,
+                       char **new_body, size_t *new_len)
+{
+        struct cache_key key;
+        JsOptions options;
+        char endpoint[256];
+        char tag[20];
+        char **hot;
+        int ret;
+
+        if (!cache)
+                return instrument_body (body, len, request_line,
+                                        new_body, new_len);
+
+        instrument_options (&options, endpoint, sizeof (endpoint));
+        cache_key_make (body, len,
+                        instrument_select (&options, request_line, &hot),
+                        &key);
+
+        cache_lock (F_WRLCK);
+        ret = cache_lookup (&key, new_body, new_len);
+        if (ret == 0) {
+                cache->stats.hits++;
+                cache->stats.bytes_saved += len;
+        }
+        cache_lock (F_UNLCK);
+        if (ret == 0)
+                goto done;
+
+        if (config.instrument_cache_dir
+            && disk_load (&key, ".js", new_body, new_len) == 0) {
+                cache_lock (F_WRLCK);
+                cache_store (&key, *new_body, *new_len);
+                cache->stats.disk_hits++;
+                cache->stats.bytes_saved += len;
+                cache_lock (F_UNLCK);
+                ret = 0;
+                goto done;
+        }
+
+        snprintf (tag, sizeof (tag), "%08x%08x", key.hash[0], key.hash[1]);
+        options.tag = tag;
+        ret = instrument_tagged (body, len, &options, request_line,
+                                 new_body, new_len);
+        if (ret < 0)
+                goto done;
+
+        cache_lock (F_WRLCK);
+        cache_store (&key, *new_body, *new_len);
+        cache->stats.misses++;
+        cache_lock (F_UNLCK);
+
+        if (config.instrument_cache_dir)
+                disk_save (&key, ".js", *new_body, *new_len);
+
+done:
+        safefree (hot);
+        return ret;
+}
+
+/*
+ * Source maps are kept in the same cache as the bodies, keyed by a hash
+ * of the map itself.  That hash is also the map's name under
+ * SOURCEMAP_PATH, so a cached body always links to its own map.
+ */
+static void map_key_make (const char *map, size_t len, struct cache_key *key)
+{
+        const char *prefix = "sourcemap ";
+        unsigned int h1 = 2166136261U;
+        unsigned int h2 = 2166136261U ^ 0x5bd1e995U;
+        size_t i;
+
+        for (; *prefix; ++prefix) {
+                h1 = (h1 ^ (unsigned char) *prefix) * 16777619U;
+                h2 = (h2 ^ (unsigned char) *prefix) * 16777619U;
+        }
+        for (i = 0; i != len; ++i) {
+                h1 = (h1 ^ (unsigned char) map[i]) * 16777619U;
+                h2 = (h2 ^ (unsigned char) map[i] ^ 0xff) * 16777619U;
+        }
+
+        key->hash[0] = h1 & 0xffffffffU;
+        key->hash[1] = h2 & 0xffffffffU;
+        key->len = len;
+}
+
+/*
+ * Make the source map of a script "js" has been fed completely, store
+ * it and return the comment that links the script to it.  Returns NULL
+ * if the map can't be made or kept; the caller frees the comment with
+ * safefree().
+ */
+char *instrument_map_link (JsStream *js, const char *request_line)
+{
+        struct cache_key key;
+        char *url, *map, *link;
+        int map_len, ret;
+        size_t len;
+
+        if (!config.stathost)
+                return NULL;
+
+        url = request_url (request_line);
+        ret = js_stream_source_map (js, url ? url : "", NULL, 0,
+                                    &map, &map_len);
+        safefree (url);
+        if (ret < 0)
+                return NULL;
+
+        if ((!cache || (size_t) map_len > cache->ring_size / 2)
+            && !config.instrument_cache_dir) {
+                log_message (LOG_WARNING, "Source map of %d bytes for "
+                             "\"%s\" is too large to keep", map_len,
+                             request_line);
+                free (map);
+                return NULL;
+        }
+
+        map_key_make (map, map_len, &key);
+        if (cache) {
+                cache_lock (F_WRLCK);
+                cache_store (&key, map, map_len);
+                cache_lock (F_UNLCK);
+        }
+        if (config.instrument_cache_dir)
+                disk_save (&key, ".map", map, map_len);
+        free (map);
+
+        len = strlen (config.stathost) + sizeof (SOURCEMAP_PATH) + 64;
+        link = (char *) safemalloc (len);
+        if (link)
+                snprintf (link, len, "\n//# sourceMappingURL=http://%s"
+                          SOURCEMAP_PATH "%08x%08x-%lu.map\n",
+                          config.stathost, key.hash[0], key.hash[1],
+                          (unsigned long) key.len);
+        return link;
+}
+
+/*
+ * Send the source map "name" (the part of the path after
+ * SOURCEMAP_PATH) to the client.
+ */
+int instrument_send_map (struct conn_s *connptr, const char *name)
+{
+        static const char *headers[] = {
+                "Server: " PACKAGE "/" VERSION,
+                "Content-Type: application/json",
+                "Access-Control-Allow-Origin: *",
+                "Connection: close"
+        };
+        struct cache_key key;
+        http_message_t msg;
+        unsigned long len;
+        char expected[48];
+        char *map = NULL;
+        size_t map_len;
+        int ret = -1;
+
+        if (sscanf (name, "%8x%8x-%lu.map", &key.hash[0], &key.hash[1],
+                    &len) != 3)
+                goto not_found;
+        key.len = len;
+        snprintf (expected, sizeof (expected), "%08x%08x-%lu.map",
+                  key.hash[0], key.hash[1], len);
+        if (strcmp (name, expected) != 0)
+                goto not_found;
+
+        if (cache) {
+                cache_lock (F_WRLCK);
+                ret = cache_lookup (&key, &map, &map_len);
+                cache_lock (F_UNLCK);
+        }
+        if (ret < 0 && config.instrument_cache_dir)
+                ret = disk_load (&key, ".map", &map, &map_len);
+        if (ret < 0)
+                goto not_found;
+
+        msg = http_message_create (200, "OK");
+        if (msg == NULL) {
+                free (map);
+                return -1;
+        }
+        http_message_add_headers (msg, headers, 4);
+        http_message_set_body (msg, map, map_len);
+        http_message_send (msg, connptr->client_fd);
+        http_message_destroy (msg);
+        free (map);
+        return 0;
+
+not_found:
+        return send_http_message (connptr, 404, "Not Found",
+                                  "The source map is no longer cached.\n");
+}
+
+void instrument_cache_stats (struct instrument_cache_stats *stats)
+{
+        if (!cache) {
+                memset (stats, 0, sizeof (*stats));
+                return;
+        }
+
+        cache_lock (F_RDLCK);
+        *stats = cache->stats;
+        cache_lock (F_UNLCK);
+}
@@ -0,0 +1,67 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'instrument.c' for detailed information. */
+
+#ifndef _TINYPROXY_INSTRUMENT_H_
+#define _TINYPROXY_INSTRUMENT_H_
+
+#include "common.h"
+#include "vector.h"
+#include "js.h"
+
+/* Largest response body buffered for instrumentation by default. */
+#define INSTRUMENT_MAX_SIZE (1024 * 1024)
+
+/* Default size of the shared cache of instrumented bodies. */
+#define INSTRUMENT_CACHE_SIZE (16 * 1024 * 1024)
+
+/* Where source maps are served from on the StatHost. */
+#define SOURCEMAP_PATH "/sourcemap/"
+
+/* InstrumentMode */
+#define INSTRUMENT_MODE_LOG     0       /* console.log on entry and exit */
+#define INSTRUMENT_MODE_TIMING  1       /* timing probes, see profile.c */
+
+struct instrument_cache_stats {
+        unsigned long hits;             /* served from memory */
+        unsigned long disk_hits;        /* served from InstrumentCacheDir */
+        unsigned long misses;           /* had to be instrumented */
+        unsigned long bytes_saved;      /* original bytes not parsed again */
+};
+
+extern int instrument_add_pattern (vector_t *patterns, const char *pattern);
+extern int instrument_add_sample (vector_t *patterns, const char *pattern,
+                                  int percent);
+extern void instrument_free_patterns (vector_t patterns);
+
+extern int instrument_wanted (const char *request_line,
+                              const char *content_type);
+extern int instrument_body (char *body, size_t len, const char *request_line,
+                            char **new_body, size_t *new_len);
+extern JsStream *instrument_stream_new (const char *request_line);
+
+extern int instrument_cache_init (void);
+extern int instrument_cached (char *body, size_t len, const char *request_line,
+                              char **new_body, size_t *new_len);
+extern void instrument_cache_stats (struct instrument_cache_stats *stats);
+
+struct conn_s;
+extern char *instrument_map_link (JsStream *js, const char *request_line);
+extern int instrument_send_map (struct conn_s *connptr, const char *name);
+
+#endif /* _TINYPROXY_INSTRUMENT_H_ */
@@ -0,0 +1,1127 @@
+#include "common.h"
+#include "js.h"
+
+#include <dirent.h>
+#include <pthread.h>
+#include <regex.h>
+
+static char *read_file(const char *path, int *psize)
+{
+    char *buffer = NULL;
+    long size;
+    FILE *file = fopen(path, "rb");
+    if (file) {
+        fseek(file, 0, SEEK_END);
+        size = ftell(file);
+        if (size > 0) {
+            fseek(file, 0, SEEK_SET);
+            buffer = (char*) malloc(size);
+            if (buffer)
+                *psize = fread(buffer, 1, size, file);
+        }
+        fclose(file);
+    }
+    return buffer;
+}
+
+static int write_file(char *path, char *buffer, int size)
+{
+    int result = 0;
+    FILE *file = fopen(path, "wb");
+    if (file) {
+        result = fwrite(buffer, 1, size, file);
+        fclose(file);
+    }
+    return result;
+}
+
+static double now(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+/* -t 时插入计时代码，-e 指定计时数据发到哪里，-m 时生成源码映射，
+ * -s -r -f -x -H 选择插入哪些函数。都没有时 options 为 NULL */
+static JsOptions js_options = { JS_PROFILE_LOG, "js", NULL, 0, 0, 0, NULL, 0, NULL, NULL };
+static const JsOptions *options = NULL;
+
+/* 影响输出的选项，-i 时和文件内容一起算散列值 */
+static char policy[1024];
+
+/* -f 和 -x 的函数名正则表达式 */
+static regex_t include_re, exclude_re;
+static int include_set = 0, exclude_set = 0;
+
+static int filter_name(const char *name, void *data)
+{
+    if (include_set && regexec(&include_re, name, 0, NULL, 0) != 0)
+        return 0;
+    if (exclude_set && regexec(&exclude_re, name, 0, NULL, 0) == 0)
+        return 0;
+    return 1;
+}
+
+static int set_regex(regex_t *re, int *set, const char *pattern)
+{
+    if (regcomp(re, pattern, REG_EXTENDED | REG_NOSUB) != 0) {
+        fprintf(stderr, "js: bad regular expression \"%s\"\n", pattern);
+        return -1;
+    }
+    *set = 1;
+    js_options.filter = filter_name;
+    return 0;
+}
+
+/* -H 的文件每行一个函数名，只插入这些函数 */
+static char *hot_buffer = NULL;
+static const char **hot_names = NULL;
+
+static int read_hot_list(const char *path)
+{
+    int size = 0, count = 0, i;
+    char *p, *line;
+
+    hot_buffer = read_file(path, &size);
+    if (!hot_buffer && size == 0) {
+        hot_buffer = (char*) malloc(1);
+        if (hot_buffer)
+            hot_buffer[0] = '\n';
+        size = 1;
+    }
+    if (!hot_buffer) {
+        fprintf(stderr, "js: can't read %s\n", path);
+        return -1;
+    }
+    for (i = 0; i < size; i ++)
+        count += hot_buffer[i] == '\n';
+    hot_names = (const char**) malloc((count + 1) * sizeof(char*));
+    if (!hot_names)
+        return -1;
+    count = 0;
+    for (line = hot_buffer; line < hot_buffer + size; line = p + 1) {
+        p = (char*) memchr(line, '\n', hot_buffer + size - line);
+        if (!p)
+            break;
+        *p = '\0';
+        if (p > line && p[-1] == '\r')
+            p[-1] = '\0';
+        if (line[0] && line[0] != '#')
+            hot_names[count ++] = line;
+    }
+    js_options.only = hot_names;
+    js_options.only_count = count;
+    return 0;
+}
+
+/* 原来的源码用 sourceMappingURL 指向的映射文件，只找和 infile 相对的路径 */
+static char *read_input_map(const char *infile, const char *url, int *len)
+{
+    const char *slash = strrchr(infile, '/');
+    int dir_len = slash ? slash - infile + 1 : 0;
+    char *path, *map;
+
+    if (url[0] == '/' || strstr(url, "://") || strchr(url, '?') || strchr(url, '#'))
+        return NULL;
+    path = (char*) malloc(dir_len + strlen(url) + 1);
+    if (!path)
+        return NULL;
+    memcpy(path, infile, dir_len);
+    strcpy(path + dir_len, url);
+    map = read_file(path, len);
+    free(path);
+    return map;
+}
+
+static int write_all(FILE *file, const char *data, int len)
+{
+    return (int) fwrite(data, 1, len, file) == len ? 0 : -1;
+}
+
+/* 把 source 插入代码后写到 outfile，-m 时映射写到 outfile.map，并在
+ * outfile 末尾指向它。成功返回 NULL，否则返回出错原因 */
+static const char *instrument_to_file(JsStream *js, const char *infile,
+        char *source, int source_len, const char *outfile)
+{
+    static char empty[1];
+    const char *url, *base, *error = NULL;
+    char *out, *map = NULL, *input_map = NULL, *path = NULL;
+    int out_len, map_len, input_len = 0;
+    FILE *file = NULL;
+
+    if (js_stream_feed(js, source ? source : empty, source_len, 1, &out, &out_len) < 0)
+        return "out of memory";
+    if (options && options->source_map) {
+        url = js_stream_map_url(js);
+        if (url)
+            input_map = read_input_map(infile, url, &input_len);
+        if (js_stream_source_map(js, infile, input_map, input_len, &map, &map_len) < 0) {
+            error = "out of memory";
+            goto done;
+        }
+        path = (char*) malloc(strlen(outfile) + 5);
+        if (!path) {
+            error = "out of memory";
+            goto done;
+        }
+        sprintf(path, "%s.map", outfile);
+    }
+    if (!(file = fopen(outfile, "wb")) || write_all(file, out, out_len) < 0)
+        goto fail;
+    if (path) {
+        base = strrchr(path, '/');
+        base = base ? base + 1 : path;
+        if (fprintf(file, "\n//# sourceMappingURL=%s\n", base) < 0)
+            goto fail;
+    }
+    if (fclose(file) != 0) {
+        file = NULL;
+        goto fail;
+    }
+    file = NULL;
+    if (path && (!(file = fopen(path, "wb")) || write_all(file, map, map_len) < 0
+                || fclose(file) != 0)) {
+        file = NULL;
+        goto fail;
+    }
+    file = NULL;
+    goto done;
+
+fail:
+    error = strerror(errno);
+    if (file)
+        fclose(file);
+done:
+    free(path);
+    free(map);
+    free(input_map);
+    return error;
+}
+
+/* 一段一段地插入，chunk 是每段的长度 */
+static int insert_chunked(char *source, int source_len, int chunk,
+        char **new_source, int *new_source_len)
+{
+    JsStream *js = js_stream_new(options);
+    char *out;
+    char *buffer;
+    int out_len, pos = 0, len = 0, cap = source_len + source_len / 8 + 1024, n;
+
+    buffer = (char*) malloc(cap);
+    if (!js || !buffer)
+        goto fail;
+    do {
+        n = source_len - pos < chunk ? source_len - pos : chunk;
+        if (js_stream_feed(js, source + pos, n, pos + n == source_len, &out, &out_len) < 0)
+            goto fail;
+        pos += n;
+        if (len + out_len > cap) {
+            char *p;
+            cap = (len + out_len) * 2;
+            p = (char*) realloc(buffer, cap);
+            if (!p)
+                goto fail;
+            buffer = p;
+        }
+        memcpy(buffer + len, out, out_len);
+        len += out_len;
+    } while (pos < source_len);
+    js_stream_free(js);
+    *new_source = buffer;
+    *new_source_len = len;
+    return 0;
+
+fail:
+    js_stream_free(js);
+    free(buffer);
+    return -1;
+}
+
+/* 插入代码并生成源码映射，*new_source 是映射，用来测速度 */
+static int insert_with_map(char *source, int source_len, char **new_source, int *new_source_len)
+{
+    JsStream *js = js_stream_new(options);
+    char *out;
+    int out_len, ret = -1;
+
+    if (js && js_stream_feed(js, source, source_len, 1, &out, &out_len) == 0)
+        ret = js_stream_source_map(js, "", NULL, 0, new_source, new_source_len);
+    js_stream_free(js);
+    return ret;
+}
+
+/* 统计 -b 时 malloc 的次数和堆的峰值：换掉 glibc 的 malloc 系列函数，
+ * 只在 alloc_counting 时计数，这时只有一个线程。别的 C 库上统计不到 */
+#ifdef __GLIBC__
+#include <malloc.h>
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+extern void __libc_free(void *p);
+
+static int alloc_counting = 0;
+static long alloc_count = 0;
+static long heap_live = 0, heap_peak = 0;
+
+static void count_alloc(void *p)
+{
+    alloc_count ++;
+    heap_live += malloc_usable_size(p);
+    if (heap_live > heap_peak)
+        heap_peak = heap_live;
+}
+
+void *malloc(size_t size)
+{
+    void *p = __libc_malloc(size);
+    if (p && alloc_counting)
+        count_alloc(p);
+    return p;
+}
+
+void *calloc(size_t count, size_t size)
+{
+    void *p = __libc_calloc(count, size);
+    if (p && alloc_counting)
+        count_alloc(p);
+    return p;
+}
+
+void *realloc(void *old, size_t size)
+{
+    long old_size = old && alloc_counting ? (long) malloc_usable_size(old) : 0;
+    void *p = __libc_realloc(old, size);
+    if (p && alloc_counting) {
+        heap_live -= old_size;
+        count_alloc(p);
+    }
+    return p;
+}
+
+void free(void *p)
+{
+    if (p && alloc_counting)
+        heap_live -= malloc_usable_size(p);
+    __libc_free(p);
+}
+
+static void alloc_stats_start(void)
+{
+    alloc_count = heap_live = heap_peak = 0;
+    alloc_counting = 1;
+}
+
+static void alloc_stats_stop(long *count, long *peak)
+{
+    alloc_counting = 0;
+    *count = alloc_count;
+    *peak = heap_peak;
+}
+#else
+static void alloc_stats_start(void)
+{
+}
+
+static void alloc_stats_stop(long *count, long *peak)
+{
+    *count = *peak = -1;
+}
+#endif
+
+/* -p 时每个文件输出一行，用 tab 分隔，第一行是列名 */
+static int plain_output = 0;
+
+typedef struct {
+    int bytes, nodes;
+    double parse_time, insert_time;     /* 所有轮加起来的秒数 */
+    long parse_allocs, parse_heap;      /* 一轮里 malloc 的次数和堆的峰值 */
+    long insert_allocs, insert_heap;
+} BenchResult;
+
+/* 插入一次，chunk 和 -m 同正常运行 */
+static int bench_insert(char *source, int source_len, int chunk)
+{
+    char *new_source;
+    int new_source_len, ret;
+
+    if (options && options->source_map)
+        ret = insert_with_map(source, source_len, &new_source, &new_source_len);
+    else if (chunk > 0)
+        ret = insert_chunked(source, source_len, chunk, &new_source, &new_source_len);
+    else
+        ret = insert_profile_codes(options, source, source_len, &new_source, &new_source_len);
+    if (ret == 0)
+        free(new_source);
+    return ret;
+}
+
+/* 解析和插入代码分开计时，插入不需要语法树。计时的几轮不统计内存，
+ * 最后再各跑一轮统计 malloc */
+static int bench_file(char *source, int source_len, int rounds, int chunk, BenchResult *r)
+{
+    int i;
+    double t;
+    AST ast;
+
+    memset(r, 0, sizeof(*r));
+    r->bytes = source_len;
+    for (i = 0; i < rounds; i ++) {
+        t = now();
+        if (parse(&ast, source, source_len) < 0)
+            return -1;
+        r->parse_time += now() - t;
+        r->nodes = ast.node_count;
+        free_tree(&ast);
+        t = now();
+        if (bench_insert(source, source_len, chunk) < 0)
+            return -1;
+        r->insert_time += now() - t;
+    }
+
+    alloc_stats_start();
+    i = parse(&ast, source, source_len);
+    if (i == 0)
+        free_tree(&ast);
+    alloc_stats_stop(&r->parse_allocs, &r->parse_heap);
+    alloc_stats_start();
+    if (i == 0)
+        i = bench_insert(source, source_len, chunk);
+    alloc_stats_stop(&r->insert_allocs, &r->insert_heap);
+    return i;
+}
+
+/* 整个进程到现在为止的最大常驻内存，KB */
+static long peak_rss(void)
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) < 0)
+        return -1;
+    return usage.ru_maxrss;
+}
+
+/* 测试每个文件解析和插入代码的速度，MB/s 按 10^6 字节算 */
+static int benchmark(char **files, int file_count, int rounds, int chunk)
+{
+    BenchResult r;
+    char *source;
+    int source_len, i, ret = 0;
+    double parse_mbs, insert_mbs;
+
+    if (rounds < 1)
+        rounds = 1;
+    if (plain_output)
+        printf("file\tbytes\tnodes\trounds\tparse_mb_s\tparse_nodes_s\tparse_allocs\tparse_heap_kb"
+                "\tinsert_mb_s\tinsert_allocs\tinsert_heap_kb\trss_kb\n");
+    for (i = 0; i < file_count; i ++) {
+        source_len = 0;
+        source = read_file(files[i], &source_len);
+        if (!source) {
+            fprintf(stderr, "js: can't read %s\n", files[i]);
+            ret = 1;
+            continue;
+        }
+        if (bench_file(source, source_len, rounds, chunk, &r) < 0) {
+            fprintf(stderr, "js: out of memory\n");
+            free(source);
+            return 1;
+        }
+        free(source);
+
+        parse_mbs = r.bytes * (double) rounds / r.parse_time / 1e6;
+        insert_mbs = r.bytes * (double) rounds / r.insert_time / 1e6;
+        if (plain_output)
+            printf("%s\t%d\t%d\t%d\t%.2f\t%.0f\t%ld\t%ld\t%.2f\t%ld\t%ld\t%ld\n",
+                    files[i], r.bytes, r.nodes, rounds,
+                    parse_mbs, r.nodes * (double) rounds / r.parse_time,
+                    r.parse_allocs, r.parse_heap < 0 ? -1 : r.parse_heap / 1024,
+                    insert_mbs, r.insert_allocs,
+                    r.insert_heap < 0 ? -1 : r.insert_heap / 1024, peak_rss());
+        else
+            printf("%s: %d bytes, %d nodes, parse %.1f MB/s %.2f M nodes/s "
+                    "(%ld allocs, %ld KB heap), insert %.1f MB/s (%ld allocs, %ld KB heap)\n",
+                    files[i], r.bytes, r.nodes,
+                    parse_mbs, r.nodes * (double) rounds / r.parse_time / 1e6,
+                    r.parse_allocs, r.parse_heap / 1024,
+                    insert_mbs, r.insert_allocs, r.insert_heap / 1024);
+    }
+    if (!plain_output)
+        printf("peak rss %ld KB\n", peak_rss());
+    return ret;
+}
+
+/**********
+ * 批量插入
+ *
+ * 把目录下所有的 .js 文件（或者列表文件里每行一个的文件）插入代码后
+ * 写到输出目录，保持相对路径。文件按大小从大到小轮流分给各个线程，
+ * 每个线程先做自己的，做完了从别的线程的队列尾部拿小文件做。每个线程
+ * 只用一个 JsStream，处理下一个文件时 js_stream_reset()，缓冲区一直
+ * 复用。输入文件用 mmap 读。
+ *
+ * 增量模式（-i）在输出目录的 BATCH_STATE 里记下每个文件内容（加上插入
+ * 方式）的散列值，下次内容没变、输出文件还在的就跳过。
+ **********/
+
+#define BATCH_STATE ".js-batch"
+
+enum { BATCH_TODO, BATCH_DONE, BATCH_SKIPPED, BATCH_FAILED };
+
+typedef struct {
+    char *in;
+    char *out;
+    long size;
+    char hash[17];              /* 内容的散列值，计时模式下也用作 tag */
+    int functions;
+    double ms;
+    int status;
+    const char *error;
+    int order;                  /* 第几个找到的，结果按这个顺序输出 */
+} BatchFile;
+
+/* 每个线程一个队列，自己从头上拿，别的线程从尾部拿 */
+typedef struct {
+    pthread_mutex_t lock;
+    int *items;
+    int head;
+    int tail;
+} BatchQueue;
+
+typedef struct {
+    BatchFile *files;
+    int file_count;
+    int file_cap;
+    BatchQueue *queues;
+    int thread_count;
+    char **old_paths;           /* 上次的 BATCH_STATE，按路径排好序 */
+    char **old_hashes;
+    int old_count;
+} Batch;
+
+typedef struct {
+    Batch *batch;
+    int id;
+} BatchThread;
+
+static int add_file(Batch *batch, const char *in, const char *out)
+{
+    BatchFile *file;
+    if (batch->file_count == batch->file_cap) {
+        int cap = batch->file_cap ? batch->file_cap * 2 : 256;
+        BatchFile *files = (BatchFile*) realloc(batch->files, cap * sizeof(BatchFile));
+        if (!files)
+            return -1;
+        batch->files = files;
+        batch->file_cap = cap;
+    }
+    file = &batch->files[batch->file_count];
+    memset(file, 0, sizeof(*file));
+    file->in = (char*) malloc(strlen(in) + 1);
+    file->out = (char*) malloc(strlen(out) + 1);
+    if (!file->in || !file->out) {
+        free(file->in);
+        free(file->out);
+        return -1;
+    }
+    strcpy(file->in, in);
+    strcpy(file->out, out);
+    file->order = batch->file_count ++;
+    return 0;
+}
+
+static char *join_path(const char *dir, const char *name)
+{
+    char *path = (char*) malloc(strlen(dir) + strlen(name) + 2);
+    if (path)
+        sprintf(path, "%s/%s", dir, name);
+    return path;
+}
+
+static int is_js_file(const char *name)
+{
+    int len = strlen(name);
+    return (len > 3 && strcmp(name + len - 3, ".js") == 0)
+        || (len > 4 && strcmp(name + len - 4, ".mjs") == 0);
+}
+
+/* 找出 indir 下所有的 .js 文件，跳过 . 开头的文件和目录 */
+static int scan_dir(Batch *batch, const char *indir, const char *outdir)
+{
+    DIR *dir = opendir(indir);
+    struct dirent *entry;
+    struct stat st;
+    char *in, *out;
+    int ret = 0;
+
+    if (!dir) {
+        fprintf(stderr, "js: can't read %s: %s\n", indir, strerror(errno));
+        return -1;
+    }
+    while (ret == 0 && (entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.')
+            continue;
+        in = join_path(indir, entry->d_name);
+        out = join_path(outdir, entry->d_name);
+        if (!in || !out)
+            ret = -1;
+        else if (stat(in, &st) < 0)
+            ;
+        else if (S_ISDIR(st.st_mode))
+            ret = scan_dir(batch, in, out);
+        else if (S_ISREG(st.st_mode) && is_js_file(entry->d_name))
+            ret = add_file(batch, in, out);
+        free(in);
+        free(out);
+    }
+    closedir(dir);
+    return ret;
+}
+
+/* 列表文件每行一个输入文件，输出到 outdir 下同样的相对路径 */
+static int read_list(Batch *batch, const char *list, const char *outdir)
+{
+    char line[4096];
+    char *name, *out;
+    int len, ret = 0;
+    FILE *file = fopen(list, "r");
+
+    if (!file) {
+        fprintf(stderr, "js: can't read %s: %s\n", list, strerror(errno));
+        return -1;
+    }
+    while (ret == 0 && fgets(line, sizeof(line), file)) {
+        len = strlen(line);
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r'))
+            line[-- len] = '\0';
+        if (len == 0 || line[0] == '#')
+            continue;
+        for (name = line; name[0] == '/' || (name[0] == '.' && name[1] == '/'); )
+            name += name[0] == '/' ? 1 : 2;
+        if (strcmp(name, "..") == 0 || strncmp(name, "../", 3) == 0
+                || strstr(name, "/../") || (len >= 3 && strcmp(line + len - 3, "/..") == 0)) {
+            fprintf(stderr, "js: %s: path leaves the output directory\n", line);
+            ret = -1;
+            break;
+        }
+        out = join_path(outdir, name);
+        ret = out ? add_file(batch, line, out) : -1;
+        free(out);
+    }
+    fclose(file);
+    return ret;
+}
+
+/* 建好 path 所在的目录 */
+static int make_dirs(const char *path)
+{
+    char *dir = (char*) malloc(strlen(path) + 1);
+    char *p;
+    int ret = 0;
+
+    if (!dir)
+        return -1;
+    strcpy(dir, path);
+    for (p = strchr(dir + 1, '/'); p && ret == 0; p = strchr(p + 1, '/')) {
+        *p = '\0';
+        if (mkdir(dir, 0755) < 0 && errno != EEXIST)
+            ret = -1;
+        *p = '/';
+    }
+    free(dir);
+    return ret;
+}
+
+/* 两个初值不同的 32 位 FNV-1a，和 instrument.c 的缓存一样 */
+static void hash_source(const char *source, long len, char *hash)
+{
+    unsigned int h1 = 2166136261U;
+    unsigned int h2 = 2166136261U ^ 0x5bd1e995U;
+    const char *mode = !options ? "log " : options->mode == JS_PROFILE_TIMING
+        ? (options->source_map ? "timing map " : "timing ")
+        : (options->source_map ? "log map " : "log ");
+    long i;
+
+    for (; *mode; mode ++) {
+        h1 = (h1 ^ (unsigned char) *mode) * 16777619U;
+        h2 = (h2 ^ (unsigned char) *mode) * 16777619U;
+    }
+    if (options && options->endpoint) {
+        for (mode = options->endpoint; *mode; mode ++) {
+            h1 = (h1 ^ (unsigned char) *mode) * 16777619U;
+            h2 = (h2 ^ (unsigned char) *mode) * 16777619U;
+        }
+    }
+    for (mode = policy; *mode; mode ++) {
+        h1 = (h1 ^ (unsigned char) *mode) * 16777619U;
+        h2 = (h2 ^ (unsigned char) *mode) * 16777619U;
+    }
+    for (i = 0; i < len; i ++) {
+        h1 = (h1 ^ (unsigned char) source[i]) * 16777619U;
+        h2 = (h2 ^ (unsigned char) source[i] ^ 0xff) * 16777619U;
+    }
+    sprintf(hash, "%08x%08x", h1 & 0xffffffffU, h2 & 0xffffffffU);
+}
+
+static int compare_strings(const void *a, const void *b)
+{
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+/* 上次的散列值，没有返回 NULL */
+static const char *old_hash(Batch *batch, const char *path)
+{
+    char **found;
+    if (batch->old_count == 0)
+        return NULL;
+    found = (char**) bsearch(&path, batch->old_paths, batch->old_count,
+            sizeof(char*), compare_strings);
+    return found ? *found + strlen(path) + 1 : NULL;
+}
+
+/* BATCH_STATE 每行是 "散列值 输出文件"，读进来后改成 "输出文件\0散列值"
+ * 以便按路径查找 */
+static int read_state(Batch *batch, const char *outdir)
+{
+    char *path = join_path(outdir, BATCH_STATE);
+    char line[4096 + 32];
+    char *entry;
+    int len, cap = 0;
+    FILE *file;
+
+    if (!path)
+        return -1;
+    file = fopen(path, "r");
+    free(path);
+    if (!file)
+        return 0;
+    while (fgets(line, sizeof(line), file)) {
+        len = strlen(line);
+        if (len > 0 && line[len - 1] == '\n')
+            line[-- len] = '\0';
+        if (len < 18 || line[16] != ' ')
+            continue;
+        if (batch->old_count == cap) {
+            char **paths;
+            cap = cap ? cap * 2 : 256;
+            paths = (char**) realloc(batch->old_paths, cap * sizeof(char*));
+            if (!paths)
+                goto fail;
+            batch->old_paths = paths;
+        }
+        entry = (char*) malloc(len + 1);
+        if (!entry)
+            goto fail;
+        strcpy(entry, line + 17);
+        memcpy(entry + len - 16, line, 16);
+        entry[len] = '\0';
+        entry[len - 17] = '\0';
+        batch->old_paths[batch->old_count ++] = entry;
+    }
+    fclose(file);
+    qsort(batch->old_paths, batch->old_count, sizeof(char*), compare_strings);
+    return 0;
+
+fail:
+    fclose(file);
+    return -1;
+}
+
+static int write_state(Batch *batch, const char *outdir)
+{
+    char *path = join_path(outdir, BATCH_STATE);
+    FILE *file;
+    int i;
+
+    if (!path)
+        return -1;
+    file = fopen(path, "w");
+    free(path);
+    if (!file)
+        return -1;
+    for (i = 0; i < batch->file_count; i ++) {
+        BatchFile *f = &batch->files[i];
+        if (f->status == BATCH_DONE || f->status == BATCH_SKIPPED)
+            fprintf(file, "%s %s\n", f->hash, f->out);
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
+
+/* 处理一个文件，js 是这个线程的 JsStream */
+static void process_file(Batch *batch, JsStream *js, BatchFile *file, int incremental)
+{
+    JsOptions file_options;
+    const char *hash;
+    struct stat st;
+    char *source = NULL;
+    int fd;
+    double t = now();
+
+    file->status = BATCH_FAILED;
+    fd = open(file->in, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        file->error = strerror(errno);
+        if (fd >= 0)
+            close(fd);
+        return;
+    }
+    if (st.st_size > INT_MAX) {
+        file->error = "file too large";
+        close(fd);
+        return;
+    }
+    file->size = st.st_size;
+    if (file->size > 0) {
+        source = (char*) mmap(NULL, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (source == (char*) MAP_FAILED) {
+            file->error = strerror(errno);
+            close(fd);
+            return;
+        }
+    }
+    close(fd);
+
+    hash_source(source, file->size, file->hash);
+    hash = incremental ? old_hash(batch, file->out) : NULL;
+    if (hash && strcmp(hash, file->hash) == 0 && stat(file->out, &st) == 0) {
+        file->status = BATCH_SKIPPED;
+        goto done;
+    }
+
+    /* 不同的脚本用不同的 tag，内容不变时插入的代码也不变 */
+    if (options) {
+        file_options = *options;
+        file_options.tag = file->hash;
+    }
+    if (js_stream_reset(js, options ? &file_options : NULL) < 0) {
+        file->error = "out of memory";
+        goto done;
+    }
+    if (make_dirs(file->out) < 0) {
+        file->error = strerror(errno);
+        goto done;
+    }
+    file->error = instrument_to_file(js, file->in, source, (int) file->size, file->out);
+    if (file->error)
+        goto done;
+    file->functions = js_stream_functions(js);
+    file->status = BATCH_DONE;
+
+done:
+    if (source)
+        munmap(source, file->size);
+    file->ms = (now() - t) * 1000;
+}
+
+/* 先从自己的队列头上拿，没有了就从别的队列尾部拿。都没有了返回 -1 */
+static int next_file(Batch *batch, int id)
+{
+    BatchQueue *queue;
+    int i, index = -1;
+
+    for (i = 0; i < batch->thread_count && index < 0; i ++) {
+        queue = &batch->queues[(id + i) % batch->thread_count];
+        pthread_mutex_lock(&queue->lock);
+        if (queue->head < queue->tail)
+            index = i == 0 ? queue->items[queue->head ++] : queue->items[-- queue->tail];
+        pthread_mutex_unlock(&queue->lock);
+    }
+    return index;
+}
+
+static int incremental = 0;
+
+static void *batch_thread(void *arg)
+{
+    BatchThread *thread = (BatchThread*) arg;
+    Batch *batch = thread->batch;
+    JsStream *js = js_stream_new(NULL);
+    int index;
+
+    while ((index = next_file(batch, thread->id)) >= 0) {
+        if (js)
+            process_file(batch, js, &batch->files[index], incremental);
+        else
+            batch->files[index].error = "out of memory";
+    }
+    js_stream_free(js);
+    return NULL;
+}
+
+static int compare_size(const void *a, const void *b)
+{
+    const BatchFile *x = (const BatchFile*) a;
+    const BatchFile *y = (const BatchFile*) b;
+    return x->size < y->size ? 1 : x->size > y->size ? -1 : x->order - y->order;
+}
+
+static int compare_order(const void *a, const void *b)
+{
+    return ((const BatchFile*) a)->order - ((const BatchFile*) b)->order;
+}
+
+static int batch_run(const char *input, const char *outdir, int threads)
+{
+    Batch batch;
+    BatchThread *thread_args = NULL;
+    pthread_t *thread_ids = NULL;
+    struct stat st;
+    long bytes = 0;
+    int i, started = 0, done = 0, skipped = 0, failed = 0, functions = 0, ret = 1, oom = 0;
+    double t = now();
+
+    memset(&batch, 0, sizeof(batch));
+    if (stat(input, &st) < 0) {
+        fprintf(stderr, "js: can't read %s: %s\n", input, strerror(errno));
+        return 1;
+    }
+    if ((S_ISDIR(st.st_mode) ? scan_dir(&batch, input, outdir) : read_list(&batch, input, outdir)) < 0)
+        goto out;
+    if (incremental && read_state(&batch, outdir) < 0) {
+        oom = 1;
+        goto out;
+    }
+
+    /* 按大小排序后轮流分给各个线程，大文件先做 */
+    for (i = 0; i < batch.file_count; i ++) {
+        if (stat(batch.files[i].in, &st) == 0)
+            batch.files[i].size = st.st_size;
+    }
+    qsort(batch.files, batch.file_count, sizeof(BatchFile), compare_size);
+    if (threads > batch.file_count)
+        threads = batch.file_count > 0 ? batch.file_count : 1;
+    batch.thread_count = threads;
+    batch.queues = (BatchQueue*) calloc(threads, sizeof(BatchQueue));
+    thread_args = (BatchThread*) malloc(threads * sizeof(BatchThread));
+    thread_ids = (pthread_t*) malloc(threads * sizeof(pthread_t));
+    oom = 1;
+    if (!batch.queues || !thread_args || !thread_ids)
+        goto out;
+    for (i = 0; i < threads; i ++) {
+        batch.queues[i].items = (int*) malloc((batch.file_count / threads + 1) * sizeof(int));
+        if (!batch.queues[i].items)
+            goto out;
+        pthread_mutex_init(&batch.queues[i].lock, NULL);
+    }
+    for (i = 0; i < batch.file_count; i ++) {
+        BatchQueue *queue = &batch.queues[i % threads];
+        queue->items[queue->tail ++] = i;
+    }
+    oom = 0;
+
+    for (started = 0; started < threads; started ++) {
+        thread_args[started].batch = &batch;
+        thread_args[started].id = started;
+        if (pthread_create(&thread_ids[started], NULL, batch_thread, &thread_args[started]) != 0)
+            break;
+    }
+    if (started == 0)
+        batch_thread(&thread_args[0]);
+    for (i = 0; i < started; i ++)
+        pthread_join(thread_ids[i], NULL);
+
+    qsort(batch.files, batch.file_count, sizeof(BatchFile), compare_order);
+    for (i = 0; i < batch.file_count; i ++) {
+        BatchFile *f = &batch.files[i];
+        switch (f->status) {
+        case BATCH_DONE:
+            printf("%s: %ld bytes, %d functions, %.2f ms\n", f->in, f->size, f->functions, f->ms);
+            done ++;
+            bytes += f->size;
+            functions += f->functions;
+            break;
+        case BATCH_SKIPPED:
+            printf("%s: unchanged\n", f->in);
+            skipped ++;
+            break;
+        default:
+            printf("%s: failed: %s\n", f->in, f->error ? f->error : "not processed");
+            failed ++;
+        }
+    }
+    t = now() - t;
+    printf("%d files: %d instrumented, %d unchanged, %d failed; "
+            "%d functions, %ld bytes; %d threads, %.2f s, %.1f MB/s\n",
+            batch.file_count, done, skipped, failed, functions, bytes,
+            started > 0 ? started : 1, t, t > 0 ? bytes / t / 1e6 : 0.0);
+    if (incremental && write_state(&batch, outdir) < 0)
+        fprintf(stderr, "js: can't write %s/%s\n", outdir, BATCH_STATE);
+    ret = failed ? 1 : 0;
+
+out:
+    for (i = 0; batch.queues && i < batch.thread_count; i ++) {
+        if (batch.queues[i].items)
+            pthread_mutex_destroy(&batch.queues[i].lock);
+        free(batch.queues[i].items);
+    }
+    free(batch.queues);
+    free(thread_args);
+    free(thread_ids);
+    for (i = 0; i < batch.file_count; i ++) {
+        free(batch.files[i].in);
+        free(batch.files[i].out);
+    }
+    free(batch.files);
+    for (i = 0; i < batch.old_count; i ++)
+        free(batch.old_paths[i]);
+    free(batch.old_paths);
+    if (oom)
+        fprintf(stderr, "js: out of memory\n");
+    return ret;
+}
+
+/**********
+ * 主程序
+ **********/
+int main(int argc, char **argv)
+{
+    char *infile, *outfile, *source, *new_source = NULL;
+    int source_len = 0, new_source_len = 0, chunk = 0, threads = 0, ret, len, i;
+
+    for (;;) {
+        if (argc >= 3 && strcmp(argv[1], "-c") == 0) {
+            chunk = atoi(argv[2]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 2 && strcmp(argv[1], "-t") == 0) {
+            js_options.mode = JS_PROFILE_TIMING;
+            options = &js_options;
+            argc --;
+            argv ++;
+        }
+        else if (argc >= 3 && strcmp(argv[1], "-e") == 0) {
+            js_options.endpoint = argv[2];
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 3 && strcmp(argv[1], "-j") == 0) {
+            threads = atoi(argv[2]);
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 2 && strcmp(argv[1], "-m") == 0) {
+            js_options.source_map = 1;
+            options = &js_options;
+            argc --;
+            argv ++;
+        }
+        else if (argc >= 3 && strcmp(argv[1], "-s") == 0) {
+            js_options.min_body = atoi(argv[2]);
+            options = &js_options;
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 3 && strcmp(argv[1], "-r") == 0) {
+            js_options.sample = atoi(argv[2]);
+            options = &js_options;
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 3 && (strcmp(argv[1], "-f") == 0 || strcmp(argv[1], "-x") == 0)) {
+            if (argv[1][1] == 'f' ? set_regex(&include_re, &include_set, argv[2]) < 0
+                    : set_regex(&exclude_re, &exclude_set, argv[2]) < 0)
+                return 1;
+            len = strlen(policy);
+            snprintf(policy + len, sizeof(policy) - len, " %s %s", argv[1], argv[2]);
+            options = &js_options;
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 3 && strcmp(argv[1], "-H") == 0) {
+            if (read_hot_list(argv[2]) < 0)
+                return 1;
+            options = &js_options;
+            argc -= 2;
+            argv += 2;
+        }
+        else if (argc >= 2 && strcmp(argv[1], "-i") == 0) {
+            incremental = 1;
+            argc --;
+            argv ++;
+        }
+        else if (argc >= 2 && strcmp(argv[1], "-p") == 0) {
+            plain_output = 1;
+            argc --;
+            argv ++;
+        }
+        else
+            break;
+    }
+    len = strlen(policy);
+    snprintf(policy + len, sizeof(policy) - len, " -s %d -r %d", js_options.min_body, js_options.sample);
+    for (i = 0; i < js_options.only_count; i ++) {
+        len = strlen(policy);
+        snprintf(policy + len, sizeof(policy) - len, " %s", js_options.only[i]);
+    }
+    if (argc >= 3 && strcmp(argv[1], "-b") == 0) {
+        /* 最后一个参数是数字时是轮数 */
+        int rounds = 20;
+        if (argc > 3 && strspn(argv[argc - 1], "0123456789") == strlen(argv[argc - 1])) {
+            rounds = atoi(argv[argc - 1]);
+            argc --;
+        }
+        return benchmark(argv + 2, argc - 2, rounds, chunk);
+    }
+    if (argc == 4 && strcmp(argv[1], "-d") == 0) {
+        if (threads <= 0)
+            threads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+        return batch_run(argv[2], argv[3], threads > 0 ? threads : 1);
+    }
+    if (argc != 3) {
+        printf("Usage: js [-t [-e <endpoint>]] [-m] [select] [-c <chunk>] <infile> <outfile>\n"
+               "       js [-t [-e <endpoint>]] [-m] [select] [-c <chunk>] [-p] -b <infile>... [rounds]\n"
+               "       js [-t [-e <endpoint>]] [-m] [select] [-j <threads>] [-i] -d <indir|list> <outdir>\n"
+               "  -t  insert timing probes instead of console.log\n"
+               "  -e  where the timing probes send their reports\n"
+               "  -m  also write a source map to <outfile>.map\n"
+               "  -d  instrument every .js file under indir, or every file named\n"
+               "      in list (one per line), into the same path under outdir\n"
+               "  -j  number of threads for -d, the number of CPUs by default\n"
+               "  -i  skip files that haven't changed since the last -d run\n"
+               "  -b  measure parsing and inserting speed, malloc calls and peak heap\n"
+               "  -p  print the -b results as tab-separated columns with a header\n"
+               "select, to instrument only some of the functions:\n"
+               "  -s <bytes>    skip functions whose body is smaller than this\n"
+               "  -r <percent>  pick about this many percent of the functions by name\n"
+               "  -f <regex>    only functions whose name matches\n"
+               "  -x <regex>    skip functions whose name matches\n"
+               "  -H <file>     only the functions named in file, one per line\n");
+        return 0;
+    }
+    infile = argv[1];
+    outfile = argv[2];
+    source = read_file(infile, &source_len);
+    if (!source) {
+        fprintf(stderr, "js: can't read %s\n", infile);
+        return 1;
+    }
+
+    if (options && options->source_map) {
+        JsStream *js = js_stream_new(options);
+        const char *error = js ? instrument_to_file(js, infile, source, source_len, outfile)
+            : "out of memory";
+        js_stream_free(js);
+        free(source);
+        if (error) {
+            fprintf(stderr, "js: %s: %s\n", outfile, error);
+            return 1;
+        }
+        return 0;
+    }
+    if (chunk > 0)
+        ret = insert_chunked(source, source_len, chunk, &new_source, &new_source_len);
+    else
+        ret = insert_profile_codes(options, source, source_len, &new_source, &new_source_len);
+    if (ret < 0) {
+        fprintf(stderr, "js: out of memory\n");
+        return 1;
+    }
+    printf("new_len=%d\n", new_source_len);
+    if (new_source_len)
+        write_file(outfile, new_source, new_source_len);
+
+    free(new_source);
+    free(source);
+    return 0;
+}
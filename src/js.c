@@ -1,235 +1,524 @@
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
 #include "common.h"
+#include "js.h"
 
 /* 节点类型 */
 typedef enum { NAME, KEYWORD, BLOCK, OPERATOR, STAMENT, OTHER } NodeType;
 
-/* 节点结构 */
+/* 没有节点 */
+#define NO_NODE (-1)
+
+/* 节点结构：父子兄弟关系都是 AST 节点数组的下标 */
 struct AstNode_t {
     int source_pos, source_len;
-    NodeType type;
-    struct AstNode_t *parent, *first_child, *last_child, *next, *prev;
+    int first_child, last_child, next, prev;
+    unsigned char type;
+};
+
+#define NODE(ast, i) (&(ast)->nodes[i])
+
+/*****************************
+ * 词法分析
+ *
+ * 一遍扫描源码，每个字符只看一次。字符串、模板字符串、正则表达式
+ * 字面量都作为一个 OTHER 单词跳过，注释和空白一样跳过，所以其中的
+ * 括号不会破坏语法树。
+ *****************************/
+
+/* 字符类别 */
+enum {
+    C_OTHER, C_SPACE, C_NAME, C_DIGIT, C_OPEN, C_CLOSE,
+    C_OPERATOR, C_QUOTE, C_TEMPLATE, C_SLASH
+};
+
+#define O C_OTHER
+#define S C_SPACE
+#define N C_NAME
+#define D C_DIGIT
+#define B C_OPEN
+#define E C_CLOSE
+#define P C_OPERATOR
+#define Q C_QUOTE
+#define T C_TEMPLATE
+#define L C_SLASH
+
+/* 0x80 以上是 UTF-8 编码的字符，当作名字的一部分 */
+static const unsigned char char_class[256] = {
+    O, O, O, O, O, O, O, O, O, S, S, S, S, S, O, O,   /* 00 */
+    O, O, O, O, O, O, O, O, O, O, O, O, O, O, O, O,   /* 10 */
+    S, O, Q, O, N, O, O, Q, B, E, O, O, O, O, O, L,   /* 20 */
+    D, D, D, D, D, D, D, D, D, D, P, O, O, P, O, O,   /* 30 */
+    O, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* 40 */
+    N, N, N, N, N, N, N, N, N, N, N, B, O, E, O, N,   /* 50 */
+    T, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* 60 */
+    N, N, N, N, N, N, N, N, N, N, N, B, O, E, O, O,   /* 70 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* 80 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* 90 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* a0 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* b0 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* c0 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* d0 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N,   /* e0 */
+    N, N, N, N, N, N, N, N, N, N, N, N, N, N, N, N    /* f0 */
 };
-typedef struct AstNode_t AstNode;
 
-/* 语法树 */
+#undef O
+#undef S
+#undef N
+#undef D
+#undef B
+#undef E
+#undef P
+#undef Q
+#undef T
+#undef L
+
+/* 单词类型 */
+/* T_MORE：单词一直到输入末尾，要等更多的输入才知道它在哪里结束 */
+typedef enum { T_END, T_OPEN, T_CLOSE, T_NAME, T_OPERATOR, T_OTHER, T_MORE } TokenType;
+
 typedef struct {
-    AstNode *root;
-} AST;
+    TokenType type;
+    int start, end;
+    int ends_expr;      /* 后面的 / 是除号而不是正则表达式（名字另外判断） */
+    int condition;      /* 名字是 if、while、for 或 with */
+} Token;
+
+/* 记录到这么深的括号，更深的 ) 后面的 / 都当除号 */
+#define PAREN_DEPTH 64
 
 typedef struct {
-    AstNode *cur_node;
-    char *source;
+    AST *ast;
+    const unsigned char *source;
     int source_pos;
     int source_len;
-    int block_start;
+    Token prev;         /* 上一个单词 */
+    /* 每层 ( 是不是 if (...) 这样的条件，它的 ) 后面的 / 是正则表达式 */
+    unsigned char paren_condition[PAREN_DEPTH];
+    int paren_depth;
+    Token peek;         /* 预读的单词 */
+    int peek_pos;       /* 预读单词的位置，-1 表示没有 */
+    int failed;         /* 内存不足 */
+    int eof;            /* source 之后没有更多输入了 */
 } ParseState;
 
-char next_char(ParseState *state)
+/* 跳过 '...' 或 "..."，没有结束引号时到行尾为止 */
+static int skip_string(const unsigned char *s, int pos, int n)
 {
-    if (state->source_pos < state->source_len)
-        return state->source[state->source_pos ++];
-    return '\0';
+    unsigned char quote = s[pos ++];
+    while (pos < n) {
+        if (s[pos] == '\\')
+            pos += 2;
+        else if (s[pos] == quote)
+            return pos + 1;
+        else if (s[pos] == '\n')
+            return pos;
+        else
+            pos ++;
+    }
+    return n;
 }
 
-char next_nonspace_char(ParseState *state)
+static int skip_comment(const unsigned char *s, int pos, int n)
 {
-    char c = next_char(state);
-    while (c == ' ' || c == '\t' || c == '\r' || c == '\n')
-        c = next_char(state);
-    return c;
+    const unsigned char *p;
+    if (s[pos + 1] == '/') {
+        p = (const unsigned char*) memchr(s + pos, '\n', n - pos);
+        return p ? p - s : n;
+    }
+    pos += 2;
+    while ((p = (const unsigned char*) memchr(s + pos, '*', n - pos))) {
+        pos = p - s + 1;
+        if (pos < n && s[pos] == '/')
+            return pos + 1;
+    }
+    return n;
 }
 
-AstNode* create_node(AstNode *parent, NodeType type, int pos, int len)
-{
-    AstNode *node = (AstNode*) malloc(sizeof(AstNode));
-    node->parent = parent;
-    node->type = type;
-    node->source_pos = pos;
-    node->source_len = len;
-    node->first_child = NULL;
-    node->last_child = NULL;
-    node->next = NULL;
-    node->prev = NULL;
-    //printf("create_node(parent=%p, type=%d, pos=%d, len=%d) => %p\n",
-        //parent, type, pos, len, node);
-    return node;
-}
+static int skip_template(const unsigned char *s, int pos, int n);
 
-void append_child(AstNode *parent, AstNode *child)
+/* 跳过模板字符串 ${...} 里的代码，返回 } 后面的位置 */
+static int skip_substitution(const unsigned char *s, int pos, int n)
 {
-    //printf("append_child(parent=%p, child=%p)\n", parent, child);
-    if (!parent->first_child) {
-        parent->first_child = child;
-        parent->last_child = child;
-    }
-    else {
-        parent->last_child->next = child;
-        child->prev = parent->last_child;
-        parent->last_child = child;
+    int depth = 1;
+    while (pos < n) {
+        switch (char_class[s[pos]]) {
+        case C_QUOTE:
+            pos = skip_string(s, pos, n);
+            break;
+        case C_TEMPLATE:
+            pos = skip_template(s, pos, n);
+            break;
+        case C_SLASH:
+            if (pos + 1 < n && (s[pos + 1] == '/' || s[pos + 1] == '*'))
+                pos = skip_comment(s, pos, n);
+            else
+                pos ++;
+            break;
+        case C_OPEN:
+            if (s[pos] == '{')
+                depth ++;
+            pos ++;
+            break;
+        case C_CLOSE:
+            if (s[pos] == '}' && -- depth == 0)
+                return pos + 1;
+            pos ++;
+            break;
+        default:
+            pos ++;
+        }
     }
-    child->parent = parent;
+    return n;
 }
 
-AstNode* __parse_statement(ParseState *state, int testMode);
-AstNode* parse_statement(ParseState *state) { return __parse_statement(state, 0); }
-AstNode* test_statement(ParseState *state) { return __parse_statement(state, 1); }
-
-AstNode* parse_operator(ParseState *state)
+static int skip_template(const unsigned char *s, int pos, int n)
 {
-    AstNode *node = create_node(state->cur_node, OPERATOR, state->source_pos, 1);
-    next_char(state);
-    return node;
+    pos ++;
+    while (pos < n) {
+        if (s[pos] == '\\')
+            pos += 2;
+        else if (s[pos] == '`')
+            return pos + 1;
+        else if (s[pos] == '$' && pos + 1 < n && s[pos + 1] == '{')
+            pos = skip_substitution(s, pos + 2, n);
+        else
+            pos ++;
+    }
+    return n;
 }
 
-AstNode* parse_other(ParseState *state)
+/* 跳过正则表达式，不是正则表达式（到行尾还没结束）时返回 -1，
+ * 到输入末尾还没结束时返回 -2 */
+static int skip_regex(const unsigned char *s, int pos, int n)
 {
-    //printf("parse_other BEGIN pos=%d\n", state->source_pos);
-    AstNode *node = create_node(state->cur_node, OTHER, state->source_pos, 0);
-    while (test_statement(state) == NULL) {
-        if (state->source[state->source_pos] == '\0')
-            break;
-        state->source_pos ++;
-        node->source_len ++;
+    int in_class = 0;
+    pos ++;
+    while (pos < n) {
+        unsigned char c = s[pos];
+        if (c == '\\')
+            pos += 2;
+        else if (c == '\n' || c == '\r')
+            return -1;
+        else {
+            if (c == '[')
+                in_class = 1;
+            else if (c == ']')
+                in_class = 0;
+            else if (c == '/' && !in_class) {
+                pos ++;
+                while (pos < n && (char_class[s[pos]] == C_NAME))
+                    pos ++;
+                return pos;
+            }
+            pos ++;
+        }
     }
-    //printf("parse_other END\n");
-    return node;
+    return -2;
 }
 
-int is_keyword(const char *str, int len)
+/* 这些关键字后面的 / 是正则表达式 */
+static int is_regex_keyword(const unsigned char *str, int len)
 {
-    const char* keywords[] = {"function"};
-    int i;
+    static const char* keywords[] = {
+        "return", "typeof", "case", "do", "else", "in", "instanceof",
+        "new", "delete", "void", "throw", "yield", "await"
+    };
+    unsigned int i;
     for (i = 0; i < sizeof(keywords) / sizeof(char*); i ++) {
-        if (strncmp(str, keywords[i], len) == 0)
+        if ((int) strlen(keywords[i]) == len && memcmp(str, keywords[i], len) == 0)
             return 1;
     }
     return 0;
 }
 
-int is_function_keyword(AstNode *node, char *source)
+/* 上一个单词后面的 / 是不是除号 */
+static int ends_expr(ParseState *state)
 {
-    return node->type == KEYWORD
-        && node->source_len == 8
-        && strncmp(source + node->source_pos, "function", 8) == 0;
+    Token *prev = &state->prev;
+    if (prev->type == T_NAME)
+        return !is_regex_keyword(state->source + prev->start, prev->end - prev->start);
+    return prev->ends_expr;
 }
 
-AstNode* parse_name(ParseState *state)
+/* 读下一个单词，不移动位置 */
+static Token *peek_token(ParseState *state)
 {
-    char c;
-    AstNode *node = create_node(state->cur_node, NAME, state->source_pos, 0);
-    while (c = next_char(state)) {
-        if ((c >= 'a' && c <= 'z')
-            || (c >= 'A' && c <= 'Z'
-            || (c >= '0' && c <= '9')
-            || c == '_'))
-            node->source_len ++;
-        else {
-            state->source_pos --;
+    const unsigned char *s = state->source;
+    int n = state->source_len;
+    int pos = state->source_pos;
+    Token *tok = &state->peek;
+
+    if (state->peek_pos == pos)
+        return tok;
+    state->peek_pos = pos;
+
+    /* 跳过空白和注释 */
+    for (;;) {
+        while (pos < n && char_class[s[pos]] == C_SPACE)
+            pos ++;
+        if (pos + 1 < n && s[pos] == '/' && (s[pos + 1] == '/' || s[pos + 1] == '*'))
+            pos = skip_comment(s, pos, n);
+        else
             break;
+    }
+
+    tok->start = pos;
+    tok->end = pos + 1;
+    tok->ends_expr = 0;
+    if (pos >= n || s[pos] == '\0') {
+        tok->type = pos >= n && !state->eof ? T_MORE : T_END;
+        tok->end = pos;
+        return tok;
+    }
+
+    switch (char_class[s[pos]]) {
+    case C_OPEN:
+        tok->type = T_OPEN;
+        break;
+    case C_CLOSE:
+        tok->type = T_CLOSE;
+        tok->ends_expr = 1;
+        break;
+    case C_OPERATOR:
+        tok->type = T_OPERATOR;
+        break;
+    case C_NAME:
+        tok->type = T_NAME;
+        while (tok->end < n && (char_class[s[tok->end]] == C_NAME
+                    || char_class[s[tok->end]] == C_DIGIT))
+            tok->end ++;
+        break;
+    case C_DIGIT:
+        /* 数字，包括 0x1f、1e5、1.5 */
+        tok->type = T_OTHER;
+        while (tok->end < n && (char_class[s[tok->end]] == C_NAME
+                    || char_class[s[tok->end]] == C_DIGIT || s[tok->end] == '.'))
+            tok->end ++;
+        tok->ends_expr = 1;
+        break;
+    case C_QUOTE:
+        tok->type = T_OTHER;
+        tok->end = skip_string(s, pos, n);
+        tok->ends_expr = 1;
+        break;
+    case C_TEMPLATE:
+        tok->type = T_OTHER;
+        tok->end = skip_template(s, pos, n);
+        tok->ends_expr = 1;
+        break;
+    case C_SLASH:
+        tok->type = T_OTHER;
+        if (!ends_expr(state)) {
+            int end = skip_regex(s, pos, n);
+            if (end > 0) {
+                tok->end = end;
+                tok->ends_expr = 1;
+            }
+            else if (end == -2 && !state->eof)
+                tok->end = n;
         }
+        break;
+    default:
+        /* 连续的标点符号是一个单词 */
+        tok->type = T_OTHER;
+        while (tok->end < n && char_class[s[tok->end]] == C_OTHER && s[tok->end] != '\0')
+            tok->end ++;
     }
-    if (is_keyword(state->source + node->source_pos, node->source_len))
-        node->type = KEYWORD;
-    return node;
+    if (tok->end >= n) {
+        tok->end = n;
+        /* 除了单个字符的括号和运算符，碰到输入末尾的单词都可能还没完 */
+        if (!state->eof && tok->type != T_OPEN && tok->type != T_CLOSE
+                && tok->type != T_OPERATOR)
+            tok->type = T_MORE;
+    }
+    return tok;
 }
 
-AstNode* parse_block(ParseState *state)
+static int is_condition_keyword(const unsigned char *str, int len)
 {
-    char start_char = state->source[state->source_pos - 1];
-    char end_char = '\0';
-    if (start_char == '{')
-        end_char = '}';
-    else if (start_char == '(')
-        end_char = ')';
-    else if (start_char = '[')
-        end_char = ']';
-    AstNode *node = create_node(state->cur_node, BLOCK, state->source_pos - 1, 0);
-    AstNode *cur_node = state->cur_node;
-    state->cur_node = node;
-    char c = next_nonspace_char(state);
-    while (c != '\0' && c != end_char) {
-        state->source_pos --;
-        AstNode *child = parse_statement(state);
-        if (child)
-            append_child(node, child);
-        c = next_nonspace_char(state);
-    }
-    node->source_len = state->source_pos - node->source_pos;
-    state->cur_node = cur_node;
-    return node;
+    return (len == 2 && memcmp(str, "if", 2) == 0)
+        || (len == 3 && memcmp(str, "for", 3) == 0)
+        || (len == 4 && memcmp(str, "with", 4) == 0)
+        || (len == 5 && memcmp(str, "while", 5) == 0);
 }
 
-AstNode* __parse_statement(ParseState *state, int testMode)
+/* 读下一个单词并移到它后面 */
+static Token *next_token(ParseState *state)
 {
-    //printf("__parse_statement(pos=%d, testMode=%d)\n", state->source_pos, testMode);
-    AstNode *node = NULL;
-    char c;
-    int source_pos = state->source_pos;
+    Token *tok = peek_token(state);
+    const unsigned char *s = state->source;
+    int depth = state->paren_depth;
 
-    c = next_nonspace_char(state);
-    if (c == '\0') {
+    tok->condition = tok->type == T_NAME
+        && is_condition_keyword(s + tok->start, tok->end - tok->start);
+    if (tok->type == T_OPEN && s[tok->start] == '(') {
+        if (depth < PAREN_DEPTH)
+            state->paren_condition[depth] = (unsigned char) state->prev.condition;
+        state->paren_depth ++;
     }
-    else if (c == '{' || c == '(' || c == '[') {
-        node = testMode ? (AstNode*)1 : parse_block(state);
+    else if (tok->type == T_CLOSE && s[tok->start] == ')' && depth > 0) {
+        /* if (x) /re/.test(y) 里的 / 不是除号 */
+        state->paren_depth --;
+        if (depth <= PAREN_DEPTH && state->paren_condition[depth - 1])
+            tok->ends_expr = 0;
     }
-    else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_') {
-        state->source_pos --;
-        node = testMode ? (AstNode*)1 : parse_name(state);
+    state->source_pos = tok->end;
+    state->prev = *tok;
+    return tok;
+}
+
+/*****************************
+ * 语法分析
+ *****************************/
+
+/* 从节点数组里分配一个节点，数组满了就加倍 */
+static int create_node(ParseState *state, NodeType type, int pos, int len)
+{
+    AST *ast = state->ast;
+    AstNode *node;
+
+    if (ast->node_count == ast->node_cap) {
+        int cap = ast->node_cap * 2;
+        AstNode *nodes = (AstNode*) realloc(ast->nodes, cap * sizeof(AstNode));
+        if (!nodes) {
+            state->failed = 1;
+            return NO_NODE;
+        }
+        ast->nodes = nodes;
+        ast->node_cap = cap;
     }
-    else if (c == ':' || c == '=') {
-        state->source_pos --;
-        node = testMode ? (AstNode*)1 : parse_operator(state);
+    node = NODE(ast, ast->node_count);
+    node->type = type;
+    node->source_pos = pos;
+    node->source_len = len;
+    node->first_child = NO_NODE;
+    node->last_child = NO_NODE;
+    node->next = NO_NODE;
+    node->prev = NO_NODE;
+    return ast->node_count ++;
+}
+
+static void append_child(AST *ast, int parent, int child)
+{
+    AstNode *p = NODE(ast, parent);
+    if (p->first_child == NO_NODE) {
+        p->first_child = child;
+        p->last_child = child;
     }
-    else if (c == '}' || c == ')' || c == ']') {
-        if (testMode) {
-            node = (AstNode*) 1;
-        }
+    else {
+        NODE(ast, p->last_child)->next = child;
+        NODE(ast, child)->prev = p->last_child;
+        p->last_child = child;
     }
-    else if (!testMode) {
-        state->source_pos --;
-        node = parse_other(state);
+}
+
+static int is_function_keyword(AstNode *node, const char *source)
+{
+    return node->type == KEYWORD
+        && node->source_len == 8
+        && memcmp(source + node->source_pos, "function", 8) == 0;
+}
+
+static int parse_statement(ParseState *state);
+
+/* 连续的 OTHER 单词合成一个节点 */
+static int parse_other(ParseState *state, Token *tok)
+{
+    int start = tok->start;
+    int end = tok->end;
+    while (peek_token(state)->type == T_OTHER)
+        end = next_token(state)->end;
+    return create_node(state, OTHER, start, end - start);
+}
+
+static int parse_name(ParseState *state, Token *tok)
+{
+    int len = tok->end - tok->start;
+    int node = create_node(state, NAME, tok->start, len);
+    if (node != NO_NODE && len == 8 && memcmp(state->source + tok->start, "function", 8) == 0)
+        NODE(state->ast, node)->type = KEYWORD;
+    return node;
+}
+
+static int parse_block(ParseState *state, Token *tok)
+{
+    const unsigned char *s = state->source;
+    unsigned char end_char;
+    int node, child;
+
+    if (s[tok->start] == '{')
+        end_char = '}';
+    else if (s[tok->start] == '(')
+        end_char = ')';
+    else
+        end_char = ']';
+    node = create_node(state, BLOCK, tok->start, 0);
+    if (node == NO_NODE)
+        return NO_NODE;
+    while (!state->failed) {
+        tok = peek_token(state);
+        if (tok->type == T_END)
+            break;
+        if (tok->type == T_CLOSE && s[tok->start] == end_char) {
+            next_token(state);
+            break;
+        }
+        child = parse_statement(state);
+        if (child != NO_NODE)
+            append_child(state->ast, node, child);
     }
-    if (testMode)
-        state->source_pos = source_pos;
+    NODE(state->ast, node)->source_len = state->source_pos - NODE(state->ast, node)->source_pos;
     return node;
 }
 
-typedef struct {
-    char *buffer;
-    int buffer_cap;
-    int buffer_len;
-    int dumped_pos;
-} InsertState;
+/* 不配对的右括号被跳过并返回 NO_NODE */
+static int parse_statement(ParseState *state)
+{
+    Token *tok = next_token(state);
+    Token copy = *tok;      /* 预读会覆盖 tok */
 
-int is_function_block(AstNode *node, char *source, AstNode **name)
+    switch (copy.type) {
+    case T_OPEN:
+        return parse_block(state, &copy);
+    case T_NAME:
+        return parse_name(state, &copy);
+    case T_OPERATOR:
+        return create_node(state, OPERATOR, copy.start, 1);
+    case T_OTHER:
+        return parse_other(state, &copy);
+    default:
+        return NO_NODE;
+    }
+}
+
+static int is_function_block(AST *ast, int index, char *source, int *name)
 {
+    AstNode *node = NODE(ast, index);
     if (node->type == BLOCK && source[node->source_pos] == '{') {
-        AstNode *prev1 = node->prev;
-        if (!prev1) return 0;
+        AstNode *prev1, *prev2, *prev3, *prev4;
+        if (node->prev == NO_NODE) return 0;
+        prev1 = NODE(ast, node->prev);
         if (prev1->type == BLOCK && source[prev1->source_pos] == '(') {
-            AstNode *prev2 = prev1->prev;
-            if (!prev2) return 0;
+            if (prev1->prev == NO_NODE) return 0;
+            prev2 = NODE(ast, prev1->prev);
             if (prev2->type == NAME) {
-                AstNode *prev3 = prev2->prev;
-                if (!prev3) return 0;
+                if (prev2->prev == NO_NODE) return 0;
+                prev3 = NODE(ast, prev2->prev);
                 if (is_function_keyword(prev3, source)) {
                     if (name)
-                        *name = prev2;
+                        *name = prev1->prev;
                     return 1;
                 }
             }
             else if (is_function_keyword(prev2, source)) {
-                AstNode *prev3 = prev2->prev;
-                if (!prev3) return 0;
+                if (prev2->prev == NO_NODE) return 0;
+                prev3 = NODE(ast, prev2->prev);
                 if (prev3->type == OPERATOR && (source[prev3->source_pos] == ':' || source[prev3->source_pos] == '=')) {
-                    AstNode *prev4 = prev3->prev;
-                    if (!prev4) return 0;
+                    if (prev3->prev == NO_NODE) return 0;
+                    prev4 = NODE(ast, prev3->prev);
                     if (prev4->type == NAME) {
                         if (name)
-                            *name = prev4;
+                            *name = prev3->prev;
                         return 1;
                     }
                 }
@@ -239,121 +528,1369 @@ int is_function_block(AstNode *node, char *source, AstNode **name)
     return 0;
 }
 
-void append_source(InsertState *state, const char *source, int source_len)
+/*****************************
+ * 插入性能分析代码
+ *
+ * 不建语法树，边读单词边输出。每层括号只记住最近的 4 个兄弟节点，
+ * 足够认出 function name(...) { 和 name = function(...) {，和
+ * is_function_block() 的规则一样。入口日志在读到 { 时输出，出口日志在
+ * 读到配对的 } 时输出，所以源码可以一段一段地输入，每段只留下最后
+ * 没读完的单词等下一段。
+ *
+ * 计时模式不用 console.log：脚本开头插入一小段运行时，每个函数编号，
+ * 函数体包在 try { } finally { } 里，进出时用 performance.now() 计时，
+ * 调用次数、总时间和自身时间累加在 Float64Array 里，隔一会儿或者页面
+ * 隐藏时用 navigator.sendBeacon 批量发给 endpoint。函数名要到最后才
+ * 知道，放在脚本末尾。为了不破坏 "use strict"，运行时和函数入口代码
+ * 都插在开头的字符串语句后面。
+ *
+ * 可以只插入一部分函数：函数体太小的（读到 { 时往后看 min_body 个
+ * 字节，不够的话等下一段输入）、按函数名抽样没抽中的、不在 only 名单
+ * 里的和 filter 不要的都不插入。
+ *****************************/
+
+#define NAME_SIZE 64
+#define HISTORY 4
+
+/* 没读完的单词超过这么长就不再分析，原样输出 */
+#define MAX_PENDING (1024 * 1024)
+
+/* 兄弟节点 */
+typedef struct {
+    unsigned char type;         /* NodeType */
+    unsigned char c;            /* 括号或运算符 */
+    char name[NAME_SIZE];       /* 名字 */
+} Sibling;
+
+/* 一层括号 */
+typedef struct {
+    unsigned char open_char;
+    unsigned char function;     /* 是函数体，出口要插入日志 */
+    char name[NAME_SIZE];       /* 函数名 */
+    int id;                     /* 计时：函数编号 */
+    Sibling history[HISTORY];   /* 最近的兄弟节点，环形缓冲 */
+    int count;                  /* 一共有过几个兄弟节点 */
+} Frame;
+
+/* 往前数第 i 个兄弟节点，i 从 1 开始 */
+#define SIBLING(frame, i) (&(frame)->history[((frame)->count - (i)) % HISTORY])
+
+typedef struct {
+    char *buffer;
+    int buffer_cap;
+    int buffer_len;
+    int failed;
+} InsertState;
+
+/* 源码映射：segments 里每段四个数，输出的行、列和原来的行、列，
+ * 原来的行为 -1 表示插入的代码，没有对应的源码 */
+typedef struct {
+    int *segments;
+    int count;
+    int cap;
+    int gen_line, gen_col;
+    int orig_line, orig_col;
+    int in_name;                /* 上一个字符是名字的一部分 */
+    int mapped;                 /* 最后一段是原来的源码 */
+    InsertState content;        /* 原来的源码，放进 sourcesContent */
+    int url_match;              /* 匹配到了 MAP_URL 的第几个字符 */
+    int url_reading;            /* 正在读 sourceMappingURL 的地址 */
+    InsertState url;            /* 最后一个 sourceMappingURL 的地址 */
+} SourceMap;
+
+struct JsStream_t {
+    ParseState lex;
+    char *input;                /* 上一段留下的输入 */
+    int input_len;
+    int input_cap;
+    int dumped_pos;             /* 当前输入里已经输出到的位置 */
+    Frame *frames;              /* frames[0] 是最外层 */
+    int depth;
+    int frame_cap;
+    int passthrough;            /* 不再分析，原样输出 */
+    InsertState out;
+    JsProfileMode mode;
+    char tag[32];
+    char *endpoint;
+    int pending;                /* 计时：这一层的入口代码还没插入，-1 表示没有；
+                                   0 表示运行时还没插入 */
+    int pending_pos;            /* 计时：开头没有以 ; 结束的字符串的位置，-1 表示没有 */
+    int finished;               /* 计时：已经输出了末尾的函数名 */
+    int resume_pos;             /* 留下的输入里从这里接着读 */
+    char (*names)[NAME_SIZE];   /* 计时：按编号排的函数名 */
+    int name_count;
+    int name_cap;
+    int function_count;         /* 插入了代码的函数个数 */
+    int min_body;               /* 以下同 JsOptions */
+    int sample;
+    char **only;                /* 排好序，和名字放在一块内存里 */
+    int only_count;
+    int (*filter)(const char *name, void *data);
+    void *filter_data;
+    SourceMap *map;             /* 生成源码映射，NULL 表示不生成 */
+};
+
+/* 计时模式的运行时，参数是脚本地址和 endpoint，返回这个脚本的计数器 */
+static const char timing_runtime[] =
+    "(function(u,ep){"
+    "var w=typeof self!=\"undefined\"?self:window,r=w.__tp;"
+    "if(!r){"
+    "var p=w.performance,now=p&&p.now?function(){return p.now()}:function(){return +new Date},"
+    "t0=[],kid=[],all=[],timer=0,"
+    "flush=function(){var o=\"\",i,j,s,a;timer=0;"
+    "for(i=0;i<all.length;i++){s=all[i];if(!s.dirty)continue;s.dirty=0;a=s.a;o+=\"U \"+s.u+\"\\n\";"
+    "for(j=0;j<a.length;j+=3)if(a[j]){"
+    "o+=\"F \"+j/3+\" \"+a[j]+\" \"+a[j+1].toFixed(3)+\" \"+a[j+2].toFixed(3)+\" \"+(s.n[j/3]||\"#\"+j/3)+\"\\n\";"
+    "a[j]=a[j+1]=a[j+2]=0}}"
+    "if(o&&ep&&w.navigator&&w.navigator.sendBeacon)w.navigator.sendBeacon(ep,o)};"
+    "r=w.__tp={d:0,s:function(u){"
+    "var s={u:u,n:[],a:new Float64Array(192),dirty:0,"
+    "e:function(){t0[r.d]=now();kid[r.d]=0;return r.d++},"
+    "x:function(i,D){var t=now()-t0[D],a=s.a,b;r.d=D;if(D>0)kid[D-1]+=t;"
+    "if(3*i>=a.length){b=new Float64Array(Math.max(2*a.length,3*i+3));b.set(a);a=s.a=b}"
+    "a[3*i]++;a[3*i+1]+=t;a[3*i+2]+=t-kid[D];"
+    "if(!s.dirty){s.dirty=1;if(!timer)timer=setTimeout(flush,2000)}}};"
+    "all.push(s);return s}};"
+    "if(w.addEventListener)w.addEventListener(\"pagehide\",flush);"
+    "if(w.document)w.document.addEventListener(\"visibilitychange\",function(){"
+    "if(w.document.visibilityState==\"hidden\")flush()})}"
+    "return r.s(u)})"
+    "(typeof document!=\"undefined\"&&document.currentScript&&document.currentScript.src"
+    "||(typeof location!=\"undefined\"?location.href:\"\"),";
+
+static void append_source(InsertState *state, const char *source, int source_len)
 {
-    if (source_len == 0)
+    char *buffer;
+    int buffer_cap;
+
+    if (source_len <= 0 || state->failed)
         return;
     if (state->buffer_len + source_len > state->buffer_cap) {
-        if (source_len > state->buffer_cap)
-            state->buffer_cap += source_len;
-        else
-            state->buffer_cap *= 2;
-        state->buffer = (char*) realloc(state->buffer, state->buffer_cap);
+        buffer_cap = state->buffer_cap * 2;
+        if (buffer_cap < state->buffer_len + source_len)
+            buffer_cap = state->buffer_len + source_len;
+        buffer = (char*) realloc(state->buffer, buffer_cap);
+        if (!buffer) {
+            state->failed = 1;
+            return;
+        }
+        state->buffer = buffer;
+        state->buffer_cap = buffer_cap;
     }
     memcpy(state->buffer + state->buffer_len, source, source_len);
     state->buffer_len += source_len;
 }
 
-void __insert_profile_codes(AstNode *node, char *source, InsertState *state)
-{
-    if (!node) return;
-    AstNode *name_node = NULL;
-    char name[64];
-    char code[128];
-    int profiling = 0;
-    if (is_function_block(node, source, &name_node)) {
-        //插入源码
-        append_source(state, source + state->dumped_pos, node->source_pos + 1 - state->dumped_pos);
-        state->dumped_pos = node->source_pos + 1;
-        //函数名称
-        int name_len = name_node->source_len;
-        if (name_len > sizeof(name) - 1)
-            name_len = sizeof(name) - 1;
-        memcpy(name, source + name_node->source_pos, name_len);
-        name[name_len] = '\0';
-        //进入函数日志
-        snprintf(code, sizeof(code), "console.log(\"%s\");if (window.dump) window.dump(\"jsconsole# %s\\n\");\n", name, name);
-        append_source(state, code, strlen(code));
-        profiling = 1;
-    }
-    AstNode *child = node->first_child;
-    while (child) {
-        __insert_profile_codes(child, source, state);
-        child = child->next;
-    }
-    if (profiling) {
-        //函数体
-        append_source(state, source + state->dumped_pos, node->source_pos + node->source_len - 1 - state->dumped_pos);
-        state->dumped_pos = node->source_pos + node->source_len - 1;
-        //退出函数日志
-        snprintf(code, sizeof(code), "console.log(\"<<%s\");if (window.dump) window.dump(\"jsconsole# <<%s\\n\");\n", name, name);
-        append_source(state, code, strlen(code));
-    }
-
-}
-
-void insert_profile_codes(AST *ast, char *source, int source_len,
-        char **new_source, int *new_source_len)
+/*****************************
+ * 源码映射
+ *
+ * 输出时同时记下输出的位置和原来的位置。原样输出的源码在开头、每行
+ * 开头和每个名字开头各记一段，插入的代码记一段没有源码的，所以断点和
+ * 调用栈能精确到名字。列数按 UTF-16 计。原来的源码末尾的
+ * sourceMappingURL 也在这里找出来，是 data: 地址的话生成映射时和它
+ * 合成，映射到更早的源码。
+ *****************************/
+
+#define MAP_URL "//# sourceMappingURL="
+
+/* 地址比这还长（内嵌的映射太大）就不要了 */
+#define MAX_MAP_URL (64 * 1024 * 1024)
+
+static void add_segment(JsStream *js, int orig_line, int orig_col)
 {
-    InsertState state;
-    state.buffer_cap = 1024;
-    state.buffer = (char*) malloc(state.buffer_cap);
-    state.buffer_len = 0;
-    state.dumped_pos = 0;
-    __insert_profile_codes(ast->root, source, &state);
-    append_source(&state, source + state.dumped_pos, source_len - state.dumped_pos);
-    *new_source = state.buffer;
-    *new_source_len = state.buffer_len;
+    SourceMap *map = js->map;
+    int *seg;
+
+    /* 同一个位置只留最后一段 */
+    if (map->count > 0) {
+        seg = map->segments + (map->count - 1) * 4;
+        if (seg[0] == map->gen_line && seg[1] == map->gen_col) {
+            seg[2] = orig_line;
+            seg[3] = orig_col;
+            return;
+        }
+    }
+    if (map->count == map->cap) {
+        int cap = map->cap ? map->cap * 2 : 1024;
+        int *segments = (int*) realloc(map->segments, cap * 4 * sizeof(int));
+        if (!segments) {
+            js->out.failed = 1;
+            return;
+        }
+        map->segments = segments;
+        map->cap = cap;
+    }
+    seg = map->segments + map->count * 4;
+    seg[0] = map->gen_line;
+    seg[1] = map->gen_col;
+    seg[2] = orig_line;
+    seg[3] = orig_col;
+    map->count ++;
 }
 
-AstNode* parse(char *source, int source_len)
+/* 在原来的源码里找 "//# sourceMappingURL=" 或者 "//@ sourceMappingURL="，
+ * 记下最后一个的地址 */
+static void find_map_url(SourceMap *map, unsigned char c)
 {
-    AstNode *root, *node;
-    ParseState state;
+    static const char pattern[] = MAP_URL;
+    char ch = (char) c;
 
-    root = create_node(NULL, OTHER, 0, source_len);
+    if (map->url_reading) {
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '"' || c == '\'')
+            map->url_reading = 0;
+        else if (map->url.buffer_len < MAX_MAP_URL)
+            append_source(&map->url, &ch, 1);
+        return;
+    }
+    if (ch == pattern[map->url_match] || (map->url_match == 2 && c == '@'))
+        map->url_match ++;
+    else if (c == '/')
+        map->url_match = map->url_match == 2 ? 2 : 1;
+    else
+        map->url_match = 0;
+    if (pattern[map->url_match] == '\0') {
+        map->url_match = 0;
+        map->url_reading = 1;
+        map->url.buffer_len = 0;
+        map->url.failed = 0;
+    }
+}
 
-    state.cur_node = root;
-    state.source = source;
-    state.source_len = source_len;
-    state.source_pos = 0;
-    state.block_start = -1;
+/* 原样输出的源码 */
+static void map_copied(JsStream *js, const char *source, int len)
+{
+    SourceMap *map = js->map;
+    const unsigned char *s = (const unsigned char*) source;
+    int i, c;
 
-    while (node = parse_statement(&state)) {
-        append_child(root, node);
+    if (!map || len <= 0)
+        return;
+    append_source(&map->content, source, len);
+    if (map->content.failed)
+        js->out.failed = 1;
+    for (i = 0; i < len; i ++) {
+        c = char_class[s[i]];
+        if (i == 0 || map->gen_col == 0 || (c == C_NAME && !map->in_name))
+            add_segment(js, map->orig_line, map->orig_col);
+        map->in_name = c == C_NAME || c == C_DIGIT;
+        if (s[i] == '\n') {
+            map->gen_line ++;
+            map->gen_col = 0;
+            map->orig_line ++;
+            map->orig_col = 0;
+        }
+        else if ((s[i] & 0xc0) != 0x80) {
+            c = s[i] >= 0xf0 ? 2 : 1;   /* 4 字节的 UTF-8 是两个 UTF-16 */
+            map->gen_col += c;
+            map->orig_col += c;
+        }
+        if (s[i] == '/' || map->url_match || map->url_reading)
+            find_map_url(map, s[i]);
     }
-    return root;
+    map->mapped = 1;
 }
 
-char *read_file(char *path, int *psize)
-{  
-    char *buffer = NULL;
-    FILE *file = fopen(path, "r");
-    if (file) {
-        fseek(file, 0, SEEK_END);
-        int size = ftell(file);
-        if (size > 0) {
-            fseek(file, 0, SEEK_SET);
-            buffer = malloc(size);
-            *psize = fread(buffer, 1, size, file);
+/* 插入的代码 */
+static void map_inserted(JsStream *js, const char *code, int len)
+{
+    SourceMap *map = js->map;
+    int i;
+
+    if (!map || len <= 0)
+        return;
+    if (map->mapped) {
+        add_segment(js, -1, 0);
+        map->mapped = 0;
+    }
+    for (i = 0; i < len; i ++) {
+        if (code[i] == '\n') {
+            map->gen_line ++;
+            map->gen_col = 0;
         }
-        fclose(file);
+        else if ((code[i] & 0xc0) != 0x80)
+            map->gen_col ++;
+    }
+    map->in_name = 0;
+}
+
+static void free_map(SourceMap *map)
+{
+    if (!map)
+        return;
+    free(map->segments);
+    free(map->content.buffer);
+    free(map->url.buffer);
+    free(map);
+}
+
+/* 输出到当前输入的 pos 位置 */
+static void dump_to(JsStream *js, int pos)
+{
+    if (pos > js->dumped_pos) {
+        map_copied(js, (const char*) js->lex.source + js->dumped_pos, pos - js->dumped_pos);
+        append_source(&js->out, (const char*) js->lex.source + js->dumped_pos, pos - js->dumped_pos);
+        js->dumped_pos = pos;
+    }
+}
+
+/* 输出插入的代码 */
+static void insert_code(JsStream *js, const char *code, int len)
+{
+    map_inserted(js, code, len);
+    append_source(&js->out, code, len);
+}
+
+static void append_string(JsStream *js, const char *str)
+{
+    insert_code(js, str, strlen(str));
+}
+
+/* 计时：脚本开头的运行时 */
+static void append_runtime(JsStream *js)
+{
+    append_string(js, ";var __tp_");
+    append_string(js, js->tag);
+    append_string(js, "=");
+    append_string(js, timing_runtime);
+    if (js->endpoint) {
+        append_string(js, "\"");
+        append_string(js, js->endpoint);
+        append_string(js, "\");\n");
+    }
+    else
+        append_string(js, "\"\");\n");
+}
+
+/* 计时：脚本末尾的函数名 */
+static void append_names(JsStream *js)
+{
+    int i;
+    append_string(js, "\n;__tp_");
+    append_string(js, js->tag);
+    append_string(js, ".n=[");
+    for (i = 0; i < js->name_count; i ++) {
+        append_string(js, i ? ",\"" : "\"");
+        append_string(js, js->names[i]);
+        append_string(js, "\"");
     }
-    return buffer;
+    append_string(js, "];\n");
 }
 
-int write_file(char *path, char *buffer, int size)
+/* 运行时插入了，末尾的函数名还没输出 */
+static int needs_names(JsStream *js)
 {
-    int result = 0;
-    FILE *file = fopen(path, "w");
-    if (file) {
-        result = fwrite(buffer, 1, size, file);
-        fclose(file);
+    return js->mode == JS_PROFILE_TIMING && js->pending != 0 && !js->finished;
+}
+
+/* 给函数编号并记下函数名 */
+static int add_function(JsStream *js, const char *name)
+{
+    if (js->name_count == js->name_cap) {
+        int cap = js->name_cap ? js->name_cap * 2 : 64;
+        char (*names)[NAME_SIZE] = (char (*)[NAME_SIZE]) realloc(js->names, cap * NAME_SIZE);
+        if (!names) {
+            js->out.failed = 1;
+            return 0;
+        }
+        js->names = names;
+        js->name_cap = cap;
     }
-    return result;
+    strcpy(js->names[js->name_count], name);
+    return js->name_count ++;
+}
+
+static void append_enter_code(JsStream *js, Frame *frame)
+{
+    char code[256];
+    if (js->mode == JS_PROFILE_TIMING)
+        snprintf(code, sizeof(code), "var __tpD=__tp_%s.e();try{", js->tag);
+    else
+        snprintf(code, sizeof(code), "console.log(\"%s\");if (window.dump) window.dump(\"jsconsole# %s\\n\");\n", frame->name, frame->name);
+    insert_code(js, code, strlen(code));
+}
+
+static void append_exit_code(JsStream *js, Frame *frame)
+{
+    char code[256];
+    if (js->mode == JS_PROFILE_TIMING)
+        snprintf(code, sizeof(code), "\n}finally{__tp_%s.x(%d,__tpD)}", js->tag, frame->id);
+    else
+        snprintf(code, sizeof(code), ";console.log(\"<<%s\");if (window.dump) window.dump(\"jsconsole# <<%s\\n\");\n", frame->name, frame->name);
+    insert_code(js, code, strlen(code));
+}
+
+/* 计时：在 pos 插入还没插入的入口代码 */
+static void flush_pending(JsStream *js, int pos)
+{
+    if (js->pending < 0)
+        return;
+    dump_to(js, pos);
+    if (js->pending == 0)
+        append_runtime(js);
+    else
+        append_enter_code(js, &js->frames[js->pending]);
+    js->pending = -1;
+    js->pending_pos = -1;
 }
 
-void print_source(const char *source, int source_len, Bool single_line)
+/* 计时：开头的 "use strict"; 这样的字符串语句后面才能插入代码。
+ * 字符串后面跟的不是 ; 时（比如 "string"==typeof x）插在字符串前面 */
+static void check_directive(JsStream *js, Token *tok)
+{
+    const unsigned char *s = js->lex.source;
+    int i;
+    if (tok->type == T_OTHER) {
+        if (s[tok->start] == '"' || s[tok->start] == '\'') {
+            if (js->pending_pos < 0)
+                js->pending_pos = tok->start;
+            return;
+        }
+        for (i = tok->start; i < tok->end && s[i] == ';'; i ++)
+            ;
+        if (i == tok->end) {
+            js->pending_pos = -1;
+            return;
+        }
+    }
+    flush_pending(js, js->pending_pos >= 0 ? js->pending_pos : tok->start);
+}
+
+static Sibling *add_sibling(Frame *frame, NodeType type, unsigned char c)
+{
+    Sibling *sibling = &frame->history[frame->count % HISTORY];
+    frame->count ++;
+    sibling->type = type;
+    sibling->c = c;
+    return sibling;
+}
+
+/* 下一个兄弟节点是 { 时，判断它是不是函数体 */
+static const char *function_name(Frame *frame)
+{
+    Sibling *prev1, *prev2, *prev3, *prev4;
+    if (frame->count < 3)
+        return NULL;
+    prev1 = SIBLING(frame, 1);
+    if (prev1->type != BLOCK || prev1->c != '(')
+        return NULL;
+    prev2 = SIBLING(frame, 2);
+    prev3 = SIBLING(frame, 3);
+    if (prev2->type == NAME && prev3->type == KEYWORD)
+        return prev2->name;
+    if (prev2->type == KEYWORD && prev3->type == OPERATOR
+            && (prev3->c == ':' || prev3->c == '=') && frame->count >= 4) {
+        prev4 = SIBLING(frame, 4);
+        if (prev4->type == NAME)
+            return prev4->name;
+    }
+    return NULL;
+}
+
+static int compare_names(const void *a, const void *b)
+{
+    return strcmp(*(char* const*) a, *(char* const*) b);
+}
+
+/* 按函数名抽样，同一个名字每次都一样 */
+static int sampled(JsStream *js, const char *name)
+{
+    unsigned int h = 2166136261U;
+    for (; *name; name ++)
+        h = (h ^ (unsigned char) *name) * 16777619U;
+    h ^= h >> 16;
+    h = (h * 0x85ebca6bU) & 0xffffffffU;
+    h ^= h >> 13;
+    return (int) (h % 100) < js->sample;
+}
+
+static int function_wanted(JsStream *js, const char *name)
+{
+    if (js->sample > 0 && js->sample < 100 && !sampled(js, name))
+        return 0;
+    if (js->only && !bsearch(&name, js->only, js->only_count, sizeof(char*), compare_names))
+        return 0;
+    if (js->filter && !js->filter(name, js->filter_data))
+        return 0;
+    return 1;
+}
+
+/* 下一个单词是函数体的 {，看它是不是不到 min_body 个字节：是返回 1，
+ * 不是返回 0，要等下一段输入返回 -1 */
+static int small_body(JsStream *js)
+{
+    ParseState look = js->lex;
+    Token *tok = next_token(&look);
+    int body_start = tok->end, depth = 1;
+
+    for (;;) {
+        tok = peek_token(&look);
+        if (tok->start - body_start >= js->min_body)
+            return 0;
+        if (tok->type == T_MORE)
+            return -1;
+        if (tok->type == T_END)
+            return 0;
+        next_token(&look);
+        if (tok->type == T_OPEN)
+            depth ++;
+        else if (tok->type == T_CLOSE && -- depth == 0)
+            return 1;
+    }
+}
+
+/* small 为 1 时是太小的函数体 */
+static void open_block(JsStream *js, Token *tok, int small)
+{
+    const char *name;
+    Frame *frame;
+    unsigned char c = js->lex.source[tok->start];
+
+    if (js->depth + 1 == js->frame_cap) {
+        int cap = js->frame_cap * 2;
+        Frame *frames = (Frame*) realloc(js->frames, cap * sizeof(Frame));
+        if (!frames) {
+            js->out.failed = 1;
+            return;
+        }
+        js->frames = frames;
+        js->frame_cap = cap;
+    }
+    name = c == '{' ? function_name(&js->frames[js->depth]) : NULL;
+    if (name && (small || !function_wanted(js, name)))
+        name = NULL;
+    frame = &js->frames[++ js->depth];
+    frame->open_char = c;
+    frame->count = 0;
+    frame->function = name != NULL;
+    if (name) {
+        js->function_count ++;
+        strcpy(frame->name, name);
+        if (js->mode == JS_PROFILE_TIMING) {
+            frame->id = add_function(js, name);
+            js->pending = js->depth;
+            js->pending_pos = -1;
+        }
+        else {
+            dump_to(js, tok->end);
+            append_enter_code(js, frame);
+        }
+    }
+}
+
+/* 不配对的右括号被跳过，最外层的右括号后面都原样输出 */
+static void close_block(JsStream *js, Token *tok)
+{
+    Frame *frame = &js->frames[js->depth];
+    unsigned char c = js->lex.source[tok->start];
+
+    if (js->depth == 0) {
+        js->passthrough = 1;
+        return;
+    }
+    if ((frame->open_char == '{' && c != '}') || (frame->open_char == '(' && c != ')')
+            || (frame->open_char == '[' && c != ']'))
+        return;
+    if (frame->function) {
+        dump_to(js, tok->start);
+        append_exit_code(js, frame);
+    }
+    js->depth --;
+    add_sibling(&js->frames[js->depth], BLOCK, frame->open_char);
+}
+
+static void add_name(JsStream *js, Token *tok)
+{
+    int len = tok->end - tok->start;
+    const unsigned char *s = js->lex.source + tok->start;
+    Sibling *sibling = add_sibling(&js->frames[js->depth],
+            len == 8 && memcmp(s, "function", 8) == 0 ? KEYWORD : NAME, 0);
+    if (len > NAME_SIZE - 1)
+        len = NAME_SIZE - 1;
+    memcpy(sibling->name, s, len);
+    sibling->name[len] = '\0';
+}
+
+/* 输入结束时还没配对的函数体，出口日志插在最后一个单词的最后一个字符前面 */
+static void close_all(JsStream *js)
+{
+    int end = js->lex.source_pos - 1;
+    int i;
+    flush_pending(js, js->pending > 0 ? end : js->lex.source_pos);
+    for (i = js->depth; i > 0; i --) {
+        if (js->frames[i].function) {
+            dump_to(js, end);
+            append_exit_code(js, &js->frames[i]);
+        }
+    }
+    js->depth = 0;
+}
+
+JsStream *js_stream_new(const JsOptions *options)
+{
+    JsStream *js = (JsStream*) calloc(1, sizeof(JsStream));
+    if (!js)
+        return NULL;
+    js->frame_cap = 16;
+    js->frames = (Frame*) malloc(js->frame_cap * sizeof(Frame));
+    if (!js->frames || js_stream_reset(js, options) < 0) {
+        js_stream_free(js);
+        return NULL;
+    }
+    return js;
+}
+
+/* 分配好的缓冲区都留着，处理很多文件时不用每次重新分配 */
+int js_stream_reset(JsStream *js, const JsOptions *options)
+{
+    memset(&js->lex, 0, sizeof(js->lex));
+    js->lex.prev.type = T_END;
+    js->input_len = 0;
+    js->dumped_pos = 0;
+    js->depth = 0;
+    js->passthrough = 0;
+    js->out.buffer_len = 0;
+    js->out.failed = 0;
+    js->mode = JS_PROFILE_LOG;
+    js->tag[0] = '\0';
+    free(js->endpoint);
+    js->endpoint = NULL;
+    js->pending = -1;
+    js->pending_pos = -1;
+    js->finished = 0;
+    js->resume_pos = 0;
+    js->name_count = 0;
+    js->function_count = 0;
+    free(js->only);
+    js->only = NULL;
+    js->only_count = 0;
+    js->min_body = options ? options->min_body : 0;
+    if (js->min_body > MAX_PENDING / 2)
+        js->min_body = MAX_PENDING / 2;
+    js->sample = options ? options->sample : 0;
+    js->filter = options ? options->filter : NULL;
+    js->filter_data = options ? options->filter_data : NULL;
+    if (options && options->only) {
+        int i, size = options->only_count * sizeof(char*);
+        char *p;
+        for (i = 0; i < options->only_count; i ++)
+            size += strlen(options->only[i]) + 1;
+        js->only = (char**) malloc(size > 0 ? size : 1);
+        if (!js->only)
+            return -1;
+        p = (char*) (js->only + options->only_count);
+        for (i = 0; i < options->only_count; i ++) {
+            js->only[i] = p;
+            strcpy(p, options->only[i]);
+            p += strlen(p) + 1;
+        }
+        js->only_count = options->only_count;
+        qsort(js->only, js->only_count, sizeof(char*), compare_names);
+    }
+    js->frames[0].open_char = 0;
+    js->frames[0].function = 0;
+    js->frames[0].count = 0;
+    if (options && options->source_map) {
+        if (!js->map) {
+            js->map = (SourceMap*) calloc(1, sizeof(SourceMap));
+            if (!js->map)
+                return -1;
+        }
+        js->map->count = 0;
+        js->map->gen_line = js->map->gen_col = 0;
+        js->map->orig_line = js->map->orig_col = 0;
+        js->map->in_name = 0;
+        js->map->mapped = 0;
+        js->map->content.buffer_len = 0;
+        js->map->content.failed = 0;
+        js->map->url_match = 0;
+        js->map->url_reading = 0;
+        js->map->url.buffer_len = 0;
+        js->map->url.failed = 0;
+    }
+    else {
+        free_map(js->map);
+        js->map = NULL;
+    }
+    if (options && options->mode == JS_PROFILE_TIMING) {
+        js->mode = JS_PROFILE_TIMING;
+        strncpy(js->tag, options->tag, sizeof(js->tag) - 1);
+        js->tag[sizeof(js->tag) - 1] = '\0';
+        if (options->endpoint) {
+            js->endpoint = (char*) malloc(strlen(options->endpoint) + 1);
+            if (!js->endpoint)
+                return -1;
+            strcpy(js->endpoint, options->endpoint);
+        }
+        js->pending = 0;
+    }
+    return 0;
+}
+
+int js_stream_functions(JsStream *js)
+{
+    return js->function_count;
+}
+
+void js_stream_free(JsStream *js)
+{
+    if (!js)
+        return;
+    free(js->input);
+    free(js->frames);
+    free(js->endpoint);
+    free(js->names);
+    free(js->out.buffer);
+    free(js->only);
+    free_map(js->map);
+    free(js);
+}
+
+/* 成功返回 0，内存不足返回 -1 */
+int js_stream_feed(JsStream *js, char *data, int len, int eof,
+        char **out, int *out_len)
+{
+    ParseState *lex = &js->lex;
+    Token *tok;
+    Token copy;
+    int rest, small;
+
+    js->out.buffer_len = 0;
+    *out = NULL;
+    *out_len = 0;
+    if (js->out.failed)
+        return -1;
+    if (js->passthrough) {
+        map_copied(js, data, len);
+        if (js->out.failed)
+            return -1;
+        if (!eof || !needs_names(js)) {
+            *out = data;
+            *out_len = len;
+            return 0;
+        }
+        append_source(&js->out, data, len);
+        append_names(js);
+        js->finished = 1;
+        if (js->out.failed)
+            return -1;
+        *out = js->out.buffer;
+        *out_len = js->out.buffer_len;
+        return 0;
+    }
+
+    /* 没有留下的输入时直接在 data 上分析，否则接在后面 */
+    if (js->input_len == 0) {
+        lex->source = (const unsigned char*) data;
+        lex->source_len = len;
+    }
+    else {
+        if (js->input_len + len > js->input_cap) {
+            int cap = js->input_cap * 2;
+            char *input;
+            if (cap < js->input_len + len)
+                cap = js->input_len + len;
+            input = (char*) realloc(js->input, cap);
+            if (!input) {
+                js->out.failed = 1;
+                return -1;
+            }
+            js->input = input;
+            js->input_cap = cap;
+        }
+        memcpy(js->input + js->input_len, data, len);
+        js->input_len += len;
+        lex->source = (const unsigned char*) js->input;
+        lex->source_len = js->input_len;
+    }
+    lex->source_pos = js->resume_pos;
+    lex->peek_pos = -1;
+    lex->eof = eof;
+    js->dumped_pos = 0;
+
+    while (!js->out.failed && !js->passthrough) {
+        tok = peek_token(lex);
+        if (tok->type == T_MORE)
+            break;
+        if (tok->type == T_END) {
+            /* 输入结束或者碰到 \0，剩下的原样输出 */
+            close_all(js);
+            js->passthrough = 1;
+            break;
+        }
+        small = 0;
+        if (tok->type == T_OPEN && js->min_body > 0 && lex->source[tok->start] == '{'
+                && function_name(&js->frames[js->depth])) {
+            small = small_body(js);
+            if (small < 0)
+                break;
+        }
+        copy = *next_token(lex);
+        if (js->pending >= 0)
+            check_directive(js, &copy);
+        switch (copy.type) {
+        case T_OPEN:
+            open_block(js, &copy, small);
+            break;
+        case T_CLOSE:
+            close_block(js, &copy);
+            break;
+        case T_NAME:
+            add_name(js, &copy);
+            break;
+        case T_OPERATOR:
+            add_sibling(&js->frames[js->depth], OPERATOR, lex->source[copy.start]);
+            break;
+        default:
+            add_sibling(&js->frames[js->depth], OTHER, 0);
+        }
+    }
+
+    if (lex->source_len - lex->source_pos > MAX_PENDING)
+        js->passthrough = 1;
+    if (js->passthrough)
+        dump_to(js, lex->source_len);
+    else if (js->pending >= 0 && js->pending_pos >= 0)
+        dump_to(js, js->pending_pos);   /* 代码可能要插在这个字符串前面 */
+    else
+        dump_to(js, lex->source_pos);
+    if (eof && needs_names(js)) {
+        append_names(js);
+        js->finished = 1;
+    }
+    if (js->out.failed)
+        return -1;
+
+    /* 留下没读完的单词；上一个名字马上要被移走，先判断好它后面的 / */
+    if (lex->prev.type == T_NAME) {
+        lex->prev.ends_expr = ends_expr(lex);
+        lex->prev.type = T_OTHER;
+    }
+    rest = lex->source_len - js->dumped_pos;
+    if (rest > 0) {
+        if (rest > js->input_cap) {
+            char *input = (char*) malloc(rest);
+            if (!input) {
+                js->out.failed = 1;
+                return -1;
+            }
+            memcpy(input, lex->source + js->dumped_pos, rest);
+            free(js->input);
+            js->input = input;
+            js->input_cap = rest;
+        }
+        else
+            memmove(js->input, lex->source + js->dumped_pos, rest);
+    }
+    else if (rest < 0)
+        rest = 0;
+    js->input_len = rest;
+    js->resume_pos = rest > 0 ? lex->source_pos - js->dumped_pos : 0;
+    if (js->pending_pos >= 0)
+        js->pending_pos -= js->dumped_pos;
+
+    *out = js->out.buffer;
+    *out_len = js->out.buffer_len;
+    return 0;
+}
+
+/*****************************
+ * 生成源码映射（Source Map 第 3 版）
+ *
+ * 原来的源码带着映射时，只用到它的 mappings，sources、sourcesContent、
+ * names 原样照抄，所以只需要跳过 JSON 值，不用完整地解析。两边的段都是
+ * 按位置排好的，合成时一起往前走一遍就行。
+ *****************************/
+
+static const char base64_digits[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static int base64_value(unsigned char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;
+}
+
+static void put_string(InsertState *out, const char *str)
+{
+    append_source(out, str, strlen(str));
+}
+
+static void put_vlq(InsertState *out, int value)
+{
+    char buf[8];
+    unsigned int v = value < 0 ? ((unsigned int) -value << 1) | 1 : (unsigned int) value << 1;
+    int n = 0, digit;
+
+    do {
+        digit = v & 31;
+        v >>= 5;
+        if (v)
+            digit |= 32;
+        buf[n ++] = base64_digits[digit];
+    } while (v);
+    append_source(out, buf, n);
+}
+
+/* 读一个 VLQ 数，成功返回 0 */
+static int get_vlq(const char *s, int *pos, int end, int *value)
+{
+    unsigned int v = 0;
+    int shift = 0, digit;
+
+    do {
+        if (*pos >= end || shift > 30)
+            return -1;
+        digit = base64_value(s[(*pos) ++]);
+        if (digit < 0)
+            return -1;
+        v |= (unsigned int) (digit & 31) << shift;
+        shift += 5;
+    } while (digit & 32);
+    *value = v & 1 ? -(int) (v >> 1) : (int) (v >> 1);
+    return 0;
+}
+
+static void put_json_string(InsertState *out, const char *str, int len)
+{
+    char buf[8];
+    int i, start = 0;
+
+    append_source(out, "\"", 1);
+    for (i = 0; i < len; i ++) {
+        unsigned char c = str[i];
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+        append_source(out, str + start, i - start);
+        start = i + 1;
+        if (c == '\n')
+            put_string(out, "\\n");
+        else if (c == '\r')
+            put_string(out, "\\r");
+        else if (c == '\t')
+            put_string(out, "\\t");
+        else if (c == '"' || c == '\\') {
+            buf[0] = '\\';
+            buf[1] = c;
+            append_source(out, buf, 2);
+        }
+        else {
+            sprintf(buf, "\\u%04x", c);
+            put_string(out, buf);
+        }
+    }
+    append_source(out, str + start, len - start);
+    append_source(out, "\"", 1);
+}
+
+static int json_skip_space(const char *s, int i, int n)
+{
+    while (i < n && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n'))
+        i ++;
+    return i;
+}
+
+/* s[i] 是 "，返回字符串后面的位置，出错返回 -1 */
+static int json_skip_string(const char *s, int i, int n)
+{
+    for (i ++; i < n; i ++) {
+        if (s[i] == '\\')
+            i ++;
+        else if (s[i] == '"')
+            return i + 1;
+    }
+    return -1;
+}
+
+static int json_skip_value(const char *s, int i, int n)
+{
+    int depth = 0;
+
+    if (i < n && s[i] == '"')
+        return json_skip_string(s, i, n);
+    if (i < n && (s[i] == '[' || s[i] == '{')) {
+        while (i < n) {
+            if (s[i] == '"') {
+                i = json_skip_string(s, i, n);
+                if (i < 0)
+                    return -1;
+                continue;
+            }
+            if (s[i] == '[' || s[i] == '{')
+                depth ++;
+            else if ((s[i] == ']' || s[i] == '}') && -- depth == 0)
+                return i + 1;
+            i ++;
+        }
+        return -1;
+    }
+    while (i < n && s[i] != ',' && s[i] != '}' && s[i] != ']'
+            && s[i] != ' ' && s[i] != '\t' && s[i] != '\r' && s[i] != '\n')
+        i ++;
+    return i;
+}
+
+/* 找最外层对象里 key 的值，找到时 [*start, *end) 是值的 JSON 文本 */
+static int json_field(const char *s, int n, const char *key, int *start, int *end)
+{
+    int i = json_skip_space(s, 0, n), key_start, key_len = strlen(key);
+
+    if (i >= n || s[i] != '{')
+        return 0;
+    i ++;
+    for (;;) {
+        i = json_skip_space(s, i, n);
+        if (i >= n || s[i] != '"')
+            return 0;
+        key_start = i + 1;
+        i = json_skip_string(s, i, n);
+        if (i < 0)
+            return 0;
+        if (i - 1 - key_start == key_len && memcmp(s + key_start, key, key_len) == 0)
+            key_start = -1;
+        i = json_skip_space(s, i, n);
+        if (i >= n || s[i] != ':')
+            return 0;
+        i = json_skip_space(s, i + 1, n);
+        *start = i;
+        i = json_skip_value(s, i, n);
+        if (i < 0)
+            return 0;
+        if (key_start < 0) {
+            *end = i;
+            return 1;
+        }
+        i = json_skip_space(s, i, n);
+        if (i >= n || s[i] != ',')
+            return 0;
+        i ++;
+    }
+}
+
+/* 原来的源码的映射：segments 里每段五个数，列、源文件、行、列、名字，
+ * 源文件为 -1 表示这段没有对应的源码，名字为 -1 表示没有名字。
+ * lines[i] 是第 i 行第一段的下标 */
+typedef struct {
+    int *segments;
+    int count;
+    int cap;
+    int *lines;
+    int line_count;
+    int line_cap;
+} InputMap;
+
+static int input_map_add_line(InputMap *input)
+{
+    if (input->line_count == input->line_cap) {
+        int cap = input->line_cap ? input->line_cap * 2 : 256;
+        int *lines = (int*) realloc(input->lines, cap * sizeof(int));
+        if (!lines)
+            return -1;
+        input->lines = lines;
+        input->line_cap = cap;
+    }
+    input->lines[input->line_count ++] = input->count;
+    return 0;
+}
+
+/* 解码 mappings，s 是去掉引号的字符串。内存不足返回 -1，格式不对返回 -2 */
+static int decode_mappings(InputMap *input, const char *s, int n)
+{
+    int pos = 0, col = 0, src = 0, line = 0, ocol = 0, name = 0;
+    int value, fields, *seg;
+
+    if (input_map_add_line(input) < 0)
+        return -1;
+    while (pos < n) {
+        if (s[pos] == ';') {
+            pos ++;
+            col = 0;
+            if (input_map_add_line(input) < 0)
+                return -1;
+            continue;
+        }
+        if (s[pos] == ',') {
+            pos ++;
+            continue;
+        }
+        if (input->count == input->cap) {
+            int cap = input->cap ? input->cap * 2 : 1024;
+            int *segments = (int*) realloc(input->segments, cap * 5 * sizeof(int));
+            if (!segments)
+                return -1;
+            input->segments = segments;
+            input->cap = cap;
+        }
+        seg = input->segments + input->count * 5;
+        for (fields = 0; pos < n && s[pos] != ',' && s[pos] != ';'; fields ++) {
+            if (fields == 5 || get_vlq(s, &pos, n, &value) < 0)
+                return -2;
+            switch (fields) {
+            case 0: col += value; break;
+            case 1: src += value; break;
+            case 2: line += value; break;
+            case 3: ocol += value; break;
+            default: name += value;
+            }
+        }
+        if (fields != 1 && fields != 4 && fields != 5)
+            return -2;
+        seg[0] = col;
+        seg[1] = fields > 1 ? src : -1;
+        seg[2] = line;
+        seg[3] = ocol;
+        seg[4] = fields == 5 ? name : -1;
+        input->count ++;
+    }
+    return 0;
+}
+
+/* data:...;base64, 地址里的映射，不是的话返回 NULL */
+static char *decode_data_url(const char *url, int len, int *out_len)
+{
+    const char *comma = (const char*) memchr(url, ',', len);
+    char *out;
+    int i, bits = 0, value, n = 0, d;
+
+    if (len < 5 || memcmp(url, "data:", 5) != 0 || !comma
+            || comma - url < 12 || memcmp(comma - 7, ";base64", 7) != 0)
+        return NULL;
+    out = (char*) malloc(len / 4 * 3 + 3);
+    if (!out)
+        return NULL;
+    value = 0;
+    for (i = comma + 1 - url; i < len; i ++) {
+        d = base64_value(url[i]);
+        if (d < 0)
+            continue;
+        value = (value << 6) | d;
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out[n ++] = (char) ((value >> bits) & 0xff);
+        }
+    }
+    *out_len = n;
+    return out;
+}
+
+/* 原来的源码里 sourceMappingURL 的地址，没有或者是 data: 地址时返回 NULL */
+const char *js_stream_map_url(JsStream *js)
+{
+    InsertState *url;
+
+    if (!js->map || js->map->url.buffer_len == 0)
+        return NULL;
+    url = &js->map->url;
+    if (url->buffer_len >= 5 && memcmp(url->buffer, "data:", 5) == 0)
+        return NULL;
+    append_source(url, "", 1);
+    if (url->failed)
+        return NULL;
+    url->buffer_len --;
+    return url->buffer;
+}
+
+/* 成功返回 0，内存不足或者没有要求生成映射时返回 -1 */
+int js_stream_source_map(JsStream *js, const char *source_url,
+        const char *input_map, int input_len, char **map_json, int *map_len)
+{
+    SourceMap *map = js->map;
+    InputMap input;
+    InsertState out;
+    char *inline_map = NULL;
+    const char *raw;
+    int composed = 0, start, end, i, line = 0, in_line = -1, k = 0, first = 1;
+    int prev_col = 0, prev_src = 0, prev_line = 0, prev_ocol = 0, prev_name = 0;
+    int src, oline, ocol, name, *seg, *iseg;
+
+    *map_json = NULL;
+    *map_len = 0;
+    if (!map || js->out.failed)
+        return -1;
+    memset(&input, 0, sizeof(input));
+    memset(&out, 0, sizeof(out));
+
+    if (!input_map && map->url.buffer_len > 0) {
+        inline_map = decode_data_url(map->url.buffer, map->url.buffer_len, &input_len);
+        input_map = inline_map;
+    }
+    if (input_map && !json_field(input_map, input_len, "sections", &start, &end)
+            && json_field(input_map, input_len, "mappings", &start, &end)
+            && input_map[start] == '"') {
+        composed = decode_mappings(&input, input_map + start + 1, end - start - 2);
+        if (composed == -1)
+            out.failed = 1;
+        composed = composed == 0;
+    }
+
+    put_string(&out, "{\"version\":3,");
+    if (composed) {
+        static const char *fields[] = { "sourceRoot", "sources", "sourcesContent", "names" };
+        for (i = 0; i < 4; i ++) {
+            if (json_field(input_map, input_len, fields[i], &start, &end)) {
+                put_string(&out, "\"");
+                put_string(&out, fields[i]);
+                put_string(&out, "\":");
+                append_source(&out, input_map + start, end - start);
+                put_string(&out, ",");
+            }
+        }
+    }
+    else {
+        raw = source_url ? source_url : "";
+        put_string(&out, "\"sources\":[");
+        put_json_string(&out, raw, strlen(raw));
+        put_string(&out, "],\"sourcesContent\":[");
+        put_json_string(&out, map->content.buffer, map->content.buffer_len);
+        put_string(&out, "],\"names\":[],");
+    }
+
+    put_string(&out, "\"mappings\":\"");
+    for (i = 0; i < map->count; i ++) {
+        seg = map->segments + i * 4;
+        for (; line < seg[0]; line ++) {
+            append_source(&out, ";", 1);
+            prev_col = 0;
+            first = 1;
+        }
+        src = 0;
+        oline = seg[2];
+        ocol = seg[3];
+        name = -1;
+        if (oline >= 0 && composed) {
+            /* 原来的源码里 (oline, ocol) 所在的段 */
+            if (oline != in_line) {
+                in_line = oline;
+                k = oline < input.line_count ? input.lines[oline] : input.count;
+            }
+            end = oline + 1 < input.line_count ? input.lines[oline + 1] : input.count;
+            while (k + 1 < end && input.segments[(k + 1) * 5] <= ocol)
+                k ++;
+            iseg = input.segments + k * 5;
+            if (k < end && iseg[0] <= ocol && iseg[1] >= 0) {
+                src = iseg[1];
+                oline = iseg[2];
+                ocol = iseg[3];
+                name = iseg[4];
+            }
+            else
+                oline = -1;
+        }
+        if (!first)
+            append_source(&out, ",", 1);
+        first = 0;
+        put_vlq(&out, seg[1] - prev_col);
+        prev_col = seg[1];
+        if (oline < 0)
+            continue;
+        put_vlq(&out, src - prev_src);
+        put_vlq(&out, oline - prev_line);
+        put_vlq(&out, ocol - prev_ocol);
+        prev_src = src;
+        prev_line = oline;
+        prev_ocol = ocol;
+        if (name >= 0) {
+            put_vlq(&out, name - prev_name);
+            prev_name = name;
+        }
+    }
+    put_string(&out, "\"}\n");
+
+    free(inline_map);
+    free(input.segments);
+    free(input.lines);
+    if (out.failed) {
+        free(out.buffer);
+        return -1;
+    }
+    *map_json = out.buffer;
+    *map_len = out.buffer_len;
+    return 0;
+}
+
+/* 成功返回 0，内存不足返回 -1 */
+int insert_profile_codes(const JsOptions *options, char *source, int source_len,
+        char **new_source, int *new_source_len)
+{
+    JsStream *js = js_stream_new(options);
+    char *out;
+    int out_len;
+
+    *new_source = NULL;
+    *new_source_len = 0;
+    if (!js)
+        return -1;
+    js->out.buffer_cap = source_len + source_len / 8 + 1024;
+    js->out.buffer = (char*) malloc(js->out.buffer_cap);
+    if (!js->out.buffer || js_stream_feed(js, source, source_len, 1, &out, &out_len) < 0) {
+        js_stream_free(js);
+        return -1;
+    }
+    *new_source = js->out.buffer;
+    *new_source_len = js->out.buffer_len;
+    js->out.buffer = NULL;
+    js_stream_free(js);
+    return 0;
+}
+
+/* 成功返回 0，内存不足返回 -1 */
+int parse(AST *ast, char *source, int source_len)
+{
+    ParseState state;
+    int node;
+
+    /* 先按每 8 个字节一个节点分配，不够时再加倍 */
+    ast->node_count = 0;
+    ast->node_cap = source_len / 8 + 16;
+    ast->nodes = (AstNode*) malloc(ast->node_cap * sizeof(AstNode));
+    if (!ast->nodes)
+        return -1;
+
+    state.ast = ast;
+    state.source = (const unsigned char*) source;
+    state.source_len = source_len;
+    state.source_pos = 0;
+    state.prev.type = T_END;
+    state.prev.ends_expr = 0;
+    state.prev.condition = 0;
+    state.paren_depth = 0;
+    state.peek_pos = -1;
+    state.failed = 0;
+    state.eof = 1;
+
+    create_node(&state, OTHER, 0, source_len);
+    while (!state.failed && peek_token(&state)->type != T_END) {
+        node = parse_statement(&state);
+        if (node == NO_NODE)
+            break;
+        append_child(ast, 0, node);
+    }
+    if (state.failed) {
+        free_tree(ast);
+        return -1;
+    }
+    return 0;
+}
+
+/* 释放语法树 */
+void free_tree(AST *ast)
+{
+    free(ast->nodes);
+    ast->nodes = NULL;
+    ast->node_count = 0;
+    ast->node_cap = 0;
+}
+
+static void print_source(const char *source, int source_len, Bool single_line)
 {
     int i;
     for (i = 0; i < source_len; i ++) {
@@ -363,55 +1900,47 @@ void print_source(const char *source, int source_len, Bool single_line)
     }
 }
 
-/***********
- * 显示AST
- ***********/
-void print_tree(AstNode *node, char *source, int indent)
+static void __print_tree(AST *ast, int index, char *source, int indent)
 {
-    int pos, len;
+    AstNode *node = NODE(ast, index);
     AstNode *last_child;
+    int pos, len, child;
     char desc[15];
     int desc_len;
+    const char *indent_str;
 
     static const char indent_space[] = "                                                                      ";
-    if (!node)
-        return;
-
 
-    
     /* 缩进 */
-    if (indent > sizeof(indent_space) - 1)
+    if (indent > (int) sizeof(indent_space) - 1)
         indent = sizeof(indent_space) - 1;
-    const char *indent_str = indent_space + sizeof(indent_space) - indent - 1;
+    indent_str = indent_space + sizeof(indent_space) - indent - 1;
 
-    //节点信息
+    /* 节点信息 */
     desc_len = snprintf(desc, sizeof(desc), "%d @%d,%d", node->type, node->source_pos, node->source_len);
     printf("%s%s", indent_str, desc);
-    
+
     /* 显示前面代码 */
     pos = node->source_pos;
     len = node->source_len;
-    if (node->first_child) {
-        len = node->first_child->source_pos - pos;
+    if (node->first_child != NO_NODE) {
+        len = NODE(ast, node->first_child)->source_pos - pos;
     }
     if (len > 0) {
         print_source(indent_space, sizeof(desc) - desc_len, True);
         print_source(source + pos, len, True);
     }
-    if (is_function_block(node, source, NULL))
+    if (is_function_block(ast, index, source, NULL))
         printf(" *");
     printf("\n");
 
     /* 显示孩子节点 */
-    AstNode *child = node->first_child;
-    while (child) {
-        print_tree(child, source, indent + 2);
-        child = child->next;
-    }
+    for (child = node->first_child; child != NO_NODE; child = NODE(ast, child)->next)
+        __print_tree(ast, child, source, indent + 2);
 
     /* 显示后面代码 */
-    last_child = node->last_child;
-    if (last_child) {
+    if (node->last_child != NO_NODE) {
+        last_child = NODE(ast, node->last_child);
         pos = last_child->source_pos + last_child->source_len;
         len = node->source_pos + node->source_len - pos;
         if (len > 0) {
@@ -423,37 +1952,11 @@ void print_tree(AstNode *node, char *source, int indent)
     }
 }
 
-/**********
- * 主程序
- **********/
-int main(int argc, char **argv)
+/***********
+ * 显示AST
+ ***********/
+void print_tree(AST *ast, char *source)
 {
-    if (argc != 3) {
-        printf("Usage: js <infile> <outfile>\n");
-        return 0;
-    }
-    char *infile = argv[1];
-    char *outfile = argv[2];
-    int source_len = 0;
-    char *source = read_file(infile, &source_len);
-    #if 0
-    char source[] = "{var i}{var j = 0; {} function a() { alert(1); alert([1, 2]) }}";
-    int source_len = sizeof(source);
-    printf("%s\n", source);
-    printf("len=%d\n", source_len);
-    #endif
-
-    AST ast;
-    ast.root = parse(source, source_len);
-    printf("Syntax Tree:\n");
-    //print_tree(ast.root, source, 0);
-
-    char *new_source = NULL;
-    int new_source_len = 0;
-    insert_profile_codes(&ast, source, source_len, &new_source, &new_source_len);
-    printf("new_len=%d\n", new_source_len);
-    if (new_source_len)
-        write_file(outfile, new_source, new_source_len);
-
-    return 0;
+    if (ast->node_count > 0)
+        __print_tree(ast, 0, source, 0);
 }
@@ -0,0 +1,83 @@
+/* JavaScript 性能分析代码插入
+ *
+ * 在每个函数的入口和出口插入日志代码。源码可以一次给完，也可以
+ * 一段一段地给（JsStream），边读边输出。另外可以把源码解析成以代码块
+ * 为单位的语法树，用来调试。
+ */
+
+#ifndef TINYPROXY_JS_H
+#define TINYPROXY_JS_H
+
+/* 语法树节点，定义见 js.c */
+typedef struct AstNode_t AstNode;
+
+/* 语法树：所有节点放在一个数组里，用下标互相引用，0 号是根节点 */
+typedef struct {
+    AstNode *nodes;
+    int node_count;
+    int node_cap;
+} AST;
+
+/* 解析源码，成功返回 0，内存不足返回 -1；用完后用 free_tree() 一次释放 */
+extern int parse(AST *ast, char *source, int source_len);
+extern void free_tree(AST *ast);
+
+/* 插入什么代码 */
+typedef enum {
+    JS_PROFILE_LOG,         /* 进出函数时 console.log 函数名 */
+    JS_PROFILE_TIMING       /* 记录调用次数和时间，批量发送到 endpoint */
+} JsProfileMode;
+
+typedef struct {
+    JsProfileMode mode;
+    const char *tag;        /* 计时：区分不同脚本的变量名后缀，只能是字母和数字 */
+    const char *endpoint;   /* 计时：接收数据的地址，NULL 表示不发送 */
+    int source_map;         /* 记录源码映射，用 js_stream_source_map() 取出 */
+
+    /* 只插入一部分函数，都是 0 或者 NULL 时插入全部 */
+    int min_body;           /* 函数体不到这么多字节的不插入 */
+    int sample;             /* 按函数名抽样，只插入大约这个百分比的函数 */
+    const char *const *only;    /* 只插入这些名字的函数 */
+    int only_count;
+    int (*filter)(const char *name, void *data);   /* 返回 0 的函数不插入 */
+    void *filter_data;
+} JsOptions;
+
+/* 插入性能分析代码，options 为 NULL 时用 JS_PROFILE_LOG；
+ * *new_source 由调用者用 free() 释放 */
+extern int insert_profile_codes(const JsOptions *options, char *source, int source_len,
+        char **new_source, int *new_source_len);
+
+/* 流式插入，定义见 js.c */
+typedef struct JsStream_t JsStream;
+
+/* options 同 insert_profile_codes()，内存不足返回 NULL */
+extern JsStream *js_stream_new(const JsOptions *options);
+extern void js_stream_free(JsStream *js);
+
+/* 换一个文件重新开始，留着已经分配的内存。内存不足返回 -1 */
+extern int js_stream_reset(JsStream *js, const JsOptions *options);
+
+/* 到目前为止插入了代码的函数个数 */
+extern int js_stream_functions(JsStream *js);
+
+/* 最后一段输入后生成源码映射（JSON），source_url 是原来的源码的地址。
+ * input_map 是原来的源码自己的映射，NULL 时用源码里内嵌的 data: 映射，
+ * 有的话生成的映射直接指向更早的源码。*map 用 free() 释放。
+ * 内存不足或者 options 里没有 source_map 时返回 -1 */
+extern int js_stream_source_map(JsStream *js, const char *source_url,
+        const char *input_map, int input_len, char **map, int *map_len);
+
+/* 原来的源码末尾 sourceMappingURL 指向的地址，没有或者是内嵌的 data:
+ * 映射时返回 NULL */
+extern const char *js_stream_map_url(JsStream *js);
+
+/* 输入一段源码，最后一段 eof 为 1。成功返回 0，内存不足返回 -1。
+ * *out 指向可以输出的代码，下次调用前有效；没读完的单词留到下一段 */
+extern int js_stream_feed(JsStream *js, char *data, int len, int eof,
+        char **out, int *out_len);
+
+/* 显示语法树（调试用） */
+extern void print_tree(AST *ast, char *source);
+
+#endif
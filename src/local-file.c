@@ -0,0 +1,308 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Answers requests for URLs under a directory mapped in urls.conf
+ * (see get_local_dir_file() in conf.c) from the local file, without
+ * asking the server.
+ *
+ * The file is served like a static web server would: the ETag and
+ * Last-Modified validators come from stat(), so that the browser's
+ * conditional requests get a 304 while the file is unchanged, and a
+ * single byte range is answered with 206 so that media and large
+ * files can be seeked.  The body is sent with sendfile().
+ */
+
+#include "main.h"
+
+#include "local-file.h"
+#include "html-error.h"
+#include "log.h"
+#include "network.h"
+#include "utils.h"
+
+#define LOCAL_FILE_ETAG 64
+#define LOCAL_FILE_DATE 64
+
+static const struct {
+        const char *extension;
+        const char *type;
+} content_types[] = {
+        { "html", "text/html; charset=utf-8" },
+        { "htm", "text/html; charset=utf-8" },
+        { "js", "application/javascript" },
+        { "mjs", "application/javascript" },
+        { "css", "text/css" },
+        { "json", "application/json" },
+        { "map", "application/json" },
+        { "txt", "text/plain; charset=utf-8" },
+        { "xml", "text/xml" },
+        { "svg", "image/svg+xml" },
+        { "png", "image/png" },
+        { "jpg", "image/jpeg" },
+        { "jpeg", "image/jpeg" },
+        { "gif", "image/gif" },
+        { "webp", "image/webp" },
+        { "ico", "image/x-icon" },
+        { "woff", "font/woff" },
+        { "woff2", "font/woff2" },
+        { "ttf", "font/ttf" },
+        { "wasm", "application/wasm" },
+        { "mp4", "video/mp4" },
+        { "webm", "video/webm" },
+        { "mp3", "audio/mpeg" },
+        { "pdf", "application/pdf" }
+};
+
+static const char *content_type (const char *path)
+{
+        const char *dot = strrchr (path, '.');
+        unsigned int i;
+
+        if (dot && !strchr (dot, '/')) {
+                for (i = 0; i < sizeof (content_types) /
+                     sizeof (content_types[0]); i++) {
+                        if (strcasecmp (dot + 1,
+                                        content_types[i].extension) == 0)
+                                return content_types[i].type;
+                }
+        }
+        return "application/octet-stream";
+}
+
+static const char *request_header (hashmap_t headers, const char *name)
+{
+        char *value;
+
+        if (hashmap_entry_by_key (headers, name, (void **) &value) > 0)
+                return value;
+        return NULL;
+}
+
+/*
+ * Does the If-None-Match list "value" name "etag"?  The comparison is
+ * the weak one, as RFC 7232 asks for If-None-Match.
+ */
+static int etag_listed (const char *value, const char *etag)
+{
+        size_t len = strlen (etag);
+
+        while (*value) {
+                value += strspn (value, " \t,");
+                if (*value == '*')
+                        return 1;
+                if (strncmp (value, "W/", 2) == 0)
+                        value += 2;
+                if (strncmp (value, etag, len) == 0
+                    && (value[len] == '\0' || value[len] == ','
+                        || value[len] == ' ' || value[len] == '\t'))
+                        return 1;
+                value += strcspn (value, ",");
+        }
+        return 0;
+}
+
+/*
+ * Parse a Range header for a file of "size" bytes.  Returns 1 with the
+ * first and last byte of a single satisfiable range, 0 if the header is
+ * to be ignored (malformed, or more than one range), or -1 if the range
+ * lies past the end of the file.
+ */
+static int parse_range (const char *value, off_t size,
+                        off_t *first, off_t *last)
+{
+        char *end;
+        long a, b;
+
+        if (strncasecmp (value, "bytes=", 6) != 0 || strchr (value, ','))
+                return 0;
+        value += 6;
+        while (*value == ' ')
+                value++;
+
+        if (*value == '-') {
+                /* the last "b" bytes */
+                b = strtol (value + 1, &end, 10);
+                if (end == value + 1 || *end != '\0' || b < 0)
+                        return 0;
+                if (b == 0 || size == 0)
+                        return -1;
+                *first = b < size ? size - b : 0;
+                *last = size - 1;
+                return 1;
+        }
+
+        a = strtol (value, &end, 10);
+        if (end == value || *end != '-' || a < 0)
+                return 0;
+        value = end + 1;
+        if (*value == '\0') {
+                b = size - 1;
+        } else {
+                b = strtol (value, &end, 10);
+                if (*end != '\0' || b < a)
+                        return 0;
+                if (b >= size)
+                        b = size - 1;
+        }
+        if (a >= size)
+                return -1;
+        *first = a;
+        *last = b;
+        return 1;
+}
+
+/*
+ * Send the file "path" as the answer to a "method" request with the
+ * client's headers "headers".  Returns 0 once a response was sent, or
+ * -1 with the error set by indicate_http_error() for the caller to send.
+ */
+int local_file_send (struct conn_s *connptr, const char *method,
+                     const char *path, hashmap_t headers)
+{
+        char etag[LOCAL_FILE_ETAG];
+        char modified[LOCAL_FILE_DATE], date[LOCAL_FILE_DATE];
+        const char *value, *status = "200 OK";
+        struct stat st;
+        off_t first = 0, last = 0;
+        time_t now = time (NULL);
+        int fd, error, range = 0, head, ret = -1;
+
+        head = strcmp (method, "HEAD") == 0;
+        if (!head && strcmp (method, "GET") != 0) {
+                indicate_http_error (connptr, 405, "Method Not Allowed",
+                                     "detail", "Only GET and HEAD requests "
+                                     "can be answered from a local file.",
+                                     "url", path, NULL);
+                return -1;
+        }
+
+        fd = open (path, O_RDONLY);
+        if (fd >= 0 && (fstat (fd, &st) < 0 || !S_ISREG (st.st_mode))) {
+                close (fd);
+                fd = -1;
+                errno = ENOENT;
+        }
+        if (fd < 0) {
+                error = errno;
+                log_message (LOG_INFO, "Could not open local file \"%s\": %s",
+                             path, strerror (error));
+                if (error == EACCES)
+                        indicate_http_error (connptr, 403, "Forbidden",
+                                             "detail", "The local file "
+                                             "can not be read.",
+                                             "url", path, NULL);
+                else
+                        indicate_http_error (connptr, 404, "Not Found",
+                                             "detail", "There is no such "
+                                             "local file.",
+                                             "url", path, NULL);
+                return -1;
+        }
+        printf ("  << %s\n", path);
+
+        snprintf (etag, sizeof (etag), "\"%lx-%lx-%lx\"",
+                  (unsigned long) st.st_ino, (unsigned long) st.st_size,
+                  (unsigned long) st.st_mtime);
+        strftime (modified, sizeof (modified), "%a, %d %b %Y %H:%M:%S GMT",
+                  gmtime (&st.st_mtime));
+        strftime (date, sizeof (date), "%a, %d %b %Y %H:%M:%S GMT",
+                  gmtime (&now));
+
+        /* If-None-Match wins over If-Modified-Since (RFC 7232, 6) */
+        if ((value = request_header (headers, "if-none-match")) != NULL
+            ? etag_listed (value, etag)
+            : ((value = request_header (headers, "if-modified-since"))
+               != NULL && parse_http_date (value) >= st.st_mtime)) {
+                ret = write_message_with_log (connptr->client_fd,
+                                              connptr->http_log.response_data,
+                                              "HTTP/1.0 304 Not Modified\r\n"
+                                              "Date: %s\r\n"
+                                              "ETag: %s\r\n"
+                                              "Last-Modified: %s\r\n"
+                                              "Cache-Control: no-cache\r\n"
+                                              "Connection: close\r\n"
+                                              "\r\n", date, etag, modified);
+                goto done;
+        }
+
+        /* a Range only applies if the If-Range validator still matches */
+        if ((value = request_header (headers, "range")) != NULL) {
+                const char *if_range = request_header (headers, "if-range");
+
+                if (!if_range || strcmp (if_range, etag) == 0
+                    || parse_http_date (if_range) == st.st_mtime)
+                        range = parse_range (value, st.st_size,
+                                             &first, &last);
+        }
+
+        if (range < 0) {
+                ret = write_message_with_log (connptr->client_fd,
+                                              connptr->http_log.response_data,
+                                              "HTTP/1.0 416 Range Not Satisfiable\r\n"
+                                              "Date: %s\r\n"
+                                              "Content-Range: bytes */%ld\r\n"
+                                              "Content-Length: 0\r\n"
+                                              "Connection: close\r\n"
+                                              "\r\n", date,
+                                              (long) st.st_size);
+                goto done;
+        }
+        if (range > 0)
+                status = "206 Partial Content";
+        else
+                last = st.st_size - 1;
+
+        if (write_message_with_log (connptr->client_fd,
+                                    connptr->http_log.response_data,
+                                    "HTTP/1.0 %s\r\n"
+                                    "Date: %s\r\n"
+                                    "Content-Type: %s\r\n"
+                                    "Content-Length: %ld\r\n"
+                                    "ETag: %s\r\n"
+                                    "Last-Modified: %s\r\n"
+                                    "Accept-Ranges: bytes\r\n"
+                                    "Cache-Control: no-cache\r\n"
+                                    "Connection: close\r\n",
+                                    status, date, content_type (path),
+                                    (long) (last - first + 1),
+                                    etag, modified) < 0)
+                goto done;
+        if (range > 0
+            && write_message_with_log (connptr->client_fd,
+                                       connptr->http_log.response_data,
+                                       "Content-Range: bytes %ld-%ld/%ld\r\n",
+                                       (long) first, (long) last,
+                                       (long) st.st_size) < 0)
+                goto done;
+        if (safe_write_with_log (connptr->client_fd,
+                                 connptr->http_log.response_data,
+                                 "\r\n", 2) < 0)
+                goto done;
+
+        ret = 0;
+        if (!head && last >= first)
+                ret = send_file (connptr->client_fd, fd, first,
+                                 (size_t) (last - first + 1));
+
+done:
+        close (fd);
+        if (ret < 0)
+                log_message (LOG_WARNING,
+                             "Could not send the local file \"%s\"", path);
+        /* the response, or as much of it as could be sent, is out */
+        return 0;
+}
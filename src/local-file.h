@@ -0,0 +1,29 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'local-file.c' for detailed information. */
+
+#ifndef _TINYPROXY_LOCAL_FILE_H_
+#define _TINYPROXY_LOCAL_FILE_H_
+
+#include "conns.h"
+#include "hashmap.h"
+
+extern int local_file_send (struct conn_s *connptr, const char *method,
+                            const char *path, hashmap_t headers);
+
+#endif /* _TINYPROXY_LOCAL_FILE_H_ */
@@ -289,11 +289,12 @@ void shutdown_logging (void)
                 return;
         }
 
-        if (config.syslog) {
-                closelog ();
-        } else {
-                close_log_file ();
-        }
+        /*
+         * The configuration may have been reloaded since logging was set
+         * up, so close whichever was in use.
+         */
+        closelog ();
+        close_log_file ();
 
         logging_initialized = FALSE;
 }
@@ -304,6 +305,9 @@ void http_log_init(http_log_s *http_log)
 {
     http_log->request_data = new_buffer();
     http_log->response_data = new_buffer();
+    gettimeofday(&http_log->start, NULL);
+    http_log->first_byte.tv_sec = 0;
+    http_log->first_byte.tv_usec = 0;
 }
 
 void http_log_destroy(http_log_s *http_log)
@@ -314,26 +318,55 @@ void http_log_destroy(http_log_s *http_log)
         delete_buffer(http_log->response_data);
 }
 
+/* 记下服务器开始响应的时间，回放时按它延迟第一个字节 */
+void http_log_first_byte(http_log_s *http_log)
+{
+    if (http_log->first_byte.tv_sec == 0)
+        gettimeofday(&http_log->first_byte, NULL);
+}
+
+static long elapsed_ms(const struct timeval *from, const struct timeval *to)
+{
+    return (to->tv_sec - from->tv_sec) * 1000L
+           + (to->tv_usec - from->tv_usec) / 1000L;
+}
+
+/*
+ * 每条记录的请求和响应前面写上字节数，按原样写出（可能有二进制数据），
+ * 响应还带上第一个字节和整个响应用的时间，replay.c 读这个格式。
+ */
 void http_log_flush(http_log_s *http_log)
 {
-    unsigned char str_end[] = { '\0' };
     char *request_data, *response_data;
+    size_t request_size, response_size;
+    struct timeval now;
+    long total, first;
     FILE *file;
 
-    add_to_buffer(http_log->request_data, str_end, 1);
-    add_to_buffer(http_log->response_data, str_end, 1);
-
+    request_size = buffer_size(http_log->request_data);
+    response_size = buffer_size(http_log->response_data);
     request_data = buffer_get(http_log->request_data);
     response_data = buffer_get(http_log->response_data);
 
+    gettimeofday(&now, NULL);
+    total = elapsed_ms(&http_log->start, &now);
+    first = http_log->first_byte.tv_sec
+            ? elapsed_ms(&http_log->start, &http_log->first_byte) : total;
+
     file = fopen(HTTP_LOG_FILE, "a");
     
     if (file) {
-        flock(LOCK_EX, fileno(file));
-        fprintf(file, "======== request ========\n");
-        fprintf(file, "%s\n", request_data);
-        fprintf(file, "======== response ========\n");
-        fprintf(file, "%s\n", response_data);
+        flock(fileno(file), LOCK_EX);
+        fprintf(file, "======== request (%lu bytes) ========\n",
+                (unsigned long) request_size);
+        if (request_size > 0)
+            fwrite(request_data, 1, request_size, file);
+        fprintf(file, "\n======== response (%lu bytes, %ld ms to first byte, "
+                "%ld ms) ========\n", (unsigned long) response_size,
+                first, total);
+        if (response_size > 0)
+            fwrite(response_data, 1, response_size, file);
+        fprintf(file, "\n");
         fclose(file);
     }
     else
@@ -125,12 +125,16 @@ struct buffer_s;
 typedef struct {
     struct buffer_s *request_data;
     struct buffer_s *response_data;
+    struct timeval start;           /* 连接开始的时间 */
+    struct timeval first_byte;      /* 收到服务器响应的时间，还没收到时为 0 */
 } http_log_s;
 
 void http_log_reset(void);
 
 void http_log_init(http_log_s *http_log);
 
+void http_log_first_byte(http_log_s *http_log);
+
 void http_log_destroy(http_log_s *http_log);
 
 void http_log_flush(http_log_s *http_log);
@@ -38,11 +38,16 @@
 #include "daemon.h"
 #include "heap.h"
 #include "filter.h"
+#include "http-cache.h"
+#include "instrument.h"
 #include "child.h"
 #include "log.h"
+#include "profile.h"
+#include "replay.h"
 #include "reqs.h"
 #include "sock.h"
 #include "stats.h"
+#include "upstream.h"
 #include "utils.h"
 
 /*
@@ -357,14 +362,14 @@ int reload_config (void)
 {
         int ret;
 
-        shutdown_logging ();
-
+        /* On failure the old configuration and its logging stay */
         ret = reload_config_file (config_defaults.config_file, &config,
                                   &config_defaults);
         if (ret != 0) {
                 goto done;
         }
 
+        shutdown_logging ();
         ret = setup_logging ();
 
 done:
@@ -398,6 +403,38 @@ main (int argc, char **argv)
 
         init_stats ();
 
+#ifdef UPSTREAM_SUPPORT
+        if (upstream_health_init ()) {
+                log_message (LOG_WARNING,
+                             "Could not set up the upstream health table; "
+                             "upstream group members are never marked down.");
+        }
+#endif
+
+        if (instrument_cache_init ()) {
+                log_message (LOG_WARNING,
+                             "Could not set up the instrumentation cache; "
+                             "every response will be instrumented again.");
+        }
+
+        if (http_cache_init ()) {
+                log_message (LOG_WARNING,
+                             "Could not set up the response cache; "
+                             "every request will go to the server.");
+        }
+
+        if (replay_init ()) {
+                log_message (LOG_WARNING,
+                             "Could not read the ReplayFile; "
+                             "every request will be answered 404.");
+        }
+
+        if (profile_init ()) {
+                log_message (LOG_WARNING,
+                             "Could not set up the JavaScript profile; "
+                             "timing reports will be dropped.");
+        }
+
         /* If ANONYMOUS is turned on, make sure that Content-Length is
          * in the list of allowed headers, since it is required in a
          * HTTP/1.0 request. Also add the Content-Type header since it
@@ -449,6 +486,9 @@ main (int argc, char **argv)
                 }
         }
 
+        /* CacheDir is shared with the children, which run as User */
+        http_cache_disk_init ();
+
         if (child_pool_create () < 0) {
                 fprintf (stderr,
                          "%s: Could not create the pool of children.\n",
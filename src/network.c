@@ -350,3 +350,39 @@ int full_inet_pton (const char *ip, void *dst)
                   inet_ntop (AF_INET, dst, tmp, sizeof (tmp)));
         return inet_pton (AF_INET6, buf, dst);
 }
+
+/*
+ * Send "len" bytes of the file "file_fd" from "offset" on to the socket,
+ * with sendfile() where there is one.  Returns 0, or -1 on error.
+ */
+int send_file (int fd, int file_fd, off_t offset, size_t len)
+{
+#ifdef HAVE_SYS_SENDFILE_H
+        ssize_t n;
+
+        while (len > 0) {
+                n = sendfile (fd, file_fd, &offset, len);
+                if (n < 0 && errno == EINTR)
+                        continue;
+                if (n <= 0)
+                        return -1;
+                len -= n;
+        }
+#else
+        char buffer[READ_BUFFER_SIZE];
+        ssize_t n;
+
+        if (lseek (file_fd, offset, SEEK_SET) < 0)
+                return -1;
+        while (len > 0) {
+                n = read (file_fd, buffer, len < sizeof (buffer) ?
+                          len : sizeof (buffer));
+                if (n < 0 && errno == EINTR)
+                        continue;
+                if (n <= 0 || safe_write (fd, buffer, n) < 0)
+                        return -1;
+                len -= n;
+        }
+#endif
+        return 0;
+}
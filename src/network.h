@@ -26,6 +26,7 @@ struct buffer_s;
 extern ssize_t safe_write (int fd, const char *buffer, size_t count);
 extern ssize_t safe_write_with_log (int fd, struct buffer_s *log, const char *buffer, size_t count);
 extern ssize_t safe_read (int fd, char *buffer, size_t count);
+extern int send_file (int fd, int file_fd, off_t offset, size_t len);
 
 extern int write_message (int fd, const char *fmt, ...);
 extern int write_message_with_log (int fd, struct buffer_s *log, const char *fmt, ...);
@@ -0,0 +1,478 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Collects the measurements sent by the timing probes that
+ * "InstrumentMode timing" inserts into JavaScript (see js.c), and shows
+ * them per script URL on the StatHost.
+ *
+ * The probes POST plain text reports to PROFILE_PATH on the StatHost,
+ * made of lines
+ *
+ *      U <script url>
+ *      F <id> <calls> <total ms> <self ms> <function name>
+ *
+ * where the F lines belong to the U line before them.  The totals are
+ * kept in a table in shared memory, so that every child adds to the
+ * same profile.
+ */
+
+#include "main.h"
+
+#include "profile.h"
+#include "conf.h"
+#include "heap.h"
+#include "log.h"
+#include "network.h"
+#include "text.h"
+#include "utils.h"
+
+#define PROFILE_ENTRIES         2048
+#define PROFILE_URL_LEN         160
+#define PROFILE_NAME_LEN        64
+
+struct profile_entry {
+        char url[PROFILE_URL_LEN];      /* empty if the entry is free */
+        char name[PROFILE_NAME_LEN];
+        unsigned long calls;
+        double total;                   /* milliseconds */
+        double self;                    /* total less the probed callees */
+};
+
+struct profile_table {
+        unsigned long reports;
+        unsigned long dropped;          /* functions that found no entry */
+        unsigned int used;
+        struct profile_entry entries[PROFILE_ENTRIES];
+};
+
+static struct profile_table *table = NULL;
+static int profile_lock_fd = -1;
+
+static void profile_lock (short type)
+{
+        struct flock lock;
+
+        lock.l_type = type;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = 0;
+        lock.l_len = 0;
+
+        while (fcntl (profile_lock_fd, F_SETLKW, &lock) < 0) {
+                if (errno != EINTR)
+                        return;
+        }
+}
+
+/*
+ * Set up the shared table.  This has to be done before the children
+ * are created.
+ */
+int profile_init (void)
+{
+        char lock_file[] = "/tmp/tinyproxy.profile.lock.XXXXXX";
+        void *mem;
+
+        if (!config.instrument_types && !config.instrument_urls)
+                return 0;
+
+        mem = calloc_shared_memory (1, sizeof (struct profile_table));
+        if (mem == MAP_FAILED)
+                return -1;
+
+        profile_lock_fd = mkstemp (lock_file);
+        if (profile_lock_fd < 0)
+                return -1;
+        unlink (lock_file);
+
+        table = (struct profile_table *) mem;
+        return 0;
+}
+
+/*
+ * Find the entry for a function, claiming a free one if it isn't there
+ * yet.  Returns NULL if the table is full.  Must be called with the
+ * table locked.
+ */
+static struct profile_entry *profile_entry (const char *url,
+                                            const char *name)
+{
+        struct profile_entry *entry;
+        unsigned int h = 2166136261U;
+        const char *p;
+        unsigned int i, n;
+
+        for (p = url; *p; ++p)
+                h = (h ^ (unsigned char) *p) * 16777619U;
+        h = (h ^ ' ') * 16777619U;
+        for (p = name; *p; ++p)
+                h = (h ^ (unsigned char) *p) * 16777619U;
+
+        for (i = h % PROFILE_ENTRIES, n = 0; n != PROFILE_ENTRIES;
+             i = (i + 1) % PROFILE_ENTRIES, ++n) {
+                entry = &table->entries[i];
+                if (!entry->url[0]) {
+                        /* Leave room so that probing stays short */
+                        if (table->used >= PROFILE_ENTRIES * 3 / 4)
+                                return NULL;
+                        strlcpy (entry->url, url, sizeof (entry->url));
+                        strlcpy (entry->name, name, sizeof (entry->name));
+                        table->used++;
+                        return entry;
+                }
+                if (strcmp (entry->url, url) == 0
+                    && strcmp (entry->name, name) == 0)
+                        return entry;
+        }
+
+        return NULL;
+}
+
+/*
+ * Add a report from the timing probes to the table.  Lines that don't
+ * parse are skipped.  Returns -1 if out of memory.
+ */
+int profile_record (const char *report, size_t len)
+{
+        struct profile_entry *entry;
+        char url[PROFILE_URL_LEN];
+        char *copy, *line, *next, *p;
+        unsigned long calls;
+        double total, self;
+
+        if (!table)
+                return 0;
+
+        copy = (char *) safemalloc (len + 1);
+        if (!copy)
+                return -1;
+        memcpy (copy, report, len);
+        copy[len] = '\0';
+
+        url[0] = '\0';
+
+        profile_lock (F_WRLCK);
+        table->reports++;
+        for (line = copy; line; line = next) {
+                next = strchr (line, '\n');
+                if (next)
+                        *next++ = '\0';
+                chomp (line, strlen (line));
+
+                if (line[0] == 'U' && line[1] == ' ') {
+                        strlcpy (url, line + 2, sizeof (url));
+                        continue;
+                }
+                if (line[0] != 'F' || line[1] != ' ' || !url[0])
+                        continue;
+
+                /* id, calls, total, self, name */
+                strtoul (line + 2, &p, 10);
+                calls = strtoul (p, &p, 10);
+                total = strtod (p, &p);
+                self = strtod (p, &p);
+                while (*p == ' ')
+                        ++p;
+                if (!*p || !(total >= 0) || !(self >= 0))
+                        continue;
+
+                entry = profile_entry (url, p);
+                if (!entry) {
+                        table->dropped++;
+                        continue;
+                }
+                entry->calls += calls;
+                entry->total += total;
+                entry->self += self;
+        }
+        profile_lock (F_UNLCK);
+
+        safefree (copy);
+        return 0;
+}
+
+static void profile_reset (void)
+{
+        if (!table)
+                return;
+
+        profile_lock (F_WRLCK);
+        memset (table, 0, sizeof (*table));
+        profile_lock (F_UNLCK);
+}
+
+/*
+ * The names of the functions of the script at "url" that have spent at
+ * least "threshold" milliseconds in total, for InstrumentHotThreshold.
+ * "*names" is a single block holding the array and the strings, which
+ * the caller releases with safefree().  Returns -1 if none have, or
+ * nothing is known about the script yet.
+ */
+int profile_hot_functions (const char *url, double threshold,
+                           char ***names, int *count)
+{
+        char key[PROFILE_URL_LEN];
+        struct profile_entry *entry;
+        size_t size = 0;
+        char *p;
+        int i, n = 0;
+
+        *names = NULL;
+        *count = 0;
+        if (!table)
+                return -1;
+
+        /* the reports are cut to the same length */
+        strlcpy (key, url, sizeof (key));
+
+        profile_lock (F_RDLCK);
+        for (i = 0; i != PROFILE_ENTRIES; ++i) {
+                entry = &table->entries[i];
+                if (entry->url[0] && entry->total >= threshold
+                    && strcmp (entry->url, key) == 0) {
+                        size += strlen (entry->name) + 1;
+                        n++;
+                }
+        }
+
+        if (n > 0)
+                *names = (char **) safemalloc (n * sizeof (char *) + size);
+        if (*names) {
+                p = (char *) (*names + n);
+                for (i = 0; i != PROFILE_ENTRIES; ++i) {
+                        entry = &table->entries[i];
+                        if (entry->url[0] && entry->total >= threshold
+                            && strcmp (entry->url, key) == 0) {
+                                (*names)[(*count)++] = p;
+                                strcpy (p, entry->name);
+                                p += strlen (p) + 1;
+                        }
+                }
+        }
+        profile_lock (F_UNLCK);
+
+        return *names ? 0 : -1;
+}
+
+/* By script, then by self time, highest first */
+static int entry_compare (const void *a, const void *b)
+{
+        const struct profile_entry *x = (const struct profile_entry *) a;
+        const struct profile_entry *y = (const struct profile_entry *) b;
+        int ret = strcmp (x->url, y->url);
+
+        if (ret != 0)
+                return ret;
+        if (x->self < y->self)
+                return 1;
+        if (x->self > y->self)
+                return -1;
+        return strcmp (x->name, y->name);
+}
+
+/*
+ * A page under construction.  Text is appended with page_add() and
+ * page_escaped(); "failed" is set if the page couldn't be grown.
+ */
+struct page {
+        char *text;
+        size_t len, size;
+        int failed;
+};
+
+static void page_add (struct page *page, const char *text)
+{
+        size_t len = strlen (text);
+        char *tmp;
+
+        if (page->failed)
+                return;
+        if (page->len + len + 1 > page->size) {
+                page->size = (page->len + len + 1) * 2;
+                tmp = (char *) saferealloc (page->text, page->size);
+                if (!tmp) {
+                        page->failed = 1;
+                        return;
+                }
+                page->text = tmp;
+        }
+        memcpy (page->text + page->len, text, len + 1);
+        page->len += len;
+}
+
+static void page_escaped (struct page *page, const char *text)
+{
+        char c[2];
+
+        c[1] = '\0';
+        for (; *text; ++text) {
+                switch (*text) {
+                case '<':
+                        page_add (page, "&lt;");
+                        break;
+                case '>':
+                        page_add (page, "&gt;");
+                        break;
+                case '&':
+                        page_add (page, "&amp;");
+                        break;
+                case '"':
+                        page_add (page, "&quot;");
+                        break;
+                default:
+                        c[0] = *text;
+                        page_add (page, c);
+                }
+        }
+}
+
+/*
+ * Send the collected profile to the client, one table per script.
+ */
+static int profile_show (struct conn_s *connptr)
+{
+        struct profile_entry *entries = NULL;
+        struct page page;
+        char line[256];
+        unsigned long reports = 0, dropped = 0;
+        unsigned int i, n = 0;
+        int ret;
+
+        if (table) {
+                entries = (struct profile_entry *)
+                        safemalloc (sizeof (table->entries));
+                if (!entries)
+                        return -1;
+
+                profile_lock (F_RDLCK);
+                for (i = 0; i != PROFILE_ENTRIES; ++i) {
+                        if (table->entries[i].url[0])
+                                entries[n++] = table->entries[i];
+                }
+                reports = table->reports;
+                dropped = table->dropped;
+                profile_lock (F_UNLCK);
+
+                qsort (entries, n, sizeof (*entries), entry_compare);
+        }
+
+        memset (&page, 0, sizeof (page));
+        page_add (&page,
+                  "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+                  "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" "
+                  "\"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n"
+                  "<html>\n"
+                  "<head><title>" PACKAGE " JavaScript profile</title></head>\n"
+                  "<body>\n"
+                  "<h1>" PACKAGE " JavaScript profile</h1>\n");
+        snprintf (line, sizeof (line),
+                  "<p>\n%lu reports, %u functions, %lu not recorded "
+                  "because the table is full "
+                  "(<a href=\"" PROFILE_PATH "?reset\">reset</a>)\n</p>\n",
+                  reports, n, dropped);
+        page_add (&page, line);
+        if (!table)
+                page_add (&page, "<p>Set InstrumentMode to timing and "
+                          "configure InstrumentContentType or "
+                          "InstrumentURL to collect a profile.</p>\n");
+
+        for (i = 0; i != n; ++i) {
+                if (i == 0 || strcmp (entries[i].url, entries[i - 1].url)) {
+                        if (i != 0)
+                                page_add (&page, "</table>\n");
+                        page_add (&page, "<h2>");
+                        page_escaped (&page, entries[i].url);
+                        page_add (&page, "</h2>\n<table border=\"1\">\n"
+                                  "<tr><th>Function</th><th>Calls</th>"
+                                  "<th>Total ms</th><th>Self ms</th>"
+                                  "<th>Self ms/call</th></tr>\n");
+                }
+                page_add (&page, "<tr><td>");
+                page_escaped (&page, entries[i].name);
+                snprintf (line, sizeof (line),
+                          "</td><td>%lu</td><td>%.3f</td><td>%.3f</td>"
+                          "<td>%.4f</td></tr>\n",
+                          entries[i].calls, entries[i].total,
+                          entries[i].self, entries[i].calls ?
+                          entries[i].self / entries[i].calls : 0.0);
+                page_add (&page, line);
+        }
+        if (n != 0)
+                page_add (&page, "</table>\n");
+
+        page_add (&page, "<hr />\n<p><em>Generated by " PACKAGE
+                  " version " VERSION ".</em></p>\n</body>\n</html>\n");
+
+        safefree (entries);
+        if (page.failed) {
+                safefree (page.text);
+                return -1;
+        }
+
+        ret = send_http_message (connptr, 200, "OK", page.text);
+        safefree (page.text);
+        return ret;
+}
+
+/*
+ * Answer a request for PROFILE_PATH on the StatHost, as flagged in
+ * connptr->profile_request.  A report has a body of "length" bytes,
+ * which is read here.
+ */
+int profile_handle (struct conn_s *connptr, long length)
+{
+        char *report;
+        size_t len = 0;
+        ssize_t ret;
+
+        switch (connptr->profile_request) {
+        case PROFILE_RESET:
+                profile_reset ();
+                log_message (LOG_NOTICE, "JavaScript profile reset");
+                return profile_show (connptr);
+        case PROFILE_RECORD:
+                break;
+        default:
+                return profile_show (connptr);
+        }
+
+        if (length < 0 || length > PROFILE_MAX_REPORT) {
+                log_message (LOG_WARNING,
+                             "Ignoring profile report of %ld bytes", length);
+                return send_http_message (connptr, 413,
+                                          "Request Entity Too Large", "");
+        }
+
+        report = (char *) safemalloc (length + 1);
+        if (!report)
+                return -1;
+
+        while (len < (size_t) length) {
+                ret = safe_read (connptr->client_fd, report + len,
+                                 length - len);
+                if (ret <= 0)
+                        break;
+                len += ret;
+        }
+
+        if (profile_record (report, len) < 0) {
+                safefree (report);
+                return -1;
+        }
+        safefree (report);
+
+        return send_http_message (connptr, 204, "No Content", "");
+}
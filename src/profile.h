@@ -0,0 +1,42 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'profile.c' for detailed information. */
+
+#ifndef _TINYPROXY_PROFILE_H_
+#define _TINYPROXY_PROFILE_H_
+
+#include "conns.h"
+
+/* Where the timing probes report to on the StatHost. */
+#define PROFILE_PATH "/profile"
+
+/* Largest report accepted from a page. */
+#define PROFILE_MAX_REPORT (256 * 1024)
+
+/* Values of connptr->profile_request */
+#define PROFILE_SHOW    1       /* GET PROFILE_PATH */
+#define PROFILE_RESET   2       /* GET PROFILE_PATH?reset */
+#define PROFILE_RECORD  3       /* POST PROFILE_PATH from sendBeacon() */
+
+extern int profile_init (void);
+extern int profile_record (const char *report, size_t len);
+extern int profile_handle (struct conn_s *connptr, long length);
+extern int profile_hot_functions (const char *url, double threshold,
+                                  char ***names, int *count);
+
+#endif /* _TINYPROXY_PROFILE_H_ */
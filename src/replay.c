@@ -0,0 +1,457 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Replays traffic captured in http.log (see http_log_flush() in log.c):
+ * with ReplayFile set, requests are answered with the response recorded
+ * for them and never reach a server, so that load tests run against an
+ * origin that does not change.
+ *
+ * The file is mapped and indexed once by the main process, and the
+ * children share the mapping.  A record is found by its method, host,
+ * port and path, and by the values of the ReplayMatchHeader headers;
+ * when the same request was recorded more than once the last record
+ * is served.  With ReplayTiming the response is sent with the delay to
+ * its first byte and the duration it was recorded with, otherwise as
+ * fast as possible.
+ *
+ * What the client was sent is what is replayed, after any rewriting,
+ * so it is sent as it is.  Tunnels made with CONNECT can't be replayed.
+ */
+
+#include "main.h"
+
+#include "replay.h"
+#include "conf.h"
+#include "heap.h"
+#include "html-error.h"
+#include "log.h"
+#include "network.h"
+
+/* Bytes sent at a time when the body is spread over its duration */
+#define REPLAY_CHUNK    4096
+
+/* Longest record header line */
+#define REPLAY_LINE     128
+
+struct replay_entry {
+        char *key;              /* see make_key(), NULL if the slot is free */
+        const char *response;   /* in the mapped file */
+        size_t len;
+        long first_byte;        /* ms after the request */
+        long total;
+};
+
+static char *map;
+static size_t map_len;
+static struct replay_entry *slots;
+static size_t slot_count;       /* a power of two */
+
+static unsigned int hash_key (const char *key)
+{
+        unsigned int h = 2166136261U;
+
+        for (; *key; key++)
+                h = (h ^ (unsigned char) *key) * 16777619U;
+        return h & 0xffffffffU;
+}
+
+/*
+ * The key of a request: "METHOD host[:port]path", then a line with the
+ * value of each ReplayMatchHeader header, empty when it is missing.
+ * "header" returns the value of a header of the request, or NULL.
+ */
+static char *make_key (const char *method, const char *host,
+                       const char *path,
+                       const char *(*header) (void *, const char *),
+                       void *request)
+{
+        const char *name, *value;
+        size_t len;
+        ssize_t i;
+        char *key, *p;
+
+        len = strlen (method) + strlen (host) + strlen (path) + 2;
+        for (i = 0; i < vector_length (config.replay_headers); i++) {
+                name = (const char *) vector_getentry (config.replay_headers,
+                                                       i, NULL);
+                value = header (request, name);
+                len += (value ? strlen (value) : 0) + 1;
+        }
+
+        key = (char *) safemalloc (len + 1);
+        if (!key)
+                return NULL;
+        p = key + sprintf (key, "%s %s%s", method, host, path);
+        for (i = 0; i < vector_length (config.replay_headers); i++) {
+                name = (const char *) vector_getentry (config.replay_headers,
+                                                       i, NULL);
+                value = header (request, name);
+                p += sprintf (p, "\n%s", value ? value : "");
+        }
+        return key;
+}
+
+/* The request headers of a record, as they were sent to the server */
+struct recorded {
+        const char *data;
+        size_t len;
+        char value[1024];
+};
+
+static const char *recorded_header (void *request, const char *name)
+{
+        struct recorded *rec = (struct recorded *) request;
+        const char *line = rec->data, *end = rec->data + rec->len;
+        const char *eol, *value;
+        size_t name_len = strlen (name), n;
+
+        /* skip the request line */
+        while (line < end && *line != '\n')
+                line++;
+        for (line++; line < end; line = eol + 1) {
+                for (eol = line; eol < end && *eol != '\n'; eol++)
+                        continue;
+                if (eol - line <= 1)
+                        break;          /* the blank line */
+                if ((size_t) (eol - line) > name_len
+                    && line[name_len] == ':'
+                    && strncasecmp (line, name, name_len) == 0) {
+                        value = line + name_len + 1;
+                        while (value < eol && (*value == ' ' || *value == '\t'))
+                                value++;
+                        n = eol - value;
+                        if (n > 0 && value[n - 1] == '\r')
+                                n--;
+                        if (n >= sizeof (rec->value))
+                                n = sizeof (rec->value) - 1;
+                        memcpy (rec->value, value, n);
+                        rec->value[n] = '\0';
+                        return rec->value;
+                }
+        }
+        return NULL;
+}
+
+static const char *request_header (void *request, const char *name)
+{
+        char *value;
+
+        if (hashmap_entry_by_key ((hashmap_t) request, name,
+                                  (void **) &value) > 0)
+                return value;
+        return NULL;
+}
+
+/*
+ * The key of a recorded request, which starts with a request line such
+ * as establish_http_connection() writes and has a Host header.  NULL if
+ * it isn't one.
+ */
+static char *recorded_key (const char *data, size_t len)
+{
+        struct recorded rec;
+        char line[2048], method[32], path[2048], host[256];
+        const char *value;
+        size_t n;
+
+        for (n = 0; n < len && data[n] != '\n'; n++)
+                continue;
+        if (n >= sizeof (line) || n == len)
+                return NULL;
+        memcpy (line, data, n);
+        line[n] = '\0';
+        if (sscanf (line, "%31s %2047s HTTP/", method, path) != 2)
+                return NULL;
+
+        rec.data = data;
+        rec.len = len;
+        value = recorded_header (&rec, "host");
+        if (!value || strlen (value) >= sizeof (host))
+                return NULL;
+        strcpy (host, value);
+
+        return make_key (method, host, path, recorded_header, &rec);
+}
+
+static void insert (char *key, const char *response, size_t len,
+                    long first_byte, long total)
+{
+        size_t i = hash_key (key) & (slot_count - 1);
+
+        while (slots[i].key && strcmp (slots[i].key, key) != 0)
+                i = (i + 1) & (slot_count - 1);
+
+        /* the last record of a request wins */
+        safefree (slots[i].key);
+        slots[i].key = key;
+        slots[i].response = response;
+        slots[i].len = len;
+        slots[i].first_byte = first_byte;
+        slots[i].total = total;
+}
+
+/* Find "needle" in data[from, len), or return len */
+static size_t find (const char *data, size_t len, size_t from,
+                    const char *needle)
+{
+        size_t n = strlen (needle);
+
+        for (; from + n <= len; from++) {
+                if (data[from] == needle[0]
+                    && memcmp (data + from, needle, n) == 0)
+                        return from;
+        }
+        return len;
+}
+
+/* Read the header line at "*pos" into "line" and move past it */
+static int header_line (size_t *pos, char *line)
+{
+        size_t n = 0;
+
+        while (*pos + n < map_len && map[*pos + n] != '\n') {
+                if (n == REPLAY_LINE - 1)
+                        return -1;
+                line[n] = map[*pos + n];
+                n++;
+        }
+        if (*pos + n == map_len)
+                return -1;
+        line[n] = '\0';
+        *pos += n + 1;
+        return 0;
+}
+
+static void release (void)
+{
+        size_t i;
+
+        for (i = 0; i < slot_count; i++)
+                safefree (slots[i].key);
+        safefree (slots);
+        slot_count = 0;
+        if (map)
+                munmap (map, map_len);
+        map = NULL;
+}
+
+/*
+ * Map ReplayFile and index its records, dropping the index of the
+ * previous configuration.  Returns 0, or -1 if the file can't be read.
+ */
+int replay_init (void)
+{
+        char line[REPLAY_LINE];
+        unsigned long request_len, response_len;
+        long first_byte, total;
+        size_t pos, records = 0, skipped = 0, start;
+        struct stat st;
+        char *key;
+        int fd;
+
+        release ();
+        if (!config.replay_file)
+                return 0;
+
+        fd = open (config.replay_file, O_RDONLY);
+        if (fd < 0 || fstat (fd, &st) < 0) {
+                log_message (LOG_ERR, "Could not open ReplayFile \"%s\": %s",
+                             config.replay_file, strerror (errno));
+                if (fd >= 0)
+                        close (fd);
+                return -1;
+        }
+        map_len = (size_t) st.st_size;
+        if (map_len > 0) {
+                map = (char *) mmap (NULL, map_len, PROT_READ, MAP_PRIVATE,
+                                     fd, 0);
+                if (map == MAP_FAILED)
+                        map = NULL;
+        }
+        close (fd);
+        if (map_len > 0 && !map) {
+                log_message (LOG_ERR, "Could not map ReplayFile \"%s\": %s",
+                             config.replay_file, strerror (errno));
+                return -1;
+        }
+
+        /* every record has at least its two header lines */
+        for (pos = 0; pos < map_len; pos = find (map, map_len, pos + 1,
+                                                "\n======== request ("))
+                records++;
+        for (slot_count = 16; slot_count < records * 2; slot_count *= 2)
+                continue;
+        slots = (struct replay_entry *)
+                safecalloc (slot_count, sizeof (struct replay_entry));
+        if (!slots) {
+                slot_count = 0;
+                return -1;
+        }
+
+        records = 0;
+        pos = 0;
+        while (pos < map_len) {
+                start = pos;
+                if (header_line (&pos, line) < 0
+                    || sscanf (line, "======== request (%lu bytes) ========",
+                               &request_len) != 1
+                    || request_len > map_len - pos)
+                        goto resync;
+                key = recorded_key (map + pos, request_len);
+                pos += request_len + 1;
+                if (pos > map_len || header_line (&pos, line) < 0
+                    || sscanf (line, "======== response (%lu bytes, %ld ms "
+                               "to first byte, %ld ms) ========",
+                               &response_len, &first_byte, &total) != 3
+                    || response_len > map_len - pos) {
+                        safefree (key);
+                        goto resync;
+                }
+
+                if (key && response_len > 0) {
+                        insert (key, map + pos, response_len,
+                                first_byte, total);
+                        records++;
+                } else {
+                        /* a tunnel, or nothing reached the client */
+                        safefree (key);
+                }
+                pos += response_len + 1;
+                continue;
+
+resync:
+                /* written by an older version, or cut short */
+                skipped++;
+                pos = find (map, map_len, start + 1, "\n======== request (");
+                if (pos < map_len)
+                        pos++;
+        }
+
+        log_message (LOG_INFO, "Replaying %lu recorded responses from \"%s\" "
+                     "(%lu records skipped)", (unsigned long) records,
+                     config.replay_file, (unsigned long) skipped);
+        return 0;
+}
+
+static double now_ms (void)
+{
+        struct timeval tv;
+
+        gettimeofday (&tv, NULL);
+        return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+static void wait_until (double when)
+{
+        struct timeval tv;
+        double left;
+
+        while ((left = when - now_ms ()) > 0) {
+                tv.tv_sec = (long) left / 1000;
+                tv.tv_usec = (long) (left - tv.tv_sec * 1000.0) * 1000;
+                select (0, NULL, NULL, NULL, &tv);
+        }
+}
+
+/*
+ * Answer "request" with the response recorded for it.  Returns 0 once
+ * it was sent, or -1 with the error set by indicate_http_error() if
+ * nothing was recorded for it.
+ */
+int replay_send (struct conn_s *connptr, struct request_s *request,
+                 hashmap_t headers)
+{
+        char host[300];
+        const struct replay_entry *entry = NULL;
+        const char *data;
+        double start, body_start;
+        size_t i, len, head, sent, n;
+        char *key;
+
+        if (connptr->connect_method) {
+                indicate_http_error (connptr, 501, "Not Implemented",
+                                     "detail", "Tunnels can not be replayed.",
+                                     NULL);
+                return -1;
+        }
+
+        /* as establish_http_connection() wrote the Host header */
+        snprintf (host, sizeof (host), strchr (request->host, ':') ?
+                  "[%s]" : "%s", request->host);
+        if (request->port != HTTP_PORT && request->port != HTTP_PORT_SSL)
+                snprintf (host + strlen (host), sizeof (host) - strlen (host),
+                          ":%u", request->port);
+
+        key = make_key (request->method, host, request->path,
+                        request_header, headers);
+        if (key && slot_count > 0) {
+                for (i = hash_key (key) & (slot_count - 1); slots[i].key;
+                     i = (i + 1) & (slot_count - 1)) {
+                        if (strcmp (slots[i].key, key) == 0) {
+                                entry = &slots[i];
+                                break;
+                        }
+                }
+        }
+        if (!entry) {
+                log_message (LOG_INFO, "No recorded response for %s %s%s",
+                             request->method, host, request->path);
+                safefree (key);
+                indicate_http_error (connptr, 404, "Not Recorded",
+                                     "detail", "There is no response "
+                                     "recorded for this request in the "
+                                     "ReplayFile.", NULL);
+                return -1;
+        }
+        safefree (key);
+
+        data = entry->response;
+        len = entry->len;
+        /* a client that went away gets no error page either */
+        if (!config.replay_timing) {
+                safe_write_with_log (connptr->client_fd,
+                                     connptr->http_log.response_data,
+                                     data, len);
+                return 0;
+        }
+
+        /* the headers after the delay they had, the body spread evenly */
+        head = find (data, len, 0, "\r\n\r\n");
+        head = head < len ? head + 4 : len;
+        start = connptr->http_log.start.tv_sec * 1000.0
+                + connptr->http_log.start.tv_usec / 1000.0;
+        body_start = start + entry->first_byte;
+
+        wait_until (body_start);
+        if (safe_write_with_log (connptr->client_fd,
+                                 connptr->http_log.response_data,
+                                 data, head) < 0)
+                return 0;
+        for (sent = 0; head + sent < len; sent += n) {
+                n = len - head - sent;
+                if (n > REPLAY_CHUNK)
+                        n = REPLAY_CHUNK;
+                wait_until (body_start + (double) (entry->total
+                                                   - entry->first_byte)
+                            * sent / (len - head));
+                if (safe_write_with_log (connptr->client_fd,
+                                         connptr->http_log.response_data,
+                                         data + head + sent, n) < 0)
+                        break;
+        }
+        return 0;
+}
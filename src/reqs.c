@@ -48,6 +48,14 @@
 #include "upstream.h"
 #include "connect-ports.h"
 #include "conf.h"
+#include "instrument.h"
+#include "profile.h"
+#include "rewrite.h"
+#include "http-cache.h"
+#include "local-file.h"
+#include "shape.h"
+#include "replay.h"
+#include "chunked.h"
 
 #define ZHOUZM_CHANGE
 
@@ -62,7 +70,7 @@
  */
 #ifdef UPSTREAM_SUPPORT
 #  define UPSTREAM_CONFIGURED() (config.upstream_list != NULL)
-#  define UPSTREAM_HOST(host) upstream_get(host, config.upstream_list)
+#  define UPSTREAM_HOST(host) upstream_get(host, config.upstream_index)
 #else
 #  define UPSTREAM_CONFIGURED() (0)
 #  define UPSTREAM_HOST(host) (NULL)
@@ -414,7 +422,10 @@ BAD_REQUEST_ERROR:
 #endif
 
         printf("\x1b[1m[%8s]\x1b[0m %s\n", request->method, url);
+        connptr->mock = get_url_mock(url);
         *replace_file = get_local_file(url);
+        if (!*replace_file && !connptr->mock)
+                connptr->local_path = get_local_dir_file(url);
 
         if (strncasecmp (url, "http://", 7) == 0
             || (UPSTREAM_CONFIGURED () && strncasecmp (url, "ftp://", 6) == 0))
@@ -506,6 +517,19 @@ BAD_REQUEST_ERROR:
         if (config.stathost && strcmp (config.stathost, request->host) == 0) {
                 log_message (LOG_NOTICE, "Request for the stathost.");
                 connptr->show_stats = TRUE;
+#ifdef ZHOUZM_CHANGE
+                if (strcmp (request->path, PROFILE_PATH) == 0)
+                        connptr->profile_request =
+                                strcmp (request->method, "POST") == 0 ?
+                                PROFILE_RECORD : PROFILE_SHOW;
+                else if (strcmp (request->path, PROFILE_PATH "?reset") == 0)
+                        connptr->profile_request = PROFILE_RESET;
+                else if (strncmp (request->path, SOURCEMAP_PATH,
+                                  strlen (SOURCEMAP_PATH)) == 0)
+                        connptr->sourcemap_request =
+                                safestrdup (request->path +
+                                            strlen (SOURCEMAP_PATH));
+#endif
                 goto fail;
         }
 
@@ -529,6 +553,7 @@ static int pull_client_data (struct conn_s *connptr, long int length)
 {
         char *buffer;
         ssize_t len;
+        size_t want, allowed;
 
         buffer =
             (char *) safemalloc (min (MAXBUFFSIZE, (unsigned long int) length));
@@ -536,8 +561,15 @@ static int pull_client_data (struct conn_s *connptr, long int length)
                 return -1;
 
         do {
-                len = safe_read (connptr->client_fd, buffer,
-                                 min (MAXBUFFSIZE, (unsigned long int) length));
+                want = min (MAXBUFFSIZE, (unsigned long int) length);
+#ifdef ZHOUZM_CHANGE
+                /* 网络模拟：请求体也按上行的令牌发送 */
+                if (connptr->shape) {
+                        allowed = shape_wait (connptr->shape, SHAPE_UP);
+                        want = min (want, allowed);
+                }
+#endif
+                len = safe_read (connptr->client_fd, buffer, want);
                 if (len <= 0)
                         goto ERROR_EXIT;
 
@@ -545,6 +577,10 @@ static int pull_client_data (struct conn_s *connptr, long int length)
                         if (safe_write_with_log (connptr->server_fd, connptr->http_log.request_data, buffer, len) < 0)
                                 goto ERROR_EXIT;
                 }
+#ifdef ZHOUZM_CHANGE
+                if (connptr->shape)
+                        shape_sent (connptr->shape, SHAPE_UP, len);
+#endif
 
                 length -= len;
         } while (length > 0);
@@ -580,6 +616,62 @@ ERROR_EXIT:
         return -1;
 }
 
+#ifdef ZHOUZM_CHANGE
+/*
+ * Like pull_client_data(), but for a chunked request body, which is
+ * sent on with its framing.  The client socket is peeked at first and
+ * only the bytes up to the end of the body are read, so whatever
+ * follows it is left for the relay.
+ */
+static int pull_chunked_client_data (struct conn_s *connptr)
+{
+        struct chunked *chunked;
+        char *buffer;
+        ssize_t len, body;
+        size_t want, allowed;
+        int ret = -1;
+
+        chunked = chunked_new ();
+        buffer = (char *) safemalloc (MAXBUFFSIZE);
+        if (!chunked || !buffer)
+                goto done;
+
+        while (!chunked_done (chunked)) {
+                want = MAXBUFFSIZE;
+                /* 网络模拟：请求体也按上行的令牌发送 */
+                if (connptr->shape) {
+                        allowed = shape_wait (connptr->shape, SHAPE_UP);
+                        want = min (want, allowed);
+                }
+                do {
+                        len = recv (connptr->client_fd, buffer, want,
+                                    MSG_PEEK);
+                } while (len < 0 && errno == EINTR);
+                if (len <= 0)
+                        goto done;
+
+                body = chunked_scan (chunked, buffer, (size_t) len);
+                if (body < 0 || safe_read (connptr->client_fd, buffer,
+                                           (size_t) body) != body)
+                        goto done;
+
+                if (!connptr->error_variables
+                    && safe_write_with_log (connptr->server_fd,
+                                            connptr->http_log.request_data,
+                                            buffer, body) < 0)
+                        goto done;
+                if (connptr->shape)
+                        shape_sent (connptr->shape, SHAPE_UP, body);
+        }
+        ret = 0;
+
+done:
+        chunked_free (chunked);
+        safefree (buffer);
+        return ret;
+}
+#endif
+
 #ifdef XTINYPROXY_ENABLE
 /*
  * Add the X-Tinyproxy header to the collection of headers being sent to
@@ -852,6 +944,10 @@ process_client_headers (struct conn_s *connptr, hashmap_t hashofheaders)
         int ret = 0;
 
         char *data, *header;
+#ifdef ZHOUZM_CHANGE
+        const char *if_none_match, *if_modified_since;
+        int client_chunked;
+#endif
 
         /*
          * Don't send headers if there's already an error, if the request was
@@ -870,6 +966,14 @@ process_client_headers (struct conn_s *connptr, hashmap_t hashofheaders)
          * to do a bit of processing.
          */
         connptr->content_length.client = get_content_length (hashofheaders);
+#ifdef ZHOUZM_CHANGE
+        /* 分块的请求体以最后一块结束，不看 Content-Length */
+        client_chunked = chunked_wanted (hashofheaders);
+        if (client_chunked) {
+                hashmap_remove (hashofheaders, "content-length");
+                connptr->content_length.client = -1;
+        }
+#endif
 
         /*
          * See if there is a "Connection" header.  If so, we need to do a bit
@@ -930,6 +1034,26 @@ process_client_headers (struct conn_s *connptr, hashmap_t hashofheaders)
                 add_xtinyproxy_header (connptr);
 #endif
 
+#ifdef ZHOUZM_CHANGE
+        /* 缓存里有过期的副本，问服务器它是否还有效 */
+        if (connptr->cache_fill
+            && http_cache_validators (connptr->cache_fill, &if_none_match,
+                                      &if_modified_since)) {
+                if (if_none_match
+                    && write_message_with_log (connptr->server_fd,
+                                               connptr->http_log.request_data,
+                                               "If-None-Match: %s\r\n",
+                                               if_none_match) < 0)
+                        return -1;
+                if (if_modified_since
+                    && write_message_with_log (connptr->server_fd,
+                                               connptr->http_log.request_data,
+                                               "If-Modified-Since: %s\r\n",
+                                               if_modified_since) < 0)
+                        return -1;
+        }
+#endif
+
         /* Write the final "blank" line to signify the end of the headers */
         if (safe_write_with_log (connptr->server_fd, connptr->http_log.request_data, "\r\n", 2) < 0)
                 return -1;
@@ -942,10 +1066,332 @@ PULL_CLIENT_DATA:
                 ret = pull_client_data (connptr,
                                         connptr->content_length.client);
         }
+#ifdef ZHOUZM_CHANGE
+        else if (client_chunked) {
+                ret = pull_chunked_client_data (connptr);
+        }
+#endif
 
         return ret;
 }
 
+#ifdef ZHOUZM_CHANGE
+/*
+ * Read a body with a Content-Length of at most InstrumentMaxSize whole
+ * and instrument it through the cache, leaving the result in
+ * connptr->instrumented_body.  A body the instrumenter can't handle is
+ * queued in the server buffer and relayed unchanged.  Returns -1 only if
+ * reading from the server failed.
+ */
+static int instrument_response (struct conn_s *connptr)
+{
+        char *body;
+        size_t len;
+        long length = connptr->content_length.server;
+        ssize_t ret;
+
+        body = (char *) safemalloc (length + 1);
+        if (!body)
+                return 0;
+
+        len = 0;
+        while (len < (size_t) length) {
+                ret = safe_read (connptr->server_fd, body + len, length - len);
+                if (ret < 0) {
+                        safefree (body);
+                        return -1;
+                }
+                if (ret == 0)
+                        goto relay;
+                len += ret;
+        }
+
+        if (instrument_cached (body, len, connptr->request_line,
+                               &connptr->instrumented_body,
+                               &connptr->instrumented_len) < 0) {
+                log_message (LOG_WARNING,
+                             "Could not instrument the response to \"%s\"",
+                             connptr->request_line);
+                goto relay;
+        }
+
+        log_message (LOG_INFO, "Instrumented the response to \"%s\" "
+                     "(%lu -> %lu bytes)", connptr->request_line,
+                     (unsigned long) len,
+                     (unsigned long) connptr->instrumented_len);
+        safefree (body);
+        return 0;
+
+relay:
+        /* Hand what was read so far to relay_connection() */
+        if (len > 0 && add_to_buffer (connptr->sbuffer,
+                                      (unsigned char *) body, len) < 0) {
+                safefree (body);
+                return -1;
+        }
+        connptr->content_length.server -= len;
+        safefree (body);
+        return 0;
+}
+
+/*
+ * Send a response found by http_cache_lookup(): the status line and
+ * headers as they were first sent, its current age and the Via header,
+ * then the body unless the request was HEAD.
+ */
+static int send_cached_response (struct conn_s *connptr,
+                                 const struct http_cache_hit *hit)
+{
+        /* the stored blank line ends the headers */
+        size_t head = hit->header_len - 2;
+
+        log_message (LOG_INFO, "Serving \"%s\" from the response cache",
+                     connptr->request_line);
+
+        if (safe_write_with_log (connptr->client_fd,
+                                 connptr->http_log.response_data,
+                                 hit->data, head) < 0
+            || write_message_with_log (connptr->client_fd,
+                                       connptr->http_log.response_data,
+                                       "Age: %ld\r\n", hit->age) < 0
+            || write_via_header (connptr->client_fd, NULL,
+                                 connptr->protocol.major,
+                                 connptr->protocol.minor) < 0)
+                return -1;
+
+        if (strncmp (connptr->request_line, "HEAD ", 5) == 0)
+                return safe_write_with_log (connptr->client_fd,
+                                            connptr->http_log.response_data,
+                                            "\r\n", 2) < 0 ? -1 : 0;
+        if (hit->fd < 0)
+                return safe_write_with_log (connptr->client_fd,
+                                            connptr->http_log.response_data,
+                                            hit->data + head,
+                                            hit->len - head) < 0 ? -1 : 0;
+
+        /* found in CacheDir: the body goes straight from the file */
+        if (safe_write_with_log (connptr->client_fd,
+                                 connptr->http_log.response_data,
+                                 "\r\n", 2) < 0)
+                return -1;
+        return send_file (connptr->client_fd, hit->fd, (off_t) hit->offset,
+                          hit->len - hit->header_len);
+}
+
+/*
+ * Decide how the body of the response is rewritten.  The Rewrite* rules
+ * that apply to it, and the JavaScript instrumenter if the response was
+ * selected by the InstrumentContentType or InstrumentURL patterns, go
+ * into connptr->rewrite and work on the body as relay_connection()
+ * relays it, so the client sees the first bytes without waiting for the
+ * whole body.  Only JavaScript that no rule applies to and whose
+ * Content-Length is at most InstrumentMaxSize is read whole by
+ * instrument_response(), to be served from the cache.  A gzip or
+ * deflate body is inflated first, and compressed again afterwards if
+ * RewriteCompressLevel says so; one no rule applies to is relayed as it
+ * is.  A chunked body is rewritten once read_relayed() has taken its
+ * framing off.  Returns -1 only if reading from the server failed.
+ */
+static int rewrite_response (struct conn_s *connptr,
+                             hashmap_t hashofheaders, int status)
+{
+        char *data;
+        char *content_type = NULL;
+        char *content_encoding = NULL;
+        long length = connptr->content_length.server;
+        int encoding, level;
+
+        if (status < 200 || status == 204 || status == 304
+            || strncasecmp (connptr->request_line, "HEAD ", 5) == 0)
+                return 0;
+
+        hashmap_entry_by_key (hashofheaders, "content-encoding",
+                              (void **) &content_encoding);
+        encoding = rewrite_encoding (content_encoding);
+        if (encoding < 0)
+                return 0;
+        if (!connptr->server_chunked
+            && hashmap_entry_by_key (hashofheaders, "transfer-encoding",
+                                     (void **) &data) > 0)
+                return 0;
+
+        hashmap_entry_by_key (hashofheaders, "content-type",
+                              (void **) &content_type);
+        connptr->rewrite = rewrite_chain_new (connptr->request_line,
+                                              content_type);
+
+        if (status == 200
+            && (config.instrument_types || config.instrument_urls)
+            && instrument_wanted (connptr->request_line, content_type)) {
+                if (!connptr->rewrite && encoding == REWRITE_IDENTITY
+                    && length >= 0
+                    && length <= (long) config.instrument_maxsize)
+                        return instrument_response (connptr);
+
+                if (rewrite_add_instrument (&connptr->rewrite,
+                                            connptr->request_line) < 0) {
+                        log_message (LOG_WARNING,
+                                     "Could not instrument the response "
+                                     "to \"%s\"", connptr->request_line);
+                        rewrite_chain_free (connptr->rewrite);
+                        connptr->rewrite = NULL;
+                        return 0;
+                }
+        }
+
+        if (connptr->rewrite && encoding != REWRITE_IDENTITY) {
+                level = (int) config.rewrite_compress_level;
+                if (rewrite_add_decoder (connptr->rewrite, encoding) < 0
+                    || (level > 0 && rewrite_add_encoder (connptr->rewrite,
+                                                          encoding,
+                                                          level) < 0)) {
+                        log_message (LOG_WARNING,
+                                     "Could not decompress the response "
+                                     "to \"%s\"", connptr->request_line);
+                        rewrite_chain_free (connptr->rewrite);
+                        connptr->rewrite = NULL;
+                        return 0;
+                }
+                if (level == 0)
+                        hashmap_remove (hashofheaders, "content-encoding");
+        }
+
+        if (connptr->rewrite)
+                log_message (LOG_INFO,
+                             "Rewriting the response to \"%s\" as it is "
+                             "relayed", connptr->request_line);
+        return 0;
+}
+
+/*
+ * Queue "len" bytes of rewritten body for the client, as a chunk when
+ * the body is sent chunked.  The end of a chunked body is marked by
+ * passing "eof".
+ */
+static int queue_rewritten (struct conn_s *connptr, char *data, size_t len,
+                            int eof)
+{
+        char frame[CHUNKED_FRAME_SIZE];
+        size_t frame_len;
+
+        if (!connptr->rewrite_chunked)
+                return len > 0 ? add_to_buffer (connptr->sbuffer,
+                                                (unsigned char *) data,
+                                                len) : 0;
+
+        if (len > 0) {
+                frame_len = chunked_frame (frame, len);
+                if (add_to_buffer (connptr->sbuffer, (unsigned char *) frame,
+                                   frame_len) < 0
+                    || add_to_buffer (connptr->sbuffer,
+                                      (unsigned char *) data, len) < 0
+                    || add_to_buffer (connptr->sbuffer, (unsigned char *)
+                                      frame + frame_len - 2, 2) < 0)
+                        return -1;
+        }
+        if (eof) {
+                /* the server's trailers go after the last chunk */
+                frame_len = chunked_frame (frame, 0);
+                if (add_to_buffer (connptr->sbuffer, (unsigned char *) frame,
+                                   frame_len) < 0
+                    || (connptr->server_chunked
+                        && connptr->server_chunked->trailers_len > 0
+                        && add_to_buffer (connptr->sbuffer,
+                                          (unsigned char *)
+                                          connptr->server_chunked->trailers,
+                                          connptr->server_chunked->trailers_len)
+                        < 0)
+                    || add_to_buffer (connptr->sbuffer, (unsigned char *)
+                                      frame + frame_len - 2, 2) < 0)
+                        return -1;
+        }
+        return 0;
+}
+
+/*
+ * Like read_buffer(), but the bytes read from the server are passed
+ * through connptr->rewrite before they are queued for the client, or
+ * kept in connptr->cache_fill for the response cache.  The rewrite
+ * stages only hold back what might still be part of a match; the end of
+ * the body flushes them.  A chunked body has its framing followed, and
+ * taken off in the read buffer with dechunk_server.
+ */
+static ssize_t read_relayed (struct conn_s *connptr)
+{
+        char buffer[READ_BUFFER_SIZE];
+        char *out;
+        size_t out_len, len;
+        int eof;
+        ssize_t bytesin, body;
+
+        if (buffer_size (connptr->sbuffer) >= MAXBUFFSIZE)
+                return 0;
+
+        bytesin = read (connptr->server_fd, buffer, sizeof (buffer));
+        if (bytesin < 0) {
+                switch (errno) {
+#ifdef EWOULDBLOCK
+                case EWOULDBLOCK:
+#else
+#  ifdef EAGAIN
+                case EAGAIN:
+#  endif
+#endif
+                case EINTR:
+                        return 0;
+                }
+                log_message (LOG_ERR,
+                             "read_relayed: recv() error \"%s\" on "
+                             "file descriptor %d",
+                             strerror (errno), connptr->server_fd);
+                return -1;
+        }
+
+        if (connptr->cache_fill
+            && http_cache_add_body (connptr->cache_fill, buffer,
+                                    (size_t) bytesin) < 0) {
+                http_cache_fill_free (connptr->cache_fill);
+                connptr->cache_fill = NULL;
+        }
+
+        len = bytesin > 0 ? (size_t) bytesin : 0;
+        if (connptr->server_chunked && len > 0) {
+                /* 最后一块和 trailer 之后的字节不属于响应体 */
+                body = connptr->dechunk_server
+                        ? chunked_decode (connptr->server_chunked, buffer,
+                                          len, &len)
+                        : chunked_scan (connptr->server_chunked, buffer, len);
+                if (body < 0)
+                        return -1;
+                if (!connptr->dechunk_server)
+                        len = (size_t) body;
+        }
+
+        if (!connptr->rewrite) {
+                if (len > 0
+                    && add_to_buffer (connptr->sbuffer,
+                                      (unsigned char *) buffer, len) < 0)
+                        return -1;
+                return bytesin > 0 ? bytesin : -1;
+        }
+
+        eof = bytesin == 0 || bytesin == connptr->content_length.server
+                || (connptr->server_chunked
+                    && chunked_done (connptr->server_chunked));
+        if (rewrite_feed (connptr->rewrite, buffer, len, eof,
+                          &out, &out_len) < 0) {
+                log_message (LOG_ERR,
+                             "read_relayed: could not rewrite \"%s\"",
+                             connptr->request_line);
+                return -1;
+        }
+        if (queue_rewritten (connptr, out, out_len, eof) < 0)
+                return -1;
+
+        return bytesin > 0 ? bytesin : -1;
+}
+#endif
+
 /*
  * Loop through all the headers (including the response code) from the
  * server.
@@ -971,6 +1417,11 @@ static int process_server_headers (struct conn_s *connptr
         ssize_t len;
         int i;
         int ret;
+#ifdef ZHOUZM_CHANGE
+        unsigned int major = 0, minor = 0;
+        int status = 0;
+        struct http_cache_hit hit;
+#endif
 
 #ifdef REVERSE_SUPPORT
         struct reversepath *reverse = config.reversepath_list;
@@ -981,6 +1432,9 @@ retry:
         len = readline (connptr->server_fd, &response_line);
         if (len <= 0)
                 return -1;
+#ifdef ZHOUZM_CHANGE
+        http_log_first_byte (&connptr->http_log);
+#endif
 
         /*
          * Strip the new line and character return from the string.
@@ -1031,6 +1485,31 @@ retry:
                 return 0;
         }
 
+#ifdef ZHOUZM_CHANGE
+        sscanf (response_line, "HTTP/%u.%u %d", &major, &minor, &status);
+
+        /* 过期的副本仍然有效，把它发给客户端 */
+        if (connptr->cache_fill && status == 304
+            && http_cache_not_modified (connptr->cache_fill, hashofheaders,
+                                        &hit) > 0) {
+                hashmap_delete (hashofheaders);
+                safefree (response_line);
+                http_cache_fill_free (connptr->cache_fill);
+                connptr->cache_fill = NULL;
+                connptr->cache_revalidated = 1;
+                ret = send_cached_response (connptr, &hit);
+                http_cache_hit_free (&hit);
+                return ret;
+        }
+
+        if (connptr->cache_fill
+            && http_cache_response (connptr->cache_fill, response_line,
+                                    status, hashofheaders) < 0) {
+                http_cache_fill_free (connptr->cache_fill);
+                connptr->cache_fill = NULL;
+        }
+#endif
+
         /* Send the saved response line first */
         ret = write_message_with_log (connptr->client_fd, connptr->http_log.response_data, "%s\r\n", response_line);
         safefree (response_line);
@@ -1043,6 +1522,66 @@ retry:
          */
         connptr->content_length.server = get_content_length (hashofheaders);
 
+#ifdef ZHOUZM_CHANGE
+        /*
+         * A chunked body ends with its last chunk, whatever
+         * Content-Length says.  Follow its framing so relay_connection()
+         * knows where it ends.
+         */
+        if (status >= 200 && status != 204 && status != 304
+            && strncasecmp (connptr->request_line, "HEAD ", 5) != 0
+            && chunked_wanted (hashofheaders)) {
+                hashmap_remove (hashofheaders, "content-length");
+                connptr->content_length.server = -1;
+                connptr->server_chunked = chunked_new ();
+                if (!connptr->server_chunked)
+                        goto ERROR_EXIT;
+        }
+
+        /*
+         * Set up the rewriting and run the JavaScript instrumenter before
+         * the headers go out, so Content-Length can be fixed up for the
+         * rewritten body.  A body rewritten as it is relayed is sent
+         * chunked when both sides speak HTTP/1.1, otherwise it ends when
+         * the connection is closed.
+         */
+        if (replace_content_length < 0
+            && (config.instrument_types || config.instrument_urls
+                || config.rewrite_rules)) {
+                if (rewrite_response (connptr, hashofheaders, status) < 0)
+                        goto ERROR_EXIT;
+                if (connptr->instrumented_body)
+                        replace_content_length =
+                                (int) connptr->instrumented_len;
+                connptr->rewrite_chunked = connptr->rewrite
+                        && (major > 1 || (major == 1 && minor >= 1))
+                        && (connptr->protocol.major > 1
+                            || (connptr->protocol.major == 1
+                                && connptr->protocol.minor >= 1));
+        }
+
+        /*
+         * The framing comes off a chunked body that is rewritten, or
+         * that goes to an HTTP/1.0 client, and off one replaced by a
+         * local file.
+         */
+        if (connptr->server_chunked
+            && (connptr->rewrite || replace_content_length >= 0
+                || connptr->protocol.major < 1
+                || (connptr->protocol.major == 1
+                    && connptr->protocol.minor == 0))) {
+                connptr->dechunk_server = 1;
+                hashmap_remove (hashofheaders, "transfer-encoding");
+        }
+
+        /* The cache keeps bodies as the server sent them */
+        if (connptr->cache_fill
+            && (connptr->rewrite || connptr->instrumented_body)) {
+                http_cache_fill_free (connptr->cache_fill);
+                connptr->cache_fill = NULL;
+        }
+#endif
+
         /*
          * See if there is a connection header.  If so, we need to to a bit of
          * processing.
@@ -1056,6 +1595,18 @@ retry:
                 hashmap_remove (hashofheaders, skipheaders[i]);
         }
 
+#ifdef ZHOUZM_CHANGE
+        /* a hit adds our own Via again, see send_cached_response() */
+        if (connptr->cache_fill
+            && hashmap_entry_by_key (hashofheaders, "via",
+                                     (void **) &header) > 0
+            && http_cache_add_header (connptr->cache_fill, "Via",
+                                      header) < 0) {
+                http_cache_fill_free (connptr->cache_fill);
+                connptr->cache_fill = NULL;
+        }
+#endif
+
         /* Send, or add the Via header */
         ret = write_via_header (connptr->client_fd, hashofheaders,
                                 connptr->protocol.major,
@@ -1081,10 +1632,8 @@ retry:
 
                 /* Look for a matching entry in the reversepath list */
                 while (reverse) {
-                        if (strncasecmp (header,
-                                         reverse->url, (len =
-                                                        strlen (reverse->
-                                                                url))) == 0)
+                        len = reverse->url_len;
+                        if (strncasecmp (header, reverse->url, len) == 0)
                                 break;
                         reverse = reverse->next;
                 }
@@ -1121,16 +1670,25 @@ retry:
                         {
                             char replace_header[256];
                             if (replace_content_length >= 0
-                                    && (strcmp(data, "Content-Length") == 0
-                                    || strcmp(data, "Content-length") == 0)) {
+                                    && strcasecmp(data, "Content-Length") == 0) {
                                 sprintf(replace_header, "%d", replace_content_length);
                                 header = replace_header;
                             }
                             if (replace_content_length >= 0
-                                    && (strcmp(data, "Content-Encoding") == 0
-                                    || strcmp(data, "Content-encoding") == 0)) {
+                                    && strcasecmp(data, "Content-Encoding") == 0) {
+                                continue;
+                            }
+                            /* 边读边改写，长度要到最后才知道 */
+                            if (connptr->rewrite
+                                    && strcasecmp(data, "Content-Length") == 0) {
                                 continue;
                             }
+                            if (connptr->cache_fill
+                                    && http_cache_add_header(connptr->cache_fill,
+                                                             data, header) < 0) {
+                                http_cache_fill_free(connptr->cache_fill);
+                                connptr->cache_fill = NULL;
+                            }
                         }
                         #endif
 
@@ -1143,6 +1701,25 @@ retry:
         }
         hashmap_delete (hashofheaders);
 
+        #ifdef ZHOUZM_CHANGE
+        /* 原来没有 Content-Length 的响应，插桩或替换成本地文件后补上 */
+        if (replace_content_length >= 0 && connptr->content_length.server < 0
+            && (connptr->instrumented_body || connptr->server_chunked)) {
+            ret = write_message_with_log (connptr->client_fd,
+                                 connptr->http_log.response_data,
+                                 "Content-Length: %d\r\n", replace_content_length);
+            if (ret < 0)
+                return -1;
+        }
+        if (connptr->rewrite_chunked) {
+            ret = write_message_with_log (connptr->client_fd,
+                                 connptr->http_log.response_data,
+                                 "Transfer-Encoding: chunked\r\n");
+            if (ret < 0)
+                return -1;
+        }
+        #endif
+
         /* Write the final blank line to signify the end of the headers */
         if (safe_write_with_log (connptr->client_fd, connptr->http_log.response_data, "\r\n", 2) < 0)
                 return -1;
@@ -1170,7 +1747,8 @@ static void relay_connection (struct conn_s *connptr)
         int ret;
         double tdiff;
         int maxfd = max (connptr->client_fd, connptr->server_fd) + 1;
-        ssize_t bytes_received;
+        ssize_t bytes_received, bytes_sent;
+        size_t down = (size_t) -1, up = (size_t) -1;
 
         socket_nonblocking (connptr->client_fd);
         socket_nonblocking (connptr->server_fd);
@@ -1185,9 +1763,20 @@ static void relay_connection (struct conn_s *connptr)
                     config.idletimeout - difftime (time (NULL), last_access);
                 tv.tv_usec = 0;
 
-                if (buffer_size (connptr->sbuffer) > 0)
+#ifdef ZHOUZM_CHANGE
+                /* 网络模拟：令牌不够时不写，select() 等到够了再醒 */
+                if (connptr->shape) {
+                        if (buffer_size (connptr->sbuffer) > 0)
+                                down = shape_allow (connptr->shape,
+                                                    SHAPE_DOWN, &tv);
+                        if (buffer_size (connptr->cbuffer) > 0)
+                                up = shape_allow (connptr->shape,
+                                                  SHAPE_UP, &tv);
+                }
+#endif
+                if (buffer_size (connptr->sbuffer) > 0 && down > 0)
                         FD_SET (connptr->client_fd, &wset);
-                if (buffer_size (connptr->cbuffer) > 0)
+                if (buffer_size (connptr->cbuffer) > 0 && up > 0)
                         FD_SET (connptr->server_fd, &wset);
                 if (buffer_size (connptr->sbuffer) < MAXBUFFSIZE)
                         FD_SET (connptr->server_fd, &rset);
@@ -1207,6 +1796,9 @@ static void relay_connection (struct conn_s *connptr)
                                 continue;
                         }
                 } else if (ret < 0) {
+                        if (errno == EINTR)
+                                continue;
+
                         log_message (LOG_ERR,
                                      "relay_connection: select() error \"%s\". "
                                      "Closing connection (client_fd:%d, server_fd:%d)",
@@ -1221,6 +1813,12 @@ static void relay_connection (struct conn_s *connptr)
                 }
 
                 if (FD_ISSET (connptr->server_fd, &rset)) {
+#ifdef ZHOUZM_CHANGE
+                        if (connptr->rewrite || connptr->cache_fill
+                            || connptr->server_chunked)
+                                bytes_received = read_relayed (connptr);
+                        else
+#endif
                         bytes_received =
                             read_buffer (connptr->server_fd, connptr->sbuffer);
                         if (bytes_received < 0)
@@ -1229,18 +1827,41 @@ static void relay_connection (struct conn_s *connptr)
                         connptr->content_length.server -= bytes_received;
                         if (connptr->content_length.server == 0)
                                 break;
+#ifdef ZHOUZM_CHANGE
+                        if (connptr->server_chunked
+                            && chunked_done (connptr->server_chunked))
+                                break;
+#endif
                 }
                 if (FD_ISSET (connptr->client_fd, &rset)
                     && read_buffer (connptr->client_fd, connptr->cbuffer) < 0) {
                         break;
                 }
-                if (FD_ISSET (connptr->server_fd, &wset)
-                    && write_buffer (connptr->server_fd, connptr->cbuffer, connptr->http_log.request_data) < 0) {
-                        break;
+                if (FD_ISSET (connptr->server_fd, &wset)) {
+                        bytes_sent = write_buffer_limit (connptr->server_fd,
+                                                         connptr->cbuffer,
+                                                         connptr->http_log.request_data,
+                                                         up);
+                        if (bytes_sent < 0)
+                                break;
+#ifdef ZHOUZM_CHANGE
+                        if (connptr->shape)
+                                shape_sent (connptr->shape, SHAPE_UP,
+                                            bytes_sent);
+#endif
                 }
-                if (FD_ISSET (connptr->client_fd, &wset)
-                    && write_buffer (connptr->client_fd, connptr->sbuffer, connptr->http_log.response_data) < 0) {
-                        break;
+                if (FD_ISSET (connptr->client_fd, &wset)) {
+                        bytes_sent = write_buffer_limit (connptr->client_fd,
+                                                         connptr->sbuffer,
+                                                         connptr->http_log.response_data,
+                                                         down);
+                        if (bytes_sent < 0)
+                                break;
+#ifdef ZHOUZM_CHANGE
+                        if (connptr->shape)
+                                shape_sent (connptr->shape, SHAPE_DOWN,
+                                            bytes_sent);
+#endif
                 }
         }
 
@@ -1250,8 +1871,20 @@ static void relay_connection (struct conn_s *connptr)
          */
         socket_blocking (connptr->client_fd);
         while (buffer_size (connptr->sbuffer) > 0) {
-                if (write_buffer (connptr->client_fd, connptr->sbuffer, connptr->http_log.response_data) < 0)
+#ifdef ZHOUZM_CHANGE
+                if (connptr->shape)
+                        down = shape_wait (connptr->shape, SHAPE_DOWN);
+#endif
+                bytes_sent = write_buffer_limit (connptr->client_fd,
+                                                 connptr->sbuffer,
+                                                 connptr->http_log.response_data,
+                                                 down);
+                if (bytes_sent < 0)
                         break;
+#ifdef ZHOUZM_CHANGE
+                if (connptr->shape)
+                        shape_sent (connptr->shape, SHAPE_DOWN, bytes_sent);
+#endif
         }
         shutdown (connptr->client_fd, SHUT_WR);
 
@@ -1267,6 +1900,60 @@ static void relay_connection (struct conn_s *connptr)
         return;
 }
 
+#ifdef UPSTREAM_SUPPORT
+/*
+ * Connect to a member of an upstream group, failing over to the next
+ * member picked by the group's balancing policy until one accepts the
+ * connection or every member has been tried.
+ */
+static struct upstream_member *
+connect_to_upstream_group (struct conn_s *connptr, struct request_s *request,
+                           struct upstream_group *group)
+{
+        struct upstream_member *member;
+        unsigned char *tried;
+        struct timeval tv;
+        int slot;
+
+        connptr->server_fd = -1;
+
+        tried = (unsigned char *) safecalloc (group->nmembers + 1, 1);
+        if (!tried)
+                return NULL;
+
+        while ((member = upstream_member_pick (group, request->host, tried))) {
+                slot = upstream_member_slot (member);
+
+                /*
+                 * A member that hangs counts as failed after Timeout
+                 * seconds, both while connecting and while waiting for
+                 * its response headers.
+                 */
+                connptr->server_fd =
+                        opensock_timeout (member->host, member->port,
+                                          connptr->server_ip_addr,
+                                          config.idletimeout);
+                if (connptr->server_fd >= 0) {
+                        tv.tv_sec = config.idletimeout;
+                        tv.tv_usec = 0;
+                        setsockopt (connptr->server_fd, SOL_SOCKET,
+                                    SO_RCVTIMEO, &tv, sizeof (tv));
+                        upstream_health_connected (slot);
+                        connptr->upstream_slot = slot;
+                        break;
+                }
+
+                log_message (LOG_WARNING,
+                             "Could not connect to upstream %s:%d in group %s",
+                             member->host, member->port, group->name);
+                upstream_health_failed (slot);
+        }
+
+        safefree (tried);
+        return member;
+}
+#endif
+
 /*
  * Establish a connection to the upstream proxy server.
  */
@@ -1284,6 +1971,8 @@ connect_to_upstream (struct conn_s *connptr, struct request_s *request)
         int len;
 
         struct upstream *cur_upstream = connptr->upstream_proxy;
+        struct upstream_member *member;
+        const char *host;
 
         if (!cur_upstream) {
                 log_message (LOG_WARNING,
@@ -1294,9 +1983,16 @@ connect_to_upstream (struct conn_s *connptr, struct request_s *request)
                 return -1;
         }
 
-        connptr->server_fd =
-            opensock (cur_upstream->host, cur_upstream->port,
-                      connptr->server_ip_addr);
+        if (cur_upstream->group) {
+                member = connect_to_upstream_group (connptr, request,
+                                                    cur_upstream->group);
+                host = member ? member->host : NULL;
+        } else {
+                connptr->server_fd =
+                    opensock (cur_upstream->host, cur_upstream->port,
+                              connptr->server_ip_addr);
+                host = cur_upstream->host;
+        }
 
         if (connptr->server_fd < 0) {
                 log_message (LOG_WARNING,
@@ -1313,7 +2009,7 @@ connect_to_upstream (struct conn_s *connptr, struct request_s *request)
         log_message (LOG_CONN,
                      "Established connection to upstream proxy \"%s\" "
                      "using file descriptor %d.",
-                     cur_upstream->host, connptr->server_fd);
+                     host, connptr->server_fd);
 
         /*
          * We need to re-write the "path" part of the request so that we
@@ -1392,6 +2088,39 @@ get_request_entity(struct conn_s *connptr)
         return ret;
 }
 
+#ifdef ZHOUZM_CHANGE
+/*
+ * The absolute URL of the request, as the key of the response cache.
+ * Built from what process_request() resolved, so that it has the host
+ * however the request line was written.
+ */
+static char *absolute_url (const struct request_s *request)
+{
+        char port[7];
+        const char *left = "", *right = "";
+        size_t len;
+        char *url;
+
+        if (request->port != HTTP_PORT)
+                snprintf (port, sizeof (port), ":%u", request->port);
+        else
+                port[0] = '\0';
+        /* an IPv6 address literal goes in brackets */
+        if (strchr (request->host, ':')) {
+                left = "[";
+                right = "]";
+        }
+
+        len = strlen ("http://") + strlen (request->host) + 2 + strlen (port)
+                + strlen (request->path) + 1;
+        url = (char *) safemalloc (len);
+        if (!url)
+                return NULL;
+        snprintf (url, len, "http://%s%s%s%s%s", left, request->host, right,
+                  port, request->path);
+        return url;
+}
+#endif
 
 /*
  * This is the main drive for each connection. As you can tell, for the
@@ -1417,6 +2146,9 @@ void handle_connection (int fd)
         const char *replace_file = 0;
         char *replace_file_data = 0;
         int replace_file_size = -1;
+        struct http_cache_hit hit;
+        char *shape_url, *cache_url;
+        int cache_found;
         #endif
 
         getpeer_information (fd, peer_ipaddr, peer_string);
@@ -1507,12 +2239,14 @@ void handle_connection (int fd)
             printf("can't open debug file!!!\n");
             replace_file = NULL;
           }
-          fseek(file, 0L, SEEK_END);
-          file_size = ftell(file);
-          fseek(file, 0L, SEEK_SET);
-          replace_file_data = (char*) malloc(file_size);
-          replace_file_size = fread(replace_file_data, 1, file_size, file);
-          fclose(file);
+          else {
+            fseek(file, 0L, SEEK_END);
+            file_size = ftell(file);
+            fseek(file, 0L, SEEK_SET);
+            replace_file_data = (char*) malloc(file_size);
+            replace_file_size = fread(replace_file_data, 1, file_size, file);
+            fclose(file);
+          }
         }
         #else
         request = process_request (connptr, hashofheaders);
@@ -1524,6 +2258,65 @@ void handle_connection (int fd)
                 goto fail;
         }
 
+        #ifdef ZHOUZM_CHANGE
+        /* 网络模拟：按客户端或 URL 选择配置，先加上延迟 */
+        shape_url = request_url (connptr->request_line);
+        connptr->shape = shape_new (connptr->client_ip_addr,
+                                    connptr->client_string_addr, shape_url);
+        safefree (shape_url);
+        if (connptr->shape)
+                shape_delay (connptr->shape);
+
+        /* mocks.conf 里的模拟响应已经拼好，一次写出去 */
+        if (connptr->mock) {
+                get_request_entity (connptr);
+                if (safe_write_with_log (connptr->client_fd,
+                                         connptr->http_log.response_data,
+                                         connptr->mock->response,
+                                         strcasecmp (request->method, "HEAD") == 0
+                                         ? connptr->mock->header_len
+                                         : connptr->mock->response_len) < 0)
+                        goto fail;
+                goto done;
+        }
+
+        /* urls.conf 映射到目录的请求直接用本地文件应答，不连接服务器 */
+        if (connptr->local_path) {
+                if (local_file_send (connptr, request->method,
+                                     connptr->local_path, hashofheaders) < 0)
+                        goto fail;
+                goto done;
+        }
+
+        /* 回放模式：用录下的响应应答，不连接服务器 */
+        if (config.replay_file) {
+                if (replay_send (connptr, request, hashofheaders) < 0)
+                        goto fail;
+                goto done;
+        }
+
+        /*
+         * urls.conf 映射到本地文件的请求不经过缓存。缓存用带主机名的
+         * 完整 URL，透明代理和反向代理的请求行里只有路径
+         */
+        if (!replace_file) {
+                cache_url = absolute_url (request);
+                cache_found = cache_url
+                        && http_cache_lookup (request->method, cache_url,
+                                              hashofheaders, &hit,
+                                              &connptr->cache_fill) > 0;
+                safefree (cache_url);
+                if (cache_found) {
+                        if (send_cached_response (connptr, &hit) < 0)
+                                log_message (LOG_WARNING,
+                                             "Could not send the cached "
+                                             "response");
+                        http_cache_hit_free (&hit);
+                        goto done;
+                }
+        }
+        #endif
+
         connptr->upstream_proxy = UPSTREAM_HOST (request->host);
         if (connptr->upstream_proxy != NULL) {
                 if (connect_to_upstream (connptr, request) < 0) {
@@ -1557,9 +2350,15 @@ void handle_connection (int fd)
 
         if (!(connptr->connect_method && (connptr->upstream_proxy == NULL))) {
                 if (process_server_headers (connptr, replace_file_size) < 0) {
+#ifdef UPSTREAM_SUPPORT
+                        upstream_health_failed (connptr->upstream_slot);
+#endif
                         update_stats (STAT_BADCONN);
                         goto fail;
                 }
+#ifdef UPSTREAM_SUPPORT
+                upstream_health_ok (connptr->upstream_slot);
+#endif
         } else {
                 if (send_ssl_response (connptr) < 0) {
                         log_message (LOG_ERR,
@@ -1573,10 +2372,20 @@ void handle_connection (int fd)
         #ifdef ZHOUZM_CHANGE
         if (replace_file)
             safe_write(connptr->client_fd, replace_file_data, replace_file_size);
-        else
+        else if (connptr->instrumented_body)
+            safe_write_with_log(connptr->client_fd, connptr->http_log.response_data,
+                                connptr->instrumented_body, connptr->instrumented_len);
+        /* 304 之后缓存的副本已经发出 */
+        else if (!connptr->cache_revalidated)
         #endif
             relay_connection (connptr);
 
+        #ifdef ZHOUZM_CHANGE
+        /* 完整收到的响应才放进缓存 */
+        if (connptr->cache_fill && connptr->content_length.server == 0)
+                http_cache_store (connptr->cache_fill);
+        #endif
+
         log_message (LOG_INFO,
                      "Closed connection between local client (fd:%d) "
                      "and remote client (fd:%d)",
@@ -1585,6 +2394,24 @@ void handle_connection (int fd)
         goto done;
 
 fail:
+#ifdef ZHOUZM_CHANGE
+        /* Timing reports carry a body that profile.c reads itself */
+        if (connptr->profile_request) {
+                if (profile_handle (connptr,
+                                    get_content_length (hashofheaders)) < 0)
+                        log_message (LOG_WARNING,
+                                     "Could not answer the profile request");
+                goto done;
+        }
+        if (connptr->sourcemap_request) {
+                if (instrument_send_map (connptr,
+                                         connptr->sourcemap_request) < 0)
+                        log_message (LOG_WARNING,
+                                     "Could not send the source map");
+                goto done;
+        }
+#endif
+
         /*
          * First, get the body if there is one.
          * If we don't read all there is from the socket first,
@@ -1608,6 +2435,10 @@ fail:
         }
 
 done:
+        #ifdef ZHOUZM_CHANGE
+        if (replace_file_data)
+            free(replace_file_data);
+        #endif
         http_log_flush(&connptr->http_log);
         free_request_struct (request);
         hashmap_delete (hashofheaders);
@@ -70,6 +70,9 @@ void reversepath_add (const char *path, const char *url,
 
         reverse->url = safestrdup (url);
 
+        reverse->path_len = strlen (reverse->path);
+        reverse->url_len = strlen (reverse->url);
+
         reverse->next = *reversepath_list;
         *reversepath_list = reverse;
 
@@ -79,18 +82,239 @@ void reversepath_add (const char *path, const char *url,
 }
 
 /*
- * Check if a request url is in the reversepath list
+ * A node of the radix tree.  The edge leading to a node is a run of
+ * bytes of some rule's path; it points into that path rather than
+ * holding a copy, so the index must be freed before the list.  Children
+ * are kept sorted by the first byte of their edge.
  */
-struct reversepath *reversepath_get (char *url, struct reversepath *reverse)
+struct reversepath_node {
+        const char *edge;
+        size_t edge_len;
+        struct reversepath *rule;
+
+        struct reversepath_node **children;
+        unsigned int nchildren;
+};
+
+struct reversepath_index {
+        struct reversepath_node root;
+};
+
+static struct reversepath_node *reversepath_node_new (const char *edge,
+                                                      size_t edge_len)
 {
-        while (reverse) {
-                if (strstr (url, reverse->path) == url)
-                        return reverse;
+        struct reversepath_node *node;
 
-                reverse = reverse->next;
+        node = (struct reversepath_node *)
+                safecalloc (1, sizeof (struct reversepath_node));
+        if (!node)
+                return NULL;
+
+        node->edge = edge;
+        node->edge_len = edge_len;
+
+        return node;
+}
+
+static void reversepath_node_free_children (struct reversepath_node *node)
+{
+        unsigned int i;
+
+        for (i = 0; i != node->nchildren; ++i) {
+                reversepath_node_free_children (node->children[i]);
+                safefree (node->children[i]);
+        }
+        safefree (node->children);
+}
+
+/*
+ * Binary search for the child whose edge starts with byte c.  Returns
+ * its position, or the position it should be inserted at if there is
+ * none, with *found telling which.
+ */
+static unsigned int reversepath_node_find (const struct reversepath_node *node,
+                                           unsigned char c, int *found)
+{
+        unsigned int lo = 0, hi = node->nchildren, mid;
+        unsigned char first;
+
+        while (lo < hi) {
+                mid = (lo + hi) / 2;
+                first = (unsigned char) node->children[mid]->edge[0];
+
+                if (first == c) {
+                        *found = TRUE;
+                        return mid;
+                }
+
+                if (first < c)
+                        lo = mid + 1;
+                else
+                        hi = mid;
+        }
+
+        *found = FALSE;
+        return lo;
+}
+
+static int reversepath_node_insert_child (struct reversepath_node *node,
+                                          unsigned int pos,
+                                          struct reversepath_node *child)
+{
+        struct reversepath_node **children;
+
+        children = (struct reversepath_node **)
+                saferealloc (node->children,
+                             (node->nchildren + 1) * sizeof (*children));
+        if (!children)
+                return -1;
+
+        memmove (&children[pos + 1], &children[pos],
+                 (node->nchildren - pos) * sizeof (*children));
+        children[pos] = child;
+
+        node->children = children;
+        node->nchildren++;
+
+        return 0;
+}
+
+static int reversepath_index_add (struct reversepath_index *index,
+                                  struct reversepath *reverse)
+{
+        struct reversepath_node *node = &index->root, *child, *split;
+        const char *path = reverse->path;
+        size_t left = reverse->path_len, common;
+        unsigned int pos;
+        int found;
+
+        while (left > 0) {
+                pos = reversepath_node_find (node, (unsigned char) *path,
+                                             &found);
+                if (!found) {
+                        child = reversepath_node_new (path, left);
+                        if (!child)
+                                return -1;
+                        if (reversepath_node_insert_child (node, pos,
+                                                           child) < 0) {
+                                safefree (child);
+                                return -1;
+                        }
+                        node = child;
+                        left = 0;
+                        break;
+                }
+
+                child = node->children[pos];
+                for (common = 1; common < child->edge_len && common < left
+                     && child->edge[common] == path[common]; ++common)
+                        ;
+
+                if (common < child->edge_len) {
+                        /* The path ends or leaves the edge half way. */
+                        split = reversepath_node_new (child->edge, common);
+                        if (!split)
+                                return -1;
+                        split->children = (struct reversepath_node **)
+                                safemalloc (sizeof (*split->children));
+                        if (!split->children) {
+                                safefree (split);
+                                return -1;
+                        }
+                        split->children[0] = child;
+                        split->nchildren = 1;
+
+                        child->edge += common;
+                        child->edge_len -= common;
+                        node->children[pos] = split;
+                        child = split;
+                }
+
+                node = child;
+                path += common;
+                left -= common;
+        }
+
+        /*
+         * The list holds the most recent rule first, and for the same
+         * path that one has always won.
+         */
+        if (!node->rule)
+                node->rule = reverse;
+
+        return 0;
+}
+
+struct reversepath_index *reversepath_index_build (struct reversepath *reverse)
+{
+        struct reversepath_index *index;
+
+        index = (struct reversepath_index *)
+                safecalloc (1, sizeof (struct reversepath_index));
+        if (!index) {
+                log_message (LOG_ERR,
+                             "Unable to allocate memory in "
+                             "reversepath_index_build()");
+                return NULL;
+        }
+
+        for (; reverse; reverse = reverse->next) {
+                if (reversepath_index_add (index, reverse) < 0) {
+                        log_message (LOG_ERR,
+                                     "Unable to allocate memory in "
+                                     "reversepath_index_build()");
+                        reversepath_index_free (index);
+                        return NULL;
+                }
+        }
+
+        return index;
+}
+
+void reversepath_index_free (struct reversepath_index *index)
+{
+        if (!index)
+                return;
+
+        reversepath_node_free_children (&index->root);
+        safefree (index);
+}
+
+/*
+ * Find the reversepath rule with the longest path that is a prefix of
+ * the request url.
+ */
+struct reversepath *reversepath_get (const char *url,
+                                     struct reversepath_index *index)
+{
+        struct reversepath_node *node;
+        struct reversepath *best = NULL;
+        unsigned int pos;
+        int found;
+
+        if (!index)
+                return NULL;
+
+        node = &index->root;
+        for (;;) {
+                if (node->rule)
+                        best = node->rule;
+
+                if (*url == '\0')
+                        break;
+
+                pos = reversepath_node_find (node, (unsigned char) *url,
+                                             &found);
+                if (!found)
+                        break;
+
+                node = node->children[pos];
+                if (strncmp (node->edge, url, node->edge_len) != 0)
+                        break;
+                url += node->edge_len;
         }
 
-        return NULL;
+        return best;
 }
 
 /**
@@ -108,6 +332,25 @@ void free_reversepath_list (struct reversepath *reverse)
         }
 }
 
+/*
+ * Join the rule's url and the rest of the request path in one go.
+ */
+static char *reverse_join_url (const struct reversepath *reverse,
+                               const char *rest)
+{
+        size_t rest_len = strlen (rest);
+        char *rewrite_url;
+
+        rewrite_url = (char *) safemalloc (reverse->url_len + rest_len + 1);
+        if (!rewrite_url)
+                return NULL;
+
+        memcpy (rewrite_url, reverse->url, reverse->url_len);
+        memcpy (rewrite_url + reverse->url_len, rest, rest_len + 1);
+
+        return rewrite_url;
+}
+
 /*
  * Rewrite the URL for reverse proxying.
  */
@@ -122,13 +365,10 @@ char *reverse_rewrite_url (struct conn_s *connptr, hashmap_t hashofheaders,
         /* Reverse requests always start with a slash */
         if (*url == '/') {
                 /* First try locating the reverse mapping by request url */
-                reverse = reversepath_get (url, config.reversepath_list);
+                reverse = reversepath_get (url, config.reversepath_index);
                 if (reverse) {
-                        rewrite_url = (char *)
-                            safemalloc (strlen (url) + strlen (reverse->url) +
-                                        1);
-                        strcpy (rewrite_url, reverse->url);
-                        strcat (rewrite_url, url + strlen (reverse->path));
+                        rewrite_url = reverse_join_url (reverse,
+                                                        url + reverse->path_len);
                 } else if (config.reversemagic
                            && hashmap_entry_by_key (hashofheaders,
                                                     "cookie",
@@ -139,15 +379,11 @@ char *reverse_rewrite_url (struct conn_s *connptr, hashmap_t hashofheaders,
                             && (reverse =
                                 reversepath_get (cookieval +
                                                  strlen (REVERSE_COOKIE) + 1,
-                                                 config.reversepath_list)))
+                                                 config.reversepath_index)))
                         {
 
-                                rewrite_url = (char *) safemalloc
-                                        (strlen (url) +
-                                         strlen (reverse->url) +
-                                         1);
-                                strcpy (rewrite_url, reverse->url);
-                                strcat (rewrite_url, url + 1);
+                                rewrite_url = reverse_join_url (reverse,
+                                                                url + 1);
 
                                 log_message (LOG_INFO,
                                              "Magical tracking cookie says: %s",
@@ -27,15 +27,26 @@ struct reversepath {
         struct reversepath *next;
         char *path;
         char *url;
+        size_t path_len, url_len;
 };
 
+/*
+ * Radix tree over the ReversePath paths, compiled from the list once the
+ * configuration has been read.  A lookup walks the request path byte by
+ * byte and returns the rule with the longest matching path.
+ */
+struct reversepath_index;
+
 #define REVERSE_COOKIE "yummy_magical_cookie"
 
 extern void reversepath_add (const char *path, const char *url,
                              struct reversepath **reversepath_list);
-extern struct reversepath *reversepath_get (char *url,
-                                            struct reversepath *reverse);
+extern struct reversepath *reversepath_get (const char *url,
+                                            struct reversepath_index *index);
 void free_reversepath_list (struct reversepath *reverse);
+extern struct reversepath_index *reversepath_index_build (struct reversepath
+                                                          *reverse);
+extern void reversepath_index_free (struct reversepath_index *index);
 extern char *reverse_rewrite_url (struct conn_s *connptr,
                                   hashmap_t hashofheaders, char *url);
 
@@ -0,0 +1,804 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Rewrites response bodies while relay_connection() relays them.  The
+ * body goes through a chain of stages, each working on what the one
+ * before it let through:
+ *
+ *   - the RewriteReplace and RewriteRegex rules whose URL pattern
+ *     matches, in the order of the configuration file;
+ *   - the RewriteInjectHead rules, for HTML;
+ *   - the JavaScript instrumenter (see instrument.c), last, so that its
+ *     source map describes the text the other stages produced.
+ *
+ * Each stage is handed the body a read at a time and only holds back
+ * what may still turn out to be part of a match: the length of the text
+ * less one for RewriteReplace, RewriteLookahead bytes for RewriteRegex
+ * and an unfinished tag for RewriteInjectHead.  A rewritten body has a
+ * different length, so reqs.c sends it without its Content-Length.
+ *
+ * A gzip or deflate body is inflated by a stage in front of the others
+ * and, with RewriteCompressLevel set, compressed again by one behind
+ * them.  Responses no rule applies to never get a chain, so their bytes
+ * are relayed as they come, compressed or not.
+ */
+
+#include "main.h"
+
+#include "rewrite.h"
+#include "buffer.h"
+#include "conf.h"
+#include "heap.h"
+#include "instrument.h"
+#include "js.h"
+#include "log.h"
+#include "utils.h"
+
+#ifdef HAVE_ZLIB
+#  include <zlib.h>
+#endif
+
+/* An unfinished <head> tag longer than this is left alone. */
+#define REWRITE_MAX_TAG 1024
+
+struct rewrite_rule {
+        int kind;                       /* REWRITE_* */
+        regex_t url;
+        regex_t re;                     /* REWRITE_REGEX */
+        char *find;                     /* REWRITE_REPLACE */
+        size_t find_len;
+        char *replace;                  /* or the HTML to inject */
+        size_t replace_len;
+};
+
+/* Part of a body, kept with a '\0' after it for regexec() */
+struct rewrite_buf {
+        char *data;
+        size_t len;
+        size_t size;
+};
+
+struct rewrite_stage {
+        int (*run) (struct rewrite_stage *stage, char *data, size_t len,
+                    int eof, struct rewrite_buf *out);
+        struct rewrite_stage *next;
+        struct rewrite_buf out;         /* passed on to the next stage */
+
+        /* text and HTML rules */
+        const struct rewrite_rule *rule;
+        struct rewrite_buf window;      /* held back for the next read */
+        int prev;                       /* the byte before the window */
+        int done;                       /* the HTML has been inserted */
+
+        /* the instrumenter */
+        JsStream *js;
+        char *request_line;
+
+#ifdef HAVE_ZLIB
+        /* inflating and deflating */
+        z_stream *zs;
+        int encoding;                   /* REWRITE_GZIP or REWRITE_DEFLATE */
+        int ready;                      /* zs has been initialized */
+#endif
+};
+
+struct rewrite_chain {
+        struct rewrite_stage *first;
+        struct rewrite_stage *last;
+};
+
+static void free_rule (struct rewrite_rule *rule)
+{
+        regfree (&rule->url);
+        if (rule->kind == REWRITE_REGEX)
+                regfree (&rule->re);
+        safefree (rule->find);
+        safefree (rule->replace);
+}
+
+/*
+ * Compile a rule and add it to the list, creating the list if needed.
+ * "find" isn't used by REWRITE_INJECT_HEAD rules.  Returns 0 on success,
+ * -1 if a pattern is not a valid regular expression or out of memory.
+ */
+int rewrite_add_rule (vector_t *rules, int kind, const char *url,
+                      const char *find, const char *replace)
+{
+        struct rewrite_rule rule;
+
+        memset (&rule, 0, sizeof (rule));
+        rule.kind = kind;
+        if (regcomp (&rule.url, url, REG_EXTENDED | REG_ICASE | REG_NOSUB)) {
+                log_message (LOG_ERR, "Bad rewrite URL pattern \"%s\"", url);
+                return -1;
+        }
+        if (kind == REWRITE_REGEX
+            && regcomp (&rule.re, find, REG_EXTENDED | REG_NEWLINE)) {
+                log_message (LOG_ERR, "Bad rewrite pattern \"%s\"", find);
+                regfree (&rule.url);
+                return -1;
+        }
+        if (kind == REWRITE_REPLACE) {
+                rule.find = safestrdup (find);
+                rule.find_len = strlen (find);
+        }
+        rule.replace = safestrdup (replace);
+        rule.replace_len = strlen (replace);
+
+        if (!*rules)
+                *rules = vector_create ();
+        if (!*rules || (kind == REWRITE_REPLACE && !rule.find)
+            || !rule.replace
+            || vector_append (*rules, &rule, sizeof (rule)) < 0) {
+                free_rule (&rule);
+                return -1;
+        }
+        return 0;
+}
+
+void rewrite_free_rules (vector_t rules)
+{
+        ssize_t i;
+
+        for (i = 0; i < vector_length (rules); i++)
+                free_rule ((struct rewrite_rule *)
+                           vector_getentry (rules, i, NULL));
+
+        vector_delete (rules);
+}
+
+/* Make room for "len" more bytes (and the '\0') */
+static int buf_space (struct rewrite_buf *buf, size_t len)
+{
+        size_t size;
+        char *p;
+
+        if (buf->len + len + 1 > buf->size) {
+                size = buf->size ? buf->size : READ_BUFFER_SIZE;
+                while (size < buf->len + len + 1)
+                        size *= 2;
+                p = (char *) saferealloc (buf->data, size);
+                if (!p)
+                        return -1;
+                buf->data = p;
+                buf->size = size;
+        }
+        return 0;
+}
+
+static int buf_add (struct rewrite_buf *buf, const char *data, size_t len)
+{
+        if (buf_space (buf, len) < 0)
+                return -1;
+        if (len > 0)
+                memcpy (buf->data + buf->len, data, len);
+        buf->len += len;
+        buf->data[buf->len] = '\0';
+        return 0;
+}
+
+/* Drop the first "len" bytes, remembering the last of them */
+static void window_consume (struct rewrite_stage *stage, size_t len)
+{
+        struct rewrite_buf *window = &stage->window;
+
+        if (len == 0)
+                return;
+        stage->prev = (unsigned char) window->data[len - 1];
+        memmove (window->data, window->data + len, window->len - len + 1);
+        window->len -= len;
+}
+
+/*
+ * Look for the stage's text or pattern in the window from "pos" on.
+ * Returns 1 and fills in "match" if found, 0 if not.
+ */
+static int find_match (struct rewrite_stage *stage, size_t pos,
+                       regmatch_t match[10])
+{
+        const struct rewrite_rule *rule = stage->rule;
+        char *data = stage->window.data;
+        size_t len = stage->window.len;
+        char *p;
+        int flags = 0;
+#ifndef REG_STARTEND
+        int i;
+#endif
+
+        if (rule->kind == REWRITE_REPLACE) {
+                for (p = data + pos; (size_t) (data + len - p) >= rule->find_len;
+                     p++) {
+                        p = (char *) memchr (p, rule->find[0],
+                                             data + len - p - rule->find_len
+                                             + 1);
+                        if (!p)
+                                break;
+                        if (memcmp (p, rule->find, rule->find_len) == 0) {
+                                match[0].rm_so = p - data;
+                                match[0].rm_eo = match[0].rm_so
+                                        + rule->find_len;
+                                return 1;
+                        }
+                }
+                return 0;
+        }
+
+        /* "^" only matches where a line starts */
+#ifdef REG_STARTEND
+        if (stage->prev != '\n')
+                flags |= REG_NOTBOL;
+        match[0].rm_so = pos;
+        match[0].rm_eo = len;
+        return regexec (&rule->re, data, 10, match, flags | REG_STARTEND) == 0;
+#else
+        if (pos > 0 ? data[pos - 1] != '\n' : stage->prev != '\n')
+                flags |= REG_NOTBOL;
+        if (regexec (&rule->re, data + pos, 10, match, flags) != 0)
+                return 0;
+        for (i = 0; i < 10; i++) {
+                if (match[i].rm_so >= 0) {
+                        match[i].rm_so += pos;
+                        match[i].rm_eo += pos;
+                }
+        }
+        return 1;
+#endif
+}
+
+/* The replacement for "match", with \0 to \9 filled in for RewriteRegex */
+static int add_replacement (struct rewrite_stage *stage,
+                            const regmatch_t match[10],
+                            struct rewrite_buf *out)
+{
+        const struct rewrite_rule *rule = stage->rule;
+        const char *p = rule->replace;
+        const char *end = p + rule->replace_len;
+        const char *copied = p;
+        int n;
+
+        if (rule->kind == REWRITE_REPLACE)
+                return buf_add (out, rule->replace, rule->replace_len);
+
+        for (; p + 1 < end; p++) {
+                if (*p != '\\' || (p[1] != '\\' && !isdigit ((unsigned char) p[1])))
+                        continue;
+                if (buf_add (out, copied, p - copied) < 0)
+                        return -1;
+                if (p[1] == '\\') {
+                        copied = p + 1;
+                } else {
+                        n = p[1] - '0';
+                        if (match[n].rm_so >= 0
+                            && buf_add (out, stage->window.data + match[n].rm_so,
+                                        match[n].rm_eo - match[n].rm_so) < 0)
+                                return -1;
+                        copied = p + 2;
+                }
+                p++;
+        }
+        return buf_add (out, copied, end - copied);
+}
+
+/*
+ * RewriteReplace and RewriteRegex.  Everything before "cut" is settled:
+ * a match that starts there can be seen whole.  What follows is kept for
+ * the next read, unless this is the end of the body.
+ */
+static int replace_run (struct rewrite_stage *stage, char *data, size_t len,
+                        int eof, struct rewrite_buf *out)
+{
+        struct rewrite_buf *window = &stage->window;
+        regmatch_t match[10];
+        size_t keep, cut, pos = 0, start, end;
+
+        if (buf_add (window, data, len) < 0)
+                return -1;
+
+        if (stage->rule->kind == REWRITE_REPLACE)
+                keep = stage->rule->find_len - 1;
+        else
+                keep = config.rewrite_lookahead > 0 ?
+                        config.rewrite_lookahead : 1;
+        if (eof)
+                cut = window->len;
+        else
+                cut = window->len > keep ? window->len - keep : 0;
+
+        while (pos < window->len && find_match (stage, pos, match)) {
+                start = match[0].rm_so;
+                end = match[0].rm_eo;
+
+                /* it may go on in the next read */
+                if (!eof && end > cut && end - start < keep) {
+                        if (start < cut)
+                                cut = start;
+                        break;
+                }
+
+                if (buf_add (out, window->data + pos, start - pos) < 0)
+                        return -1;
+
+                /* an empty match replaces nothing */
+                if (end == start) {
+                        if (start == window->len)
+                                break;
+                        if (buf_add (out, window->data + start, 1) < 0)
+                                return -1;
+                        pos = start + 1;
+                        continue;
+                }
+
+                if (add_replacement (stage, match, out) < 0)
+                        return -1;
+                pos = end;
+        }
+
+        if (cut < pos)
+                cut = pos;
+        if (buf_add (out, window->data + pos, cut - pos) < 0)
+                return -1;
+        window_consume (stage, cut);
+        return 0;
+}
+
+/* Is there a "name" tag at "p"? */
+static int is_tag (const char *p, const char *end, const char *name)
+{
+        size_t len = strlen (name);
+
+        return (size_t) (end - p) > len + 1
+                && strncasecmp (p + 1, name, len) == 0
+                && strchr ("> \t\r\n/", p[len + 1]) && p[len + 1];
+}
+
+/*
+ * RewriteInjectHead: the HTML goes right after the <head> tag, or before
+ * <body> in a document that leaves out <head>.  Only a '<' near the end
+ * of the read or an unfinished <head> tag is held back.
+ */
+static int inject_run (struct rewrite_stage *stage, char *data, size_t len,
+                       int eof, struct rewrite_buf *out)
+{
+        struct rewrite_buf *window = &stage->window;
+        const struct rewrite_rule *rule = stage->rule;
+        char *p, *end, *at = NULL;
+
+        if (stage->done)
+                return buf_add (out, data, len);
+
+        if (buf_add (window, data, len) < 0)
+                return -1;
+
+        p = window->data;
+        end = p + window->len;
+        while ((p = (char *) memchr (p, '<', end - p)) != NULL) {
+                if (end - p < 6 && !eof)
+                        break;
+                if (is_tag (p, end, "head")) {
+                        at = (char *) memchr (p, '>', end - p);
+                        if (at)
+                                at++;
+                        else if (eof || end - p >= REWRITE_MAX_TAG)
+                                stage->done = 1;
+                        break;
+                }
+                if (is_tag (p, end, "body")) {
+                        at = p;
+                        break;
+                }
+                p++;
+        }
+
+        if (at) {
+                if (buf_add (out, window->data, at - window->data) < 0
+                    || buf_add (out, rule->replace, rule->replace_len) < 0
+                    || buf_add (out, at, end - at) < 0)
+                        return -1;
+                stage->done = 1;
+                window_consume (stage, window->len);
+                return 0;
+        }
+
+        if (eof)
+                stage->done = 1;
+        if (!p || stage->done)
+                p = end;
+        if (buf_add (out, window->data, p - window->data) < 0)
+                return -1;
+        window_consume (stage, p - window->data);
+        return 0;
+}
+
+/* The JavaScript instrumenter, with the link to the source map last */
+static int instrument_run (struct rewrite_stage *stage, char *data,
+                           size_t len, int eof, struct rewrite_buf *out)
+{
+        char *js_out, *link;
+        int js_len;
+
+        if ((int) len < 0
+            || js_stream_feed (stage->js, data, (int) len, eof,
+                               &js_out, &js_len) < 0)
+                return -1;
+        if (buf_add (out, js_out, js_len) < 0)
+                return -1;
+
+        if (eof && config.instrument_source_map) {
+                link = instrument_map_link (stage->js, stage->request_line);
+                if (link && buf_add (out, link, strlen (link)) < 0) {
+                        safefree (link);
+                        return -1;
+                }
+                safefree (link);
+        }
+        return 0;
+}
+
+#ifdef HAVE_ZLIB
+/* Point zlib's output at the free end of "out", with room for a read */
+static int zlib_output (z_stream *zs, struct rewrite_buf *out)
+{
+        if (buf_space (out, READ_BUFFER_SIZE) < 0)
+                return -1;
+        zs->next_out = (Bytef *) out->data + out->len;
+        zs->avail_out = (uInt) (out->size - out->len - 1);
+        return 0;
+}
+
+/* Take in what zlib wrote since zlib_output() */
+static void zlib_written (z_stream *zs, struct rewrite_buf *out)
+{
+        out->len = (char *) zs->next_out - out->data;
+        out->data[out->len] = '\0';
+}
+
+/*
+ * Inflate a gzip or deflate body.  "deflate" should come with a zlib
+ * header, but some servers send a bare deflate stream, so the first two
+ * bytes decide.  Whatever follows the end of the stream is dropped.
+ */
+static int inflate_run (struct rewrite_stage *stage, char *data, size_t len,
+                        int eof, struct rewrite_buf *out)
+{
+        struct rewrite_buf *window = &stage->window;
+        z_stream *zs = stage->zs;
+        unsigned char *head;
+        int bits, ret;
+
+        if (!stage->ready) {
+                if (buf_add (window, data, len) < 0)
+                        return -1;
+                if (window->len < 2 && !eof)
+                        return 0;
+
+                head = (unsigned char *) window->data;
+                bits = MAX_WBITS + 16;
+                if (stage->encoding == REWRITE_DEFLATE)
+                        bits = window->len >= 2
+                                && (head[0] & 0x0f) == Z_DEFLATED
+                                && (head[0] * 256 + head[1]) % 31 == 0 ?
+                                MAX_WBITS : -MAX_WBITS;
+                if (inflateInit2 (zs, bits) != Z_OK)
+                        return -1;
+                stage->ready = 1;
+                data = window->data;
+                len = window->len;
+        }
+
+        zs->next_in = (Bytef *) data;
+        zs->avail_in = (uInt) len;
+        while (!stage->done) {
+                if (zlib_output (zs, out) < 0)
+                        return -1;
+                ret = inflate (zs, Z_NO_FLUSH);
+                zlib_written (zs, out);
+
+                if (ret == Z_STREAM_END) {
+                        /* a gzip body may be several members */
+                        if (stage->encoding == REWRITE_GZIP
+                            && zs->avail_in > 0 && inflateReset (zs) == Z_OK)
+                                continue;
+                        stage->done = 1;
+                } else if (ret == Z_BUF_ERROR) {
+                        break;
+                } else if (ret != Z_OK) {
+                        log_message (LOG_WARNING,
+                                     "Could not inflate the response: %s",
+                                     zs->msg ? zs->msg : "bad data");
+                        return -1;
+                } else if (zs->avail_in == 0 && zs->avail_out > 0) {
+                        break;
+                }
+        }
+
+        if (eof && !stage->done)
+                log_message (LOG_WARNING, "Compressed response cut short");
+        window->len = 0;
+        return 0;
+}
+
+/* Compress the rewritten body again, flushing at each read */
+static int deflate_run (struct rewrite_stage *stage, char *data, size_t len,
+                        int eof, struct rewrite_buf *out)
+{
+        z_stream *zs = stage->zs;
+
+        if (len == 0 && !eof)
+                return 0;
+
+        zs->next_in = (Bytef *) data;
+        zs->avail_in = (uInt) len;
+        do {
+                if (zlib_output (zs, out) < 0)
+                        return -1;
+                if (deflate (zs, eof ? Z_FINISH : Z_SYNC_FLUSH)
+                    == Z_STREAM_ERROR)
+                        return -1;
+                zlib_written (zs, out);
+        } while (zs->avail_out == 0);
+        return 0;
+}
+#endif
+
+static struct rewrite_stage *add_stage (struct rewrite_chain **chain)
+{
+        struct rewrite_stage *stage;
+
+        if (!*chain) {
+                *chain = (struct rewrite_chain *)
+                        safecalloc (1, sizeof (struct rewrite_chain));
+                if (!*chain)
+                        return NULL;
+        }
+
+        stage = (struct rewrite_stage *)
+                safecalloc (1, sizeof (struct rewrite_stage));
+        if (!stage)
+                return NULL;
+        stage->prev = '\n';
+
+        if ((*chain)->last)
+                (*chain)->last->next = stage;
+        else
+                (*chain)->first = stage;
+        (*chain)->last = stage;
+        return stage;
+}
+
+/*
+ * The stages for the rules that apply to the response to "request_line"
+ * with the given Content-Type (which may be NULL).  Returns NULL if
+ * there are none, or out of memory.
+ */
+struct rewrite_chain *rewrite_chain_new (const char *request_line,
+                                         const char *content_type)
+{
+        struct rewrite_chain *chain = NULL;
+        struct rewrite_stage *stage;
+        struct rewrite_rule *rule;
+        char *url;
+        ssize_t i;
+        int pass, html;
+
+        if (vector_length (config.rewrite_rules) <= 0)
+                return NULL;
+
+        url = request_url (request_line);
+        if (!url)
+                return NULL;
+        html = content_type && strstr (content_type, "html") != NULL;
+
+        /* the text rules first, then the HTML */
+        for (pass = 0; pass < 2; pass++) {
+                for (i = 0; i < vector_length (config.rewrite_rules); i++) {
+                        rule = (struct rewrite_rule *)
+                                vector_getentry (config.rewrite_rules, i,
+                                                 NULL);
+                        if ((rule->kind == REWRITE_INJECT_HEAD) != pass
+                            || (pass == 1 && !html)
+                            || regexec (&rule->url, url, 0, NULL, 0) != 0)
+                                continue;
+
+                        stage = add_stage (&chain);
+                        if (!stage) {
+                                rewrite_chain_free (chain);
+                                safefree (url);
+                                return NULL;
+                        }
+                        stage->rule = rule;
+                        stage->run = pass == 0 ? replace_run : inject_run;
+                }
+        }
+
+        safefree (url);
+        return chain;
+}
+
+/*
+ * Instrument the JavaScript once the other stages are done with it,
+ * creating the chain if needed.  Returns -1 if out of memory.
+ */
+int rewrite_add_instrument (struct rewrite_chain **chain,
+                            const char *request_line)
+{
+        struct rewrite_stage *stage = add_stage (chain);
+
+        if (!stage)
+                return -1;
+        stage->run = instrument_run;
+        stage->request_line = safestrdup (request_line);
+        stage->js = instrument_stream_new (request_line);
+        return stage->request_line && stage->js ? 0 : -1;
+}
+
+/*
+ * The REWRITE_* constant for a Content-Encoding header, which may be
+ * NULL.  Returns -1 for encodings a chain can't decode, including all
+ * but identity without zlib.
+ */
+int rewrite_encoding (const char *content_encoding)
+{
+        if (!content_encoding || *content_encoding == '\0'
+            || strcasecmp (content_encoding, "identity") == 0)
+                return REWRITE_IDENTITY;
+#ifdef HAVE_ZLIB
+        if (strcasecmp (content_encoding, "gzip") == 0
+            || strcasecmp (content_encoding, "x-gzip") == 0)
+                return REWRITE_GZIP;
+        if (strcasecmp (content_encoding, "deflate") == 0)
+                return REWRITE_DEFLATE;
+#endif
+        return -1;
+}
+
+#ifdef HAVE_ZLIB
+static struct rewrite_stage *new_zlib_stage (int encoding)
+{
+        struct rewrite_stage *stage;
+
+        stage = (struct rewrite_stage *)
+                safecalloc (1, sizeof (struct rewrite_stage));
+        if (!stage)
+                return NULL;
+        stage->zs = (z_stream *) safecalloc (1, sizeof (z_stream));
+        if (!stage->zs) {
+                safefree (stage);
+                return NULL;
+        }
+        stage->encoding = encoding;
+        return stage;
+}
+#endif
+
+/*
+ * Inflate a body sent with the given encoding before the other stages
+ * see it.  Returns -1 if out of memory, or if it can't be decoded.
+ */
+int rewrite_add_decoder (struct rewrite_chain *chain, int encoding)
+{
+#ifdef HAVE_ZLIB
+        struct rewrite_stage *stage;
+
+        if (encoding == REWRITE_IDENTITY)
+                return 0;
+        if (encoding != REWRITE_GZIP && encoding != REWRITE_DEFLATE)
+                return -1;
+
+        stage = new_zlib_stage (encoding);
+        if (!stage)
+                return -1;
+        stage->run = inflate_run;
+        stage->next = chain->first;
+        chain->first = stage;
+        if (!chain->last)
+                chain->last = stage;
+        return 0;
+#else
+        return encoding == REWRITE_IDENTITY ? 0 : -1;
+#endif
+}
+
+/*
+ * Compress what comes out of the chain with the given encoding and zlib
+ * "level" (1 to 9).  Returns -1 if out of memory or not supported.
+ */
+int rewrite_add_encoder (struct rewrite_chain *chain, int encoding,
+                         int level)
+{
+#ifdef HAVE_ZLIB
+        struct rewrite_stage *stage;
+
+        if (encoding == REWRITE_IDENTITY)
+                return 0;
+        if (encoding != REWRITE_GZIP && encoding != REWRITE_DEFLATE)
+                return -1;
+
+        stage = new_zlib_stage (encoding);
+        if (!stage)
+                return -1;
+        stage->run = deflate_run;
+        if (deflateInit2 (stage->zs, level, Z_DEFLATED,
+                          encoding == REWRITE_GZIP ?
+                          MAX_WBITS + 16 : MAX_WBITS,
+                          8, Z_DEFAULT_STRATEGY) != Z_OK) {
+                safefree (stage->zs);
+                safefree (stage);
+                return -1;
+        }
+        stage->ready = 1;
+
+        if (chain->last)
+                chain->last->next = stage;
+        else
+                chain->first = stage;
+        chain->last = stage;
+        return 0;
+#else
+        (void) level;
+        return encoding == REWRITE_IDENTITY ? 0 : -1;
+#endif
+}
+
+/*
+ * Pass the next "len" bytes of the body through the chain; "eof" is set
+ * for the last of them.  "*out" points to what may be sent on, and stays
+ * valid until the next call.  Returns -1 if out of memory.
+ */
+int rewrite_feed (struct rewrite_chain *chain, char *data, size_t len,
+                  int eof, char **out, size_t *out_len)
+{
+        static char empty[1];
+        struct rewrite_stage *stage;
+
+        for (stage = chain->first; stage; stage = stage->next) {
+                stage->out.len = 0;
+                if (stage->run (stage, len > 0 ? data : empty, len, eof,
+                                &stage->out) < 0)
+                        return -1;
+                data = stage->out.data;
+                len = stage->out.len;
+        }
+
+        *out = len > 0 ? data : empty;
+        *out_len = len;
+        return 0;
+}
+
+void rewrite_chain_free (struct rewrite_chain *chain)
+{
+        struct rewrite_stage *stage, *next;
+
+        if (!chain)
+                return;
+
+        for (stage = chain->first; stage; stage = next) {
+                next = stage->next;
+                safefree (stage->out.data);
+                safefree (stage->window.data);
+                js_stream_free (stage->js);
+                safefree (stage->request_line);
+#ifdef HAVE_ZLIB
+                if (stage->ready && stage->run == inflate_run)
+                        inflateEnd (stage->zs);
+                else if (stage->ready)
+                        deflateEnd (stage->zs);
+                safefree (stage->zs);
+#endif
+                safefree (stage);
+        }
+        safefree (chain);
+}
@@ -0,0 +1,57 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'rewrite.c' for detailed information. */
+
+#ifndef _TINYPROXY_REWRITE_H_
+#define _TINYPROXY_REWRITE_H_
+
+#include "common.h"
+#include "vector.h"
+
+/* Longest RewriteRegex match found across two reads by default. */
+#define REWRITE_LOOKAHEAD 4096
+
+/* Kinds of rewrite rule */
+#define REWRITE_REPLACE         0       /* RewriteReplace, literal text */
+#define REWRITE_REGEX           1       /* RewriteRegex */
+#define REWRITE_INJECT_HEAD     2       /* RewriteInjectHead */
+
+/* Content-Encodings a chain can decode (see rewrite_encoding()) */
+#define REWRITE_IDENTITY        0
+#define REWRITE_GZIP            1
+#define REWRITE_DEFLATE         2
+
+struct rewrite_chain;
+
+extern int rewrite_add_rule (vector_t *rules, int kind, const char *url,
+                             const char *find, const char *replace);
+extern void rewrite_free_rules (vector_t rules);
+
+extern struct rewrite_chain *rewrite_chain_new (const char *request_line,
+                                                const char *content_type);
+extern int rewrite_add_instrument (struct rewrite_chain **chain,
+                                   const char *request_line);
+extern int rewrite_encoding (const char *content_encoding);
+extern int rewrite_add_decoder (struct rewrite_chain *chain, int encoding);
+extern int rewrite_add_encoder (struct rewrite_chain *chain, int encoding,
+                                int level);
+extern int rewrite_feed (struct rewrite_chain *chain, char *data,
+                         size_t len, int eof, char **out, size_t *out_len);
+extern void rewrite_chain_free (struct rewrite_chain *chain);
+
+#endif /* _TINYPROXY_REWRITE_H_ */
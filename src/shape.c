@@ -0,0 +1,355 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* Emulates a slow network for the connections of some clients or to
+ * some URLs, so that a page can be watched loading the way it would
+ * over a mobile link.
+ *
+ * A ShapeProfile names a latency, a downstream and an upstream
+ * bandwidth and a loss rate; the ShapeClient and ShapeURL rules pick
+ * the profile of a connection, the first one that matches winning.
+ *
+ *   - The latency holds back each request for that long before it is
+ *     answered or sent on to the server, which delays the first byte
+ *     of the response as a slower round trip would.
+ *   - Each direction has a token bucket, filled at the bandwidth and
+ *     holding SHAPE_BURST milliseconds of it.  relay_connection() only
+ *     writes what the bucket allows and, when it is empty, shortens its
+ *     select() timeout to when there will be a segment's worth again,
+ *     so shaped data is released by timers rather than by sleeping.
+ *   - Loss is emulated the way TCP makes it felt: a lost segment holds
+ *     back its direction for a retransmission timeout.
+ *
+ * Responses sent from the response cache or from local files, and
+ * bodies rewritten as a whole, only get the latency.
+ */
+
+#include "main.h"
+
+#include "shape.h"
+#include "acl.h"
+#include "conf.h"
+#include "heap.h"
+#include "log.h"
+
+#define SHAPE_SEGMENT   1460    /* bytes released at a time */
+#define SHAPE_BURST     50      /* ms of bandwidth a bucket saves up */
+#define SHAPE_RTO       200     /* ms a lost segment adds, with the latency */
+
+struct shape_profile {
+        char *name;
+        unsigned long latency;          /* ms before the first byte */
+        unsigned long rate[2];          /* kbit/s down and up, 0 unlimited */
+        unsigned long loss;             /* percent of segments lost */
+};
+
+struct shape_rule {
+        char *profile;
+        vector_t clients;               /* ShapeClient, or */
+        regex_t url;                    /* ShapeURL */
+        int has_url;
+};
+
+struct shape_bucket {
+        double rate;                    /* bytes per ms, 0 unlimited */
+        double burst;
+        double tokens;
+        double last;                    /* ms, when tokens was worked out */
+        double stall;                   /* ms, held back until then */
+};
+
+struct shape {
+        double start;                   /* ms, when the request came in */
+        unsigned long latency;
+        unsigned long loss;
+        struct shape_bucket bucket[2];  /* SHAPE_DOWN and SHAPE_UP */
+};
+
+static double now_ms (void)
+{
+        struct timeval tv;
+
+        gettimeofday (&tv, NULL);
+        return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+/* Lower the select() timeout "tv" to "ms" milliseconds */
+static void shorten_timeout (struct timeval *tv, double ms)
+{
+        long wait = (long) ms + 1;
+
+        if (wait / 1000 < tv->tv_sec
+            || (wait / 1000 == tv->tv_sec
+                && (wait % 1000) * 1000 < tv->tv_usec)) {
+                tv->tv_sec = wait / 1000;
+                tv->tv_usec = (wait % 1000) * 1000;
+        }
+}
+
+static struct shape_profile *find_profile (const char *name)
+{
+        struct shape_profile *profile;
+        ssize_t i;
+
+        for (i = 0; i < vector_length (config.shape_profiles); i++) {
+                profile = (struct shape_profile *)
+                        vector_getentry (config.shape_profiles, i, NULL);
+                if (strcasecmp (profile->name, name) == 0)
+                        return profile;
+        }
+        return NULL;
+}
+
+/*
+ * Add a ShapeProfile to the list, creating the list if needed.  Returns
+ * 0 on success, -1 if out of memory.
+ */
+int shape_add_profile (vector_t *profiles, const char *name,
+                       unsigned long latency, unsigned long down,
+                       unsigned long up, unsigned long loss)
+{
+        struct shape_profile profile;
+
+        profile.name = safestrdup (name);
+        profile.latency = latency;
+        profile.rate[SHAPE_DOWN] = down;
+        profile.rate[SHAPE_UP] = up;
+        profile.loss = loss;
+
+        if (!*profiles)
+                *profiles = vector_create ();
+        if (!*profiles || !profile.name
+            || vector_append (*profiles, &profile, sizeof (profile)) < 0) {
+                safefree (profile.name);
+                return -1;
+        }
+        return 0;
+}
+
+static int add_rule (vector_t *rules, struct shape_rule *rule,
+                     const char *profile)
+{
+        rule->profile = safestrdup (profile);
+
+        if (!*rules)
+                *rules = vector_create ();
+        if (!*rules || !rule->profile
+            || vector_append (*rules, rule, sizeof (*rule)) < 0) {
+                safefree (rule->profile);
+                flush_access_list (rule->clients);
+                if (rule->has_url)
+                        regfree (&rule->url);
+                return -1;
+        }
+        return 0;
+}
+
+/*
+ * Shape the clients at "location", an address, a network or a host
+ * name as for Allow, with "profile".
+ */
+int shape_add_client (vector_t *rules, const char *profile, char *location)
+{
+        struct shape_rule rule;
+
+        memset (&rule, 0, sizeof (rule));
+        if (insert_acl (location, ACL_ALLOW, &rule.clients) < 0) {
+                flush_access_list (rule.clients);
+                return -1;
+        }
+        return add_rule (rules, &rule, profile);
+}
+
+/* Shape the requests for URLs matching "pattern" with "profile". */
+int shape_add_url (vector_t *rules, const char *profile, const char *pattern)
+{
+        struct shape_rule rule;
+
+        memset (&rule, 0, sizeof (rule));
+        if (regcomp (&rule.url, pattern, REG_EXTENDED | REG_ICASE | REG_NOSUB)) {
+                log_message (LOG_ERR, "Bad ShapeURL pattern \"%s\"", pattern);
+                return -1;
+        }
+        rule.has_url = 1;
+        return add_rule (rules, &rule, profile);
+}
+
+void shape_free_profiles (vector_t profiles)
+{
+        ssize_t i;
+
+        for (i = 0; i < vector_length (profiles); i++)
+                safefree (((struct shape_profile *)
+                           vector_getentry (profiles, i, NULL))->name);
+        vector_delete (profiles);
+}
+
+void shape_free_rules (vector_t rules)
+{
+        struct shape_rule *rule;
+        ssize_t i;
+
+        for (i = 0; i < vector_length (rules); i++) {
+                rule = (struct shape_rule *) vector_getentry (rules, i, NULL);
+                safefree (rule->profile);
+                flush_access_list (rule->clients);
+                if (rule->has_url)
+                        regfree (&rule->url);
+        }
+        vector_delete (rules);
+}
+
+/*
+ * The shaping of a connection from the client "ip" / "host" for "url",
+ * which may be NULL, or NULL if no rule picks a profile for it.  Free it
+ * with shape_free().
+ */
+struct shape *shape_new (const char *ip, const char *host, const char *url)
+{
+        static pid_t seeded;
+        const struct shape_profile *profile = NULL;
+        struct shape_rule *rule;
+        struct shape *shape;
+        ssize_t i;
+        int dir;
+
+        for (i = 0; i < vector_length (config.shape_rules) && !profile; i++) {
+                rule = (struct shape_rule *)
+                        vector_getentry (config.shape_rules, i, NULL);
+                if (rule->has_url
+                    ? !url || regexec (&rule->url, url, 0, NULL, 0) != 0
+                    : check_acl (ip, host, rule->clients) <= 0)
+                        continue;
+                profile = find_profile (rule->profile);
+                if (!profile)
+                        log_message (LOG_WARNING,
+                                     "No ShapeProfile \"%s\"", rule->profile);
+        }
+        if (!profile)
+                return NULL;
+
+        shape = (struct shape *) safecalloc (1, sizeof (struct shape));
+        if (!shape)
+                return NULL;
+
+        /* the children were forked with the same random state */
+        if (seeded != getpid ()) {
+                seeded = getpid ();
+                srand ((unsigned int) (seeded ^ time (NULL)));
+        }
+
+        shape->start = now_ms ();
+        shape->latency = profile->latency;
+        shape->loss = profile->loss;
+        for (dir = SHAPE_DOWN; dir <= SHAPE_UP; dir++) {
+                struct shape_bucket *bucket = &shape->bucket[dir];
+
+                /* kbit/s is 1000 bits a second, so a byte per ms per 8 */
+                bucket->rate = profile->rate[dir] / 8.0;
+                bucket->burst = bucket->rate * SHAPE_BURST;
+                if (bucket->burst < SHAPE_SEGMENT)
+                        bucket->burst = SHAPE_SEGMENT;
+                bucket->tokens = SHAPE_SEGMENT;
+                bucket->last = shape->start;
+        }
+
+        log_message (LOG_INFO, "Shaping %s with profile \"%s\"",
+                     url ? url : ip, profile->name);
+        return shape;
+}
+
+/* Wait until "latency" after the request came in */
+void shape_delay (struct shape *shape)
+{
+        struct timeval tv;
+        double left;
+
+        while ((left = shape->start + shape->latency - now_ms ()) > 0) {
+                tv.tv_sec = (long) left / 1000 + 1;
+                tv.tv_usec = 0;
+                shorten_timeout (&tv, left);
+                select (0, NULL, NULL, NULL, &tv);
+        }
+}
+
+/*
+ * How many bytes may be sent in direction "dir" now.  If none, "tv" is
+ * lowered to when some may be.
+ */
+size_t shape_allow (struct shape *shape, int dir, struct timeval *tv)
+{
+        struct shape_bucket *bucket = &shape->bucket[dir];
+        double now = now_ms ();
+        size_t allowed = (size_t) -1;
+
+        if (now < bucket->stall) {
+                shorten_timeout (tv, bucket->stall - now);
+                return 0;
+        }
+
+        if (bucket->rate > 0) {
+                bucket->tokens += (now - bucket->last) * bucket->rate;
+                if (bucket->tokens > bucket->burst)
+                        bucket->tokens = bucket->burst;
+                bucket->last = now;
+
+                /* wait for a whole segment rather than dribbling */
+                if (bucket->tokens < SHAPE_SEGMENT) {
+                        shorten_timeout (tv, (SHAPE_SEGMENT - bucket->tokens)
+                                         / bucket->rate);
+                        return 0;
+                }
+                allowed = (size_t) bucket->tokens;
+        }
+
+        /* each segment may be lost on its own */
+        if (shape->loss > 0 && allowed > SHAPE_SEGMENT)
+                allowed = SHAPE_SEGMENT;
+        return allowed;
+}
+
+/* Like shape_allow(), but waits until something may be sent */
+size_t shape_wait (struct shape *shape, int dir)
+{
+        struct timeval tv;
+        size_t allowed;
+
+        for (;;) {
+                tv.tv_sec = config.idletimeout;
+                tv.tv_usec = 0;
+                if ((allowed = shape_allow (shape, dir, &tv)) > 0)
+                        return allowed;
+                select (0, NULL, NULL, NULL, &tv);
+        }
+}
+
+/* Account for "len" bytes sent in direction "dir" */
+void shape_sent (struct shape *shape, int dir, size_t len)
+{
+        struct shape_bucket *bucket = &shape->bucket[dir];
+
+        if (bucket->rate > 0)
+                bucket->tokens -= len;
+        if (len > 0 && shape->loss > 0
+            && (unsigned long) (rand () % 100) < shape->loss)
+                bucket->stall = now_ms () + SHAPE_RTO + shape->latency;
+}
+
+void shape_free (struct shape *shape)
+{
+        safefree (shape);
+}
@@ -0,0 +1,52 @@
+/* tinyproxy - A fast light-weight HTTP proxy
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/* See 'shape.c' for detailed information. */
+
+#ifndef _TINYPROXY_SHAPE_H_
+#define _TINYPROXY_SHAPE_H_
+
+#include "common.h"
+#include "vector.h"
+
+/* Directions of a shaped connection */
+#define SHAPE_DOWN      0       /* server to client */
+#define SHAPE_UP        1       /* client to server */
+
+/* The shaping of one connection */
+struct shape;
+
+extern int shape_add_profile (vector_t *profiles, const char *name,
+                              unsigned long latency, unsigned long down,
+                              unsigned long up, unsigned long loss);
+extern int shape_add_client (vector_t *rules, const char *profile,
+                             char *location);
+extern int shape_add_url (vector_t *rules, const char *profile,
+                          const char *pattern);
+extern void shape_free_profiles (vector_t profiles);
+extern void shape_free_rules (vector_t rules);
+
+extern struct shape *shape_new (const char *ip, const char *host,
+                                const char *url);
+extern void shape_delay (struct shape *shape);
+extern size_t shape_allow (struct shape *shape, int dir,
+                           struct timeval *tv);
+extern size_t shape_wait (struct shape *shape, int dir);
+extern void shape_sent (struct shape *shape, int dir, size_t len);
+extern void shape_free (struct shape *shape);
+
+#endif /* _TINYPROXY_SHAPE_H_ */
@@ -70,12 +70,70 @@ bind_socket (int sockfd, const char *addr, int family)
         return sockfd;
 }
 
+/*
+ * Connect the socket, giving up with ETIMEDOUT after "timeout" seconds
+ * unless it is 0.  Returns 0 on success, -1 on failure.
+ */
+static int
+connect_socket (int sockfd, const struct sockaddr *addr, socklen_t addrlen,
+                unsigned int timeout)
+{
+        struct timeval tv;
+        fd_set wset;
+        socklen_t len;
+        int err, ret;
+
+        if (timeout == 0)
+                return connect (sockfd, addr, addrlen);
+
+        if (socket_nonblocking (sockfd) < 0)
+                return -1;
+
+        if (connect (sockfd, addr, addrlen) < 0) {
+                if (errno != EINPROGRESS)
+                        return -1;
+
+                do {
+                        FD_ZERO (&wset);
+                        FD_SET (sockfd, &wset);
+                        tv.tv_sec = timeout;
+                        tv.tv_usec = 0;
+                        ret = select (sockfd + 1, NULL, &wset, NULL, &tv);
+                } while (ret < 0 && errno == EINTR);
+
+                if (ret == 0)
+                        errno = ETIMEDOUT;
+                if (ret <= 0)
+                        return -1;
+
+                len = sizeof (err);
+                if (getsockopt (sockfd, SOL_SOCKET, SO_ERROR, &err, &len) < 0)
+                        return -1;
+                if (err != 0) {
+                        errno = err;
+                        return -1;
+                }
+        }
+
+        return socket_blocking (sockfd) < 0 ? -1 : 0;
+}
+
 /*
  * Open a connection to a remote host.  It's been re-written to use
  * the getaddrinfo() library function, which allows for a protocol
  * independent implementation (mostly for IPv4 and IPv6 addresses.)
  */
 int opensock (const char *host, int port, const char *bind_to)
+{
+        return opensock_timeout (host, port, bind_to, 0);
+}
+
+/*
+ * Like opensock(), but each address gets "timeout" seconds to accept
+ * the connection.
+ */
+int opensock_timeout (const char *host, int port, const char *bind_to,
+                      unsigned int timeout)
 {
         int sockfd, n;
         struct addrinfo hints, *res, *ressave;
@@ -119,7 +177,8 @@ int opensock (const char *host, int port, const char *bind_to)
                         }
                 }
 
-                if (connect (sockfd, res->ai_addr, res->ai_addrlen) == 0)
+                if (connect_socket (sockfd, res->ai_addr, res->ai_addrlen,
+                                    timeout) == 0)
                         break;  /* success */
 
                 close (sockfd);
@@ -30,6 +30,8 @@
 #include "log.h"
 #include "heap.h"
 #include "html-error.h"
+#include "http-cache.h"
+#include "instrument.h"
 #include "stats.h"
 #include "utils.h"
 #include "conf.h"
@@ -64,6 +66,14 @@ showstats (struct conn_s *connptr)
 {
         char *message_buffer;
         char opens[16], reqs[16], badconns[16], denied[16], refused[16];
+        char jshits[16], jsdiskhits[16], jsmisses[16], jssaved[16];
+        char jshitrate[16];
+        char cachehits[16], cachemisses[16], cachehitrate[16];
+        char cachebytes[16], cacheused[16], cachediskhits[16];
+        char cachediskused[16], cacherevalidated[16], cachecollapsed[16];
+        struct instrument_cache_stats jscache;
+        struct http_cache_stats httpcache;
+        unsigned long jstotal, total;
         FILE *statfile;
 
         snprintf (opens, sizeof (opens), "%lu", stats->num_open);
@@ -72,6 +82,33 @@ showstats (struct conn_s *connptr)
         snprintf (denied, sizeof (denied), "%lu", stats->num_denied);
         snprintf (refused, sizeof (refused), "%lu", stats->num_refused);
 
+        instrument_cache_stats (&jscache);
+        jstotal = jscache.hits + jscache.disk_hits + jscache.misses;
+        snprintf (jshits, sizeof (jshits), "%lu", jscache.hits);
+        snprintf (jsdiskhits, sizeof (jsdiskhits), "%lu", jscache.disk_hits);
+        snprintf (jsmisses, sizeof (jsmisses), "%lu", jscache.misses);
+        snprintf (jssaved, sizeof (jssaved), "%lu", jscache.bytes_saved);
+        snprintf (jshitrate, sizeof (jshitrate), "%lu%%", jstotal ?
+                  (jscache.hits + jscache.disk_hits) * 100 / jstotal : 0);
+
+        http_cache_stats (&httpcache);
+        total = httpcache.hits + httpcache.misses;
+        snprintf (cachehits, sizeof (cachehits), "%lu", httpcache.hits);
+        snprintf (cachemisses, sizeof (cachemisses), "%lu", httpcache.misses);
+        snprintf (cachehitrate, sizeof (cachehitrate), "%lu%%", total ?
+                  httpcache.hits * 100 / total : 0);
+        snprintf (cachebytes, sizeof (cachebytes), "%lu",
+                  httpcache.bytes_served);
+        snprintf (cacheused, sizeof (cacheused), "%lu", httpcache.bytes_used);
+        snprintf (cachediskhits, sizeof (cachediskhits), "%lu",
+                  httpcache.disk_hits);
+        snprintf (cachediskused, sizeof (cachediskused), "%lu",
+                  httpcache.disk_bytes_used);
+        snprintf (cacherevalidated, sizeof (cacherevalidated), "%lu",
+                  httpcache.revalidated);
+        snprintf (cachecollapsed, sizeof (cachecollapsed), "%lu",
+                  httpcache.collapsed);
+
         if (!config.statpage || (!(statfile = fopen (config.statpage, "r")))) {
                 message_buffer = (char *) safemalloc (MAXBUFFSIZE);
                 if (!message_buffer)
@@ -93,6 +130,22 @@ showstats (struct conn_s *connptr)
                    "Number of denied connections: %lu<br />\n"
                    "Number of refused connections due to high load: %lu\n"
                    "</p>\n"
+                   "<p>\n"
+                   "Instrumentation cache hits: %lu (%lu from disk)<br />\n"
+                   "Instrumentation cache misses: %lu<br />\n"
+                   "Instrumentation cache hit rate: %s<br />\n"
+                   "Bytes not instrumented again: %lu<br />\n"
+                   "<a href=\"/profile\">JavaScript profile</a>\n"
+                   "</p>\n"
+                   "<p>\n"
+                   "Response cache hits: %lu (%lu from disk)<br />\n"
+                   "Response cache misses: %lu<br />\n"
+                   "Response cache hit rate: %s<br />\n"
+                   "Stale responses revalidated with the server: %lu<br />\n"
+                   "Requests that waited for another to fetch: %lu<br />\n"
+                   "Bytes served from the response cache: %lu<br />\n"
+                   "Bytes in the response cache: %lu (%lu on disk)\n"
+                   "</p>\n"
                    "<hr />\n"
                    "<p><em>Generated by %s version %s.</em></p>\n" "</body>\n"
                    "</html>\n",
@@ -100,7 +153,14 @@ showstats (struct conn_s *connptr)
                    stats->num_open,
                    stats->num_reqs,
                    stats->num_badcons, stats->num_denied,
-                   stats->num_refused, PACKAGE, VERSION);
+                   stats->num_refused,
+                   jscache.hits + jscache.disk_hits, jscache.disk_hits,
+                   jscache.misses, jshitrate, jscache.bytes_saved,
+                   httpcache.hits, httpcache.disk_hits, httpcache.misses,
+                   cachehitrate, httpcache.revalidated, httpcache.collapsed,
+                   httpcache.bytes_served,
+                   httpcache.bytes_used, httpcache.disk_bytes_used,
+                   PACKAGE, VERSION);
 
                 if (send_http_message (connptr, 200, "OK",
                                        message_buffer) < 0) {
@@ -117,6 +177,20 @@ showstats (struct conn_s *connptr)
         add_error_variable (connptr, "badconns", badconns);
         add_error_variable (connptr, "deniedconns", denied);
         add_error_variable (connptr, "refusedconns", refused);
+        add_error_variable (connptr, "jscachehits", jshits);
+        add_error_variable (connptr, "jscachediskhits", jsdiskhits);
+        add_error_variable (connptr, "jscachemisses", jsmisses);
+        add_error_variable (connptr, "jscachehitrate", jshitrate);
+        add_error_variable (connptr, "jscachesaved", jssaved);
+        add_error_variable (connptr, "cachehits", cachehits);
+        add_error_variable (connptr, "cachemisses", cachemisses);
+        add_error_variable (connptr, "cachehitrate", cachehitrate);
+        add_error_variable (connptr, "cachebytes", cachebytes);
+        add_error_variable (connptr, "cacheused", cacheused);
+        add_error_variable (connptr, "cachediskhits", cachediskhits);
+        add_error_variable (connptr, "cachediskused", cachediskused);
+        add_error_variable (connptr, "cacherevalidated", cacherevalidated);
+        add_error_variable (connptr, "cachecollapsed", cachecollapsed);
         add_standard_vars (connptr);
         send_http_headers (connptr, 200, "Statistic requested");
         send_html_file (statfile, connptr);
@@ -24,15 +24,21 @@
  * Routines for handling the list of upstream proxies.
  */
 
+#include "main.h"
+
 #include "upstream.h"
+#include "conf.h"
 #include "heap.h"
 #include "log.h"
+#include "vector.h"
 
 #ifdef UPSTREAM_SUPPORT
 /**
  * Construct an upstream struct from input data.
  */
-static struct upstream *upstream_build (const char *host, int port, const char *domain)
+static struct upstream *upstream_build (const char *host, int port,
+                                        struct upstream_group *group,
+                                        const char *domain)
 {
         char *ptr;
         struct upstream *up;
@@ -45,9 +51,22 @@ static struct upstream *upstream_build (const char *host, int port, const char *
         }
 
         up->host = up->domain = NULL;
+        up->group = group;
         up->ip = up->mask = 0;
 
-        if (domain == NULL) {
+        if (group) {
+                if (domain && domain[0] == '\0') {
+                        log_message (LOG_WARNING,
+                                     "Nonsense upstream rule: empty domain");
+                        goto fail;
+                }
+
+                if (domain)
+                        up->domain = safestrdup (domain);
+
+                log_message (LOG_INFO, "Added upstream group %s for %s",
+                             group->name, domain ? domain : "[default]");
+        } else if (domain == NULL) {
                 if (!host || host[0] == '\0' || port < 1) {
                         log_message (LOG_WARNING,
                                      "Nonsense upstream rule: invalid host or port");
@@ -91,7 +110,7 @@ static struct upstream *upstream_build (const char *host, int port, const char *
                 log_message (LOG_INFO, "Added no-upstream for %s", domain);
         } else {
                 if (!host || host[0] == '\0' || port < 1 || !domain
-                    || domain == '\0') {
+                    || domain[0] == '\0') {
                         log_message (LOG_WARNING,
                                      "Nonsense upstream rule: invalid parameters");
                         goto fail;
@@ -118,12 +137,13 @@ fail:
 /*
  * Add an entry to the upstream list
  */
-void upstream_add (const char *host, int port, const char *domain,
+void upstream_add (const char *host, int port,
+                   struct upstream_group *group, const char *domain,
                    struct upstream **upstream_list)
 {
         struct upstream *up;
 
-        up = upstream_build (host, port, domain);
+        up = upstream_build (host, port, group, domain);
         if (up == NULL) {
                 return;
         }
@@ -162,46 +182,423 @@ upstream_cleanup:
 }
 
 /*
- * Check if a host is in the upstream list
+ * Every rule is ranked by its position in the upstream list.  The list
+ * is kept with the most recently configured rule first, so the lowest
+ * rank wins, just as the first match did when the list was walked.
  */
-struct upstream *upstream_get (char *host, struct upstream *up)
+#define NO_RANK ((unsigned int) -1)
+
+struct upstream_match {
+        struct upstream *up;
+        unsigned int rank;
+};
+
+/*
+ * One node per host name label.  The path from the root spells a domain
+ * name backwards, so "www.example.com" lives at root -> com -> example
+ * -> www.  The children are kept in a small open addressing table.
+ */
+struct domain_node {
+        char *label;
+        size_t label_len;
+
+        struct upstream_match exact;    /* "name" rules */
+        struct upstream_match suffix;   /* ".name" rules */
+
+        struct domain_node **children;
+        unsigned int nchildren, nslots;
+};
+
+/*
+ * Binary prefix tree for the "IP/bits" rules, one level per address bit.
+ */
+struct cidr_node {
+        struct cidr_node *child[2];
+        struct upstream_match match;
+};
+
+struct upstream_index {
+        struct domain_node *domains;
+        struct cidr_node *networks;
+
+        /* IP rules whose netmask is not a plain prefix length */
+        vector_t masked;
+
+        struct upstream_match local;    /* the "." rule */
+        struct upstream_match fallback; /* the default upstream */
+};
+
+static void set_match (struct upstream_match *slot,
+                       const struct upstream_match *match)
 {
-        in_addr_t my_ip = INADDR_NONE;
+        /* Rules are added in rank order; keep the first one seen. */
+        if (!slot->up)
+                *slot = *match;
+}
+
+static void better_match (struct upstream_match *best,
+                          const struct upstream_match *match)
+{
+        if (match->up && match->rank < best->rank)
+                *best = *match;
+}
+
+static unsigned int label_hash (const char *label, size_t len)
+{
+        unsigned int hash = 5381;
+
+        while (len--)
+                hash = hash * 33 + tolower ((unsigned char) *label++);
+
+        return hash;
+}
+
+static struct domain_node *domain_node_new (const char *label, size_t len)
+{
+        struct domain_node *node;
+
+        node = (struct domain_node *) safecalloc (1, sizeof (*node));
+        if (!node)
+                return NULL;
+
+        node->label = (char *) safemalloc (len + 1);
+        if (!node->label) {
+                safefree (node);
+                return NULL;
+        }
+
+        memcpy (node->label, label, len);
+        node->label[len] = '\0';
+        node->label_len = len;
+
+        return node;
+}
+
+static void domain_node_free (struct domain_node *node)
+{
+        unsigned int i;
+
+        if (!node)
+                return;
+
+        for (i = 0; i != node->nslots; ++i)
+                domain_node_free (node->children[i]);
+
+        safefree (node->children);
+        safefree (node->label);
+        safefree (node);
+}
+
+static void domain_node_place (struct domain_node **slots, unsigned int nslots,
+                               struct domain_node *child)
+{
+        unsigned int mask = nslots - 1;
+        unsigned int i;
+
+        i = label_hash (child->label, child->label_len) & mask;
+        while (slots[i])
+                i = (i + 1) & mask;
+
+        slots[i] = child;
+}
+
+/*
+ * Double the child table of a node, keeping it at most half full.
+ */
+static int domain_node_grow (struct domain_node *node)
+{
+        struct domain_node **slots;
+        unsigned int nslots, i;
+
+        nslots = node->nslots ? node->nslots * 2 : 4;
+        slots = (struct domain_node **) safecalloc (nslots, sizeof (*slots));
+        if (!slots)
+                return -1;
+
+        for (i = 0; i != node->nslots; ++i) {
+                if (node->children[i])
+                        domain_node_place (slots, nslots, node->children[i]);
+        }
+
+        safefree (node->children);
+        node->children = slots;
+        node->nslots = nslots;
+
+        return 0;
+}
+
+/*
+ * Find the child of "node" for the given label, optionally creating it.
+ */
+static struct domain_node *domain_node_child (struct domain_node *node,
+                                              const char *label, size_t len,
+                                              unsigned int create)
+{
+        struct domain_node *child;
+        unsigned int mask, i;
+
+        if (node->nslots > 0) {
+                mask = node->nslots - 1;
+                for (i = label_hash (label, len) & mask;
+                     (child = node->children[i]) != NULL;
+                     i = (i + 1) & mask) {
+                        if (child->label_len == len
+                            && strncasecmp (child->label, label, len) == 0)
+                                return child;
+                }
+        }
+
+        if (!create)
+                return NULL;
+
+        if ((node->nchildren + 1) * 2 > node->nslots
+            && domain_node_grow (node) < 0)
+                return NULL;
+
+        child = domain_node_new (label, len);
+        if (!child)
+                return NULL;
+
+        domain_node_place (node->children, node->nslots, child);
+        node->nchildren++;
+
+        return child;
+}
+
+/*
+ * Walk (and with "create", build) the path for a domain name, label by
+ * label starting from the last one.  An empty label is a label too, so
+ * "." and "a..b" are handled like any other name.
+ */
+static struct domain_node *domain_node_walk (struct domain_node *node,
+                                             const char *name,
+                                             unsigned int create)
+{
+        const char *end = name + strlen (name);
+        const char *start;
+
+        for (;;) {
+                start = end;
+                while (start > name && start[-1] != '.')
+                        start--;
+
+                node = domain_node_child (node, start, end - start, create);
+                if (!node || start == name)
+                        return node;
+
+                end = start - 1;
+        }
+}
+
+static int index_add_domain (struct upstream_index *index, const char *domain,
+                             const struct upstream_match *match)
+{
+        struct domain_node *node;
+
+        /* "." matches any host without a dot in it */
+        if (domain[0] == '.' && domain[1] == '\0')
+                set_match (&index->local, match);
+
+        node = domain_node_walk (index->domains, domain, TRUE);
+        if (!node)
+                return -1;
+        set_match (&node->exact, match);
+
+        /* ".name" also matches every host below "name" */
+        if (domain[0] == '.') {
+                node = domain_node_walk (index->domains, domain + 1, TRUE);
+                if (!node)
+                        return -1;
+                set_match (&node->suffix, match);
+        }
+
+        return 0;
+}
+
+static void cidr_node_free (struct cidr_node *node)
+{
+        if (!node)
+                return;
+
+        cidr_node_free (node->child[0]);
+        cidr_node_free (node->child[1]);
+        safefree (node);
+}
+
+static int index_add_network (struct upstream_index *index,
+                              struct upstream_match *match)
+{
+        in_addr_t ip = match->up->ip;
+        in_addr_t mask = match->up->mask;
+        in_addr_t hostmask = ~mask;
+        struct cidr_node **node;
+        int bit, bits;
+
+        /* A network with host bits set can never match anything. */
+        if ((ip & mask) != ip)
+                return 0;
+
+        /* Netmasks like 255.0.255.0 are checked one by one. */
+        if (hostmask & (hostmask + 1)) {
+                if (!index->masked && !(index->masked = vector_create ()))
+                        return -1;
+                return vector_append (index->masked, match,
+                                      sizeof (*match));
+        }
+
+        for (bits = 32; hostmask; hostmask >>= 1)
+                bits--;
+
+        node = &index->networks;
+        for (bit = 31;; bit--) {
+                if (!*node) {
+                        *node = (struct cidr_node *)
+                                safecalloc (1, sizeof (struct cidr_node));
+                        if (!*node)
+                                return -1;
+                }
+
+                if (bit < 32 - bits)
+                        break;
+
+                node = &(*node)->child[(ip >> bit) & 1];
+        }
+
+        set_match (&(*node)->match, match);
+        return 0;
+}
+
+/*
+ * Compile an upstream list into a lookup index.  The list must outlive
+ * the index, since the index only points into it.
+ */
+struct upstream_index *upstream_index_build (struct upstream *up)
+{
+        struct upstream_index *index;
+        struct upstream_match match;
+        unsigned int rank;
+
+        index = (struct upstream_index *) safecalloc (1, sizeof (*index));
+        if (!index)
+                goto fail;
+
+        index->domains = domain_node_new ("", 0);
+        if (!index->domains)
+                goto fail;
+
+        for (rank = 0; up; up = up->next, ++rank) {
+                match.up = up;
+                match.rank = rank;
 
-        while (up) {
                 if (up->domain) {
-                        if (strcasecmp (host, up->domain) == 0)
-                                break;  /* exact match */
+                        if (index_add_domain (index, up->domain, &match) < 0)
+                                goto fail;
+                } else if (up->ip) {
+                        if (index_add_network (index, &match) < 0)
+                                goto fail;
+                } else {
+                        set_match (&index->fallback, &match);
+                }
+        }
 
-                        if (up->domain[0] == '.') {
-                                char *dot = strchr (host, '.');
+        return index;
+
+fail:
+        log_message (LOG_ERR,
+                     "Unable to allocate memory in upstream_index_build()");
+        upstream_index_free (index);
+        return NULL;
+}
 
-                                if (!dot && !up->domain[1])
-                                        break;  /* local host matches "." */
+void upstream_index_free (struct upstream_index *index)
+{
+        if (!index)
+                return;
 
-                                while (dot && strcasecmp (dot, up->domain))
-                                        dot = strchr (dot + 1, '.');
+        domain_node_free (index->domains);
+        cidr_node_free (index->networks);
+        if (index->masked)
+                vector_delete (index->masked);
+        safefree (index);
+}
 
-                                if (dot)
-                                        break;  /* subdomain match */
+/*
+ * Check if a host is in the upstream list
+ */
+struct upstream *upstream_get (char *host, struct upstream_index *index)
+{
+        struct upstream_match best = { NULL, NO_RANK };
+        struct upstream_match *match;
+        struct domain_node *node;
+        struct cidr_node *net;
+        struct upstream *up;
+        const char *start, *end;
+        in_addr_t my_ip;
+        ssize_t i;
+        int bit;
+
+        if (index) {
+                if (index->fallback.up)
+                        best = index->fallback;
+
+                if (!strchr (host, '.'))
+                        better_match (&best, &index->local);
+
+                /*
+                 * Domain rules: every node on the way down may carry a
+                 * ".name" rule, and the node for the full host name may
+                 * carry an exact one.
+                 */
+                node = index->domains;
+                end = host + strlen (host);
+                for (;;) {
+                        start = end;
+                        while (start > host && start[-1] != '.')
+                                start--;
+
+                        node = domain_node_child (node, start, end - start,
+                                                  FALSE);
+                        if (!node)
+                                break;
+
+                        if (start == host) {
+                                better_match (&best, &node->exact);
+                                break;
                         }
-                } else if (up->ip) {
-                        if (my_ip == INADDR_NONE)
-                                my_ip = ntohl (inet_addr (host));
 
-                        if ((my_ip & up->mask) == up->ip)
+                        better_match (&best, &node->suffix);
+                        end = start - 1;
+                }
+
+                /*
+                 * IP rules: every network on the path of the address is a
+                 * candidate, not just the longest prefix.
+                 */
+                my_ip = ntohl (inet_addr (host));
+
+                for (net = index->networks, bit = 31; net; bit--) {
+                        better_match (&best, &net->match);
+                        if (bit < 0)
                                 break;
-                } else {
-                        break;  /* No domain or IP, default upstream */
+                        net = net->child[(my_ip >> bit) & 1];
                 }
 
-                up = up->next;
+                for (i = 0; i < vector_length (index->masked); ++i) {
+                        match = (struct upstream_match *)
+                                vector_getentry (index->masked, i, NULL);
+                        if ((my_ip & match->up->mask) == match->up->ip)
+                                better_match (&best, match);
+                }
         }
 
-        if (up && (!up->host || !up->port))
+        up = best.up;
+        if (up && !up->group && (!up->host || !up->port))
                 up = NULL;
 
-        if (up)
+        if (up && up->group)
+                log_message (LOG_INFO, "Found upstream group %s for %s",
+                             up->group->name, host);
+        else if (up)
                 log_message (LOG_INFO, "Found upstream proxy %s:%d for %s",
                              up->host, up->port, host);
         else
@@ -221,4 +618,365 @@ void free_upstream_list (struct upstream *up)
         }
 }
 
+/*
+ * Look up an upstream group by name, creating an empty one if this is
+ * the first time the name is seen.  Groups may be referenced before
+ * their members are configured.
+ */
+struct upstream_group *upstream_group_get (const char *name,
+                                           struct upstream_group **groups)
+{
+        struct upstream_group *group;
+
+        for (group = *groups; group; group = group->next) {
+                if (strcasecmp (group->name, name) == 0)
+                        return group;
+        }
+
+        group = (struct upstream_group *)
+                safecalloc (1, sizeof (struct upstream_group));
+        if (!group)
+                return NULL;
+
+        group->name = safestrdup (name);
+        if (!group->name) {
+                safefree (group);
+                return NULL;
+        }
+
+        group->balance = UPSTREAM_BALANCE_LEASTCONN;
+        group->next = *groups;
+        *groups = group;
+
+        return group;
+}
+
+int upstream_group_add_member (struct upstream_group *group,
+                               const char *host, int port)
+{
+        struct upstream_member *members, *member;
+
+        if (!host || host[0] == '\0' || port < 1 || port > 65535) {
+                log_message (LOG_WARNING,
+                             "Nonsense upstream group member: invalid host or port");
+                return -1;
+        }
+
+        members = (struct upstream_member *)
+                saferealloc (group->members,
+                             (group->nmembers + 1) * sizeof (*members));
+        if (!members)
+                return -1;
+        group->members = members;
+
+        member = &members[group->nmembers];
+        member->host = safestrdup (host);
+        if (!member->host)
+                return -1;
+        member->port = port;
+        member->slot = -2;
+        group->nmembers++;
+
+        log_message (LOG_INFO, "Added upstream %s:%d to group %s",
+                     host, port, group->name);
+
+        return 0;
+}
+
+void free_upstream_groups (struct upstream_group *group)
+{
+        unsigned int i;
+
+        while (group) {
+                struct upstream_group *tmp = group;
+                group = group->next;
+
+                for (i = 0; i != tmp->nmembers; ++i)
+                        safefree (tmp->members[i].host);
+                safefree (tmp->members);
+                safefree (tmp->name);
+                safefree (tmp);
+        }
+}
+
+/*
+ * Health of the group members, shared by all the children so that a
+ * member one child has seen failing is avoided by the others too.  The
+ * table is allocated once at startup and entries are claimed by
+ * "host:port", so they survive a configuration reload.
+ */
+#define UPSTREAM_HEALTH_SLOTS   256
+#define UPSTREAM_HEALTH_HOSTLEN 128
+
+struct upstream_health {
+        char host[UPSTREAM_HEALTH_HOSTLEN];
+        int port;
+        unsigned int outstanding;       /* requests currently relayed */
+        unsigned int fails;             /* connection failures in a row */
+        time_t down_until;
+};
+
+static struct upstream_health *health = NULL;
+static int health_lock_fd = -1;
+
+static void health_lock (short type)
+{
+        struct flock lock;
+
+        lock.l_type = type;
+        lock.l_whence = SEEK_SET;
+        lock.l_start = 0;
+        lock.l_len = 0;
+
+        while (fcntl (health_lock_fd, F_SETLKW, &lock) < 0) {
+                if (errno != EINTR)
+                        return;
+        }
+}
+
+int upstream_health_init (void)
+{
+        char lock_file[] = "/tmp/tinyproxy.upstream.lock.XXXXXX";
+
+        health = (struct upstream_health *)
+                calloc_shared_memory (UPSTREAM_HEALTH_SLOTS,
+                                      sizeof (struct upstream_health));
+        if (health == MAP_FAILED) {
+                health = NULL;
+                return -1;
+        }
+
+        health_lock_fd = mkstemp (lock_file);
+        if (health_lock_fd < 0) {
+                health = NULL;
+                return -1;
+        }
+        unlink (lock_file);
+
+        return 0;
+}
+
+/*
+ * Find the health table entry of a member, claiming a free one if there
+ * is none yet.  Returns -1 if the member can not be tracked, in which
+ * case it is always considered up.
+ */
+int upstream_member_slot (struct upstream_member *member)
+{
+        struct upstream_health *entry;
+        unsigned int i, start;
+        size_t len;
+
+        if (member->slot != -2)
+                return member->slot;
+
+        member->slot = -1;
+        len = strlen (member->host);
+        if (!health || len >= UPSTREAM_HEALTH_HOSTLEN)
+                return -1;
+
+        start = (label_hash (member->host, len) + member->port)
+                % UPSTREAM_HEALTH_SLOTS;
+
+        health_lock (F_WRLCK);
+        for (i = 0; i != UPSTREAM_HEALTH_SLOTS; ++i) {
+                entry = &health[(start + i) % UPSTREAM_HEALTH_SLOTS];
+
+                if (entry->host[0] == '\0') {
+                        memcpy (entry->host, member->host, len + 1);
+                        entry->port = member->port;
+                }
+
+                if (entry->port == member->port
+                    && strcmp (entry->host, member->host) == 0) {
+                        member->slot = (start + i) % UPSTREAM_HEALTH_SLOTS;
+                        break;
+                }
+        }
+        health_lock (F_UNLCK);
+
+        if (member->slot < 0)
+                log_message (LOG_WARNING,
+                             "No room to track the health of upstream %s:%d",
+                             member->host, member->port);
+
+        return member->slot;
+}
+
+/*
+ * Rendezvous hashing: every member scores the host and the highest
+ * score wins, so removing a member only moves the hosts it served.
+ */
+static uint32_t member_score (const char *host,
+                              const struct upstream_member *member)
+{
+        uint32_t hash = 2166136261U;
+        const char *p;
+
+        for (p = host; *p; p++)
+                hash = (hash ^ (unsigned char) tolower (*p)) * 16777619U;
+        for (p = member->host; *p; p++)
+                hash = (hash ^ (unsigned char) *p) * 16777619U;
+        hash = (hash ^ (uint32_t) member->port) * 16777619U;
+
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bU;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35U;
+        hash ^= hash >> 16;
+
+        return hash;
+}
+
+/*
+ * Choose the member of a group to connect to for a host.  Members
+ * flagged in "tried" are skipped, and the chosen one is flagged.  If
+ * every remaining member is down, the one due back first is probed
+ * anyway rather than failing the request.
+ */
+struct upstream_member *upstream_member_pick (struct upstream_group *group,
+                                              const char *host,
+                                              unsigned char *tried)
+{
+        static unsigned int rotate = 0;
+        struct upstream_health *entry;
+        unsigned int i, n, best = 0, probe = 0;
+        unsigned int load, best_load = 0;
+        uint32_t score, best_score = 0;
+        int have_best = FALSE, have_probe = FALSE;
+        time_t now, probe_time = 0;
+
+        if (group->nmembers == 0)
+                return NULL;
+
+        for (i = 0; i != group->nmembers; ++i)
+                upstream_member_slot (&group->members[i]);
+
+        now = time (NULL);
+        if (health)
+                health_lock (F_WRLCK);
+
+        for (i = 0; i != group->nmembers; ++i) {
+                /* start somewhere else each time to spread out ties */
+                n = (rotate + i) % group->nmembers;
+                if (tried[n])
+                        continue;
+
+                entry = group->members[n].slot >= 0 ?
+                        &health[group->members[n].slot] : NULL;
+
+                if (entry && entry->down_until > now) {
+                        if (!have_probe || entry->down_until < probe_time) {
+                                probe = n;
+                                probe_time = entry->down_until;
+                                have_probe = TRUE;
+                        }
+                        continue;
+                }
+
+                if (group->balance == UPSTREAM_BALANCE_HASH) {
+                        score = member_score (host, &group->members[n]);
+                        if (!have_best || score > best_score) {
+                                best = n;
+                                best_score = score;
+                                have_best = TRUE;
+                        }
+                } else {
+                        load = entry ? entry->outstanding : 0;
+                        if (!have_best || load < best_load) {
+                                best = n;
+                                best_load = load;
+                                have_best = TRUE;
+                        }
+                }
+        }
+        rotate++;
+
+        if (!have_best && have_probe) {
+                best = probe;
+                have_best = TRUE;
+        }
+
+        if (have_best) {
+                tried[best] = 1;
+
+                /*
+                 * A member coming back from being down gets a single
+                 * probe; keep the other children away until it answers.
+                 */
+                entry = group->members[best].slot >= 0 ?
+                        &health[group->members[best].slot] : NULL;
+                if (entry && entry->fails >= config.upstream_max_fails)
+                        entry->down_until =
+                                now + config.upstream_fail_timeout;
+        }
+
+        if (health)
+                health_lock (F_UNLCK);
+
+        return have_best ? &group->members[best] : NULL;
+}
+
+void upstream_health_connected (int slot)
+{
+        if (!health || slot < 0)
+                return;
+
+        health_lock (F_WRLCK);
+        health[slot].outstanding++;
+        health_lock (F_UNLCK);
+}
+
+/*
+ * A member counts as healthy again once it has answered a request, not
+ * merely accepted the connection.
+ */
+void upstream_health_ok (int slot)
+{
+        struct upstream_health *entry;
+
+        if (!health || slot < 0)
+                return;
+
+        entry = &health[slot];
+        health_lock (F_WRLCK);
+        if (entry->fails >= config.upstream_max_fails)
+                log_message (LOG_NOTICE, "Upstream %s:%d is back up",
+                             entry->host, entry->port);
+        entry->fails = 0;
+        entry->down_until = 0;
+        health_lock (F_UNLCK);
+}
+
+void upstream_health_failed (int slot)
+{
+        struct upstream_health *entry;
+
+        if (!health || slot < 0)
+                return;
+
+        entry = &health[slot];
+        health_lock (F_WRLCK);
+        entry->fails++;
+        if (entry->fails >= config.upstream_max_fails) {
+                entry->down_until = time (NULL) + config.upstream_fail_timeout;
+                if (entry->fails == config.upstream_max_fails)
+                        log_message (LOG_WARNING,
+                                     "Upstream %s:%d is down after %u failures",
+                                     entry->host, entry->port, entry->fails);
+        }
+        health_lock (F_UNLCK);
+}
+
+void upstream_health_release (int slot)
+{
+        if (!health || slot < 0)
+                return;
+
+        health_lock (F_WRLCK);
+        if (health[slot].outstanding > 0)
+                health[slot].outstanding--;
+        health_lock (F_UNLCK);
+}
+
 #endif
@@ -27,6 +27,37 @@
 
 #include "common.h"
 
+/*
+ * Defaults for the passive health checks of upstream groups: a member is
+ * taken out of rotation after this many connection failures in a row,
+ * and probed again after this many seconds.
+ */
+#define UPSTREAM_MAX_FAILS      3
+#define UPSTREAM_FAIL_TIMEOUT   30
+
+typedef enum {
+        UPSTREAM_BALANCE_LEASTCONN,     /* fewest outstanding requests */
+        UPSTREAM_BALANCE_HASH           /* consistent hashing on host */
+} upstream_balance_t;
+
+struct upstream_member {
+        char *host;
+        int port;
+        int slot;               /* health table slot, -2 if not looked up */
+};
+
+/*
+ * A named set of upstream proxies, defined with UpstreamGroup and used
+ * with "Upstream @name".
+ */
+struct upstream_group {
+        struct upstream_group *next;
+        char *name;
+        upstream_balance_t balance;
+        struct upstream_member *members;        /* array of nmembers */
+        unsigned int nmembers;
+};
+
 /*
  * Even if upstream support is not compiled into tinyproxy, this
  * structure still needs to be defined.
@@ -36,14 +67,44 @@ struct upstream {
         char *domain;           /* optional */
         char *host;
         int port;
+        struct upstream_group *group;   /* used instead of host:port */
         in_addr_t ip, mask;
 };
 
+/*
+ * Lookup structure compiled from an upstream list.  The domain rules are
+ * kept in a trie keyed on the reversed host name labels and the IP rules
+ * in a binary prefix tree, so finding the rule for a host does not depend
+ * on the number of rules configured.
+ */
+struct upstream_index;
+
 #ifdef UPSTREAM_SUPPORT
-extern void upstream_add (const char *host, int port, const char *domain,
+extern void upstream_add (const char *host, int port,
+                          struct upstream_group *group, const char *domain,
                           struct upstream **upstream_list);
-extern struct upstream *upstream_get (char *host, struct upstream *up);
+extern struct upstream *upstream_get (char *host,
+                                      struct upstream_index *index);
 extern void free_upstream_list (struct upstream *up);
+
+extern struct upstream_index *upstream_index_build (struct upstream *up);
+extern void upstream_index_free (struct upstream_index *index);
+
+extern struct upstream_group *upstream_group_get (const char *name,
+                                                  struct upstream_group **groups);
+extern int upstream_group_add_member (struct upstream_group *group,
+                                      const char *host, int port);
+extern void free_upstream_groups (struct upstream_group *group);
+extern struct upstream_member *upstream_member_pick (struct upstream_group *group,
+                                                     const char *host,
+                                                     unsigned char *tried);
+
+extern int upstream_health_init (void);
+extern int upstream_member_slot (struct upstream_member *member);
+extern void upstream_health_connected (int slot);
+extern void upstream_health_ok (int slot);
+extern void upstream_health_failed (int slot);
+extern void upstream_health_release (int slot);
 #endif /* UPSTREAM_SUPPORT */
 
 #endif /* _TINYPROXY_UPSTREAM_H_ */
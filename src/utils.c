@@ -213,3 +213,73 @@ pidfile_create (const char *filename)
         fclose (fd);
         return 0;
 }
+
+/*
+ * The URL is the second word of the request line.  Returns NULL if
+ * there isn't one or out of memory; the caller frees it with safefree().
+ */
+char *request_url (const char *request_line)
+{
+        const char *start, *end;
+        char *url;
+
+        start = strchr (request_line, ' ');
+        if (!start)
+                return NULL;
+        start++;
+        end = strchr (start, ' ');
+        if (!end)
+                end = start + strlen (start);
+
+        url = (char *) safemalloc (end - start + 1);
+        if (!url)
+                return NULL;
+        memcpy (url, start, end - start);
+        url[end - start] = '\0';
+        return url;
+}
+
+/* Days since 1970-01-01 of a date in the Gregorian calendar */
+static long days_from_civil (long year, int month, int day)
+{
+        long era, yoe, doy, doe;
+
+        year -= month <= 2;
+        era = (year >= 0 ? year : year - 399) / 400;
+        yoe = year - era * 400;
+        doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+}
+
+/*
+ * Parse an HTTP-date in any of the three formats of RFC 7231.  Returns
+ * -1 if it is not a valid date.
+ */
+time_t parse_http_date (const char *value)
+{
+        static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+        char month[4];
+        const char *m;
+        int day, year, hour, min, sec;
+
+        if (sscanf (value, "%*[^,], %d %3s %d %d:%d:%d",
+                    &day, month, &year, &hour, &min, &sec) != 6
+            && sscanf (value, "%*[^,], %d-%3s-%d %d:%d:%d",
+                       &day, month, &year, &hour, &min, &sec) != 6
+            && sscanf (value, "%*s %3s %d %d:%d:%d %d",
+                       month, &day, &hour, &min, &sec, &year) != 6)
+                return -1;
+
+        m = strlen (month) == 3 ? strstr (months, month) : NULL;
+        if (!m || (m - months) % 3 != 0 || day < 1 || day > 31
+            || hour < 0 || hour > 23 || min < 0 || min > 59
+            || sec < 0 || sec > 60)
+                return -1;
+        if (year < 100)
+                year += year < 70 ? 2000 : 1900;
+
+        return (time_t) days_from_civil (year, (int) (m - months) / 3 + 1,
+                                         day) * 86400
+                + hour * 3600 + min * 60 + sec;
+}
@@ -33,5 +33,7 @@ extern int send_http_message (struct conn_s *connptr, int http_code,
 extern int pidfile_create (const char *path);
 extern int create_file_safely (const char *filename,
                                unsigned int truncate_file);
+extern char *request_url (const char *request_line);
+extern time_t parse_http_date (const char *value);
 
 #endif
@@ -0,0 +1,2 @@
+/*! js.c benchmark corpus: a minified bundle, webpack style */
+!function(e){var t={};function n(r){if(t[r])return t[r].exports;var o=t[r]={i:r,l:!1,exports:{}};return e[r].call(o.exports,o,o.exports,n),o.l=!0,o.exports}n.m=e,n.c=t,n.d=function(e,t,r){n.o(e,t)||Object.defineProperty(e,t,{enumerable:!0,get:r})},n.o=function(e,t){return Object.prototype.hasOwnProperty.call(e,t)},n(n.s=0)}([function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(390).default{constructor(e){super(e),this.state={v:0,iCb:[]},this.qid5=this.qid5.bind(this)}qid5(e){const{v:t}=this.state;this.setState({v:t+1,iCb:[...this.state.iCb,e]})}get size(){return this.state.iCb.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(317);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.zG7=r,t._HgA=o,t.run=i},function(e,t,n){"use strict";var r=n(161),o=n(374);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.yvo=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(35);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(97),o=n(300),i=function(){function e(e,t){this.aAE=e,this.qpoC=t}return e.prototype.get=function(e){return this.aAE[e]},e.prototype.set=function(e,t){return this.aAE[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.aAE).forEach(function(n){e.call(t,t.aAE[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(87);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(29);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(243),o=n(159),i=function(){function e(e,t){this.jGp=e,this.b4zc=t}return e.prototype.get=function(e){return this.jGp[e]},e.prototype.set=function(e,t){return this.jGp[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.jGp).forEach(function(n){e.call(t,t.jGp[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(329).default{constructor(e){super(e),this.state={v:0,jbt:[]},this.lz56=this.lz56.bind(this)}lz56(e){const{v:t}=this.state;this.setState({v:t+1,jbt:[...this.state.jbt,e]})}get size(){return this.state.jbt.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(164),o=n(268),i=function(){function e(e,t){this.xcI=e,this.$3Hq=t}return e.prototype.get=function(e){return this.xcI[e]},e.prototype.set=function(e,t){return this.xcI[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.xcI).forEach(function(n){e.call(t,t.xcI[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(243);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(295),o=n(187);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.jhc=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(156),o=n(9);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ihk=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(9),o=n(374);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.lmv=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(150).default{constructor(e){super(e),this.state={v:0,pgp:[]},this.oEqE=this.oEqE.bind(this)}oEqE(e){const{v:t}=this.state;this.setState({v:t+1,pgp:[...this.state.pgp,e]})}get size(){return this.state.pgp.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(231);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(221);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(302);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(287);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(84).default{constructor(e){super(e),this.state={v:0,m0h:[]},this.xeoB=this.xeoB.bind(this)}xeoB(e){const{v:t}=this.state;this.setState({v:t+1,m0h:[...this.state.m0h,e]})}get size(){return this.state.m0h.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(316),o=n(225);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.rpD=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.ywA=r,t.zo0d=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(54).default{constructor(e){super(e),this.state={v:0,nfr:[]},this.ad4x=this.ad4x.bind(this)}ad4x(e){const{v:t}=this.state;this.setState({v:t+1,nfr:[...this.state.nfr,e]})}get size(){return this.state.nfr.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(64);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(284);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(320).default{constructor(e){super(e),this.state={v:0,bjI:[]},this._9Iz=this._9Iz.bind(this)}_9Iz(e){const{v:t}=this.state;this.setState({v:t+1,bjI:[...this.state.bjI,e]})}get size(){return this.state.bjI.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(25);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(202),o=n(283);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ubi=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(365);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(236);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(41);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.c0F=r,t.tdJD=o,t.run=i},function(e,t,n){"use strict";var r=n(110),o=n(145),i=function(){function e(e,t){this.vAG=e,this.jJG5=t}return e.prototype.get=function(e){return this.vAG[e]},e.prototype.set=function(e,t){return this.vAG[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.vAG).forEach(function(n){e.call(t,t.vAG[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(36),o=n(52),i=function(){function e(e,t){this.o7z=e,this.a48B=t}return e.prototype.get=function(e){return this.o7z[e]},e.prototype.set=function(e,t){return this.o7z[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.o7z).forEach(function(n){e.call(t,t.o7z[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.a4D=r,t.qiti=o,t.run=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(261),o=n(123),i=function(){function e(e,t){this._Hk=e,this.wHAo=t}return e.prototype.get=function(e){return this._Hk[e]},e.prototype.set=function(e,t){return this._Hk[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this._Hk).forEach(function(n){e.call(t,t._Hk[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(248);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(264).default{constructor(e){super(e),this.state={v:0,$u7:[]},this.gui2=this.gui2.bind(this)}gui2(e){const{v:t}=this.state;this.setState({v:t+1,$u7:[...this.state.$u7,e]})}get size(){return this.state.$u7.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(244).default{constructor(e){super(e),this.state={v:0,qqD:[]},this.uin1=this.uin1.bind(this)}uin1(e){const{v:t}=this.state;this.setState({v:t+1,qqD:[...this.state.qqD,e]})}get size(){return this.state.qqD.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.gIx=r,t.aAFc=o,t.run=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.mAx=r,t.h609=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(397).default{constructor(e){super(e),this.state={v:0,f88:[]},this.e2vz=this.e2vz.bind(this)}e2vz(e){const{v:t}=this.state;this.setState({v:t+1,f88:[...this.state.f88,e]})}get size(){return this.state.f88.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(21);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(259);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(347),o=n(61);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.xia=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(193),o=n(111),i=function(){function e(e,t){this.xh1=e,this.xyJf=t}return e.prototype.get=function(e){return this.xh1[e]},e.prototype.set=function(e,t){return this.xh1[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.xh1).forEach(function(n){e.call(t,t.xh1[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(204),o=n(42);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.q68=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(26).default{constructor(e){super(e),this.state={v:0,oIe:[]},this.jrv5=this.jrv5.bind(this)}jrv5(e){const{v:t}=this.state;this.setState({v:t+1,oIe:[...this.state.oIe,e]})}get size(){return this.state.oIe.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.qfq=r,t.ds15=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(333);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(23);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(256),o=n(214);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.siA=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.mc2=r,t.yjhH=o,t.run=i},function(e,t,n){"use strict";var r=n(277),o=n(367),i=function(){function e(e,t){this.q1f=e,this.r1Hd=t}return e.prototype.get=function(e){return this.q1f[e]},e.prototype.set=function(e,t){return this.q1f[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.q1f).forEach(function(n){e.call(t,t.q1f[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.ufF=r,t.quCz=o,t.run=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(124).default{constructor(e){super(e),this.state={v:0,l7c:[]},this.cGou=this.cGou.bind(this)}cGou(e){const{v:t}=this.state;this.setState({v:t+1,l7c:[...this.state.l7c,e]})}get size(){return this.state.l7c.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(143),o=n(78);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.i56=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(391),o=n(10),i=function(){function e(e,t){this.ll7=e,this.mruo=t}return e.prototype.get=function(e){return this.ll7[e]},e.prototype.set=function(e,t){return this.ll7[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.ll7).forEach(function(n){e.call(t,t.ll7[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(331).default{constructor(e){super(e),this.state={v:0,yFG:[]},this.ya1r=this.ya1r.bind(this)}ya1r(e){const{v:t}=this.state;this.setState({v:t+1,yFG:[...this.state.yFG,e]})}get size(){return this.state.yFG.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.cAD=r,t.owG8=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(294).default{constructor(e){super(e),this.state={v:0,l5t:[]},this.qIwp=this.qIwp.bind(this)}qIwp(e){const{v:t}=this.state;this.setState({v:t+1,l5t:[...this.state.l5t,e]})}get size(){return this.state.l5t.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(60);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(53);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.h1o=r,t.ttt9=o,t.run=i},function(e,t,n){"use strict";var r=n(386),o=n(108);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.o19=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(295);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(162);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(320).default{constructor(e){super(e),this.state={v:0,ve7:[]},this.d2pd=this.d2pd.bind(this)}d2pd(e){const{v:t}=this.state;this.setState({v:t+1,ve7:[...this.state.ve7,e]})}get size(){return this.state.ve7.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(59),o=n(14);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.mCo=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(106),o=n(158),i=function(){function e(e,t){this.bsJ=e,this.z2ra=t}return e.prototype.get=function(e){return this.bsJ[e]},e.prototype.set=function(e,t){return this.bsJ[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.bsJ).forEach(function(n){e.call(t,t.bsJ[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.cqd=r,t.pali=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(65).default{constructor(e){super(e),this.state={v:0,wa0:[]},this.npCF=this.npCF.bind(this)}npCF(e){const{v:t}=this.state;this.setState({v:t+1,wa0:[...this.state.wa0,e]})}get size(){return this.state.wa0.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(306),o=n(321);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.k6I=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(355),o=n(230);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.t0x=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(123),o=n(388),i=function(){function e(e,t){this.cim=e,this.g0z9=t}return e.prototype.get=function(e){return this.cim[e]},e.prototype.set=function(e,t){return this.cim[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.cim).forEach(function(n){e.call(t,t.cim[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(340).default{constructor(e){super(e),this.state={v:0,hjC:[]},this.uq8t=this.uq8t.bind(this)}uq8t(e){const{v:t}=this.state;this.setState({v:t+1,hjC:[...this.state.hjC,e]})}get size(){return this.state.hjC.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(163),o=n(318),i=function(){function e(e,t){this.uq7=e,this.xEEq=t}return e.prototype.get=function(e){return this.uq7[e]},e.prototype.set=function(e,t){return this.uq7[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.uq7).forEach(function(n){e.call(t,t.uq7[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(110).default{constructor(e){super(e),this.state={v:0,y81:[]},this.z1ii=this.z1ii.bind(this)}z1ii(e){const{v:t}=this.state;this.setState({v:t+1,y81:[...this.state.y81,e]})}get size(){return this.state.y81.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(132),o=n(342),i=function(){function e(e,t){this.$v8=e,this.w6vr=t}return e.prototype.get=function(e){return this.$v8[e]},e.prototype.set=function(e,t){return this.$v8[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.$v8).forEach(function(n){e.call(t,t.$v8[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(201);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.sji=r,t.qmoB=o,t.run=i},function(e,t,n){var r=n(268);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(143).default{constructor(e){super(e),this.state={v:0,_em:[]},this.pHca=this.pHca.bind(this)}pHca(e){const{v:t}=this.state;this.setState({v:t+1,_em:[...this.state._em,e]})}get size(){return this.state._em.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.obz=r,t.qqGI=o,t.run=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(307);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.l8n=r,t.v6el=o,t.run=i},function(e,t,n){var r=n(29);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(361);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(359).default{constructor(e){super(e),this.state={v:0,kpD:[]},this.oihb=this.oihb.bind(this)}oihb(e){const{v:t}=this.state;this.setState({v:t+1,kpD:[...this.state.kpD,e]})}get size(){return this.state.kpD.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(334);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(17),o=n(85),i=function(){function e(e,t){this.qo6=e,this.qDdn=t}return e.prototype.get=function(e){return this.qo6[e]},e.prototype.set=function(e,t){return this.qo6[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.qo6).forEach(function(n){e.call(t,t.qo6[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(89);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(399),o=n(301);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.tBz=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(220);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(48);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(297).default{constructor(e){super(e),this.state={v:0,hee:[]},this.sBgn=this.sBgn.bind(this)}sBgn(e){const{v:t}=this.state;this.setState({v:t+1,hee:[...this.state.hee,e]})}get size(){return this.state.hee.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(146).default{constructor(e){super(e),this.state={v:0,lsb:[]},this.mq18=this.mq18.bind(this)}mq18(e){const{v:t}=this.state;this.setState({v:t+1,lsb:[...this.state.lsb,e]})}get size(){return this.state.lsb.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(397);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.buj=r,t.l8hq=o,t.run=i},function(e,t,n){"use strict";var r=n(280),o=n(357),i=function(){function e(e,t){this.fFG=e,this.axjb=t}return e.prototype.get=function(e){return this.fFG[e]},e.prototype.set=function(e,t){return this.fFG[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.fFG).forEach(function(n){e.call(t,t.fFG[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(331);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(340),o=n(30);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.zIl=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(260),o=n(36);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ma6=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(300);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(165),o=n(188);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.sDq=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(132),o=n(12),i=function(){function e(e,t){this._lr=e,this.vxGw=t}return e.prototype.get=function(e){return this._lr[e]},e.prototype.set=function(e,t){return this._lr[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this._lr).forEach(function(n){e.call(t,t._lr[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.k7E=r,t.pfJo=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(246).default{constructor(e){super(e),this.state={v:0,tBz:[]},this.rsl6=this.rsl6.bind(this)}rsl6(e){const{v:t}=this.state;this.setState({v:t+1,tBz:[...this.state.tBz,e]})}get size(){return this.state.tBz.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(327);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(59);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(222),o=n(8),i=function(){function e(e,t){this._Jk=e,this._Cyw=t}return e.prototype.get=function(e){return this._Jk[e]},e.prototype.set=function(e,t){return this._Jk[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this._Jk).forEach(function(n){e.call(t,t._Jk[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.nup=r,t.qEIa=o,t.run=i},function(e,t,n){"use strict";var r=n(277),o=n(281),i=function(){function e(e,t){this.enz=e,this.po9s=t}return e.prototype.get=function(e){return this.enz[e]},e.prototype.set=function(e,t){return this.enz[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.enz).forEach(function(n){e.call(t,t.enz[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(103);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(302);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(219);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(281);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(52),o=n(243);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.dDd=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(368),o=n(323);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ei4=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.aqb=r,t.n5tz=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(352).default{constructor(e){super(e),this.state={v:0,$ox:[]},this._0qw=this._0qw.bind(this)}_0qw(e){const{v:t}=this.state;this.setState({v:t+1,$ox:[...this.state.$ox,e]})}get size(){return this.state.$ox.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(353);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(302).default{constructor(e){super(e),this.state={v:0,evq:[]},this.xqhs=this.xqhs.bind(this)}xqhs(e){const{v:t}=this.state;this.setState({v:t+1,evq:[...this.state.evq,e]})}get size(){return this.state.evq.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(239),o=n(27);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.s53=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(268);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(112).default{constructor(e){super(e),this.state={v:0,hw0:[]},this.mJ9r=this.mJ9r.bind(this)}mJ9r(e){const{v:t}=this.state;this.setState({v:t+1,hw0:[...this.state.hw0,e]})}get size(){return this.state.hw0.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(230),o=n(161),i=function(){function e(e,t){this.zuH=e,this.shjJ=t}return e.prototype.get=function(e){return this.zuH[e]},e.prototype.set=function(e,t){return this.zuH[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.zuH).forEach(function(n){e.call(t,t.zuH[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(145),o=n(116);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.w4c=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(227),o=n(325);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.pau=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(384);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(239),o=n(20);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.as4=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(392),o=n(63);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.wx5=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(128),o=n(21);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ozc=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(9);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(149);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(370),o=n(266),i=function(){function e(e,t){this.e4J=e,this.baxA=t}return e.prototype.get=function(e){return this.e4J[e]},e.prototype.set=function(e,t){return this.e4J[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.e4J).forEach(function(n){e.call(t,t.e4J[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(59),o=n(218);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.wFk=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(49).default{constructor(e){super(e),this.state={v:0,z5D:[]},this.xsGf=this.xsGf.bind(this)}xsGf(e){const{v:t}=this.state;this.setState({v:t+1,z5D:[...this.state.z5D,e]})}get size(){return this.state.z5D.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(302);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(251).default{constructor(e){super(e),this.state={v:0,kpl:[]},this.ci02=this.ci02.bind(this)}ci02(e){const{v:t}=this.state;this.setState({v:t+1,kpl:[...this.state.kpl,e]})}get size(){return this.state.kpl.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(10);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(321).default{constructor(e){super(e),this.state={v:0,d8w:[]},this.jbA9=this.jbA9.bind(this)}jbA9(e){const{v:t}=this.state;this.setState({v:t+1,d8w:[...this.state.d8w,e]})}get size(){return this.state.d8w.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(303);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(299);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(119);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(362).default{constructor(e){super(e),this.state={v:0,gpi:[]},this.lb7r=this.lb7r.bind(this)}lb7r(e){const{v:t}=this.state;this.setState({v:t+1,gpi:[...this.state.gpi,e]})}get size(){return this.state.gpi.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(21),o=n(214),i=function(){function e(e,t){this.mtz=e,this.$Arf=t}return e.prototype.get=function(e){return this.mtz[e]},e.prototype.set=function(e,t){return this.mtz[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.mtz).forEach(function(n){e.call(t,t.mtz[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(15);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(30),o=n(150),i=function(){function e(e,t){this.w62=e,this.lrkC=t}return e.prototype.get=function(e){return this.w62[e]},e.prototype.set=function(e,t){return this.w62[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.w62).forEach(function(n){e.call(t,t.w62[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(64);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(111),o=n(373);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.x4g=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(255);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(270);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(169).default{constructor(e){super(e),this.state={v:0,jJn:[]},this.s6fh=this.s6fh.bind(this)}s6fh(e){const{v:t}=this.state;this.setState({v:t+1,jJn:[...this.state.jJn,e]})}get size(){return this.state.jJn.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(75),o=n(205),i=function(){function e(e,t){this.dAA=e,this.rBIF=t}return e.prototype.get=function(e){return this.dAA[e]},e.prototype.set=function(e,t){return this.dAA[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.dAA).forEach(function(n){e.call(t,t.dAA[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(300),o=n(52),i=function(){function e(e,t){this.w1i=e,this.r4Cu=t}return e.prototype.get=function(e){return this.w1i[e]},e.prototype.set=function(e,t){return this.w1i[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.w1i).forEach(function(n){e.call(t,t.w1i[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(58),o=n(47),i=function(){function e(e,t){this.o3H=e,this.xE5m=t}return e.prototype.get=function(e){return this.o3H[e]},e.prototype.set=function(e,t){return this.o3H[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.o3H).forEach(function(n){e.call(t,t.o3H[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(275),o=n(333);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.yse=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.uHe=r,t.wAqI=o,t.run=i},function(e,t,n){var r=n(76);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(149);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(253),o=n(174);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.vuH=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(85).default{constructor(e){super(e),this.state={v:0,bIe:[]},this.iHsf=this.iHsf.bind(this)}iHsf(e){const{v:t}=this.state;this.setState({v:t+1,bIe:[...this.state.bIe,e]})}get size(){return this.state.bIe.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(2);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(208);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(18),o=n(131);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.dDq=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(188),o=n(196),i=function(){function e(e,t){this.ni4=e,this.pAks=t}return e.prototype.get=function(e){return this.ni4[e]},e.prototype.set=function(e,t){return this.ni4[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.ni4).forEach(function(n){e.call(t,t.ni4[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(175),o=n(166),i=function(){function e(e,t){this.zF9=e,this.zFEc=t}return e.prototype.get=function(e){return this.zF9[e]},e.prototype.set=function(e,t){return this.zF9[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.zF9).forEach(function(n){e.call(t,t.zF9[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(57),o=n(378),i=function(){function e(e,t){this.jAl=e,this.uuew=t}return e.prototype.get=function(e){return this.jAl[e]},e.prototype.set=function(e,t){return this.jAl[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.jAl).forEach(function(n){e.call(t,t.jAl[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(174).default{constructor(e){super(e),this.state={v:0,lCx:[]},this.xyxx=this.xyxx.bind(this)}xyxx(e){const{v:t}=this.state;this.setState({v:t+1,lCx:[...this.state.lCx,e]})}get size(){return this.state.lCx.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.vug=r,t.tleF=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(53).default{constructor(e){super(e),this.state={v:0,gB1:[]},this.nctn=this.nctn.bind(this)}nctn(e){const{v:t}=this.state;this.setState({v:t+1,gB1:[...this.state.gB1,e]})}get size(){return this.state.gB1.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(199),o=n(306),i=function(){function e(e,t){this.fzb=e,this.jshs=t}return e.prototype.get=function(e){return this.fzb[e]},e.prototype.set=function(e,t){return this.fzb[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.fzb).forEach(function(n){e.call(t,t.fzb[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.kuh=r,t.em17=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.uDq=r,t.ijou=o,t.run=i},function(e,t,n){"use strict";var r=n(161),o=n(252),i=function(){function e(e,t){this.k6h=e,this.d4tI=t}return e.prototype.get=function(e){return this.k6h[e]},e.prototype.set=function(e,t){return this.k6h[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.k6h).forEach(function(n){e.call(t,t.k6h[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(128);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.avB=r,t.pdyk=o,t.run=i},function(e,t,n){"use strict";var r=n(94),o=n(289),i=function(){function e(e,t){this.iut=e,this.hEaB=t}return e.prototype.get=function(e){return this.iut[e]},e.prototype.set=function(e,t){return this.iut[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.iut).forEach(function(n){e.call(t,t.iut[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(8);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(355);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(236),o=n(191),i=function(){function e(e,t){this.zlf=e,this.qhdr=t}return e.prototype.get=function(e){return this.zlf[e]},e.prototype.set=function(e,t){return this.zlf[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.zlf).forEach(function(n){e.call(t,t.zlf[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(362),o=n(396),i=function(){function e(e,t){this.vaj=e,this.uH1y=t}return e.prototype.get=function(e){return this.vaj[e]},e.prototype.set=function(e,t){return this.vaj[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.vaj).forEach(function(n){e.call(t,t.vaj[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(97),o=n(169),i=function(){function e(e,t){this.u2I=e,this.u0b6=t}return e.prototype.get=function(e){return this.u2I[e]},e.prototype.set=function(e,t){return this.u2I[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.u2I).forEach(function(n){e.call(t,t.u2I[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.j3h=r,t.xjms=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(191).default{constructor(e){super(e),this.state={v:0,q4H:[]},this.kI9y=this.kI9y.bind(this)}kI9y(e){const{v:t}=this.state;this.setState({v:t+1,q4H:[...this.state.q4H,e]})}get size(){return this.state.q4H.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(264);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(96),o=n(33),i=function(){function e(e,t){this.o94=e,this.di6c=t}return e.prototype.get=function(e){return this.o94[e]},e.prototype.set=function(e,t){return this.o94[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.o94).forEach(function(n){e.call(t,t.o94[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(217),o=n(293);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.daB=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(375);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(13);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(1).default{constructor(e){super(e),this.state={v:0,m6F:[]},this.tff1=this.tff1.bind(this)}tff1(e){const{v:t}=this.state;this.setState({v:t+1,m6F:[...this.state.m6F,e]})}get size(){return this.state.m6F.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(98);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(263),o=n(37);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.$Bz=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.fex=r,t.xA1x=o,t.run=i},function(e,t,n){var r=n(247);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(172),o=n(264);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.gy1=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(302),o=n(214);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.zpC=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(372).default{constructor(e){super(e),this.state={v:0,aD8:[]},this.sDdv=this.sDdv.bind(this)}sDdv(e){const{v:t}=this.state;this.setState({v:t+1,aD8:[...this.state.aD8,e]})}get size(){return this.state.aD8.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(280);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(273).default{constructor(e){super(e),this.state={v:0,ime:[]},this.zAFG=this.zAFG.bind(this)}zAFG(e){const{v:t}=this.state;this.setState({v:t+1,ime:[...this.state.ime,e]})}get size(){return this.state.ime.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(349),o=n(120);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ync=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.pty=r,t.zqJm=o,t.run=i},function(e,t,n){var r=n(294);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(253);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(306);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(270).default{constructor(e){super(e),this.state={v:0,uoo:[]},this.dfup=this.dfup.bind(this)}dfup(e){const{v:t}=this.state;this.setState({v:t+1,uoo:[...this.state.uoo,e]})}get size(){return this.state.uoo.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(203),o=n(33),i=function(){function e(e,t){this.goi=e,this.psf4=t}return e.prototype.get=function(e){return this.goi[e]},e.prototype.set=function(e,t){return this.goi[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.goi).forEach(function(n){e.call(t,t.goi[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.ptB=r,t.ssA0=o,t.run=i},function(e,t,n){var r=n(97);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(195);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.m7C=r,t.vr9a=o,t.run=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(39);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(52),o=n(123),i=function(){function e(e,t){this.sey=e,this.rFxB=t}return e.prototype.get=function(e){return this.sey[e]},e.prototype.set=function(e,t){return this.sey[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.sey).forEach(function(n){e.call(t,t.sey[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(4),o=n(363);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.hiB=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(97);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(373);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(131),o=n(208),i=function(){function e(e,t){this._we=e,this.iF5o=t}return e.prototype.get=function(e){return this._we[e]},e.prototype.set=function(e,t){return this._we[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this._we).forEach(function(n){e.call(t,t._we[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(90);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(172).default{constructor(e){super(e),this.state={v:0,aG2:[]},this.fnA7=this.fnA7.bind(this)}fnA7(e){const{v:t}=this.state;this.setState({v:t+1,aG2:[...this.state.aG2,e]})}get size(){return this.state.aG2.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(333),o=n(77),i=function(){function e(e,t){this.zIc=e,this.iamc=t}return e.prototype.get=function(e){return this.zIc[e]},e.prototype.set=function(e,t){return this.zIc[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.zIc).forEach(function(n){e.call(t,t.zIc[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.yCz=r,t.hz9e=o,t.run=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(10),o=n(284);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.hrl=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(143),o=n(276);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.lJn=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.tsy=r,t.sms3=o,t.run=i},function(e,t,n){"use strict";var r=n(33),o=n(270);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.$Cu=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(33);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(299).default{constructor(e){super(e),this.state={v:0,ukh:[]},this.hCxp=this.hCxp.bind(this)}hCxp(e){const{v:t}=this.state;this.setState({v:t+1,ukh:[...this.state.ukh,e]})}get size(){return this.state.ukh.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.gsH=r,t.fBwl=o,t.run=i},function(e,t,n){"use strict";var r=n(312),o=n(162),i=function(){function e(e,t){this.c9t=e,this.vF9n=t}return e.prototype.get=function(e){return this.c9t[e]},e.prototype.set=function(e,t){return this.c9t[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.c9t).forEach(function(n){e.call(t,t.c9t[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.ptm=r,t.mocG=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(228).default{constructor(e){super(e),this.state={v:0,llk:[]},this.yiew=this.yiew.bind(this)}yiew(e){const{v:t}=this.state;this.setState({v:t+1,llk:[...this.state.llk,e]})}get size(){return this.state.llk.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.xcq=r,t.uluE=o,t.run=i},function(e,t,n){var r=n(133);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(320);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(153);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(259).default{constructor(e){super(e),this.state={v:0,cyh:[]},this.hjej=this.hjej.bind(this)}hjej(e){const{v:t}=this.state;this.setState({v:t+1,cyh:[...this.state.cyh,e]})}get size(){return this.state.cyh.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(32);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(176);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(26),o=n(63),i=function(){function e(e,t){this.bvw=e,this.gIhl=t}return e.prototype.get=function(e){return this.bvw[e]},e.prototype.set=function(e,t){return this.bvw[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.bvw).forEach(function(n){e.call(t,t.bvw[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(253);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(270),o=n(69),i=function(){function e(e,t){this.eA4=e,this.gJIB=t}return e.prototype.get=function(e){return this.eA4[e]},e.prototype.set=function(e,t){return this.eA4[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.eA4).forEach(function(n){e.call(t,t.eA4[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t._iB=r,t.$jdp=o,t.run=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.fzC=r,t.m1BG=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(301),o=n(359);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.vwc=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(210);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(207),o=n(192);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ubH=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(159),o=n(169),i=function(){function e(e,t){this.$ec=e,this.k74t=t}return e.prototype.get=function(e){return this.$ec[e]},e.prototype.set=function(e,t){return this.$ec[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.$ec).forEach(function(n){e.call(t,t.$ec[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(207),o=n(47),i=function(){function e(e,t){this.cqe=e,this.tkI1=t}return e.prototype.get=function(e){return this.cqe[e]},e.prototype.set=function(e,t){return this.cqe[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.cqe).forEach(function(n){e.call(t,t.cqe[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(375);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(252),o=n(251),i=function(){function e(e,t){this.yoH=e,this.r4np=t}return e.prototype.get=function(e){return this.yoH[e]},e.prototype.set=function(e,t){return this.yoH[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.yoH).forEach(function(n){e.call(t,t.yoH[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(323),o=n(268);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.p3C=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(251).default{constructor(e){super(e),this.state={v:0,_fx:[]},this.uA5e=this.uA5e.bind(this)}uA5e(e){const{v:t}=this.state;this.setState({v:t+1,_fx:[...this.state._fx,e]})}get size(){return this.state._fx.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.bBk=r,t.ekAJ=o,t.run=i},function(e,t,n){"use strict";var r=n(208),o=n(288);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.kJH=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.jJr=r,t.pq3e=o,t.run=i},function(e,t,n){"use strict";var r=n(57),o=n(188);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.wkv=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(18);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(290),o=n(136);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.kgl=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(206);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(294);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(170),o=n(250),i=function(){function e(e,t){this.$aj=e,this.tqdo=t}return e.prototype.get=function(e){return this.$aj[e]},e.prototype.set=function(e,t){return this.$aj[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.$aj).forEach(function(n){e.call(t,t.$aj[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(391);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(253),o=n(173);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.gIh=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(230);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(345);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(251).default{constructor(e){super(e),this.state={v:0,hyo:[]},this.lH56=this.lH56.bind(this)}lH56(e){const{v:t}=this.state;this.setState({v:t+1,hyo:[...this.state.hyo,e]})}get size(){return this.state.hyo.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(100),o=n(378);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.qja=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.f6n=r,t.ltm7=o,t.run=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(396),o=n(167);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.jIE=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.pE2=r,t.rayf=o,t.run=i},function(e,t,n){var r=n(220);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(296);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(360);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(185);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(385);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(96),o=n(101),i=function(){function e(e,t){this.zEA=e,this.hFz7=t}return e.prototype.get=function(e){return this.zEA[e]},e.prototype.set=function(e,t){return this.zEA[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.zEA).forEach(function(n){e.call(t,t.zEA[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.nfu=r,t.seFn=o,t.run=i},function(e,t,n){var r=n(221);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(344);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(0),o=n(99);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ofJ=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(21);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.nkF=r,t.lsAa=o,t.run=i},function(e,t,n){"use strict";var r=n(0),o=n(256),i=function(){function e(e,t){this.pID=e,this.f8zz=t}return e.prototype.get=function(e){return this.pID[e]},e.prototype.set=function(e,t){return this.pID[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.pID).forEach(function(n){e.call(t,t.pID[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(59),o=n(264),i=function(){function e(e,t){this.dgf=e,this.seax=t}return e.prototype.get=function(e){return this.dgf[e]},e.prototype.set=function(e,t){return this.dgf[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.dgf).forEach(function(n){e.call(t,t.dgf[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(344);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(32);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=n(270);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(174),o=n(19);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.hek=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(231),o=n(320);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.cl1=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(203),o=n(104),i=function(){function e(e,t){this.ohw=e,this.iAus=t}return e.prototype.get=function(e){return this.ohw[e]},e.prototype.set=function(e,t){return this.ohw[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.ohw).forEach(function(n){e.call(t,t.ohw[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(87);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(222),o=n(87);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.zdJ=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(183).default{constructor(e){super(e),this.state={v:0,xkv:[]},this.aabm=this.aabm.bind(this)}aabm(e){const{v:t}=this.state;this.setState({v:t+1,xkv:[...this.state.xkv,e]})}get size(){return this.state.xkv.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(141).default{constructor(e){super(e),this.state={v:0,lGs:[]},this.xc8v=this.xc8v.bind(this)}xc8v(e){const{v:t}=this.state;this.setState({v:t+1,lGs:[...this.state.lGs,e]})}get size(){return this.state.lGs.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(268);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(116).default{constructor(e){super(e),this.state={v:0,nd2:[]},this.waIe=this.waIe.bind(this)}waIe(e){const{v:t}=this.state;this.setState({v:t+1,nd2:[...this.state.nd2,e]})}get size(){return this.state.nd2.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.lrE=r,t.bpuw=o,t.run=i},function(e,t,n){"use strict";var r=n(276),o=n(265),i=function(){function e(e,t){this.f4j=e,this.gJIm=t}return e.prototype.get=function(e){return this.f4j[e]},e.prototype.set=function(e,t){return this.f4j[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.f4j).forEach(function(n){e.call(t,t.f4j[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(340),o=n(204);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.t8C=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(164).default{constructor(e){super(e),this.state={v:0,pd9:[]},this.zxam=this.zxam.bind(this)}zxam(e){const{v:t}=this.state;this.setState({v:t+1,pd9:[...this.state.pd9,e]})}get size(){return this.state.pd9.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(194),o=n(109),i=function(){function e(e,t){this.nnf=e,this.$kmw=t}return e.prototype.get=function(e){return this.nnf[e]},e.prototype.set=function(e,t){return this.nnf[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.nnf).forEach(function(n){e.call(t,t.nnf[n],n)})},e}();t.Store=i},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(181),o=n(168),i=function(){function e(e,t){this.qxI=e,this.t2ib=t}return e.prototype.get=function(e){return this.qxI[e]},e.prototype.set=function(e,t){return this.qxI[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.qxI).forEach(function(n){e.call(t,t.qxI[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.oCc=r,t.ls6g=o,t.run=i},function(e,t,n){"use strict";var r=n(147),o=n(249);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.s2t=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(220);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(79),o=n(301),i=function(){function e(e,t){this.ita=e,this.jrme=t}return e.prototype.get=function(e){return this.ita[e]},e.prototype.set=function(e,t){return this.ita[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.ita).forEach(function(n){e.call(t,t.ita[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(238);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(349).default{constructor(e){super(e),this.state={v:0,uBk:[]},this.wr7y=this.wr7y.bind(this)}wr7y(e){const{v:t}=this.state;this.setState({v:t+1,uBk:[...this.state.uBk,e]})}get size(){return this.state.uBk.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(367),o=n(388),i=function(){function e(e,t){this.zuD=e,this.mdrA=t}return e.prototype.get=function(e){return this.zuD[e]},e.prototype.set=function(e,t){return this.zuD[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.zuD).forEach(function(n){e.call(t,t.zuD[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(225);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(27),o=n(374),i=function(){function e(e,t){this.etj=e,this.cksj=t}return e.prototype.get=function(e){return this.etj[e]},e.prototype.set=function(e,t){return this.etj[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.etj).forEach(function(n){e.call(t,t.etj[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(307);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=n(342);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(14).default{constructor(e){super(e),this.state={v:0,rgm:[]},this.v4p1=this.v4p1.bind(this)}v4p1(e){const{v:t}=this.state;this.setState({v:t+1,rgm:[...this.state.rgm,e]})}get size(){return this.state.rgm.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(233).default{constructor(e){super(e),this.state={v:0,lf4:[]},this.oz80=this.oz80.bind(this)}oz80(e){const{v:t}=this.state;this.setState({v:t+1,lf4:[...this.state.lf4,e]})}get size(){return this.state.lf4.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(240),o=n(18),i=function(){function e(e,t){this.btp=e,this.occa=t}return e.prototype.get=function(e){return this.btp[e]},e.prototype.set=function(e,t){return this.btp[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.btp).forEach(function(n){e.call(t,t.btp[n],n)})},e}();t.Store=i},function(e,t,n){var r=n(261);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r=n(395);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(113),o=n(335);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ylf=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.yAG=r,t.e0G0=o,t.run=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.tcf=r,t.koJD=o,t.run=i},function(e,t,n){var r=n(126);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(116),o=n(51),i=function(){function e(e,t){this.bty=e,this.pI9m=t}return e.prototype.get=function(e){return this.bty[e]},e.prototype.set=function(e,t){return this.bty[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.bty).forEach(function(n){e.call(t,t.bty[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(70),o=n(31);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.m6E=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(163).default{constructor(e){super(e),this.state={v:0,x56:[]},this.u9nn=this.u9nn.bind(this)}u9nn(e){const{v:t}=this.state;this.setState({v:t+1,x56:[...this.state.x56,e]})}get size(){return this.state.x56.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(363),o=n(293),i=function(){function e(e,t){this.o3c=e,this.boDi=t}return e.prototype.get=function(e){return this.o3c[e]},e.prototype.set=function(e,t){return this.o3c[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.o3c).forEach(function(n){e.call(t,t.o3c[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(351),o=n(75);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.fg0=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(98),o=n(43);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.h60=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(136);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(346);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(24),o=n(361);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.y33=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(265).default{constructor(e){super(e),this.state={v:0,wJC:[]},this.vG6G=this.vG6G.bind(this)}vG6G(e){const{v:t}=this.state;this.setState({v:t+1,wJC:[...this.state.wJC,e]})}get size(){return this.state.wJC.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(233);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";var r=n(34),o=n(86);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.vjd=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=n(129);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(90),o=n(341),i=function(){function e(e,t){this.ktv=e,this.a3te=t}return e.prototype.get=function(e){return this.ktv[e]},e.prototype.set=function(e,t){return this.ktv[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.ktv).forEach(function(n){e.call(t,t.ktv[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r=n(56);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.o2D=r,t.zrs2=o,t.run=i},function(e,t,n){var r=n(184);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=n(88),o=n(108),i=function(){function e(e,t){this.td7=e,this.nqyG=t}return e.prototype.get=function(e){return this.td7[e]},e.prototype.set=function(e,t){return this.td7[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.td7).forEach(function(n){e.call(t,t.td7[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(59).default{constructor(e){super(e),this.state={v:0,gCI:[]},this.ay1I=this.ay1I.bind(this)}ay1I(e){const{v:t}=this.state;this.setState({v:t+1,gCI:[...this.state.gCI,e]})}get size(){return this.state.gCI.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.nhr=r,t.y19x=o,t.run=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(309),o=n(371),i=function(){function e(e,t){this.tqq=e,this.mbbt=t}return e.prototype.get=function(e){return this.tqq[e]},e.prototype.set=function(e,t){return this.tqq[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.tqq).forEach(function(n){e.call(t,t.tqq[n],n)})},e}();t.Store=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";var r=n(265),o=n(320),i=function(){function e(e,t){this.srE=e,this.hdDy=t}return e.prototype.get=function(e){return this.srE[e]},e.prototype.set=function(e,t){return this.srE[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.srE).forEach(function(n){e.call(t,t.srE[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.shp=r,t.m5xE=o,t.run=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(203),o=n(68),i=function(){function e(e,t){this.rAx=e,this._mB8=t}return e.prototype.get=function(e){return this.rAx[e]},e.prototype.set=function(e,t){return this.rAx[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.rAx).forEach(function(n){e.call(t,t.rAx[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.rib=r,t.wwwI=o,t.run=i},function(e,t,n){"use strict";var r=n(222),o=n(381);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ivG=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=n(230);r.on("load",function(){document.querySelectorAll(".x").forEach(function(e){e.addEventListener("click",function(t){t.preventDefault(),e.classList.toggle("on")},{passive:!1})})}),e.exports=r},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.rCe=r,t.nfEy=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(385).default{constructor(e){super(e),this.state={v:0,bJH:[]},this._lr7=this._lr7.bind(this)}_lr7(e){const{v:t}=this.state;this.setState({v:t+1,bJH:[...this.state.bJH,e]})}get size(){return this.state.bJH.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=n(165);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.k7g=r,t.mFh7=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(354).default{constructor(e){super(e),this.state={v:0,$ql:[]},this.jdC1=this.jdC1.bind(this)}jdC1(e){const{v:t}=this.state;this.setState({v:t+1,$ql:[...this.state.$ql,e]})}get size(){return this.state.$ql.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";var r=n(382),o=n(26),i=function(){function e(e,t){this.npi=e,this.mjgg=t}return e.prototype.get=function(e){return this.npi[e]},e.prototype.set=function(e,t){return this.npi[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.npi).forEach(function(n){e.call(t,t.npi[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.rm3=r,t.jtqe=o,t.run=i},function(e,t,n){e.exports=function*(e){for(let t=0;t<e.length;t++){if(e[t]==null)continue;yield e[t]}l:for(var n=0;n<3;n++)for(var r=0;r<3;r++){if(r>n)continue l;if(n===2)break l}}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.ntd=r,t.ipa3=o,t.run=i},function(e,t,n){"use strict";var r=n(108),o=n(378),i=function(){function e(e,t){this.raH=e,this.g3nF=t}return e.prototype.get=function(e){return this.raH[e]},e.prototype.set=function(e,t){return this.raH[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.raH).forEach(function(n){e.call(t,t.raH[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(164).default{constructor(e){super(e),this.state={v:0,o4J:[]},this.u8az=this.u8az.bind(this)}u8az(e){const{v:t}=this.state;this.setState({v:t+1,o4J:[...this.state.o4J,e]})}get size(){return this.state.o4J.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(318),o=n(190);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.ytg=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(28),o=n(154);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.$bg=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.xHh=r,t.z4CF=o,t.run=i},function(e,t,n){"use strict";var r=n(71),o=n(90);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.tho=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.at3=r,t.vHFw=o,t.run=i},function(e,t,n){"use strict";Object.defineProperty(t,"__esModule",{value:!0});class r extends n(96).default{constructor(e){super(e),this.state={v:0,a1G:[]},this._mEg=this._mEg.bind(this)}_mEg(e){const{v:t}=this.state;this.setState({v:t+1,a1G:[...this.state.a1G,e]})}get size(){return this.state.a1G.length}static of(...e){return new r(e)}}t.default=r},function(e,t,n){"use strict";var r=n(342),o=n(130),i=function(){function e(e,t){this.hDl=e,this.y1Ch=t}return e.prototype.get=function(e){return this.hDl[e]},e.prototype.set=function(e,t){return this.hDl[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.hDl).forEach(function(n){e.call(t,t.hDl[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(176),o=n(83);function i(e){return e&&e.__esModule?e:{default:e}}t.default=function(e,t){for(var n=0,r=e.length;n<r;n++)if(t(e[n],n))return n;return-1},t.dAE=function(e){var t=e/2,n=/[a-z]+\//gi;return n.test(e)?t:e/t/2}},function(e,t,n){"use strict";var r=n(170),o=n(110),i=function(){function e(e,t){this.nCA=e,this.d40w=t}return e.prototype.get=function(e){return this.nCA[e]},e.prototype.set=function(e,t){return this.nCA[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.nCA).forEach(function(n){e.call(t,t.nCA[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";var r=n(34),o=n(160),i=function(){function e(e,t){this.ktz=e,this.nGuF=t}return e.prototype.get=function(e){return this.ktz[e]},e.prototype.set=function(e,t){return this.ktz[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.ktz).forEach(function(n){e.call(t,t.ktz[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.t78=r,t._dlA=o,t.run=i},function(e,t,n){var r=n(196);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){"use strict";var r=n(220),o=n(270),i=function(){function e(e,t){this.qsi=e,this.tq8F=t}return e.prototype.get=function(e){return this.qsi[e]},e.prototype.set=function(e,t){return this.qsi[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.qsi).forEach(function(n){e.call(t,t.qsi[n],n)})},e}();t.Store=i},function(e,t,n){"use strict";const r=(e,t=1)=>e*t,o=e=>({x:e.x|0,y:e.y>>>0}),i=async function(e){try{const t=await e();return t?.value??null}catch(e){return r(e.code,2)}};t.vj0=r,t.ak47=o,t.run=i},function(e,t,n){"use strict";var r=n(160),o=n(178),i=function(){function e(e,t){this.$zj=e,this.bIwz=t}return e.prototype.get=function(e){return this.$zj[e]},e.prototype.set=function(e,t){return this.$zj[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.$zj).forEach(function(n){e.call(t,t.$zj[n],n)})},e}();t.Store=i},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r=Object.prototype.hasOwnProperty,o=Array.isArray;e.exports=function(e){var t=[];for(var n in e)r.call(e,n)&&t.push(o(e[n])?e[n].slice():e[n]);return t.length?t:void 0}},function(e,t,n){var r={a:1,b:2,"c-d":3,0:4,[`k${1+2}`]:5};function o(e){switch(typeof e){case"number":return e%2?"odd":"even";case"string":return e.replace(/\s+/g," ").trim();default:return String(e)}}e.exports={map:r,fmt:o,re:/^(?:[a-z0-9!#$%&'*+/=?^_`{|}~-]+)@/i}},function(e,t,n){var r=n(108);e.exports=function(e,t){return t=t||{},new Promise(function(n,o){var i=new XMLHttpRequest;i.open(t.method||"GET",e,!0),i.onload=function(){i.status>=200&&i.status<300?n(i.responseText):o(Error(i.statusText))},i.onerror=o,i.send(t.body||null)})}},function(e,t,n){"use strict";var r=function(e){return e<2?e:r(e-1)+r(e-2)},o=`<div class="${"a"}">${r(5)}</div>`,i=a=>b=>c=>a+b+c;t.default={fib:r,html:o,curry:i,neg:-1/3,hex:0xff,exp:1e-7,big:10n}},function(e,t,n){"use strict";var r=n(49),o=n(374),i=function(){function e(e,t){this.fy2=e,this.tigo=t}return e.prototype.get=function(e){return this.fy2[e]},e.prototype.set=function(e,t){return this.fy2[e]=t,this},e.prototype.each=function(e){var t=this;Object.keys(this.fy2).forEach(function(n){e.call(t,t.fy2[n],n)})},e}();t.Store=i}]);
@@ -0,0 +1,3401 @@
+/* js.c benchmark corpus: hand-written modern source with comments */
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS0
+ */
+export class Emitter0 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS0, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "0.0"; }
+}
+
+const DEFAULTS0 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll0(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk0(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk0(child, depth + 1);
+}
+
+export const format0 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio0(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter0.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio0(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS1
+ */
+export class Emitter1 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS1, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "1.0"; }
+}
+
+const DEFAULTS1 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll1(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk1(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk1(child, depth + 1);
+}
+
+export const format1 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio1(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter1.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio1(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS2
+ */
+export class Emitter2 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS2, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "2.0"; }
+}
+
+const DEFAULTS2 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll2(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk2(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk2(child, depth + 1);
+}
+
+export const format2 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio2(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter2.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio2(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS3
+ */
+export class Emitter3 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS3, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "3.0"; }
+}
+
+const DEFAULTS3 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll3(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk3(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk3(child, depth + 1);
+}
+
+export const format3 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio3(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter3.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio3(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS4
+ */
+export class Emitter4 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS4, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "4.0"; }
+}
+
+const DEFAULTS4 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll4(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk4(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk4(child, depth + 1);
+}
+
+export const format4 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio4(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter4.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio4(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS5
+ */
+export class Emitter5 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS5, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "5.0"; }
+}
+
+const DEFAULTS5 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll5(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk5(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk5(child, depth + 1);
+}
+
+export const format5 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio5(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter5.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio5(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS6
+ */
+export class Emitter6 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS6, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "6.0"; }
+}
+
+const DEFAULTS6 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll6(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk6(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk6(child, depth + 1);
+}
+
+export const format6 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio6(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter6.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio6(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS7
+ */
+export class Emitter7 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS7, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "7.0"; }
+}
+
+const DEFAULTS7 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll7(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk7(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk7(child, depth + 1);
+}
+
+export const format7 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio7(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter7.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio7(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS8
+ */
+export class Emitter8 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS8, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "8.0"; }
+}
+
+const DEFAULTS8 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll8(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk8(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk8(child, depth + 1);
+}
+
+export const format8 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio8(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter8.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio8(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS9
+ */
+export class Emitter9 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS9, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "9.0"; }
+}
+
+const DEFAULTS9 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll9(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk9(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk9(child, depth + 1);
+}
+
+export const format9 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio9(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter9.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio9(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS10
+ */
+export class Emitter10 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS10, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "10.0"; }
+}
+
+const DEFAULTS10 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll10(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk10(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk10(child, depth + 1);
+}
+
+export const format10 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio10(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter10.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio10(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS11
+ */
+export class Emitter11 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS11, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "11.0"; }
+}
+
+const DEFAULTS11 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll11(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk11(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk11(child, depth + 1);
+}
+
+export const format11 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio11(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter11.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio11(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS12
+ */
+export class Emitter12 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS12, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "12.0"; }
+}
+
+const DEFAULTS12 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll12(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk12(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk12(child, depth + 1);
+}
+
+export const format12 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio12(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter12.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio12(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS13
+ */
+export class Emitter13 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS13, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "13.0"; }
+}
+
+const DEFAULTS13 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll13(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk13(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk13(child, depth + 1);
+}
+
+export const format13 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio13(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter13.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio13(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS14
+ */
+export class Emitter14 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS14, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "14.0"; }
+}
+
+const DEFAULTS14 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll14(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk14(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk14(child, depth + 1);
+}
+
+export const format14 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio14(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter14.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio14(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS15
+ */
+export class Emitter15 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS15, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "15.0"; }
+}
+
+const DEFAULTS15 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll15(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk15(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk15(child, depth + 1);
+}
+
+export const format15 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio15(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter15.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio15(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS16
+ */
+export class Emitter16 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS16, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "16.0"; }
+}
+
+const DEFAULTS16 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll16(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk16(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk16(child, depth + 1);
+}
+
+export const format16 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio16(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter16.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio16(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS17
+ */
+export class Emitter17 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS17, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "17.0"; }
+}
+
+const DEFAULTS17 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll17(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk17(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk17(child, depth + 1);
+}
+
+export const format17 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio17(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter17.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio17(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS18
+ */
+export class Emitter18 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS18, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "18.0"; }
+}
+
+const DEFAULTS18 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll18(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk18(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk18(child, depth + 1);
+}
+
+export const format18 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio18(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter18.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio18(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS19
+ */
+export class Emitter19 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS19, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "19.0"; }
+}
+
+const DEFAULTS19 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll19(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk19(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk19(child, depth + 1);
+}
+
+export const format19 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio19(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter19.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio19(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS20
+ */
+export class Emitter20 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS20, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "20.0"; }
+}
+
+const DEFAULTS20 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll20(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk20(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk20(child, depth + 1);
+}
+
+export const format20 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio20(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter20.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio20(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS21
+ */
+export class Emitter21 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS21, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "21.0"; }
+}
+
+const DEFAULTS21 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll21(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk21(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk21(child, depth + 1);
+}
+
+export const format21 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio21(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter21.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio21(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS22
+ */
+export class Emitter22 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS22, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "22.0"; }
+}
+
+const DEFAULTS22 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll22(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk22(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk22(child, depth + 1);
+}
+
+export const format22 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio22(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter22.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio22(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS23
+ */
+export class Emitter23 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS23, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "23.0"; }
+}
+
+const DEFAULTS23 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll23(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk23(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk23(child, depth + 1);
+}
+
+export const format23 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio23(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter23.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio23(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS24
+ */
+export class Emitter24 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS24, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "24.0"; }
+}
+
+const DEFAULTS24 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll24(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk24(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk24(child, depth + 1);
+}
+
+export const format24 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio24(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter24.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio24(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS25
+ */
+export class Emitter25 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS25, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "25.0"; }
+}
+
+const DEFAULTS25 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll25(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk25(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk25(child, depth + 1);
+}
+
+export const format25 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio25(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter25.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio25(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS26
+ */
+export class Emitter26 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS26, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "26.0"; }
+}
+
+const DEFAULTS26 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll26(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk26(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk26(child, depth + 1);
+}
+
+export const format26 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio26(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter26.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio26(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS27
+ */
+export class Emitter27 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS27, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "27.0"; }
+}
+
+const DEFAULTS27 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll27(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk27(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk27(child, depth + 1);
+}
+
+export const format27 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio27(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter27.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio27(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS28
+ */
+export class Emitter28 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS28, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "28.0"; }
+}
+
+const DEFAULTS28 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll28(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk28(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk28(child, depth + 1);
+}
+
+export const format28 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio28(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter28.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio28(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS29
+ */
+export class Emitter29 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS29, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "29.0"; }
+}
+
+const DEFAULTS29 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll29(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk29(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk29(child, depth + 1);
+}
+
+export const format29 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio29(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter29.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio29(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS30
+ */
+export class Emitter30 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS30, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "30.0"; }
+}
+
+const DEFAULTS30 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll30(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk30(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk30(child, depth + 1);
+}
+
+export const format30 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio30(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter30.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio30(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS31
+ */
+export class Emitter31 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS31, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "31.0"; }
+}
+
+const DEFAULTS31 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll31(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk31(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk31(child, depth + 1);
+}
+
+export const format31 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio31(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter31.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio31(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS32
+ */
+export class Emitter32 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS32, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "32.0"; }
+}
+
+const DEFAULTS32 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll32(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk32(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk32(child, depth + 1);
+}
+
+export const format32 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio32(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter32.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio32(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS33
+ */
+export class Emitter33 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS33, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "33.0"; }
+}
+
+const DEFAULTS33 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll33(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk33(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk33(child, depth + 1);
+}
+
+export const format33 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio33(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter33.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio33(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS34
+ */
+export class Emitter34 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS34, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "34.0"; }
+}
+
+const DEFAULTS34 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll34(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk34(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk34(child, depth + 1);
+}
+
+export const format34 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio34(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter34.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio34(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS35
+ */
+export class Emitter35 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS35, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "35.0"; }
+}
+
+const DEFAULTS35 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll35(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk35(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk35(child, depth + 1);
+}
+
+export const format35 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio35(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter35.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio35(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS36
+ */
+export class Emitter36 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS36, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "36.0"; }
+}
+
+const DEFAULTS36 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll36(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk36(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk36(child, depth + 1);
+}
+
+export const format36 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio36(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter36.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio36(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS37
+ */
+export class Emitter37 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS37, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "37.0"; }
+}
+
+const DEFAULTS37 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll37(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk37(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk37(child, depth + 1);
+}
+
+export const format37 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio37(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter37.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio37(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS38
+ */
+export class Emitter38 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS38, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "38.0"; }
+}
+
+const DEFAULTS38 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll38(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk38(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk38(child, depth + 1);
+}
+
+export const format38 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio38(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter38.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio38(1, 3) };
+};
+
+/**
+ * A small event emitter with typed listeners.
+ *
+ * @param {Object} options  see DEFAULTS39
+ */
+export class Emitter39 {
+    #listeners = new Map();
+
+    constructor(options = {}) {
+        this.options = { ...DEFAULTS39, ...options };
+    }
+
+    on(type, listener, { once = false } = {}) {
+        const list = this.#listeners.get(type) ?? [];
+        list.push({ listener, once });
+        this.#listeners.set(type, list);
+        return () => this.off(type, listener);
+    }
+
+    off(type, listener) {
+        const list = this.#listeners.get(type);
+        if (!list)
+            return;
+        this.#listeners.set(type, list.filter(entry => entry.listener !== listener));
+    }
+
+    emit(type, ...args) {
+        // copy first: listeners may remove themselves
+        for (const { listener, once } of [...(this.#listeners.get(type) || [])]) {
+            if (once)
+                this.off(type, listener);
+            listener.apply(this, args);
+        }
+    }
+
+    static get version() { return "39.0"; }
+}
+
+const DEFAULTS39 = Object.freeze({
+    maxListeners: 10,
+    pattern: /^[a-z][\w-]*$/i,
+    separator: "/",
+});
+
+export async function fetchAll39(urls, { retries = 2, signal } = {}) {
+    const results = [];
+    for (const url of urls) {
+        let attempt = 0;
+        while (true) {
+            try {
+                const response = await fetch(url, { signal });
+                if (!response.ok)
+                    throw new Error(`HTTP ${response.status} for ${url}`);
+                results.push(await response.json());
+                break;
+            } catch (error) {
+                if (++attempt > retries || error.name === "AbortError")
+                    throw error;
+                await new Promise(resolve => setTimeout(resolve, 100 * 2 ** attempt));
+            }
+        }
+    }
+    return results;
+}
+
+export function* walk39(node, depth = 0) {
+    yield [node, depth];
+    for (let child = node.firstChild; child; child = child.nextSibling)
+        yield* walk39(child, depth + 1);
+}
+
+export const format39 = (value, width = 8) => {
+    const text = typeof value === "number" ? value.toFixed(2) : String(value);
+    return text.length >= width ? text : " ".repeat(width - text.length) + text;
+};
+
+function ratio39(a, b) {
+    var r = a / b / 2, re = /a\/b/g;   /* division, then a regex */
+    return isFinite(r) ? r : re.source;
+}
+
+Emitter39.prototype.toJSON = function () {
+    return { type: "emitter", options: this.options, ratio: ratio39(1, 3) };
+};
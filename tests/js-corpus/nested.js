@@ -0,0 +1,22 @@
+/* js.c benchmark corpus: deeply nested functions, callbacks,
+ * blocks and literals */
+function f0_0(a){var x0=a+0;function f0_1(a){var x1=a+1;function f0_2(a){var x2=a+2;function f0_3(a){var x3=a+3;function f0_4(a){var x4=a+4;function f0_5(a){var x5=a+5;function f0_6(a){var x6=a+6;function f0_7(a){var x7=a+7;function f0_8(a){var x8=a+8;function f0_9(a){var x9=a+9;function f0_10(a){var x10=a+10;function f0_11(a){var x11=a+11;function f0_12(a){var x12=a+12;function f0_13(a){var x13=a+13;function f0_14(a){var x14=a+14;function f0_15(a){var x15=a+15;function f0_16(a){var x16=a+16;function f0_17(a){var x17=a+17;function f0_18(a){var x18=a+18;function f0_19(a){var x19=a+19;function f0_20(a){var x20=a+20;function f0_21(a){var x21=a+21;function f0_22(a){var x22=a+22;function f0_23(a){var x23=a+23;function f0_24(a){var x24=a+24;function f0_25(a){var x25=a+25;function f0_26(a){var x26=a+26;function f0_27(a){var x27=a+27;function f0_28(a){var x28=a+28;function f0_29(a){var x29=a+29;function f0_30(a){var x30=a+30;function f0_31(a){var x31=a+31;function f0_32(a){var x32=a+32;function f0_33(a){var x33=a+33;function f0_34(a){var x34=a+34;function f0_35(a){var x35=a+35;function f0_36(a){var x36=a+36;function f0_37(a){var x37=a+37;function f0_38(a){var x38=a+38;function f0_39(a){var x39=a+39;function f0_40(a){var x40=a+40;function f0_41(a){var x41=a+41;function f0_42(a){var x42=a+42;function f0_43(a){var x43=a+43;function f0_44(a){var x44=a+44;function f0_45(a){var x45=a+45;function f0_46(a){var x46=a+46;function f0_47(a){var x47=a+47;function f0_48(a){var x48=a+48;function f0_49(a){var x49=a+49;function f0_50(a){var x50=a+50;function f0_51(a){var x51=a+51;function f0_52(a){var x52=a+52;function f0_53(a){var x53=a+53;function f0_54(a){var x54=a+54;function f0_55(a){var x55=a+55;function f0_56(a){var x56=a+56;function f0_57(a){var x57=a+57;function f0_58(a){var x58=a+58;function f0_59(a){var x59=a+59;return x59;}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+step(0,function(e0,r0){if(e0)return done(e0);step(r0+1,function(e1,r1){if(e1)return done(e1);step(r1+1,function(e2,r2){if(e2)return done(e2);step(r2+1,function(e3,r3){if(e3)return done(e3);step(r3+1,function(e4,r4){if(e4)return done(e4);step(r4+1,function(e5,r5){if(e5)return done(e5);step(r5+1,function(e6,r6){if(e6)return done(e6);step(r6+1,function(e7,r7){if(e7)return done(e7);step(r7+1,function(e8,r8){if(e8)return done(e8);step(r8+1,function(e9,r9){if(e9)return done(e9);step(r9+1,function(e10,r10){if(e10)return done(e10);step(r10+1,function(e11,r11){if(e11)return done(e11);step(r11+1,function(e12,r12){if(e12)return done(e12);step(r12+1,function(e13,r13){if(e13)return done(e13);step(r13+1,function(e14,r14){if(e14)return done(e14);step(r14+1,function(e15,r15){if(e15)return done(e15);step(r15+1,function(e16,r16){if(e16)return done(e16);step(r16+1,function(e17,r17){if(e17)return done(e17);step(r17+1,function(e18,r18){if(e18)return done(e18);step(r18+1,function(e19,r19){if(e19)return done(e19);step(r19+1,function(e20,r20){if(e20)return done(e20);step(r20+1,function(e21,r21){if(e21)return done(e21);step(r21+1,function(e22,r22){if(e22)return done(e22);step(r22+1,function(e23,r23){if(e23)return done(e23);step(r23+1,function(e24,r24){if(e24)return done(e24);step(r24+1,function(e25,r25){if(e25)return done(e25);step(r25+1,function(e26,r26){if(e26)return done(e26);step(r26+1,function(e27,r27){if(e27)return done(e27);step(r27+1,function(e28,r28){if(e28)return done(e28);step(r28+1,function(e29,r29){if(e29)return done(e29);step(r29+1,function(e30,r30){if(e30)return done(e30);step(r30+1,function(e31,r31){if(e31)return done(e31);step(r31+1,function(e32,r32){if(e32)return done(e32);step(r32+1,function(e33,r33){if(e33)return done(e33);step(r33+1,function(e34,r34){if(e34)return done(e34);step(r34+1,function(e35,r35){if(e35)return done(e35);step(r35+1,function(e36,r36){if(e36)return done(e36);step(r36+1,function(e37,r37){if(e37)return done(e37);step(r37+1,function(e38,r38){if(e38)return done(e38);step(r38+1,function(e39,r39){if(e39)return done(e39);step(r39+1,function(e40,r40){if(e40)return done(e40);step(r40+1,function(e41,r41){if(e41)return done(e41);step(r41+1,function(e42,r42){if(e42)return done(e42);step(r42+1,function(e43,r43){if(e43)return done(e43);step(r43+1,function(e44,r44){if(e44)return done(e44);step(r44+1,function(e45,r45){if(e45)return done(e45);step(r45+1,function(e46,r46){if(e46)return done(e46);step(r46+1,function(e47,r47){if(e47)return done(e47);step(r47+1,function(e48,r48){if(e48)return done(e48);step(r48+1,function(e49,r49){if(e49)return done(e49);step(r49+1,function(e50,r50){if(e50)return done(e50);step(r50+1,function(e51,r51){if(e51)return done(e51);step(r51+1,function(e52,r52){if(e52)return done(e52);step(r52+1,function(e53,r53){if(e53)return done(e53);step(r53+1,function(e54,r54){if(e54)return done(e54);step(r54+1,function(e55,r55){if(e55)return done(e55);step(r55+1,function(e56,r56){if(e56)return done(e56);step(r56+1,function(e57,r57){if(e57)return done(e57);step(r57+1,function(e58,r58){if(e58)return done(e58);step(r58+1,function(e59,r59){if(e59)return done(e59);step(r59+1,function(e60,r60){if(e60)return done(e60);step(r60+1,function(e61,r61){if(e61)return done(e61);step(r61+1,function(e62,r62){if(e62)return done(e62);step(r62+1,function(e63,r63){if(e63)return done(e63);step(r63+1,function(e64,r64){if(e64)return done(e64);step(r64+1,function(e65,r65){if(e65)return done(e65);step(r65+1,function(e66,r66){if(e66)return done(e66);step(r66+1,function(e67,r67){if(e67)return done(e67);step(r67+1,function(e68,r68){if(e68)return done(e68);step(r68+1,function(e69,r69){if(e69)return done(e69);step(r69+1,function(e70,r70){if(e70)return done(e70);step(r70+1,function(e71,r71){if(e71)return done(e71);step(r71+1,function(e72,r72){if(e72)return done(e72);step(r72+1,function(e73,r73){if(e73)return done(e73);step(r73+1,function(e74,r74){if(e74)return done(e74);step(r74+1,function(e75,r75){if(e75)return done(e75);step(r75+1,function(e76,r76){if(e76)return done(e76);step(r76+1,function(e77,r77){if(e77)return done(e77);step(r77+1,function(e78,r78){if(e78)return done(e78);step(r78+1,function(e79,r79){if(e79)return done(e79);step(r79+1,function(e80,r80){if(e80)return done(e80);step(r80+1,function(e81,r81){if(e81)return done(e81);step(r81+1,function(e82,r82){if(e82)return done(e82);step(r82+1,function(e83,r83){if(e83)return done(e83);step(r83+1,function(e84,r84){if(e84)return done(e84);step(r84+1,function(e85,r85){if(e85)return done(e85);step(r85+1,function(e86,r86){if(e86)return done(e86);step(r86+1,function(e87,r87){if(e87)return done(e87);step(r87+1,function(e88,r88){if(e88)return done(e88);step(r88+1,function(e89,r89){if(e89)return done(e89);step(r89+1,function(e90,r90){if(e90)return done(e90);step(r90+1,function(e91,r91){if(e91)return done(e91);step(r91+1,function(e92,r92){if(e92)return done(e92);step(r92+1,function(e93,r93){if(e93)return done(e93);step(r93+1,function(e94,r94){if(e94)return done(e94);step(r94+1,function(e95,r95){if(e95)return done(e95);step(r95+1,function(e96,r96){if(e96)return done(e96);step(r96+1,done)})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})});
+var tree2={k0:[0,{k1:[1,{k2:[2,{k3:[3,{k4:[4,{k5:[5,{k6:[6,{k7:[7,{k8:[8,{k9:[9,{k10:[10,{k11:[11,{k12:[12,{k13:[13,{k14:[14,{k15:[15,{k16:[16,{k17:[17,{k18:[18,{k19:[19,{k20:[20,{k21:[21,{k22:[22,{k23:[23,{k24:[24,{k25:[25,{k26:[26,{k27:[27,{k28:[28,{k29:[29,{k30:[30,{k31:[31,{k32:[32,{k33:[33,{k34:[34,{k35:[35,{k36:[36,{k37:[37,{k38:[38,{k39:[39,{k40:[40,{k41:[41,{k42:[42,{k43:[43,{k44:[44,{k45:[45,{k46:[46,{k47:[47,{k48:[48,{k49:[49,{k50:[50,{k51:[51,{k52:[52,{k53:[53,{k54:[54,{k55:[55,{k56:[56,{k57:[57,{k58:[58,{k59:[59,{k60:[60,{k61:[61,{k62:[62,{k63:[63,{k64:[64,{k65:[65,{k66:[66,{k67:[67,{k68:[68,{k69:[69,{k70:[70,{k71:[71,{k72:[72,{k73:[73,{k74:[74,{k75:[75,{k76:[76,{k77:[77,{k78:[78,{k79:[79,{k80:[80,{k81:[81,{k82:[82,{k83:[83,{k84:[84,{k85:[85,{k86:[86,{k87:[87,{k88:[88,{k89:[89,{k90:[90,{k91:[91,{k92:[92,{k93:[93,{k94:[94,{k95:[95,{k96:[96,{k97:[97,{k98:[98,{k99:[99,{k100:[100,{k101:[101,{k102:[102,{k103:[103,{k104:[104,{k105:[105,{k106:[106,{k107:[107,{k108:[108,{k109:[109,{k110:[110,{k111:[111,{k112:[112,{k113:[113,{k114:[114,{k115:[115,{k116:[116,{k117:[117,{k118:[118,{k119:[119,{k120:[120,{k121:[121,{k122:[122,{k123:[123,{k124:[124,{k125:[125,{k126:[126,{k127:[127,{k128:[128,{k129:[129,{k130:[130,{k131:[131,{k132:[132,{k133:[133,null]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]};
+function deep3(n){if(n>0){for(var i1=0;i1<n;i1++){while(n-->2){try{switch(n){case 4:{if(n>5){for(var i6=0;i6<n;i6++){while(n-->7){try{switch(n){case 9:{if(n>10){for(var i11=0;i11<n;i11++){while(n-->12){try{switch(n){case 14:{if(n>15){for(var i16=0;i16<n;i16++){while(n-->17){try{switch(n){case 19:{if(n>20){for(var i21=0;i21<n;i21++){while(n-->22){try{switch(n){case 24:{if(n>25){for(var i26=0;i26<n;i26++){while(n-->27){try{switch(n){case 29:{if(n>30){for(var i31=0;i31<n;i31++){while(n-->32){try{switch(n){case 34:{if(n>35){for(var i36=0;i36<n;i36++){while(n-->37){try{switch(n){case 39:{if(n>40){for(var i41=0;i41<n;i41++){while(n-->42){try{switch(n){case 44:{if(n>45){for(var i46=0;i46<n;i46++){while(n-->47){try{switch(n){case 49:{if(n>50){for(var i51=0;i51<n;i51++){while(n-->52){try{switch(n){case 54:{if(n>55){for(var i56=0;i56<n;i56++){while(n-->57){try{switch(n){case 59:{if(n>60){for(var i61=0;i61<n;i61++){while(n-->62){try{switch(n){case 64:{if(n>65){for(var i66=0;i66<n;i66++){while(n-->67){try{switch(n){case 69:{if(n>70){for(var i71=0;i71<n;i71++){while(n-->72){try{switch(n){case 74:{if(n>75){for(var i76=0;i76<n;i76++){while(n-->77){try{switch(n){case 79:{if(n>80){for(var i81=0;i81<n;i81++){while(n-->82){try{switch(n){case 84:{if(n>85){for(var i86=0;i86<n;i86++){while(n-->87){try{switch(n){case 89:{if(n>90){for(var i91=0;i91<n;i91++){while(n-->92){try{switch(n){case 94:{if(n>95){for(var i96=0;i96<n;i96++){while(n-->97){try{switch(n){case 99:{if(n>100){for(var i101=0;i101<n;i101++){while(n-->102){try{switch(n){case 104:{if(n>105){for(var i106=0;i106<n;i106++){while(n-->107){try{switch(n){case 109:{if(n>110){for(var i111=0;i111<n;i111++){while(n-->112){try{switch(n){case 114:{if(n>115){for(var i116=0;i116<n;i116++){while(n-->117){try{switch(n){case 119:{if(n>120){for(var i121=0;i121<n;i121++){while(n-->122){try{switch(n){case 124:{if(n>125){for(var i126=0;i126<n;i126++){while(n-->127){try{switch(n){case 129:{if(n>130){for(var i131=0;i131<n;i131++){while(n-->132){try{switch(n){case 134:{if(n>135){for(var i136=0;i136<n;i136++){while(n-->137){try{switch(n){case 139:{if(n>140){for(var i141=0;i141<n;i141++){while(n-->142){try{switch(n){case 144:{if(n>145){for(var i146=0;i146<n;i146++){while(n-->147){try{switch(n){case 149:{if(n>150){for(var i151=0;i151<n;i151++){while(n-->152){try{switch(n){case 154:{if(n>155){for(var i156=0;i156<n;i156++){while(n-->157){try{switch(n){case 159:{if(n>160){for(var i161=0;i161<n;i161++){while(n-->162){try{switch(n){case 164:{if(n>165){for(var i166=0;i166<n;i166++){while(n-->167){try{switch(n){case 169:{if(n>170){n--;}}}}catch(e168){n=0}}}}}}}catch(e163){n=0}}}}}}}catch(e158){n=0}}}}}}}catch(e153){n=0}}}}}}}catch(e148){n=0}}}}}}}catch(e143){n=0}}}}}}}catch(e138){n=0}}}}}}}catch(e133){n=0}}}}}}}catch(e128){n=0}}}}}}}catch(e123){n=0}}}}}}}catch(e118){n=0}}}}}}}catch(e113){n=0}}}}}}}catch(e108){n=0}}}}}}}catch(e103){n=0}}}}}}}catch(e98){n=0}}}}}}}catch(e93){n=0}}}}}}}catch(e88){n=0}}}}}}}catch(e83){n=0}}}}}}}catch(e78){n=0}}}}}}}catch(e73){n=0}}}}}}}catch(e68){n=0}}}}}}}catch(e63){n=0}}}}}}}catch(e58){n=0}}}}}}}catch(e53){n=0}}}}}}}catch(e48){n=0}}}}}}}catch(e43){n=0}}}}}}}catch(e38){n=0}}}}}}}catch(e33){n=0}}}}}}}catch(e28){n=0}}}}}}}catch(e23){n=0}}}}}}}catch(e18){n=0}}}}}}}catch(e13){n=0}}}}}}}catch(e8){n=0}}}}}}}catch(e3){n=0}}}}return n}
+var chain4=Promise.resolve(0).then(v=>{const w=v+0;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+1;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+2;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+3;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+4;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+5;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+6;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+7;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+8;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+9;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+10;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+11;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+12;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+13;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+14;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+15;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+16;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+17;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+18;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+19;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+20;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+21;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+22;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+23;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+24;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+25;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+26;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+27;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+28;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+29;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+30;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+31;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+32;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+33;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+34;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+35;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+36;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+37;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+38;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+39;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+40;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+41;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+42;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+43;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+44;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+45;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+46;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+47;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+48;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+49;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+50;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+51;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+52;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+53;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+54;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+55;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+56;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+57;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+58;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+59;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+60;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+61;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+62;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+63;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+64;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+65;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+66;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+67;return (x=>y=>x*y)(w)(2)});
+function f5_0(a){var x0=a+0;function f5_1(a){var x1=a+1;function f5_2(a){var x2=a+2;function f5_3(a){var x3=a+3;function f5_4(a){var x4=a+4;function f5_5(a){var x5=a+5;function f5_6(a){var x6=a+6;function f5_7(a){var x7=a+7;function f5_8(a){var x8=a+8;function f5_9(a){var x9=a+9;function f5_10(a){var x10=a+10;function f5_11(a){var x11=a+11;function f5_12(a){var x12=a+12;function f5_13(a){var x13=a+13;function f5_14(a){var x14=a+14;function f5_15(a){var x15=a+15;function f5_16(a){var x16=a+16;function f5_17(a){var x17=a+17;function f5_18(a){var x18=a+18;function f5_19(a){var x19=a+19;function f5_20(a){var x20=a+20;function f5_21(a){var x21=a+21;function f5_22(a){var x22=a+22;function f5_23(a){var x23=a+23;function f5_24(a){var x24=a+24;function f5_25(a){var x25=a+25;function f5_26(a){var x26=a+26;function f5_27(a){var x27=a+27;function f5_28(a){var x28=a+28;function f5_29(a){var x29=a+29;function f5_30(a){var x30=a+30;function f5_31(a){var x31=a+31;function f5_32(a){var x32=a+32;function f5_33(a){var x33=a+33;function f5_34(a){var x34=a+34;function f5_35(a){var x35=a+35;function f5_36(a){var x36=a+36;function f5_37(a){var x37=a+37;function f5_38(a){var x38=a+38;function f5_39(a){var x39=a+39;function f5_40(a){var x40=a+40;function f5_41(a){var x41=a+41;function f5_42(a){var x42=a+42;function f5_43(a){var x43=a+43;function f5_44(a){var x44=a+44;function f5_45(a){var x45=a+45;function f5_46(a){var x46=a+46;function f5_47(a){var x47=a+47;function f5_48(a){var x48=a+48;function f5_49(a){var x49=a+49;function f5_50(a){var x50=a+50;function f5_51(a){var x51=a+51;function f5_52(a){var x52=a+52;function f5_53(a){var x53=a+53;function f5_54(a){var x54=a+54;function f5_55(a){var x55=a+55;function f5_56(a){var x56=a+56;function f5_57(a){var x57=a+57;function f5_58(a){var x58=a+58;function f5_59(a){var x59=a+59;function f5_60(a){var x60=a+60;function f5_61(a){var x61=a+61;function f5_62(a){var x62=a+62;function f5_63(a){var x63=a+63;function f5_64(a){var x64=a+64;function f5_65(a){var x65=a+65;function f5_66(a){var x66=a+66;function f5_67(a){var x67=a+67;function f5_68(a){var x68=a+68;function f5_69(a){var x69=a+69;function f5_70(a){var x70=a+70;function f5_71(a){var x71=a+71;function f5_72(a){var x72=a+72;function f5_73(a){var x73=a+73;function f5_74(a){var x74=a+74;function f5_75(a){var x75=a+75;function f5_76(a){var x76=a+76;function f5_77(a){var x77=a+77;function f5_78(a){var x78=a+78;function f5_79(a){var x79=a+79;function f5_80(a){var x80=a+80;function f5_81(a){var x81=a+81;function f5_82(a){var x82=a+82;function f5_83(a){var x83=a+83;function f5_84(a){var x84=a+84;function f5_85(a){var x85=a+85;function f5_86(a){var x86=a+86;function f5_87(a){var x87=a+87;function f5_88(a){var x88=a+88;function f5_89(a){var x89=a+89;function f5_90(a){var x90=a+90;function f5_91(a){var x91=a+91;function f5_92(a){var x92=a+92;function f5_93(a){var x93=a+93;function f5_94(a){var x94=a+94;function f5_95(a){var x95=a+95;function f5_96(a){var x96=a+96;function f5_97(a){var x97=a+97;function f5_98(a){var x98=a+98;function f5_99(a){var x99=a+99;function f5_100(a){var x100=a+100;function f5_101(a){var x101=a+101;function f5_102(a){var x102=a+102;function f5_103(a){var x103=a+103;function f5_104(a){var x104=a+104;return x104;}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+step(0,function(e0,r0){if(e0)return done(e0);step(r0+1,function(e1,r1){if(e1)return done(e1);step(r1+1,function(e2,r2){if(e2)return done(e2);step(r2+1,function(e3,r3){if(e3)return done(e3);step(r3+1,function(e4,r4){if(e4)return done(e4);step(r4+1,function(e5,r5){if(e5)return done(e5);step(r5+1,function(e6,r6){if(e6)return done(e6);step(r6+1,function(e7,r7){if(e7)return done(e7);step(r7+1,function(e8,r8){if(e8)return done(e8);step(r8+1,function(e9,r9){if(e9)return done(e9);step(r9+1,function(e10,r10){if(e10)return done(e10);step(r10+1,function(e11,r11){if(e11)return done(e11);step(r11+1,function(e12,r12){if(e12)return done(e12);step(r12+1,function(e13,r13){if(e13)return done(e13);step(r13+1,function(e14,r14){if(e14)return done(e14);step(r14+1,function(e15,r15){if(e15)return done(e15);step(r15+1,function(e16,r16){if(e16)return done(e16);step(r16+1,function(e17,r17){if(e17)return done(e17);step(r17+1,function(e18,r18){if(e18)return done(e18);step(r18+1,function(e19,r19){if(e19)return done(e19);step(r19+1,function(e20,r20){if(e20)return done(e20);step(r20+1,function(e21,r21){if(e21)return done(e21);step(r21+1,function(e22,r22){if(e22)return done(e22);step(r22+1,function(e23,r23){if(e23)return done(e23);step(r23+1,function(e24,r24){if(e24)return done(e24);step(r24+1,function(e25,r25){if(e25)return done(e25);step(r25+1,function(e26,r26){if(e26)return done(e26);step(r26+1,function(e27,r27){if(e27)return done(e27);step(r27+1,function(e28,r28){if(e28)return done(e28);step(r28+1,function(e29,r29){if(e29)return done(e29);step(r29+1,function(e30,r30){if(e30)return done(e30);step(r30+1,function(e31,r31){if(e31)return done(e31);step(r31+1,function(e32,r32){if(e32)return done(e32);step(r32+1,function(e33,r33){if(e33)return done(e33);step(r33+1,function(e34,r34){if(e34)return done(e34);step(r34+1,function(e35,r35){if(e35)return done(e35);step(r35+1,function(e36,r36){if(e36)return done(e36);step(r36+1,function(e37,r37){if(e37)return done(e37);step(r37+1,function(e38,r38){if(e38)return done(e38);step(r38+1,function(e39,r39){if(e39)return done(e39);step(r39+1,function(e40,r40){if(e40)return done(e40);step(r40+1,function(e41,r41){if(e41)return done(e41);step(r41+1,function(e42,r42){if(e42)return done(e42);step(r42+1,function(e43,r43){if(e43)return done(e43);step(r43+1,function(e44,r44){if(e44)return done(e44);step(r44+1,function(e45,r45){if(e45)return done(e45);step(r45+1,function(e46,r46){if(e46)return done(e46);step(r46+1,function(e47,r47){if(e47)return done(e47);step(r47+1,function(e48,r48){if(e48)return done(e48);step(r48+1,function(e49,r49){if(e49)return done(e49);step(r49+1,function(e50,r50){if(e50)return done(e50);step(r50+1,function(e51,r51){if(e51)return done(e51);step(r51+1,function(e52,r52){if(e52)return done(e52);step(r52+1,function(e53,r53){if(e53)return done(e53);step(r53+1,function(e54,r54){if(e54)return done(e54);step(r54+1,function(e55,r55){if(e55)return done(e55);step(r55+1,function(e56,r56){if(e56)return done(e56);step(r56+1,function(e57,r57){if(e57)return done(e57);step(r57+1,function(e58,r58){if(e58)return done(e58);step(r58+1,function(e59,r59){if(e59)return done(e59);step(r59+1,function(e60,r60){if(e60)return done(e60);step(r60+1,function(e61,r61){if(e61)return done(e61);step(r61+1,function(e62,r62){if(e62)return done(e62);step(r62+1,function(e63,r63){if(e63)return done(e63);step(r63+1,function(e64,r64){if(e64)return done(e64);step(r64+1,function(e65,r65){if(e65)return done(e65);step(r65+1,function(e66,r66){if(e66)return done(e66);step(r66+1,function(e67,r67){if(e67)return done(e67);step(r67+1,function(e68,r68){if(e68)return done(e68);step(r68+1,function(e69,r69){if(e69)return done(e69);step(r69+1,function(e70,r70){if(e70)return done(e70);step(r70+1,function(e71,r71){if(e71)return done(e71);step(r71+1,function(e72,r72){if(e72)return done(e72);step(r72+1,function(e73,r73){if(e73)return done(e73);step(r73+1,function(e74,r74){if(e74)return done(e74);step(r74+1,function(e75,r75){if(e75)return done(e75);step(r75+1,function(e76,r76){if(e76)return done(e76);step(r76+1,function(e77,r77){if(e77)return done(e77);step(r77+1,function(e78,r78){if(e78)return done(e78);step(r78+1,function(e79,r79){if(e79)return done(e79);step(r79+1,function(e80,r80){if(e80)return done(e80);step(r80+1,function(e81,r81){if(e81)return done(e81);step(r81+1,function(e82,r82){if(e82)return done(e82);step(r82+1,function(e83,r83){if(e83)return done(e83);step(r83+1,function(e84,r84){if(e84)return done(e84);step(r84+1,function(e85,r85){if(e85)return done(e85);step(r85+1,function(e86,r86){if(e86)return done(e86);step(r86+1,function(e87,r87){if(e87)return done(e87);step(r87+1,function(e88,r88){if(e88)return done(e88);step(r88+1,function(e89,r89){if(e89)return done(e89);step(r89+1,function(e90,r90){if(e90)return done(e90);step(r90+1,function(e91,r91){if(e91)return done(e91);step(r91+1,function(e92,r92){if(e92)return done(e92);step(r92+1,function(e93,r93){if(e93)return done(e93);step(r93+1,function(e94,r94){if(e94)return done(e94);step(r94+1,function(e95,r95){if(e95)return done(e95);step(r95+1,function(e96,r96){if(e96)return done(e96);step(r96+1,function(e97,r97){if(e97)return done(e97);step(r97+1,function(e98,r98){if(e98)return done(e98);step(r98+1,function(e99,r99){if(e99)return done(e99);step(r99+1,function(e100,r100){if(e100)return done(e100);step(r100+1,function(e101,r101){if(e101)return done(e101);step(r101+1,function(e102,r102){if(e102)return done(e102);step(r102+1,function(e103,r103){if(e103)return done(e103);step(r103+1,function(e104,r104){if(e104)return done(e104);step(r104+1,function(e105,r105){if(e105)return done(e105);step(r105+1,function(e106,r106){if(e106)return done(e106);step(r106+1,function(e107,r107){if(e107)return done(e107);step(r107+1,function(e108,r108){if(e108)return done(e108);step(r108+1,function(e109,r109){if(e109)return done(e109);step(r109+1,function(e110,r110){if(e110)return done(e110);step(r110+1,function(e111,r111){if(e111)return done(e111);step(r111+1,function(e112,r112){if(e112)return done(e112);step(r112+1,function(e113,r113){if(e113)return done(e113);step(r113+1,function(e114,r114){if(e114)return done(e114);step(r114+1,function(e115,r115){if(e115)return done(e115);step(r115+1,function(e116,r116){if(e116)return done(e116);step(r116+1,function(e117,r117){if(e117)return done(e117);step(r117+1,function(e118,r118){if(e118)return done(e118);step(r118+1,function(e119,r119){if(e119)return done(e119);step(r119+1,function(e120,r120){if(e120)return done(e120);step(r120+1,function(e121,r121){if(e121)return done(e121);step(r121+1,function(e122,r122){if(e122)return done(e122);step(r122+1,function(e123,r123){if(e123)return done(e123);step(r123+1,function(e124,r124){if(e124)return done(e124);step(r124+1,function(e125,r125){if(e125)return done(e125);step(r125+1,function(e126,r126){if(e126)return done(e126);step(r126+1,function(e127,r127){if(e127)return done(e127);step(r127+1,function(e128,r128){if(e128)return done(e128);step(r128+1,function(e129,r129){if(e129)return done(e129);step(r129+1,function(e130,r130){if(e130)return done(e130);step(r130+1,function(e131,r131){if(e131)return done(e131);step(r131+1,function(e132,r132){if(e132)return done(e132);step(r132+1,function(e133,r133){if(e133)return done(e133);step(r133+1,function(e134,r134){if(e134)return done(e134);step(r134+1,function(e135,r135){if(e135)return done(e135);step(r135+1,function(e136,r136){if(e136)return done(e136);step(r136+1,function(e137,r137){if(e137)return done(e137);step(r137+1,function(e138,r138){if(e138)return done(e138);step(r138+1,function(e139,r139){if(e139)return done(e139);step(r139+1,function(e140,r140){if(e140)return done(e140);step(r140+1,function(e141,r141){if(e141)return done(e141);step(r141+1,done)})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})});
+var tree7={k0:[0,{k1:[1,{k2:[2,{k3:[3,{k4:[4,{k5:[5,{k6:[6,{k7:[7,{k8:[8,{k9:[9,{k10:[10,{k11:[11,{k12:[12,{k13:[13,{k14:[14,{k15:[15,{k16:[16,{k17:[17,{k18:[18,{k19:[19,{k20:[20,{k21:[21,{k22:[22,{k23:[23,{k24:[24,{k25:[25,{k26:[26,{k27:[27,{k28:[28,{k29:[29,{k30:[30,{k31:[31,{k32:[32,{k33:[33,{k34:[34,{k35:[35,{k36:[36,{k37:[37,{k38:[38,{k39:[39,{k40:[40,{k41:[41,{k42:[42,{k43:[43,{k44:[44,{k45:[45,{k46:[46,{k47:[47,{k48:[48,{k49:[49,{k50:[50,{k51:[51,{k52:[52,{k53:[53,{k54:[54,{k55:[55,{k56:[56,{k57:[57,{k58:[58,{k59:[59,{k60:[60,{k61:[61,{k62:[62,{k63:[63,{k64:[64,{k65:[65,{k66:[66,{k67:[67,{k68:[68,{k69:[69,{k70:[70,{k71:[71,{k72:[72,{k73:[73,{k74:[74,{k75:[75,{k76:[76,{k77:[77,{k78:[78,{k79:[79,{k80:[80,{k81:[81,{k82:[82,{k83:[83,{k84:[84,{k85:[85,{k86:[86,{k87:[87,{k88:[88,{k89:[89,{k90:[90,{k91:[91,{k92:[92,{k93:[93,{k94:[94,{k95:[95,{k96:[96,{k97:[97,{k98:[98,{k99:[99,{k100:[100,{k101:[101,{k102:[102,{k103:[103,{k104:[104,{k105:[105,{k106:[106,{k107:[107,{k108:[108,{k109:[109,{k110:[110,{k111:[111,{k112:[112,{k113:[113,{k114:[114,{k115:[115,{k116:[116,{k117:[117,{k118:[118,{k119:[119,{k120:[120,{k121:[121,{k122:[122,{k123:[123,{k124:[124,{k125:[125,{k126:[126,{k127:[127,{k128:[128,{k129:[129,{k130:[130,{k131:[131,{k132:[132,{k133:[133,{k134:[134,{k135:[135,{k136:[136,{k137:[137,{k138:[138,{k139:[139,{k140:[140,{k141:[141,{k142:[142,{k143:[143,{k144:[144,{k145:[145,{k146:[146,{k147:[147,{k148:[148,{k149:[149,{k150:[150,{k151:[151,{k152:[152,{k153:[153,{k154:[154,{k155:[155,{k156:[156,{k157:[157,{k158:[158,{k159:[159,{k160:[160,{k161:[161,{k162:[162,{k163:[163,{k164:[164,{k165:[165,{k166:[166,{k167:[167,{k168:[168,{k169:[169,{k170:[170,{k171:[171,{k172:[172,{k173:[173,{k174:[174,{k175:[175,{k176:[176,{k177:[177,{k178:[178,null]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]};
+function deep8(n){if(n>0){for(var i1=0;i1<n;i1++){while(n-->2){try{switch(n){case 4:{if(n>5){for(var i6=0;i6<n;i6++){while(n-->7){try{switch(n){case 9:{if(n>10){for(var i11=0;i11<n;i11++){while(n-->12){try{switch(n){case 14:{if(n>15){for(var i16=0;i16<n;i16++){while(n-->17){try{switch(n){case 19:{if(n>20){for(var i21=0;i21<n;i21++){while(n-->22){try{switch(n){case 24:{if(n>25){for(var i26=0;i26<n;i26++){while(n-->27){try{switch(n){case 29:{if(n>30){for(var i31=0;i31<n;i31++){while(n-->32){try{switch(n){case 34:{if(n>35){for(var i36=0;i36<n;i36++){while(n-->37){try{switch(n){case 39:{if(n>40){for(var i41=0;i41<n;i41++){while(n-->42){try{switch(n){case 44:{if(n>45){for(var i46=0;i46<n;i46++){while(n-->47){try{switch(n){case 49:{if(n>50){for(var i51=0;i51<n;i51++){while(n-->52){try{switch(n){case 54:{if(n>55){for(var i56=0;i56<n;i56++){while(n-->57){try{switch(n){case 59:{if(n>60){for(var i61=0;i61<n;i61++){while(n-->62){try{switch(n){case 64:{if(n>65){for(var i66=0;i66<n;i66++){while(n-->67){try{switch(n){case 69:{if(n>70){for(var i71=0;i71<n;i71++){while(n-->72){try{switch(n){case 74:{if(n>75){n--;}}}}catch(e73){n=0}}}}}}}catch(e68){n=0}}}}}}}catch(e63){n=0}}}}}}}catch(e58){n=0}}}}}}}catch(e53){n=0}}}}}}}catch(e48){n=0}}}}}}}catch(e43){n=0}}}}}}}catch(e38){n=0}}}}}}}catch(e33){n=0}}}}}}}catch(e28){n=0}}}}}}}catch(e23){n=0}}}}}}}catch(e18){n=0}}}}}}}catch(e13){n=0}}}}}}}catch(e8){n=0}}}}}}}catch(e3){n=0}}}}return n}
+var chain9=Promise.resolve(0).then(v=>{const w=v+0;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+1;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+2;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+3;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+4;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+5;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+6;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+7;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+8;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+9;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+10;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+11;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+12;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+13;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+14;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+15;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+16;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+17;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+18;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+19;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+20;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+21;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+22;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+23;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+24;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+25;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+26;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+27;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+28;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+29;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+30;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+31;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+32;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+33;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+34;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+35;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+36;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+37;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+38;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+39;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+40;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+41;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+42;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+43;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+44;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+45;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+46;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+47;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+48;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+49;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+50;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+51;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+52;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+53;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+54;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+55;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+56;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+57;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+58;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+59;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+60;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+61;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+62;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+63;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+64;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+65;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+66;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+67;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+68;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+69;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+70;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+71;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+72;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+73;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+74;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+75;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+76;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+77;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+78;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+79;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+80;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+81;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+82;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+83;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+84;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+85;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+86;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+87;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+88;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+89;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+90;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+91;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+92;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+93;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+94;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+95;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+96;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+97;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+98;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+99;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+100;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+101;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+102;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+103;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+104;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+105;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+106;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+107;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+108;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+109;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+110;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+111;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+112;return (x=>y=>x*y)(w)(2)});
+function f10_0(a){var x0=a+0;function f10_1(a){var x1=a+1;function f10_2(a){var x2=a+2;function f10_3(a){var x3=a+3;function f10_4(a){var x4=a+4;function f10_5(a){var x5=a+5;function f10_6(a){var x6=a+6;function f10_7(a){var x7=a+7;function f10_8(a){var x8=a+8;function f10_9(a){var x9=a+9;function f10_10(a){var x10=a+10;function f10_11(a){var x11=a+11;function f10_12(a){var x12=a+12;function f10_13(a){var x13=a+13;function f10_14(a){var x14=a+14;function f10_15(a){var x15=a+15;function f10_16(a){var x16=a+16;function f10_17(a){var x17=a+17;function f10_18(a){var x18=a+18;function f10_19(a){var x19=a+19;function f10_20(a){var x20=a+20;function f10_21(a){var x21=a+21;function f10_22(a){var x22=a+22;function f10_23(a){var x23=a+23;function f10_24(a){var x24=a+24;function f10_25(a){var x25=a+25;function f10_26(a){var x26=a+26;function f10_27(a){var x27=a+27;function f10_28(a){var x28=a+28;function f10_29(a){var x29=a+29;function f10_30(a){var x30=a+30;function f10_31(a){var x31=a+31;function f10_32(a){var x32=a+32;function f10_33(a){var x33=a+33;function f10_34(a){var x34=a+34;function f10_35(a){var x35=a+35;function f10_36(a){var x36=a+36;function f10_37(a){var x37=a+37;function f10_38(a){var x38=a+38;function f10_39(a){var x39=a+39;function f10_40(a){var x40=a+40;function f10_41(a){var x41=a+41;function f10_42(a){var x42=a+42;function f10_43(a){var x43=a+43;function f10_44(a){var x44=a+44;function f10_45(a){var x45=a+45;function f10_46(a){var x46=a+46;function f10_47(a){var x47=a+47;function f10_48(a){var x48=a+48;function f10_49(a){var x49=a+49;function f10_50(a){var x50=a+50;function f10_51(a){var x51=a+51;function f10_52(a){var x52=a+52;function f10_53(a){var x53=a+53;function f10_54(a){var x54=a+54;function f10_55(a){var x55=a+55;function f10_56(a){var x56=a+56;function f10_57(a){var x57=a+57;function f10_58(a){var x58=a+58;function f10_59(a){var x59=a+59;function f10_60(a){var x60=a+60;function f10_61(a){var x61=a+61;function f10_62(a){var x62=a+62;function f10_63(a){var x63=a+63;function f10_64(a){var x64=a+64;function f10_65(a){var x65=a+65;function f10_66(a){var x66=a+66;function f10_67(a){var x67=a+67;function f10_68(a){var x68=a+68;function f10_69(a){var x69=a+69;function f10_70(a){var x70=a+70;function f10_71(a){var x71=a+71;function f10_72(a){var x72=a+72;function f10_73(a){var x73=a+73;function f10_74(a){var x74=a+74;function f10_75(a){var x75=a+75;function f10_76(a){var x76=a+76;function f10_77(a){var x77=a+77;function f10_78(a){var x78=a+78;function f10_79(a){var x79=a+79;function f10_80(a){var x80=a+80;function f10_81(a){var x81=a+81;function f10_82(a){var x82=a+82;function f10_83(a){var x83=a+83;function f10_84(a){var x84=a+84;function f10_85(a){var x85=a+85;function f10_86(a){var x86=a+86;function f10_87(a){var x87=a+87;function f10_88(a){var x88=a+88;function f10_89(a){var x89=a+89;function f10_90(a){var x90=a+90;function f10_91(a){var x91=a+91;function f10_92(a){var x92=a+92;function f10_93(a){var x93=a+93;function f10_94(a){var x94=a+94;function f10_95(a){var x95=a+95;function f10_96(a){var x96=a+96;function f10_97(a){var x97=a+97;function f10_98(a){var x98=a+98;function f10_99(a){var x99=a+99;function f10_100(a){var x100=a+100;function f10_101(a){var x101=a+101;function f10_102(a){var x102=a+102;function f10_103(a){var x103=a+103;function f10_104(a){var x104=a+104;function f10_105(a){var x105=a+105;function f10_106(a){var x106=a+106;function f10_107(a){var x107=a+107;function f10_108(a){var x108=a+108;function f10_109(a){var x109=a+109;function f10_110(a){var x110=a+110;function f10_111(a){var x111=a+111;function f10_112(a){var x112=a+112;function f10_113(a){var x113=a+113;function f10_114(a){var x114=a+114;function f10_115(a){var x115=a+115;function f10_116(a){var x116=a+116;function f10_117(a){var x117=a+117;function f10_118(a){var x118=a+118;function f10_119(a){var x119=a+119;function f10_120(a){var x120=a+120;function f10_121(a){var x121=a+121;function f10_122(a){var x122=a+122;function f10_123(a){var x123=a+123;function f10_124(a){var x124=a+124;function f10_125(a){var x125=a+125;function f10_126(a){var x126=a+126;function f10_127(a){var x127=a+127;function f10_128(a){var x128=a+128;function f10_129(a){var x129=a+129;function f10_130(a){var x130=a+130;function f10_131(a){var x131=a+131;function f10_132(a){var x132=a+132;function f10_133(a){var x133=a+133;function f10_134(a){var x134=a+134;function f10_135(a){var x135=a+135;function f10_136(a){var x136=a+136;function f10_137(a){var x137=a+137;function f10_138(a){var x138=a+138;function f10_139(a){var x139=a+139;function f10_140(a){var x140=a+140;function f10_141(a){var x141=a+141;function f10_142(a){var x142=a+142;function f10_143(a){var x143=a+143;function f10_144(a){var x144=a+144;function f10_145(a){var x145=a+145;function f10_146(a){var x146=a+146;function f10_147(a){var x147=a+147;function f10_148(a){var x148=a+148;function f10_149(a){var x149=a+149;return x149;}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+step(0,function(e0,r0){if(e0)return done(e0);step(r0+1,function(e1,r1){if(e1)return done(e1);step(r1+1,function(e2,r2){if(e2)return done(e2);step(r2+1,function(e3,r3){if(e3)return done(e3);step(r3+1,function(e4,r4){if(e4)return done(e4);step(r4+1,function(e5,r5){if(e5)return done(e5);step(r5+1,function(e6,r6){if(e6)return done(e6);step(r6+1,function(e7,r7){if(e7)return done(e7);step(r7+1,function(e8,r8){if(e8)return done(e8);step(r8+1,function(e9,r9){if(e9)return done(e9);step(r9+1,function(e10,r10){if(e10)return done(e10);step(r10+1,function(e11,r11){if(e11)return done(e11);step(r11+1,function(e12,r12){if(e12)return done(e12);step(r12+1,function(e13,r13){if(e13)return done(e13);step(r13+1,function(e14,r14){if(e14)return done(e14);step(r14+1,function(e15,r15){if(e15)return done(e15);step(r15+1,function(e16,r16){if(e16)return done(e16);step(r16+1,function(e17,r17){if(e17)return done(e17);step(r17+1,function(e18,r18){if(e18)return done(e18);step(r18+1,function(e19,r19){if(e19)return done(e19);step(r19+1,function(e20,r20){if(e20)return done(e20);step(r20+1,function(e21,r21){if(e21)return done(e21);step(r21+1,function(e22,r22){if(e22)return done(e22);step(r22+1,function(e23,r23){if(e23)return done(e23);step(r23+1,function(e24,r24){if(e24)return done(e24);step(r24+1,function(e25,r25){if(e25)return done(e25);step(r25+1,function(e26,r26){if(e26)return done(e26);step(r26+1,function(e27,r27){if(e27)return done(e27);step(r27+1,function(e28,r28){if(e28)return done(e28);step(r28+1,function(e29,r29){if(e29)return done(e29);step(r29+1,function(e30,r30){if(e30)return done(e30);step(r30+1,function(e31,r31){if(e31)return done(e31);step(r31+1,function(e32,r32){if(e32)return done(e32);step(r32+1,function(e33,r33){if(e33)return done(e33);step(r33+1,function(e34,r34){if(e34)return done(e34);step(r34+1,function(e35,r35){if(e35)return done(e35);step(r35+1,function(e36,r36){if(e36)return done(e36);step(r36+1,function(e37,r37){if(e37)return done(e37);step(r37+1,function(e38,r38){if(e38)return done(e38);step(r38+1,function(e39,r39){if(e39)return done(e39);step(r39+1,function(e40,r40){if(e40)return done(e40);step(r40+1,function(e41,r41){if(e41)return done(e41);step(r41+1,function(e42,r42){if(e42)return done(e42);step(r42+1,function(e43,r43){if(e43)return done(e43);step(r43+1,function(e44,r44){if(e44)return done(e44);step(r44+1,function(e45,r45){if(e45)return done(e45);step(r45+1,function(e46,r46){if(e46)return done(e46);step(r46+1,function(e47,r47){if(e47)return done(e47);step(r47+1,function(e48,r48){if(e48)return done(e48);step(r48+1,function(e49,r49){if(e49)return done(e49);step(r49+1,function(e50,r50){if(e50)return done(e50);step(r50+1,function(e51,r51){if(e51)return done(e51);step(r51+1,function(e52,r52){if(e52)return done(e52);step(r52+1,function(e53,r53){if(e53)return done(e53);step(r53+1,function(e54,r54){if(e54)return done(e54);step(r54+1,function(e55,r55){if(e55)return done(e55);step(r55+1,function(e56,r56){if(e56)return done(e56);step(r56+1,function(e57,r57){if(e57)return done(e57);step(r57+1,function(e58,r58){if(e58)return done(e58);step(r58+1,function(e59,r59){if(e59)return done(e59);step(r59+1,function(e60,r60){if(e60)return done(e60);step(r60+1,function(e61,r61){if(e61)return done(e61);step(r61+1,function(e62,r62){if(e62)return done(e62);step(r62+1,function(e63,r63){if(e63)return done(e63);step(r63+1,function(e64,r64){if(e64)return done(e64);step(r64+1,function(e65,r65){if(e65)return done(e65);step(r65+1,function(e66,r66){if(e66)return done(e66);step(r66+1,function(e67,r67){if(e67)return done(e67);step(r67+1,function(e68,r68){if(e68)return done(e68);step(r68+1,function(e69,r69){if(e69)return done(e69);step(r69+1,function(e70,r70){if(e70)return done(e70);step(r70+1,function(e71,r71){if(e71)return done(e71);step(r71+1,function(e72,r72){if(e72)return done(e72);step(r72+1,function(e73,r73){if(e73)return done(e73);step(r73+1,function(e74,r74){if(e74)return done(e74);step(r74+1,function(e75,r75){if(e75)return done(e75);step(r75+1,function(e76,r76){if(e76)return done(e76);step(r76+1,function(e77,r77){if(e77)return done(e77);step(r77+1,function(e78,r78){if(e78)return done(e78);step(r78+1,function(e79,r79){if(e79)return done(e79);step(r79+1,function(e80,r80){if(e80)return done(e80);step(r80+1,function(e81,r81){if(e81)return done(e81);step(r81+1,function(e82,r82){if(e82)return done(e82);step(r82+1,function(e83,r83){if(e83)return done(e83);step(r83+1,function(e84,r84){if(e84)return done(e84);step(r84+1,function(e85,r85){if(e85)return done(e85);step(r85+1,function(e86,r86){if(e86)return done(e86);step(r86+1,function(e87,r87){if(e87)return done(e87);step(r87+1,function(e88,r88){if(e88)return done(e88);step(r88+1,function(e89,r89){if(e89)return done(e89);step(r89+1,function(e90,r90){if(e90)return done(e90);step(r90+1,function(e91,r91){if(e91)return done(e91);step(r91+1,function(e92,r92){if(e92)return done(e92);step(r92+1,function(e93,r93){if(e93)return done(e93);step(r93+1,function(e94,r94){if(e94)return done(e94);step(r94+1,function(e95,r95){if(e95)return done(e95);step(r95+1,function(e96,r96){if(e96)return done(e96);step(r96+1,function(e97,r97){if(e97)return done(e97);step(r97+1,function(e98,r98){if(e98)return done(e98);step(r98+1,function(e99,r99){if(e99)return done(e99);step(r99+1,function(e100,r100){if(e100)return done(e100);step(r100+1,function(e101,r101){if(e101)return done(e101);step(r101+1,function(e102,r102){if(e102)return done(e102);step(r102+1,function(e103,r103){if(e103)return done(e103);step(r103+1,function(e104,r104){if(e104)return done(e104);step(r104+1,function(e105,r105){if(e105)return done(e105);step(r105+1,function(e106,r106){if(e106)return done(e106);step(r106+1,function(e107,r107){if(e107)return done(e107);step(r107+1,function(e108,r108){if(e108)return done(e108);step(r108+1,function(e109,r109){if(e109)return done(e109);step(r109+1,function(e110,r110){if(e110)return done(e110);step(r110+1,function(e111,r111){if(e111)return done(e111);step(r111+1,function(e112,r112){if(e112)return done(e112);step(r112+1,function(e113,r113){if(e113)return done(e113);step(r113+1,function(e114,r114){if(e114)return done(e114);step(r114+1,function(e115,r115){if(e115)return done(e115);step(r115+1,function(e116,r116){if(e116)return done(e116);step(r116+1,function(e117,r117){if(e117)return done(e117);step(r117+1,function(e118,r118){if(e118)return done(e118);step(r118+1,function(e119,r119){if(e119)return done(e119);step(r119+1,function(e120,r120){if(e120)return done(e120);step(r120+1,function(e121,r121){if(e121)return done(e121);step(r121+1,function(e122,r122){if(e122)return done(e122);step(r122+1,function(e123,r123){if(e123)return done(e123);step(r123+1,function(e124,r124){if(e124)return done(e124);step(r124+1,function(e125,r125){if(e125)return done(e125);step(r125+1,function(e126,r126){if(e126)return done(e126);step(r126+1,function(e127,r127){if(e127)return done(e127);step(r127+1,function(e128,r128){if(e128)return done(e128);step(r128+1,function(e129,r129){if(e129)return done(e129);step(r129+1,function(e130,r130){if(e130)return done(e130);step(r130+1,function(e131,r131){if(e131)return done(e131);step(r131+1,function(e132,r132){if(e132)return done(e132);step(r132+1,function(e133,r133){if(e133)return done(e133);step(r133+1,function(e134,r134){if(e134)return done(e134);step(r134+1,function(e135,r135){if(e135)return done(e135);step(r135+1,function(e136,r136){if(e136)return done(e136);step(r136+1,function(e137,r137){if(e137)return done(e137);step(r137+1,function(e138,r138){if(e138)return done(e138);step(r138+1,function(e139,r139){if(e139)return done(e139);step(r139+1,function(e140,r140){if(e140)return done(e140);step(r140+1,function(e141,r141){if(e141)return done(e141);step(r141+1,function(e142,r142){if(e142)return done(e142);step(r142+1,function(e143,r143){if(e143)return done(e143);step(r143+1,function(e144,r144){if(e144)return done(e144);step(r144+1,function(e145,r145){if(e145)return done(e145);step(r145+1,function(e146,r146){if(e146)return done(e146);step(r146+1,function(e147,r147){if(e147)return done(e147);step(r147+1,function(e148,r148){if(e148)return done(e148);step(r148+1,function(e149,r149){if(e149)return done(e149);step(r149+1,function(e150,r150){if(e150)return done(e150);step(r150+1,function(e151,r151){if(e151)return done(e151);step(r151+1,function(e152,r152){if(e152)return done(e152);step(r152+1,function(e153,r153){if(e153)return done(e153);step(r153+1,function(e154,r154){if(e154)return done(e154);step(r154+1,function(e155,r155){if(e155)return done(e155);step(r155+1,function(e156,r156){if(e156)return done(e156);step(r156+1,function(e157,r157){if(e157)return done(e157);step(r157+1,function(e158,r158){if(e158)return done(e158);step(r158+1,function(e159,r159){if(e159)return done(e159);step(r159+1,function(e160,r160){if(e160)return done(e160);step(r160+1,function(e161,r161){if(e161)return done(e161);step(r161+1,function(e162,r162){if(e162)return done(e162);step(r162+1,function(e163,r163){if(e163)return done(e163);step(r163+1,function(e164,r164){if(e164)return done(e164);step(r164+1,function(e165,r165){if(e165)return done(e165);step(r165+1,function(e166,r166){if(e166)return done(e166);step(r166+1,function(e167,r167){if(e167)return done(e167);step(r167+1,function(e168,r168){if(e168)return done(e168);step(r168+1,function(e169,r169){if(e169)return done(e169);step(r169+1,function(e170,r170){if(e170)return done(e170);step(r170+1,function(e171,r171){if(e171)return done(e171);step(r171+1,function(e172,r172){if(e172)return done(e172);step(r172+1,function(e173,r173){if(e173)return done(e173);step(r173+1,function(e174,r174){if(e174)return done(e174);step(r174+1,function(e175,r175){if(e175)return done(e175);step(r175+1,function(e176,r176){if(e176)return done(e176);step(r176+1,function(e177,r177){if(e177)return done(e177);step(r177+1,function(e178,r178){if(e178)return done(e178);step(r178+1,function(e179,r179){if(e179)return done(e179);step(r179+1,function(e180,r180){if(e180)return done(e180);step(r180+1,function(e181,r181){if(e181)return done(e181);step(r181+1,function(e182,r182){if(e182)return done(e182);step(r182+1,function(e183,r183){if(e183)return done(e183);step(r183+1,function(e184,r184){if(e184)return done(e184);step(r184+1,function(e185,r185){if(e185)return done(e185);step(r185+1,function(e186,r186){if(e186)return done(e186);step(r186+1,done)})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})});
+var tree12={k0:[0,{k1:[1,{k2:[2,{k3:[3,{k4:[4,{k5:[5,{k6:[6,{k7:[7,{k8:[8,{k9:[9,{k10:[10,{k11:[11,{k12:[12,{k13:[13,{k14:[14,{k15:[15,{k16:[16,{k17:[17,{k18:[18,{k19:[19,{k20:[20,{k21:[21,{k22:[22,{k23:[23,{k24:[24,{k25:[25,{k26:[26,{k27:[27,{k28:[28,{k29:[29,{k30:[30,{k31:[31,{k32:[32,{k33:[33,{k34:[34,{k35:[35,{k36:[36,{k37:[37,{k38:[38,{k39:[39,{k40:[40,{k41:[41,{k42:[42,{k43:[43,{k44:[44,{k45:[45,{k46:[46,{k47:[47,{k48:[48,{k49:[49,{k50:[50,{k51:[51,{k52:[52,{k53:[53,{k54:[54,{k55:[55,{k56:[56,{k57:[57,{k58:[58,{k59:[59,{k60:[60,{k61:[61,{k62:[62,{k63:[63,{k64:[64,{k65:[65,{k66:[66,{k67:[67,{k68:[68,{k69:[69,{k70:[70,{k71:[71,{k72:[72,{k73:[73,{k74:[74,{k75:[75,{k76:[76,{k77:[77,{k78:[78,{k79:[79,{k80:[80,{k81:[81,{k82:[82,{k83:[83,null]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]};
+function deep13(n){if(n>0){for(var i1=0;i1<n;i1++){while(n-->2){try{switch(n){case 4:{if(n>5){for(var i6=0;i6<n;i6++){while(n-->7){try{switch(n){case 9:{if(n>10){for(var i11=0;i11<n;i11++){while(n-->12){try{switch(n){case 14:{if(n>15){for(var i16=0;i16<n;i16++){while(n-->17){try{switch(n){case 19:{if(n>20){for(var i21=0;i21<n;i21++){while(n-->22){try{switch(n){case 24:{if(n>25){for(var i26=0;i26<n;i26++){while(n-->27){try{switch(n){case 29:{if(n>30){for(var i31=0;i31<n;i31++){while(n-->32){try{switch(n){case 34:{if(n>35){for(var i36=0;i36<n;i36++){while(n-->37){try{switch(n){case 39:{if(n>40){for(var i41=0;i41<n;i41++){while(n-->42){try{switch(n){case 44:{if(n>45){for(var i46=0;i46<n;i46++){while(n-->47){try{switch(n){case 49:{if(n>50){for(var i51=0;i51<n;i51++){while(n-->52){try{switch(n){case 54:{if(n>55){for(var i56=0;i56<n;i56++){while(n-->57){try{switch(n){case 59:{if(n>60){for(var i61=0;i61<n;i61++){while(n-->62){try{switch(n){case 64:{if(n>65){for(var i66=0;i66<n;i66++){while(n-->67){try{switch(n){case 69:{if(n>70){for(var i71=0;i71<n;i71++){while(n-->72){try{switch(n){case 74:{if(n>75){for(var i76=0;i76<n;i76++){while(n-->77){try{switch(n){case 79:{if(n>80){for(var i81=0;i81<n;i81++){while(n-->82){try{switch(n){case 84:{if(n>85){for(var i86=0;i86<n;i86++){while(n-->87){try{switch(n){case 89:{if(n>90){for(var i91=0;i91<n;i91++){while(n-->92){try{switch(n){case 94:{if(n>95){for(var i96=0;i96<n;i96++){while(n-->97){try{switch(n){case 99:{if(n>100){for(var i101=0;i101<n;i101++){while(n-->102){try{switch(n){case 104:{if(n>105){for(var i106=0;i106<n;i106++){while(n-->107){try{switch(n){case 109:{if(n>110){for(var i111=0;i111<n;i111++){while(n-->112){try{switch(n){case 114:{if(n>115){for(var i116=0;i116<n;i116++){while(n-->117){try{switch(n){case 119:{if(n>120){n--;}}}}catch(e118){n=0}}}}}}}catch(e113){n=0}}}}}}}catch(e108){n=0}}}}}}}catch(e103){n=0}}}}}}}catch(e98){n=0}}}}}}}catch(e93){n=0}}}}}}}catch(e88){n=0}}}}}}}catch(e83){n=0}}}}}}}catch(e78){n=0}}}}}}}catch(e73){n=0}}}}}}}catch(e68){n=0}}}}}}}catch(e63){n=0}}}}}}}catch(e58){n=0}}}}}}}catch(e53){n=0}}}}}}}catch(e48){n=0}}}}}}}catch(e43){n=0}}}}}}}catch(e38){n=0}}}}}}}catch(e33){n=0}}}}}}}catch(e28){n=0}}}}}}}catch(e23){n=0}}}}}}}catch(e18){n=0}}}}}}}catch(e13){n=0}}}}}}}catch(e8){n=0}}}}}}}catch(e3){n=0}}}}return n}
+var chain14=Promise.resolve(0).then(v=>{const w=v+0;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+1;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+2;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+3;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+4;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+5;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+6;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+7;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+8;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+9;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+10;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+11;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+12;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+13;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+14;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+15;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+16;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+17;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+18;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+19;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+20;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+21;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+22;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+23;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+24;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+25;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+26;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+27;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+28;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+29;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+30;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+31;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+32;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+33;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+34;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+35;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+36;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+37;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+38;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+39;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+40;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+41;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+42;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+43;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+44;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+45;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+46;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+47;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+48;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+49;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+50;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+51;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+52;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+53;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+54;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+55;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+56;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+57;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+58;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+59;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+60;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+61;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+62;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+63;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+64;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+65;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+66;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+67;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+68;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+69;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+70;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+71;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+72;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+73;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+74;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+75;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+76;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+77;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+78;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+79;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+80;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+81;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+82;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+83;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+84;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+85;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+86;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+87;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+88;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+89;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+90;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+91;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+92;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+93;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+94;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+95;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+96;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+97;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+98;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+99;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+100;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+101;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+102;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+103;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+104;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+105;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+106;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+107;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+108;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+109;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+110;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+111;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+112;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+113;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+114;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+115;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+116;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+117;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+118;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+119;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+120;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+121;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+122;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+123;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+124;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+125;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+126;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+127;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+128;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+129;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+130;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+131;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+132;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+133;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+134;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+135;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+136;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+137;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+138;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+139;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+140;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+141;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+142;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+143;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+144;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+145;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+146;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+147;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+148;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+149;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+150;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+151;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+152;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+153;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+154;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+155;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+156;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+157;return (x=>y=>x*y)(w)(2)});
+function f15_0(a){var x0=a+0;function f15_1(a){var x1=a+1;function f15_2(a){var x2=a+2;function f15_3(a){var x3=a+3;function f15_4(a){var x4=a+4;function f15_5(a){var x5=a+5;function f15_6(a){var x6=a+6;function f15_7(a){var x7=a+7;function f15_8(a){var x8=a+8;function f15_9(a){var x9=a+9;function f15_10(a){var x10=a+10;function f15_11(a){var x11=a+11;function f15_12(a){var x12=a+12;function f15_13(a){var x13=a+13;function f15_14(a){var x14=a+14;function f15_15(a){var x15=a+15;function f15_16(a){var x16=a+16;function f15_17(a){var x17=a+17;function f15_18(a){var x18=a+18;function f15_19(a){var x19=a+19;function f15_20(a){var x20=a+20;function f15_21(a){var x21=a+21;function f15_22(a){var x22=a+22;function f15_23(a){var x23=a+23;function f15_24(a){var x24=a+24;function f15_25(a){var x25=a+25;function f15_26(a){var x26=a+26;function f15_27(a){var x27=a+27;function f15_28(a){var x28=a+28;function f15_29(a){var x29=a+29;function f15_30(a){var x30=a+30;function f15_31(a){var x31=a+31;function f15_32(a){var x32=a+32;function f15_33(a){var x33=a+33;function f15_34(a){var x34=a+34;function f15_35(a){var x35=a+35;function f15_36(a){var x36=a+36;function f15_37(a){var x37=a+37;function f15_38(a){var x38=a+38;function f15_39(a){var x39=a+39;function f15_40(a){var x40=a+40;function f15_41(a){var x41=a+41;function f15_42(a){var x42=a+42;function f15_43(a){var x43=a+43;function f15_44(a){var x44=a+44;function f15_45(a){var x45=a+45;function f15_46(a){var x46=a+46;function f15_47(a){var x47=a+47;function f15_48(a){var x48=a+48;function f15_49(a){var x49=a+49;function f15_50(a){var x50=a+50;function f15_51(a){var x51=a+51;function f15_52(a){var x52=a+52;function f15_53(a){var x53=a+53;function f15_54(a){var x54=a+54;function f15_55(a){var x55=a+55;function f15_56(a){var x56=a+56;function f15_57(a){var x57=a+57;function f15_58(a){var x58=a+58;function f15_59(a){var x59=a+59;function f15_60(a){var x60=a+60;function f15_61(a){var x61=a+61;function f15_62(a){var x62=a+62;function f15_63(a){var x63=a+63;function f15_64(a){var x64=a+64;function f15_65(a){var x65=a+65;function f15_66(a){var x66=a+66;function f15_67(a){var x67=a+67;function f15_68(a){var x68=a+68;function f15_69(a){var x69=a+69;function f15_70(a){var x70=a+70;function f15_71(a){var x71=a+71;function f15_72(a){var x72=a+72;function f15_73(a){var x73=a+73;function f15_74(a){var x74=a+74;function f15_75(a){var x75=a+75;function f15_76(a){var x76=a+76;function f15_77(a){var x77=a+77;function f15_78(a){var x78=a+78;function f15_79(a){var x79=a+79;function f15_80(a){var x80=a+80;function f15_81(a){var x81=a+81;function f15_82(a){var x82=a+82;function f15_83(a){var x83=a+83;function f15_84(a){var x84=a+84;function f15_85(a){var x85=a+85;function f15_86(a){var x86=a+86;function f15_87(a){var x87=a+87;function f15_88(a){var x88=a+88;function f15_89(a){var x89=a+89;function f15_90(a){var x90=a+90;function f15_91(a){var x91=a+91;function f15_92(a){var x92=a+92;function f15_93(a){var x93=a+93;function f15_94(a){var x94=a+94;function f15_95(a){var x95=a+95;function f15_96(a){var x96=a+96;function f15_97(a){var x97=a+97;function f15_98(a){var x98=a+98;function f15_99(a){var x99=a+99;function f15_100(a){var x100=a+100;function f15_101(a){var x101=a+101;function f15_102(a){var x102=a+102;function f15_103(a){var x103=a+103;function f15_104(a){var x104=a+104;function f15_105(a){var x105=a+105;function f15_106(a){var x106=a+106;function f15_107(a){var x107=a+107;function f15_108(a){var x108=a+108;function f15_109(a){var x109=a+109;function f15_110(a){var x110=a+110;function f15_111(a){var x111=a+111;function f15_112(a){var x112=a+112;function f15_113(a){var x113=a+113;function f15_114(a){var x114=a+114;function f15_115(a){var x115=a+115;function f15_116(a){var x116=a+116;function f15_117(a){var x117=a+117;function f15_118(a){var x118=a+118;function f15_119(a){var x119=a+119;function f15_120(a){var x120=a+120;function f15_121(a){var x121=a+121;function f15_122(a){var x122=a+122;function f15_123(a){var x123=a+123;function f15_124(a){var x124=a+124;function f15_125(a){var x125=a+125;function f15_126(a){var x126=a+126;function f15_127(a){var x127=a+127;function f15_128(a){var x128=a+128;function f15_129(a){var x129=a+129;function f15_130(a){var x130=a+130;function f15_131(a){var x131=a+131;function f15_132(a){var x132=a+132;function f15_133(a){var x133=a+133;function f15_134(a){var x134=a+134;function f15_135(a){var x135=a+135;function f15_136(a){var x136=a+136;function f15_137(a){var x137=a+137;function f15_138(a){var x138=a+138;function f15_139(a){var x139=a+139;function f15_140(a){var x140=a+140;function f15_141(a){var x141=a+141;function f15_142(a){var x142=a+142;function f15_143(a){var x143=a+143;function f15_144(a){var x144=a+144;function f15_145(a){var x145=a+145;function f15_146(a){var x146=a+146;function f15_147(a){var x147=a+147;function f15_148(a){var x148=a+148;function f15_149(a){var x149=a+149;function f15_150(a){var x150=a+150;function f15_151(a){var x151=a+151;function f15_152(a){var x152=a+152;function f15_153(a){var x153=a+153;function f15_154(a){var x154=a+154;function f15_155(a){var x155=a+155;function f15_156(a){var x156=a+156;function f15_157(a){var x157=a+157;function f15_158(a){var x158=a+158;function f15_159(a){var x159=a+159;function f15_160(a){var x160=a+160;function f15_161(a){var x161=a+161;function f15_162(a){var x162=a+162;function f15_163(a){var x163=a+163;function f15_164(a){var x164=a+164;function f15_165(a){var x165=a+165;function f15_166(a){var x166=a+166;function f15_167(a){var x167=a+167;function f15_168(a){var x168=a+168;function f15_169(a){var x169=a+169;function f15_170(a){var x170=a+170;function f15_171(a){var x171=a+171;function f15_172(a){var x172=a+172;function f15_173(a){var x173=a+173;function f15_174(a){var x174=a+174;function f15_175(a){var x175=a+175;function f15_176(a){var x176=a+176;function f15_177(a){var x177=a+177;function f15_178(a){var x178=a+178;function f15_179(a){var x179=a+179;function f15_180(a){var x180=a+180;function f15_181(a){var x181=a+181;function f15_182(a){var x182=a+182;function f15_183(a){var x183=a+183;function f15_184(a){var x184=a+184;function f15_185(a){var x185=a+185;function f15_186(a){var x186=a+186;function f15_187(a){var x187=a+187;function f15_188(a){var x188=a+188;function f15_189(a){var x189=a+189;function f15_190(a){var x190=a+190;function f15_191(a){var x191=a+191;function f15_192(a){var x192=a+192;function f15_193(a){var x193=a+193;function f15_194(a){var x194=a+194;return x194;}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+step(0,function(e0,r0){if(e0)return done(e0);step(r0+1,function(e1,r1){if(e1)return done(e1);step(r1+1,function(e2,r2){if(e2)return done(e2);step(r2+1,function(e3,r3){if(e3)return done(e3);step(r3+1,function(e4,r4){if(e4)return done(e4);step(r4+1,function(e5,r5){if(e5)return done(e5);step(r5+1,function(e6,r6){if(e6)return done(e6);step(r6+1,function(e7,r7){if(e7)return done(e7);step(r7+1,function(e8,r8){if(e8)return done(e8);step(r8+1,function(e9,r9){if(e9)return done(e9);step(r9+1,function(e10,r10){if(e10)return done(e10);step(r10+1,function(e11,r11){if(e11)return done(e11);step(r11+1,function(e12,r12){if(e12)return done(e12);step(r12+1,function(e13,r13){if(e13)return done(e13);step(r13+1,function(e14,r14){if(e14)return done(e14);step(r14+1,function(e15,r15){if(e15)return done(e15);step(r15+1,function(e16,r16){if(e16)return done(e16);step(r16+1,function(e17,r17){if(e17)return done(e17);step(r17+1,function(e18,r18){if(e18)return done(e18);step(r18+1,function(e19,r19){if(e19)return done(e19);step(r19+1,function(e20,r20){if(e20)return done(e20);step(r20+1,function(e21,r21){if(e21)return done(e21);step(r21+1,function(e22,r22){if(e22)return done(e22);step(r22+1,function(e23,r23){if(e23)return done(e23);step(r23+1,function(e24,r24){if(e24)return done(e24);step(r24+1,function(e25,r25){if(e25)return done(e25);step(r25+1,function(e26,r26){if(e26)return done(e26);step(r26+1,function(e27,r27){if(e27)return done(e27);step(r27+1,function(e28,r28){if(e28)return done(e28);step(r28+1,function(e29,r29){if(e29)return done(e29);step(r29+1,function(e30,r30){if(e30)return done(e30);step(r30+1,function(e31,r31){if(e31)return done(e31);step(r31+1,function(e32,r32){if(e32)return done(e32);step(r32+1,function(e33,r33){if(e33)return done(e33);step(r33+1,function(e34,r34){if(e34)return done(e34);step(r34+1,function(e35,r35){if(e35)return done(e35);step(r35+1,function(e36,r36){if(e36)return done(e36);step(r36+1,function(e37,r37){if(e37)return done(e37);step(r37+1,function(e38,r38){if(e38)return done(e38);step(r38+1,function(e39,r39){if(e39)return done(e39);step(r39+1,function(e40,r40){if(e40)return done(e40);step(r40+1,function(e41,r41){if(e41)return done(e41);step(r41+1,function(e42,r42){if(e42)return done(e42);step(r42+1,function(e43,r43){if(e43)return done(e43);step(r43+1,function(e44,r44){if(e44)return done(e44);step(r44+1,function(e45,r45){if(e45)return done(e45);step(r45+1,function(e46,r46){if(e46)return done(e46);step(r46+1,function(e47,r47){if(e47)return done(e47);step(r47+1,function(e48,r48){if(e48)return done(e48);step(r48+1,function(e49,r49){if(e49)return done(e49);step(r49+1,function(e50,r50){if(e50)return done(e50);step(r50+1,function(e51,r51){if(e51)return done(e51);step(r51+1,function(e52,r52){if(e52)return done(e52);step(r52+1,function(e53,r53){if(e53)return done(e53);step(r53+1,function(e54,r54){if(e54)return done(e54);step(r54+1,function(e55,r55){if(e55)return done(e55);step(r55+1,function(e56,r56){if(e56)return done(e56);step(r56+1,function(e57,r57){if(e57)return done(e57);step(r57+1,function(e58,r58){if(e58)return done(e58);step(r58+1,function(e59,r59){if(e59)return done(e59);step(r59+1,function(e60,r60){if(e60)return done(e60);step(r60+1,function(e61,r61){if(e61)return done(e61);step(r61+1,function(e62,r62){if(e62)return done(e62);step(r62+1,function(e63,r63){if(e63)return done(e63);step(r63+1,function(e64,r64){if(e64)return done(e64);step(r64+1,function(e65,r65){if(e65)return done(e65);step(r65+1,function(e66,r66){if(e66)return done(e66);step(r66+1,function(e67,r67){if(e67)return done(e67);step(r67+1,function(e68,r68){if(e68)return done(e68);step(r68+1,function(e69,r69){if(e69)return done(e69);step(r69+1,function(e70,r70){if(e70)return done(e70);step(r70+1,function(e71,r71){if(e71)return done(e71);step(r71+1,function(e72,r72){if(e72)return done(e72);step(r72+1,function(e73,r73){if(e73)return done(e73);step(r73+1,function(e74,r74){if(e74)return done(e74);step(r74+1,function(e75,r75){if(e75)return done(e75);step(r75+1,function(e76,r76){if(e76)return done(e76);step(r76+1,function(e77,r77){if(e77)return done(e77);step(r77+1,function(e78,r78){if(e78)return done(e78);step(r78+1,function(e79,r79){if(e79)return done(e79);step(r79+1,function(e80,r80){if(e80)return done(e80);step(r80+1,function(e81,r81){if(e81)return done(e81);step(r81+1,function(e82,r82){if(e82)return done(e82);step(r82+1,function(e83,r83){if(e83)return done(e83);step(r83+1,function(e84,r84){if(e84)return done(e84);step(r84+1,function(e85,r85){if(e85)return done(e85);step(r85+1,function(e86,r86){if(e86)return done(e86);step(r86+1,function(e87,r87){if(e87)return done(e87);step(r87+1,function(e88,r88){if(e88)return done(e88);step(r88+1,function(e89,r89){if(e89)return done(e89);step(r89+1,function(e90,r90){if(e90)return done(e90);step(r90+1,function(e91,r91){if(e91)return done(e91);step(r91+1,done)})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})})});
+var tree17={k0:[0,{k1:[1,{k2:[2,{k3:[3,{k4:[4,{k5:[5,{k6:[6,{k7:[7,{k8:[8,{k9:[9,{k10:[10,{k11:[11,{k12:[12,{k13:[13,{k14:[14,{k15:[15,{k16:[16,{k17:[17,{k18:[18,{k19:[19,{k20:[20,{k21:[21,{k22:[22,{k23:[23,{k24:[24,{k25:[25,{k26:[26,{k27:[27,{k28:[28,{k29:[29,{k30:[30,{k31:[31,{k32:[32,{k33:[33,{k34:[34,{k35:[35,{k36:[36,{k37:[37,{k38:[38,{k39:[39,{k40:[40,{k41:[41,{k42:[42,{k43:[43,{k44:[44,{k45:[45,{k46:[46,{k47:[47,{k48:[48,{k49:[49,{k50:[50,{k51:[51,{k52:[52,{k53:[53,{k54:[54,{k55:[55,{k56:[56,{k57:[57,{k58:[58,{k59:[59,{k60:[60,{k61:[61,{k62:[62,{k63:[63,{k64:[64,{k65:[65,{k66:[66,{k67:[67,{k68:[68,{k69:[69,{k70:[70,{k71:[71,{k72:[72,{k73:[73,{k74:[74,{k75:[75,{k76:[76,{k77:[77,{k78:[78,{k79:[79,{k80:[80,{k81:[81,{k82:[82,{k83:[83,{k84:[84,{k85:[85,{k86:[86,{k87:[87,{k88:[88,{k89:[89,{k90:[90,{k91:[91,{k92:[92,{k93:[93,{k94:[94,{k95:[95,{k96:[96,{k97:[97,{k98:[98,{k99:[99,{k100:[100,{k101:[101,{k102:[102,{k103:[103,{k104:[104,{k105:[105,{k106:[106,{k107:[107,{k108:[108,{k109:[109,{k110:[110,{k111:[111,{k112:[112,{k113:[113,{k114:[114,{k115:[115,{k116:[116,{k117:[117,{k118:[118,{k119:[119,{k120:[120,{k121:[121,{k122:[122,{k123:[123,{k124:[124,{k125:[125,{k126:[126,{k127:[127,{k128:[128,null]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]}]};
+function deep18(n){if(n>0){for(var i1=0;i1<n;i1++){while(n-->2){try{switch(n){case 4:{if(n>5){for(var i6=0;i6<n;i6++){while(n-->7){try{switch(n){case 9:{if(n>10){for(var i11=0;i11<n;i11++){while(n-->12){try{switch(n){case 14:{if(n>15){for(var i16=0;i16<n;i16++){while(n-->17){try{switch(n){case 19:{if(n>20){for(var i21=0;i21<n;i21++){while(n-->22){try{switch(n){case 24:{if(n>25){for(var i26=0;i26<n;i26++){while(n-->27){try{switch(n){case 29:{if(n>30){for(var i31=0;i31<n;i31++){while(n-->32){try{switch(n){case 34:{if(n>35){for(var i36=0;i36<n;i36++){while(n-->37){try{switch(n){case 39:{if(n>40){for(var i41=0;i41<n;i41++){while(n-->42){try{switch(n){case 44:{if(n>45){for(var i46=0;i46<n;i46++){while(n-->47){try{switch(n){case 49:{if(n>50){for(var i51=0;i51<n;i51++){while(n-->52){try{switch(n){case 54:{if(n>55){for(var i56=0;i56<n;i56++){while(n-->57){try{switch(n){case 59:{if(n>60){for(var i61=0;i61<n;i61++){while(n-->62){try{switch(n){case 64:{if(n>65){for(var i66=0;i66<n;i66++){while(n-->67){try{switch(n){case 69:{if(n>70){for(var i71=0;i71<n;i71++){while(n-->72){try{switch(n){case 74:{if(n>75){for(var i76=0;i76<n;i76++){while(n-->77){try{switch(n){case 79:{if(n>80){for(var i81=0;i81<n;i81++){while(n-->82){try{switch(n){case 84:{if(n>85){for(var i86=0;i86<n;i86++){while(n-->87){try{switch(n){case 89:{if(n>90){for(var i91=0;i91<n;i91++){while(n-->92){try{switch(n){case 94:{if(n>95){for(var i96=0;i96<n;i96++){while(n-->97){try{switch(n){case 99:{if(n>100){for(var i101=0;i101<n;i101++){while(n-->102){try{switch(n){case 104:{if(n>105){for(var i106=0;i106<n;i106++){while(n-->107){try{switch(n){case 109:{if(n>110){for(var i111=0;i111<n;i111++){while(n-->112){try{switch(n){case 114:{if(n>115){for(var i116=0;i116<n;i116++){while(n-->117){try{switch(n){case 119:{if(n>120){for(var i121=0;i121<n;i121++){while(n-->122){try{switch(n){case 124:{if(n>125){for(var i126=0;i126<n;i126++){while(n-->127){try{switch(n){case 129:{if(n>130){for(var i131=0;i131<n;i131++){while(n-->132){try{switch(n){case 134:{if(n>135){for(var i136=0;i136<n;i136++){while(n-->137){try{switch(n){case 139:{if(n>140){for(var i141=0;i141<n;i141++){while(n-->142){try{switch(n){case 144:{if(n>145){for(var i146=0;i146<n;i146++){while(n-->147){try{switch(n){case 149:{if(n>150){for(var i151=0;i151<n;i151++){while(n-->152){try{switch(n){case 154:{if(n>155){for(var i156=0;i156<n;i156++){while(n-->157){try{switch(n){case 159:{if(n>160){for(var i161=0;i161<n;i161++){while(n-->162){try{switch(n){case 164:{if(n>165){n--;}}}}catch(e163){n=0}}}}}}}catch(e158){n=0}}}}}}}catch(e153){n=0}}}}}}}catch(e148){n=0}}}}}}}catch(e143){n=0}}}}}}}catch(e138){n=0}}}}}}}catch(e133){n=0}}}}}}}catch(e128){n=0}}}}}}}catch(e123){n=0}}}}}}}catch(e118){n=0}}}}}}}catch(e113){n=0}}}}}}}catch(e108){n=0}}}}}}}catch(e103){n=0}}}}}}}catch(e98){n=0}}}}}}}catch(e93){n=0}}}}}}}catch(e88){n=0}}}}}}}catch(e83){n=0}}}}}}}catch(e78){n=0}}}}}}}catch(e73){n=0}}}}}}}catch(e68){n=0}}}}}}}catch(e63){n=0}}}}}}}catch(e58){n=0}}}}}}}catch(e53){n=0}}}}}}}catch(e48){n=0}}}}}}}catch(e43){n=0}}}}}}}catch(e38){n=0}}}}}}}catch(e33){n=0}}}}}}}catch(e28){n=0}}}}}}}catch(e23){n=0}}}}}}}catch(e18){n=0}}}}}}}catch(e13){n=0}}}}}}}catch(e8){n=0}}}}}}}catch(e3){n=0}}}}return n}
+var chain19=Promise.resolve(0).then(v=>{const w=v+0;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+1;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+2;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+3;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+4;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+5;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+6;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+7;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+8;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+9;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+10;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+11;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+12;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+13;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+14;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+15;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+16;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+17;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+18;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+19;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+20;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+21;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+22;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+23;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+24;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+25;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+26;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+27;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+28;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+29;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+30;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+31;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+32;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+33;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+34;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+35;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+36;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+37;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+38;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+39;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+40;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+41;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+42;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+43;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+44;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+45;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+46;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+47;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+48;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+49;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+50;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+51;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+52;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+53;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+54;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+55;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+56;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+57;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+58;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+59;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+60;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+61;return (x=>y=>x*y)(w)(2)}).then(v=>{const w=v+62;return (x=>y=>x*y)(w)(2)});
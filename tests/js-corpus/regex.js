@@ -0,0 +1,11 @@
+/* js.c benchmark corpus: regular expression literals, which must not be
+ * taken for division or let the brackets in them close blocks */
+function afterIf(x, y) { if (x) /}/.test(y); return 1; }
+function afterWhile(s) { while (s.length) /[)}]/.exec(s) ? s = s.slice(1) : s = ""; return s; }
+function afterFor(a) { var i; for (i = 0; i < a.length; i++) /\{/.test(a[i]) && a.splice(i, 1); return a; }
+function afterElse(s) { if (!s) return 0; else /^\}+$/.test(s); return 2; }
+function divide(a, b, c) { return (a + b) / c / (b || 1); }
+function call(f, g) { var r = f(1) / g(2); if ((r)) /a}b/g.lastIndex = 0; return r; }
+function nested(s) { if (s.match(/(\()/)) /\)}/.test(s); return [s.replace(/\//g, "}"), (s.length) / 2]; }
+function afterReturn(s) { return /["'}]/.test(s) ? 1 : 0; }
+var checks = { brace: /}/, paren: /\)/, klass: /[/}]/, division: (1 + 2) / 3 };
@@ -0,0 +1,1247 @@
+/* js.c benchmark corpus: string tables, as in translations and
+ * generated lookup data */
+var MESSAGES={
+  m0: "retry help redo merge ignore cancel \"quoted\"",
+  "msg.1.rFjAl": 'paste zoom column error \u00e9\u4e2d\t\n',
+  "msg.2.rGgkB": "abort close zoom copy cut edit file none close file abort yes",
+  m3: 'zoom save cut cut save file close open save help no merge \'quoted\'',
+  "msg.4.btap1": 'ignore none information none no all abort information abort save line zoom // not a comment /* nor this */',
+  "msg.5.gzu1B": 'copy edit information',
+  m6: 'paste yes undo line column tab question help help',
+  "msg.7.$Emy7": 'redo paste edit column save',
+  "msg.8.c3eDG": 'line find warning question information redo C:\\path\\to\\file',
+  m9: "undo save abort abort window close select no column select",
+  "msg.10.mIzJI": "undo view column no warning undo window // not a comment /* nor this */",
+  "msg.11.ig1nI": "warning abort warning \"quoted\"",
+  m12: 'save file all select redo find zoom',
+  "msg.13.ccges": "help edit redo yes copy view select cut warning column // not a comment /* nor this */",
+  "msg.14.dzy8s": "view line cancel paste abort select close retry help replace abort",
+  m15: 'ignore file undo redo column edit redo file open tab column',
+  "msg.16.tCIyu": "copy split split all window save ignore column cancel edit merge find C:\\path\\to\\file",
+  "msg.17.d0kho": "question open file information open view cut \u00e9\u4e2d\t\n",
+  m18: 'file yes file save question all tab select column information view C:\\path\\to\\file',
+  "msg.19.y18pt": "information undo open \"quoted\"",
+  "msg.20.lqgib": "yes open redo cut question \u00e9\u4e2d\t\n",
+  m21: "zoom column merge information ignore \u00e9\u4e2d\t\n",
+  "msg.22.voGvo": "ignore open",
+  "msg.23.reGdI": 'open copy question help redo zoom none open',
+  m24: 'zoom all select window cut redo',
+  "msg.25.pFJvh": "retry information all undo C:\\path\\to\\file",
+  "msg.26.mD8bg": 'redo error column \u00e9\u4e2d\t\n',
+  m27: 'retry file replace find window',
+  "msg.28.$nd30": "view find abort abort C:\\path\\to\\file",
+  "msg.29.vmlfb": 'replace select paste view paste ignore no ignore information abort window',
+  m30: "no window file error file none merge error merge paste open",
+  "msg.31.whvC3": "open column abort replace all find ignore help tab",
+  "msg.32._l59r": "zoom warning C:\\path\\to\\file",
+  m33: "select question information C:\\path\\to\\file",
+  "msg.34.g22In": 'tab open open save C:\\path\\to\\file',
+  "msg.35.abIcw": 'ignore view line retry merge C:\\path\\to\\file',
+  m36: "select find \u00e9\u4e2d\t\n",
+  "msg.37.ozxsb": 'find select cancel window view line window no',
+  "msg.38.oFl4y": "retry merge question question yes view paste open tab yes cut \u00e9\u4e2d\t\n",
+  m39: "question window copy merge information line cancel none abort \u00e9\u4e2d\t\n",
+  "msg.40.iAfHc": "cancel information zoom open ignore undo yes no none zoom error \"quoted\"",
+  "msg.41.gyJvx": "cut information select copy // not a comment /* nor this */",
+  m42: 'merge find',
+  "msg.43.o0qpj": 'merge abort all help zoom question redo copy file',
+  "msg.44.uHxJz": "question question information split undo error copy merge redo question all",
+  m45: "ignore find tab question tab file retry find merge edit // not a comment /* nor this */",
+  "msg.46.h549d": "all column window file retry redo view column open all \"quoted\"",
+  "msg.47.p5qEs": "retry save open tab undo none merge cancel no view error",
+  m48: "information cancel paste close view zoom replace error replace",
+  "msg.49.pGges": "ignore error undo abort help close cut no \"quoted\"",
+  "msg.50.jjtyj": 'merge error view none paste close all help replace find column C:\\path\\to\\file',
+  m51: 'line cancel warning \u00e9\u4e2d\t\n',
+  "msg.52.pI1p0": 'help undo find tab select information view error all find zoom',
+  "msg.53.ugc3r": 'replace cancel window edit copy cut retry warning split view cancel',
+  m54: 'find line tab abort cut',
+  "msg.55.gstd1": "cancel select information view close information split all \u00e9\u4e2d\t\n",
+  "msg.56.rcuH5": "split information window abort paste \u00e9\u4e2d\t\n",
+  m57: 'split tab',
+  "msg.58.cbihz": 'undo cut paste edit',
+  "msg.59.d4kH7": 'split abort information cancel merge zoom abort find merge cut',
+  m60: "column view cut zoom file all undo edit",
+  "msg.61.h4k4g": 'cut none retry retry question ignore retry column no split redo zoom \u00e9\u4e2d\t\n',
+  "msg.62.pEB0j": "replace open find copy all close warning none",
+  m63: "none ignore retry C:\\path\\to\\file",
+  "msg.64._AHjx": 'line yes save split paste no yes cut abort replace save information \'quoted\'',
+  "msg.65.jczyF": 'close cancel abort window',
+  m66: "close save redo question redo abort edit cancel retry column yes cut",
+  "msg.67._G6jr": 'cut none none redo',
+  "msg.68.a83id": 'view information retry information split yes edit üñïçödé 文字 😀',
+  m69: 'no all cancel retry copy zoom undo cut save copy find',
+  "msg.70.wIj79": "view paste merge cancel cancel merge help help \u00e9\u4e2d\t\n",
+  "msg.71.b2a2v": 'line warning',
+  m72: "view window cut",
+  "msg.73.znvJe": "all abort tab ignore window retry redo redo line",
+  "msg.74.uhH9t": "merge file line open undo window error none copy all",
+  m75: "all window view zoom cancel undo close \"quoted\"",
+  "msg.76.hgxj8": "close ignore find column zoom none abort",
+  "msg.77.sodh4": 'close view save undo none view file redo no close',
+  m78: "undo help column view ignore zoom information find abort // not a comment /* nor this */",
+  "msg.79.zhAdc": "all file file help error no cancel",
+  "msg.80.pz38y": "all view file zoom paste copy edit warning paste tab error",
+  m81: 'yes abort open file',
+  "msg.82.zbc7e": "select line yes abort yes all undo cut \u00e9\u4e2d\t\n",
+  "msg.83.nhDgJ": 'save open close tab paste cut find zoom zoom paste find C:\\path\\to\\file',
+  m84: "zoom paste split yes save",
+  "msg.85.oqdag": 'no split merge all redo',
+  "msg.86.arimj": 'save yes file find close copy save cancel tab close zoom \'quoted\'',
+  m87: 'line cancel help edit help none find help',
+  "msg.88.qEh0w": 'open abort merge',
+  "msg.89.tJ8m6": 'copy open find redo find replace no split',
+  m90: 'merge copy // not a comment /* nor this */',
+  "msg.91.iwwB7": "zoom column error replace find open all // not a comment /* nor this */",
+  "msg.92.n8x9A": "question tab // not a comment /* nor this */",
+  m93: 'paste split split \u00e9\u4e2d\t\n',
+  "msg.94.qr2JE": 'copy split ignore no abort save help help open edit no help',
+  "msg.95.yzyBv": "edit edit information yes merge split merge find",
+  m96: "warning none column view select select all warning cut cut ignore",
+  "msg.97.sFycB": 'none cut copy split retry information information zoom',
+  "msg.98.dEA6G": 'select information open save file merge retry yes redo C:\\path\\to\\file',
+  m99: "retry no file line error",
+  "msg.100.pmJA7": "merge undo yes no no file warning question question retry",
+  "msg.101.ciBCJ": "information paste tab ignore abort tab question information find üñïçödé 文字 😀",
+  m102: 'retry redo window zoom merge ignore split split copy',
+  "msg.103.pwgBd": "tab find split save // not a comment /* nor this */",
+  "msg.104.ldvwe": "all split line retry cancel zoom all none",
+  m105: "close ignore no redo question none warning no // not a comment /* nor this */",
+  "msg.106.lt981": "zoom none",
+  "msg.107.fDsGk": "close find // not a comment /* nor this */",
+  m108: "information replace paste retry no warning",
+  "msg.109.haFcH": 'split paste view zoom help help no zoom merge all paste window',
+  "msg.110.rkGFu": 'cut cancel error redo ignore split split line C:\\path\\to\\file',
+  m111: 'replace zoom column paste file window',
+  "msg.112.uft65": 'merge split ignore find none',
+  "msg.113.g0swy": 'copy all copy replace abort save close zoom paste split',
+  m114: "all view view ignore information paste zoom paste file yes merge abort \"quoted\"",
+  "msg.115.z1Bq6": 'help ignore save save retry help retry retry line edit redo',
+  "msg.116.sov0I": "tab all replace ignore paste none cancel split retry cut tab paste",
+  m117: 'column retry merge zoom all open none select',
+  "msg.118.esyE4": 'view replace window merge select question ignore yes tab edit // not a comment /* nor this */',
+  "msg.119.q0dtJ": 'find close information error \u00e9\u4e2d\t\n',
+  m120: "redo no split find close abort",
+  "msg.121.cwuf5": "tab warning line edit cut copy cancel",
+  "msg.122.jfDpk": "retry close cut select split line undo information redo help error warning // not a comment /* nor this */",
+  m123: 'question view no yes C:\\path\\to\\file',
+  "msg.124.qegFo": "paste find warning cut view \u00e9\u4e2d\t\n",
+  "msg.125.ifEyo": "line open edit open replace open copy üñïçödé 文字 😀",
+  m126: 'split replace select üñïçödé 文字 😀',
+  "msg.127.d2jDw": 'close none retry view ignore abort redo close',
+  "msg.128.mzqHD": "retry none file line split replace question \"quoted\"",
+  m129: 'merge error view yes \'quoted\'',
+  "msg.130.xm2hd": 'edit question save question cancel none',
+  "msg.131.zg1pr": "question column all line help warning information view paste all save help \u00e9\u4e2d\t\n",
+  m132: "edit undo replace all replace redo ignore copy column cut",
+  "msg.133.d20g6": "retry window close paste information view no no undo yes tab",
+  "msg.134.qEysB": "copy no tab ignore copy ignore undo",
+  m135: 'line information cancel view',
+  "msg.136.jxxFd": "replace zoom cancel ignore select",
+  "msg.137.ywzJF": "cancel replace help all error cancel split warning üñïçödé 文字 😀",
+  m138: "copy split question undo find line information copy column cut",
+  "msg.139.jG3gh": 'all view abort edit information no abort all file split ignore replace',
+  "msg.140.vC5Db": 'copy file all find open find error redo abort \u00e9\u4e2d\t\n',
+  m141: 'file save edit column column window all edit',
+  "msg.142.$udp1": 'merge replace retry line undo warning zoom file abort information find retry \u00e9\u4e2d\t\n',
+  "msg.143.n7e6l": 'paste replace view replace none cancel file',
+  m144: 'help tab warning column warning error close merge save cancel none ignore',
+  "msg.145.bfJfp": 'save edit question merge no yes no question',
+  "msg.146.nucpb": 'all find yes line abort close abort abort information copy C:\\path\\to\\file',
+  m147: 'merge undo close paste split question view help zoom ignore',
+  "msg.148.zf2rB": 'abort replace paste select question retry view select edit file all help',
+  "msg.149.kd7v8": "line error redo information file select undo information yes",
+  m150: "all no ignore edit C:\\path\\to\\file",
+  "msg.151.lwx9a": "window view window help merge question information column \"quoted\"",
+  "msg.152.u8dIu": "help retry save redo help column yes save edit window zoom üñïçödé 文字 😀",
+  m153: "zoom select cancel question find C:\\path\\to\\file",
+  "msg.154.dtarH": 'view information \u00e9\u4e2d\t\n',
+  "msg.155.uq3eD": "column yes warning all // not a comment /* nor this */",
+  m156: "cancel edit information edit edit \u00e9\u4e2d\t\n",
+  "msg.157.jCnev": "close copy yes close file question warning cancel \"quoted\"",
+  "msg.158.d8AiJ": 'undo close select open file üñïçödé 文字 😀',
+  m159: 'no tab yes cancel',
+  "msg.160.u0CFI": "no undo find question \"quoted\"",
+  "msg.161.v23q8": "find edit C:\\path\\to\\file",
+  m162: "none no column",
+  "msg.163.v8emB": "copy redo save",
+  "msg.164.yexra": 'split line üñïçödé 文字 😀',
+  m165: "close information undo abort save save",
+  "msg.166._kHcp": "help split question question question split find find merge all \u00e9\u4e2d\t\n",
+  "msg.167.l5Dx6": 'replace open undo undo open copy information',
+  m168: 'cut help error ignore no close replace yes',
+  "msg.169.vjgFu": 'cancel no',
+  "msg.170.$j4jt": 'find none cancel view cut redo zoom retry // not a comment /* nor this */',
+  m171: "warning warning no cancel help warning yes \u00e9\u4e2d\t\n",
+  "msg.172.z9l3k": "zoom none cancel",
+  "msg.173.y2ug2": 'tab retry help zoom column abort redo close all close retry all \u00e9\u4e2d\t\n',
+  m174: 'cut edit column cancel replace split tab',
+  "msg.175.s8zdA": "error line cancel find C:\\path\\to\\file",
+  "msg.176.e5ptn": 'paste column retry none file',
+  m177: 'edit question error undo column line information all open',
+  "msg.178.b6DsA": 'all save information window select // not a comment /* nor this */',
+  "msg.179.xfwr2": 'cancel select all none edit save file save',
+  m180: "edit save cut",
+  "msg.181.s283E": "copy find all copy save window column retry copy \u00e9\u4e2d\t\n",
+  "msg.182.cAyxh": "open line file question column",
+  m183: "copy redo open",
+  "msg.184.u7Fdf": 'abort view column cut column open zoom yes paste \u00e9\u4e2d\t\n',
+  "msg.185.gIn57": "cancel warning cancel paste select find merge zoom find replace",
+  m186: "paste redo close split copy copy line find file help select tab",
+  "msg.187.o5e5z": 'yes window copy no window error \u00e9\u4e2d\t\n',
+  "msg.188.xH9ob": 'warning information \u00e9\u4e2d\t\n',
+  m189: 'no copy zoom copy edit replace copy cut split yes merge edit',
+  "msg.190.hd81m": 'select retry question',
+  "msg.191.bCCdy": 'split undo abort open save',
+  m192: 'copy question undo information error select column',
+  "msg.193._5sgy": 'none retry cancel redo // not a comment /* nor this */',
+  "msg.194.n3vIk": 'redo help error view tab',
+  m195: 'tab paste find question information select column redo find redo no find \'quoted\'',
+  "msg.196.h4ckt": "question column \u00e9\u4e2d\t\n",
+  "msg.197.fly6x": "cut retry line undo tab file copy none question",
+  m198: 'undo abort copy undo open edit',
+  "msg.199.g8bsh": 'select file view find',
+  "msg.200.ziC9f": "file yes paste file abort information",
+  m201: "replace replace zoom line open merge paste save C:\\path\\to\\file",
+  "msg.202.rkAHw": "cancel none zoom \"quoted\"",
+  "msg.203.ytphd": "copy split warning question edit help close error question yes view",
+  m204: 'yes no no column redo close \'quoted\'',
+  "msg.205.ywGE0": 'replace undo yes window file file',
+  "msg.206.awIwp": 'retry cancel file close copy warning file select',
+  m207: 'no none close cut close cancel split',
+  "msg.208.s2Bvy": 'abort line \'quoted\'',
+  "msg.209.uCBvG": "error error ignore question abort open help tab help merge",
+  m210: "replace window line edit save help split redo C:\\path\\to\\file",
+  "msg.211.ia9fE": 'find edit cancel error',
+  "msg.212.g6nzr": 'copy zoom edit all redo all line tab save column question view',
+  m213: 'open column help view abort',
+  "msg.214.j3Hed": 'ignore all warning error abort paste file warning yes warning none',
+  "msg.215.iHIap": 'information retry select undo column help error yes replace replace',
+  m216: "redo ignore select close no redo no redo split",
+  "msg.217.j6EHI": 'select help open yes window split cut zoom help \u00e9\u4e2d\t\n',
+  "msg.218.lm0x4": "cancel warning copy cancel retry help merge split question close paste \"quoted\"",
+  m219: 'none none question undo split no ignore merge cancel close cut \'quoted\'',
+  "msg.220.mejrE": 'tab ignore',
+  "msg.221.rpi7j": 'cancel undo replace abort retry split edit find zoom \u00e9\u4e2d\t\n',
+  m222: 'split column replace replace tab file abort tab retry file',
+  "msg.223.pJn39": 'cut undo select undo edit edit question ignore line replace select üñïçödé 文字 😀',
+  "msg.224.oIqFa": "ignore window tab copy yes file question cancel \"quoted\"",
+  m225: 'information edit find redo yes window warning yes copy',
+  "msg.226.wGvi0": 'tab ignore all warning all merge abort open save',
+  "msg.227.rtFDc": "edit column",
+  m228: 'find question zoom help line line cancel select help tab tab abort',
+  "msg.229.pidxn": 'error edit split retry tab ignore',
+  "msg.230.hIIwg": 'close question select undo copy file error close error redo abort \u00e9\u4e2d\t\n',
+  m231: "information cancel no save none line cancel replace redo split open C:\\path\\to\\file",
+  "msg.232.eEjGi": 'warning cancel help tab retry close split // not a comment /* nor this */',
+  "msg.233.ktHqs": 'merge save open file close no ignore split file // not a comment /* nor this */',
+  m234: "warning merge select window information help information close none information no \"quoted\"",
+  "msg.235.vpjDw": 'information all retry paste C:\\path\\to\\file',
+  "msg.236.tEze3": 'help abort warning split ignore question file file \'quoted\'',
+  m237: 'cancel cut information view replace retry',
+  "msg.238.$meHg": 'error edit find retry information retry line \u00e9\u4e2d\t\n',
+  "msg.239.k4x8n": 'undo no all information close no merge none redo paste',
+  m240: 'find retry paste C:\\path\\to\\file',
+  "msg.241.fko49": 'cancel yes line view redo view',
+  "msg.242.vD1a8": "error split no cancel help ignore yes line no retry \"quoted\"",
+  m243: 'ignore question redo retry \'quoted\'',
+  "msg.244._Hb5J": 'cut zoom view line view open column window ignore abort retry \u00e9\u4e2d\t\n',
+  "msg.245.vDFIA": "cancel none save warning file merge column none no question",
+  m246: "abort redo all window help select save open column split redo \u00e9\u4e2d\t\n",
+  "msg.247._DJb7": "redo tab none tab question cut open view edit none question \"quoted\"",
+  "msg.248.usr6G": "warning all error edit merge paste \u00e9\u4e2d\t\n",
+  m249: "error undo edit yes // not a comment /* nor this */",
+  "msg.250.ty5B4": 'tab file \u00e9\u4e2d\t\n',
+  "msg.251.pldpH": 'zoom replace help paste find question merge close cut edit question tab C:\\path\\to\\file',
+  m252: "open no // not a comment /* nor this */",
+  "msg.253.w0AC0": "file zoom redo",
+  "msg.254.lrm3f": 'none paste retry C:\\path\\to\\file',
+  m255: 'redo help cut merge replace merge cancel \u00e9\u4e2d\t\n',
+  "msg.256.zxgGG": "save copy tab",
+  "msg.257.dJAx0": "column line retry ignore question paste copy ignore save",
+  m258: "help all undo copy find open find paste zoom \u00e9\u4e2d\t\n",
+  "msg.259.i7J6B": 'retry help all',
+  "msg.260.ufp3p": "error redo \u00e9\u4e2d\t\n",
+  m261: "find cancel help",
+  "msg.262._DDB1": 'warning cancel copy open help abort paste cut split C:\\path\\to\\file',
+  "msg.263.hD1Az": "save question open cancel redo column",
+  m264: "window close no split cancel zoom // not a comment /* nor this */",
+  "msg.265.rhsjd": "find question cancel all abort",
+  "msg.266._rme9": 'no question ignore retry undo ignore information',
+  m267: "error tab warning paste cancel yes edit \u00e9\u4e2d\t\n",
+  "msg.268.uE4Eo": 'cut undo',
+  "msg.269.ecF4y": 'information no replace cut cancel replace replace yes no file',
+  m270: "column all replace cancel save no line close find cut // not a comment /* nor this */",
+  "msg.271.kD76e": 'file retry none view open save error ignore none abort C:\\path\\to\\file',
+  "msg.272.cgf2g": "view replace save window tab window none warning ignore line // not a comment /* nor this */",
+  m273: "column close \u00e9\u4e2d\t\n",
+  "msg.274.wCbGw": 'paste zoom file save question edit line copy tab yes warning \'quoted\'',
+  "msg.275.gej0f": "window help ignore open tab paste C:\\path\\to\\file",
+  m276: "find tab edit warning file paste warning warning",
+  "msg.277.j89Ax": 'merge line split undo close no \u00e9\u4e2d\t\n',
+  "msg.278.fHobr": 'view line // not a comment /* nor this */',
+  m279: 'redo yes view',
+  "msg.280.w3xkd": "window open all file \"quoted\"",
+  "msg.281.oxqAH": "open no",
+  m282: 'paste information merge',
+  "msg.283.mvpyC": "window warning undo warning redo save undo save \u00e9\u4e2d\t\n",
+  "msg.284.ob8Dw": "tab merge ignore",
+  m285: "open redo view question yes üñïçödé 文字 😀",
+  "msg.286.pHFid": "close split C:\\path\\to\\file",
+  "msg.287.eEJ8t": "merge close ignore zoom warning cut üñïçödé 文字 😀",
+  m288: 'cut select retry abort line select warning',
+  "msg.289.gilcC": "replace information",
+  "msg.290.lEIFn": 'information abort',
+  m291: "cut all zoom edit file column",
+  "msg.292.k2ld3": 'find open redo save tab tab all merge zoom all edit \'quoted\'',
+  "msg.293.aJmz3": "all replace undo \"quoted\"",
+  m294: 'copy file select cancel open warning copy cancel \'quoted\'',
+  "msg.295.j3C0r": "open find open help select abort copy yes select retry paste",
+  "msg.296.rEf5v": 'abort split',
+  m297: 'copy column',
+  "msg.298.oIJam": 'abort edit none merge abort',
+  "msg.299.rkCc1": "ignore information copy copy copy undo open merge save split",
+  m300: 'split save replace retry \'quoted\'',
+  "msg.301.hjwq3": "help ignore view abort column help ignore find \"quoted\"",
+  "msg.302.gDcb4": "line abort file retry merge undo question question // not a comment /* nor this */",
+  m303: "abort select window yes cut zoom C:\\path\\to\\file",
+  "msg.304.rg6vp": 'merge column ignore ignore none line redo cut warning split cut save // not a comment /* nor this */',
+  "msg.305.zjbbE": 'select close information yes line redo',
+  m306: 'all file find error tab \'quoted\'',
+  "msg.307.geoeB": "select view retry warning zoom information none",
+  "msg.308.iiH2C": 'all file close copy undo redo information select redo copy close tab \u00e9\u4e2d\t\n',
+  m309: "all no copy window close help view \"quoted\"",
+  "msg.310.wwqi3": 'warning edit information üñïçödé 文字 😀',
+  "msg.311.fb7eG": "cancel save line find view undo no file",
+  m312: "question merge copy file C:\\path\\to\\file",
+  "msg.313.ou8CE": "replace undo redo select line retry replace zoom copy find C:\\path\\to\\file",
+  "msg.314.mCj95": 'view ignore column close undo cancel close paste',
+  m315: 'open copy split \'quoted\'',
+  "msg.316.qtaio": 'merge paste close warning \'quoted\'',
+  "msg.317.wsekC": "warning error select cut \"quoted\"",
+  m318: "redo select cut retry open cut select copy",
+  "msg.319.bqIA1": 'tab column open merge information cancel copy',
+  "msg.320.y784f": "line all view no save error save merge warning paste C:\\path\\to\\file",
+  m321: "retry column column redo",
+  "msg.322.jjae4": "warning line undo retry split retry save tab warning cancel zoom C:\\path\\to\\file",
+  "msg.323.e4nio": "view undo yes yes copy question \"quoted\"",
+  m324: 'line paste ignore retry all redo ignore select cut close file \u00e9\u4e2d\t\n',
+  "msg.325.rq06H": "ignore open select no find paste",
+  "msg.326.fAdzE": "cancel undo window retry information paste edit",
+  m327: 'find find merge all question retry merge',
+  "msg.328.dAm4d": "redo ignore find retry error paste no error all question",
+  "msg.329.dgsxc": "open close paste",
+  m330: "no save redo warning merge close retry select information open // not a comment /* nor this */",
+  "msg.331.jg9Jq": 'all find retry find column abort open split redo line',
+  "msg.332.$ujGa": "all cancel select undo",
+  m333: "edit undo split column copy copy abort find",
+  "msg.334.fziBH": 'select redo warning replace ignore tab redo yes information view replace \'quoted\'',
+  "msg.335.ruvaC": 'information line tab none zoom error find split no copy \u00e9\u4e2d\t\n',
+  m336: "file zoom zoom open undo window C:\\path\\to\\file",
+  "msg.337.kjlIq": "view all column",
+  "msg.338.$f7Fq": "ignore question error none cancel file split retry zoom save // not a comment /* nor this */",
+  m339: "select cut undo yes all \"quoted\"",
+  "msg.340.zs88u": "cancel replace save undo cancel find no merge \u00e9\u4e2d\t\n",
+  "msg.341.oiz0l": "split question window split yes view paste replace abort open",
+  m342: 'line help \'quoted\'',
+  "msg.343.nHnAr": 'abort information none column edit tab abort column question undo // not a comment /* nor this */',
+  "msg.344._Ctwl": 'line save redo question open information question view cut cancel replace open \'quoted\'',
+  m345: 'view paste cut paste column C:\\path\\to\\file',
+  "msg.346.zJi1r": 'select tab replace \'quoted\'',
+  "msg.347.tu70j": 'cut find retry error',
+  m348: "zoom retry cut window redo undo undo abort column none",
+  "msg.349.fzzze": "zoom question edit all none",
+  "msg.350.bqs9A": 'retry none no cut error copy split ignore save edit warning file \u00e9\u4e2d\t\n',
+  m351: "cut open copy find retry view view replace open line line retry // not a comment /* nor this */",
+  "msg.352.lJai4": "all edit error",
+  "msg.353.s0Hmp": 'save all copy paste replace help close window file none edit error',
+  m354: "ignore merge error yes help ignore redo retry information abort find",
+  "msg.355.mfjFC": 'column warning file replace yes cut window yes C:\\path\\to\\file',
+  "msg.356.teq59": "undo find question paste tab window \u00e9\u4e2d\t\n",
+  m357: "error ignore replace all help",
+  "msg.358.viB1F": "information paste file merge window abort ignore save close view split \u00e9\u4e2d\t\n",
+  "msg.359.ilvov": 'undo help split column find cancel replace',
+  m360: "redo error copy no no tab warning",
+  "msg.361.pGxuz": "none close question column",
+  "msg.362.c1lIr": 'cancel save',
+  m363: 'find yes merge copy redo undo open merge split find cut',
+  "msg.364.lb7yu": "zoom none file warning view yes all information merge yes help \u00e9\u4e2d\t\n",
+  "msg.365.dnE5A": 'yes paste \u00e9\u4e2d\t\n',
+  m366: "paste view edit paste find help all edit help file ignore",
+  "msg.367.rr0rn": 'edit select copy redo abort cancel zoom C:\\path\\to\\file',
+  "msg.368.wpHsA": "file cut no split select C:\\path\\to\\file",
+  m369: "split undo",
+  "msg.370.ufi46": 'question error error file none \'quoted\'',
+  "msg.371.zqvxy": 'paste help all ignore copy information window question error open undo none // not a comment /* nor this */',
+  m372: 'cancel yes column warning redo error abort',
+  "msg.373.ftg1l": 'all ignore zoom split close paste zoom tab select error replace column \u00e9\u4e2d\t\n',
+  "msg.374.xhBAw": "cut split undo cut üñïçödé 文字 😀",
+  m375: "zoom find information save",
+  "msg.376.gIDk0": 'split column abort tab üñïçödé 文字 😀',
+  "msg.377.r2cF0": "open merge merge help all ignore line copy yes C:\\path\\to\\file",
+  m378: "split zoom split save zoom no none // not a comment /* nor this */",
+  "msg.379.o5xGa": "question open replace error zoom paste // not a comment /* nor this */",
+  "msg.380.dDAE6": 'redo find redo select warning merge zoom undo information save question',
+  m381: 'column window cancel redo view none redo split \'quoted\'',
+  "msg.382.hsiw9": 'undo merge none ignore all close undo open question help save',
+  "msg.383.dC6cC": "line column question none edit redo cancel abort split // not a comment /* nor this */",
+  m384: "ignore error copy close view question close ignore split paste",
+  "msg.385.hxAwB": "yes paste line all line retry undo all \u00e9\u4e2d\t\n",
+  "msg.386.sf9ou": 'split question tab close question',
+  m387: "close abort abort",
+  "msg.388.m2CGJ": "file question ignore information cut zoom undo edit \"quoted\"",
+  "msg.389._vI3k": 'copy column merge close select close copy retry warning \u00e9\u4e2d\t\n',
+  m390: 'window retry abort find abort redo no information cut',
+  "msg.391.iyIIz": 'edit none error all undo tab cut tab',
+  "msg.392.xkJ9i": 'copy cut none window ignore paste file open open merge \'quoted\'',
+  m393: "split replace window save",
+  "msg.394.osnva": "help close question zoom cut view close yes save cut merge",
+  "msg.395.l5zy9": 'find line merge retry copy cancel save all yes replace zoom error',
+  m396: "split cut save close \u00e9\u4e2d\t\n",
+  "msg.397.imbCj": 'window cut paste abort line yes ignore zoom',
+  "msg.398.$jdpt": 'replace all',
+  m399: 'information split cancel C:\\path\\to\\file',
+  "msg.400.e9933": "ignore cancel edit undo close abort",
+  "msg.401.lteo9": 'all all zoom ignore undo undo',
+  m402: "window merge no abort help find cancel view question",
+  "msg.403.q6mt3": 'abort view cut error help select',
+  "msg.404.wABBg": "retry tab help tab window split \u00e9\u4e2d\t\n",
+  m405: 'abort copy // not a comment /* nor this */',
+  "msg.406.xh8A9": 'open error help file line find help window abort copy question undo',
+  "msg.407.s8smH": 'window no tab help select abort // not a comment /* nor this */',
+  m408: "ignore save help abort retry merge",
+  "msg.409.p0gh5": "cut select open file line no all open find open edit // not a comment /* nor this */",
+  "msg.410.q8tI1": 'open find warning window save',
+  m411: 'ignore close open line retry help all ignore \'quoted\'',
+  "msg.412.drhln": 'merge cancel paste edit replace \'quoted\'',
+  "msg.413.f1t2E": 'save cut column copy split close copy all C:\\path\\to\\file',
+  m414: 'no error no retry cancel none cancel',
+  "msg.415.xyxhd": "close close paste ignore file view find cut line C:\\path\\to\\file",
+  "msg.416.ojxgB": "undo replace split paste view tab üñïçödé 文字 😀",
+  m417: "select close cancel redo information help column redo none no split \"quoted\"",
+  "msg.418.hzGaJ": 'none zoom column file copy file information replace merge undo abort cancel',
+  "msg.419.$zJ0m": "save abort none column retry view redo",
+  m420: 'save line copy file cancel all copy warning open select \'quoted\'',
+  "msg.421.fucmq": "cancel close redo none split file edit file",
+  "msg.422.kaJff": "information cancel paste file split",
+  m423: 'yes line replace edit cut error copy',
+  "msg.424.dqhu2": "abort warning \u00e9\u4e2d\t\n",
+  "msg.425.vyoDI": 'merge all all file paste all abort copy undo window undo information üñïçödé 文字 😀',
+  m426: "save paste replace window \"quoted\"",
+  "msg.427.m6FCl": 'column help yes ignore open abort warning redo split question retry \'quoted\'',
+  "msg.428.f6suo": 'error line close paste column \'quoted\'',
+  m429: "select split help find help tab yes copy column C:\\path\\to\\file",
+  "msg.430.qrj26": "close replace column replace ignore question",
+  "msg.431.fmJyd": 'ignore undo ignore file \'quoted\'',
+  m432: "help redo window view",
+  "msg.433.lxB1C": "zoom edit error ignore window close column none üñïçödé 文字 😀",
+  "msg.434.f1igG": 'select no',
+  m435: "save error select redo open question information C:\\path\\to\\file",
+  "msg.436._8w3I": 'abort window cancel error none C:\\path\\to\\file',
+  "msg.437.xqp3D": "merge undo help split all save \u00e9\u4e2d\t\n",
+  m438: 'question all none retry open',
+  "msg.439.f4sa6": "paste window zoom split line all information window replace error undo // not a comment /* nor this */",
+  "msg.440.lbjgs": 'warning help line select ignore window none file redo error cut zoom // not a comment /* nor this */',
+  m441: 'replace copy copy paste',
+  "msg.442.ns92v": "all cut edit \u00e9\u4e2d\t\n",
+  "msg.443.v4xD7": 'retry abort cancel copy undo retry edit paste view \u00e9\u4e2d\t\n',
+  m444: 'help replace information close \u00e9\u4e2d\t\n',
+  "msg.445.is3Er": "question window split open question none column ignore help file file",
+  "msg.446.qIzas": 'undo replace abort view',
+  m447: 'ignore retry retry',
+  "msg.448.a5o0i": 'error line file copy file yes edit select merge help split',
+  "msg.449.hzjpy": 'error ignore \u00e9\u4e2d\t\n',
+  m450: 'cancel close cut none retry ignore C:\\path\\to\\file',
+  "msg.451.ifJ8f": 'replace warning line edit abort copy error undo merge yes retry cancel',
+  "msg.452.kE6hH": 'find file information \'quoted\'',
+  m453: 'question error all replace help line line edit',
+  "msg.454.$JG8t": "column retry paste close none question no",
+  "msg.455.qwe11": 'cancel select question open abort save',
+  m456: 'close cancel all window line \'quoted\'',
+  "msg.457.sakJm": "information information split none open save split information error replace error line üñïçödé 文字 😀",
+  "msg.458.do8pA": "cut split replace merge yes column warning cancel \"quoted\"",
+  m459: 'merge retry',
+  "msg.460.lwC3z": "open column copy retry error error",
+  "msg.461.aGofw": 'warning view view \u00e9\u4e2d\t\n',
+  m462: "select find find column select column find replace abort select \"quoted\"",
+  "msg.463.n5nBF": "select error select zoom none redo information help find split replace zoom",
+  "msg.464.sAzC2": "help select view file none close tab \"quoted\"",
+  m465: 'help no error select zoom üñïçödé 文字 😀',
+  "msg.466.emDBo": "all abort undo no",
+  "msg.467.qhfB2": 'retry view help information cancel abort undo file window',
+  m468: 'yes redo \u00e9\u4e2d\t\n',
+  "msg.469.wjfDu": 'all redo find error line ignore',
+  "msg.470.qCmdq": 'retry close yes abort replace question redo yes',
+  m471: "abort replace",
+  "msg.472.ck5g3": "paste warning copy none zoom close file redo \"quoted\"",
+  "msg.473.rlH73": 'find open close paste window',
+  m474: 'edit none redo C:\\path\\to\\file',
+  "msg.475._E4hm": "copy zoom line merge tab split no information copy split",
+  "msg.476.mrltI": "view tab warning error copy select information information error redo edit",
+  m477: 'error abort select file find redo column file yes üñïçödé 文字 😀',
+  "msg.478.gpk2d": "warning window open none column \"quoted\"",
+  "msg.479.lsEGJ": 'select ignore yes replace line edit no view',
+  m480: 'replace abort cut question replace view no replace find',
+  "msg.481.q01yJ": "merge retry undo question",
+  "msg.482.bjddD": 'question ignore column tab ignore replace help cut undo abort help select // not a comment /* nor this */',
+  m483: 'view none close paste yes',
+  "msg.484.glnna": "find column redo window undo all yes view split merge \u00e9\u4e2d\t\n",
+  "msg.485.x5bsv": 'replace column close close column undo copy window redo cut merge',
+  m486: 'help open tab line window none yes open C:\\path\\to\\file',
+  "msg.487.lonx9": 'open column help question cut all save cut yes tab',
+  "msg.488.sux3C": 'cut all information line ignore view error select error \u00e9\u4e2d\t\n',
+  m489: "ignore ignore abort replace undo no warning redo information",
+  "msg.490.dHfBB": "warning retry abort zoom warning merge tab save cut file",
+  "msg.491.lDd40": "window copy retry no tab view save tab find none find window",
+  m492: 'file tab split none all warning cut file replace // not a comment /* nor this */',
+  "msg.493.tn7tz": 'paste warning ignore find replace paste cancel üñïçödé 文字 😀',
+  "msg.494.b217g": 'edit select edit select window all column ignore column \'quoted\'',
+  m495: 'column column no column undo error none tab ignore all line',
+  "msg.496.xGzAE": 'information copy',
+  "msg.497.aF16u": "cancel window help save open split paste merge tab find paste C:\\path\\to\\file",
+  m498: "help edit replace tab find question open split tab zoom",
+  "msg.499.f7tCh": 'retry copy',
+  "msg.500.hjzBl": "find open",
+  m501: 'retry tab no undo find line open no error undo',
+  "msg.502.b4t2C": "yes view all find open file select",
+  "msg.503.nwJ79": 'information open find column replace redo replace yes column replace abort close',
+  m504: 'information help select redo paste select all question error paste paste',
+  "msg.505.nja6H": "all undo edit none line open",
+  "msg.506.e1rCn": 'warning warning error abort cancel // not a comment /* nor this */',
+  m507: 'cut merge tab merge find view close paste retry paste window C:\\path\\to\\file',
+  "msg.508.fawtD": 'information retry cut save all \'quoted\'',
+  "msg.509.pGwx4": "split file abort file information question paste ignore tab C:\\path\\to\\file",
+  m510: 'zoom zoom // not a comment /* nor this */',
+  "msg.511.bFJjD": 'no help window warning column redo paste none retry copy edit',
+  "msg.512.pkmad": "line all none save find ignore find cancel",
+  m513: "paste error abort \"quoted\"",
+  "msg.514.d2vph": 'error retry replace warning find column save zoom // not a comment /* nor this */',
+  "msg.515.iwp5J": "zoom ignore question no save zoom open information cut \"quoted\"",
+  m516: 'column line error',
+  "msg.517.cHr97": 'no column cut none warning',
+  "msg.518.e1F89": 'yes window all zoom find find cut cancel üñïçödé 文字 😀',
+  m519: 'replace no copy error tab',
+  "msg.520.l2jpH": 'merge all find select merge abort file view none zoom open paste',
+  "msg.521.c32my": 'line line error split close warning yes // not a comment /* nor this */',
+  m522: 'line none undo select retry error all question help replace',
+  "msg.523.yD0tB": "close no save cut redo save warning split split tab \"quoted\"",
+  "msg.524.knrm3": "zoom help all find tab cancel redo warning yes edit üñïçödé 文字 😀",
+  m525: 'line question no window paste window view warning copy question C:\\path\\to\\file',
+  "msg.526.bI5u3": 'view merge tab all error line redo // not a comment /* nor this */',
+  "msg.527.wE7Jr": "window no save warning paste merge // not a comment /* nor this */",
+  m528: 'paste yes cancel help copy copy replace window',
+  "msg.529.st39E": 'yes file copy copy cut column tab find cancel yes window split',
+  "msg.530.ooah0": 'abort cut all split ignore find zoom open open \'quoted\'',
+  m531: 'open help abort view merge C:\\path\\to\\file',
+  "msg.532.jnw4r": 'yes none window cut information help warning open paste column',
+  "msg.533.msssm": 'view save copy edit file',
+  m534: "retry warning abort save ignore view split",
+  "msg.535.ejGbf": 'file find paste redo none merge close ignore',
+  "msg.536.ru4y1": 'redo cut error split select warning file information close line copy yes \u00e9\u4e2d\t\n',
+  m537: 'warning redo save tab ignore cut zoom yes',
+  "msg.538.x1u99": "yes window view select yes open none open yes file all C:\\path\\to\\file",
+  "msg.539.udxH3": 'all close select edit column \u00e9\u4e2d\t\n',
+  m540: 'zoom file ignore \u00e9\u4e2d\t\n',
+  "msg.541.f6FvF": "line window split undo tab cut",
+  "msg.542.pqifJ": "question view tab line warning no help question no",
+  m543: 'save help no error split cancel edit zoom ignore line open question üñïçödé 文字 😀',
+  "msg.544.vk4or": 'replace window question question line üñïçödé 文字 😀',
+  "msg.545.eugfH": 'edit warning select undo \'quoted\'',
+  m546: "file view help window zoom abort help column open none column",
+  "msg.547.c66Ax": 'window zoom copy column no zoom \'quoted\'',
+  "msg.548.iGbvI": "redo information no close save view question merge abort save redo \u00e9\u4e2d\t\n",
+  m549: "none view tab view help",
+  "msg.550.b3Idq": "close cut zoom none zoom error cut // not a comment /* nor this */",
+  "msg.551.upt0c": 'warning question information edit copy information none',
+  m552: 'question help no save all paste edit error',
+  "msg.553.xEllj": "tab all paste error information cut edit no window undo",
+  "msg.554.s5t1A": 'open cancel zoom all window abort warning merge window replace cut',
+  m555: "abort open question error retry save zoom window all",
+  "msg.556.wbha8": "all information cut \u00e9\u4e2d\t\n",
+  "msg.557._8bkg": "information retry no column split C:\\path\\to\\file",
+  m558: 'redo replace',
+  "msg.559.o0z5J": "window abort ignore help help cancel information none zoom find information",
+  "msg.560._wDrs": 'error ignore abort replace line ignore close redo retry paste \u00e9\u4e2d\t\n',
+  m561: "error zoom find information open line \u00e9\u4e2d\t\n",
+  "msg.562.exlyr": "split warning no information paste cancel retry find file",
+  "msg.563.n1H5v": 'retry retry copy replace line',
+  m564: 'abort line column warning paste none find retry',
+  "msg.565.aejHC": "view line file column split merge question file close yes",
+  "msg.566.rGgdb": 'information paste find help',
+  m567: 'help save all warning information save no split undo cut abort file \'quoted\'',
+  "msg.568.kBf9t": 'redo merge window save tab paste cut tab abort error retry none \u00e9\u4e2d\t\n',
+  "msg.569._6mom": "paste undo",
+  m570: "save redo redo tab merge open find tab zoom cut C:\\path\\to\\file",
+  "msg.571.isowq": 'cut no merge edit',
+  "msg.572.mEckc": 'question warning // not a comment /* nor this */',
+  m573: "tab cancel edit abort edit zoom paste cut question paste",
+  "msg.574.phkpu": 'zoom none copy column help copy save',
+  "msg.575.piFky": 'find paste column open abort edit split split cut redo redo // not a comment /* nor this */',
+  m576: "file question window close open cancel view redo retry C:\\path\\to\\file",
+  "msg.577.nJkA6": 'file redo edit help merge cancel close \u00e9\u4e2d\t\n',
+  "msg.578.sgf80": "split warning abort information line window question error",
+  m579: "close open \u00e9\u4e2d\t\n",
+  "msg.580.eHojh": "tab window abort open edit open view merge copy cut split split // not a comment /* nor this */",
+  "msg.581.t5df1": 'cut view abort none merge edit none save yes replace save merge C:\\path\\to\\file',
+  m582: 'file information retry paste select replace open select',
+  "msg.583.pnho6": 'replace paste ignore ignore view all all abort all warning \u00e9\u4e2d\t\n',
+  "msg.584._qBu0": "help copy question column tab undo all paste window copy",
+  m585: 'save redo file window open cancel no paste information information no cut',
+  "msg.586.p7p8H": 'select help replace question tab open',
+  "msg.587.awCJj": "cut redo close help no no cut no",
+  m588: 'tab find save replace cut merge window all split',
+  "msg.589._0iDf": 'select retry üñïçödé 文字 😀',
+  "msg.590.hhAop": 'redo zoom find all redo column C:\\path\\to\\file',
+  m591: "yes select question select select view",
+  "msg.592.zvx6e": 'line find cut column paste open',
+  "msg.593.yufiC": "warning cut merge yes none close column cancel question file replace \"quoted\"",
+  m594: 'retry zoom warning window copy cut undo tab edit \u00e9\u4e2d\t\n',
+  "msg.595.aj2Js": 'merge merge zoom copy retry all select yes view open find',
+  "msg.596.ujp7E": 'find all tab question save information window file information close question all',
+  m597: "replace undo zoom close error replace file retry zoom // not a comment /* nor this */",
+  "msg.598.kq0dr": 'cut retry question merge \u00e9\u4e2d\t\n',
+  "msg.599.ygjAe": 'retry copy open error C:\\path\\to\\file',
+  m600: 'find copy retry split information paste warning copy question // not a comment /* nor this */',
+  "msg.601.$ozh0": 'file help abort find question select no question no file select yes',
+  "msg.602.aCyuE": 'edit redo view paste replace merge save copy \u00e9\u4e2d\t\n',
+  m603: 'retry none view question merge window \'quoted\'',
+  "msg.604.f23wu": "retry close open none replace all redo yes zoom",
+  "msg.605.dsJ9m": "tab open close find",
+  m606: "tab question close close all file",
+  "msg.607._Dtg1": 'error none undo information üñïçödé 文字 😀',
+  "msg.608.kqaI3": 'line zoom warning all zoom error save cut question \'quoted\'',
+  m609: 'cancel question undo cancel no redo retry cancel column find',
+  "msg.610.owmtz": "yes undo column yes tab error \"quoted\"",
+  "msg.611.hbDE4": 'all select none close error',
+  m612: 'line ignore retry yes question',
+  "msg.613.yzF3J": "merge split retry redo close help none copy view ignore no tab üñïçödé 文字 😀",
+  "msg.614.wo2FH": 'cancel question ignore select question \u00e9\u4e2d\t\n',
+  m615: "undo column redo error column edit undo file warning save üñïçödé 文字 😀",
+  "msg.616.xaxq0": 'error column no undo file replace abort error // not a comment /* nor this */',
+  "msg.617.cidow": 'file abort select undo // not a comment /* nor this */',
+  m618: "split save split help yes warning split \u00e9\u4e2d\t\n",
+  "msg.619.obEnq": "zoom undo window redo",
+  "msg.620.jGjIc": "help view edit help help replace save question column warning cancel C:\\path\\to\\file",
+  m621: "help file cancel",
+  "msg.622.nqmfu": 'abort yes abort paste abort ignore',
+  "msg.623.s8qfF": "all none window none",
+  m624: 'none save line help warning copy none yes open paste \'quoted\'',
+  "msg.625.r73Jc": "error copy view copy all open view abort find tab yes view \"quoted\"",
+  "msg.626.s38u5": 'close tab question retry merge question copy yes redo information select window',
+  m627: 'column retry paste abort undo C:\\path\\to\\file',
+  "msg.628.ceCjq": "save merge ignore question all merge",
+  "msg.629.vtxhJ": "open question",
+  m630: 'edit open replace no tab no abort \u00e9\u4e2d\t\n',
+  "msg.631.l0rhv": "question information view split cancel open line warning help paste all cancel",
+  "msg.632.h52z5": "file paste",
+  m633: 'yes redo cut paste line redo window all select cancel none',
+  "msg.634.eHE5a": 'abort redo no find no \'quoted\'',
+  "msg.635.smJ9k": 'ignore tab save redo',
+  m636: "open zoom view line",
+  "msg.637.g66yy": "none abort warning zoom none cut help cancel split ignore",
+  "msg.638.kpjff": 'save save all error merge error',
+  m639: 'copy replace split replace find tab window',
+  "msg.640.s634I": 'tab merge retry undo warning',
+  "msg.641.my03F": "close information select select ignore no undo",
+  m642: "redo zoom warning zoom üñïçödé 文字 😀",
+  "msg.643.rl9J6": 'paste save view redo cancel retry warning retry replace copy window \u00e9\u4e2d\t\n',
+  "msg.644.vyEmq": "line save warning cancel all select close C:\\path\\to\\file",
+  m645: "view all question help",
+  "msg.646.uegHC": 'cut cancel help information all copy paste save save',
+  "msg.647.hnGCE": 'window warning find retry redo line find close redo üñïçödé 文字 😀',
+  m648: 'merge all line all error paste no zoom',
+  "msg.649.$lvg8": 'view zoom \'quoted\'',
+  "msg.650.klIG5": 'ignore abort column window window ignore yes zoom save close edit error',
+  m651: "line retry merge save file paste none ignore view column C:\\path\\to\\file",
+  "msg.652.ki4dj": "question yes redo error tab \u00e9\u4e2d\t\n",
+  "msg.653.hcFhx": 'copy no \u00e9\u4e2d\t\n',
+  m654: "cancel column file retry open \u00e9\u4e2d\t\n",
+  "msg.655.hnoG6": "edit close warning all warning ignore undo split abort no warning find // not a comment /* nor this */",
+  "msg.656.pk0D1": "edit help line edit line tab",
+  m657: "merge cut window information edit warning cancel split edit close tab warning C:\\path\\to\\file",
+  "msg.658.l4uiv": 'edit cut information warning information line cut no close line edit yes // not a comment /* nor this */',
+  "msg.659.vdvwc": "line zoom warning no column // not a comment /* nor this */",
+  m660: "file window abort merge all help yes close",
+  "msg.661.aqcsb": 'error redo paste open cut line help \'quoted\'',
+  "msg.662.oa5Jt": 'save ignore undo edit select line ignore',
+  m663: "column select information question yes information copy cut open \u00e9\u4e2d\t\n",
+  "msg.664.xGBB8": "edit none warning find cancel \"quoted\"",
+  "msg.665.cd1ux": 'copy undo \u00e9\u4e2d\t\n',
+  m666: 'error select replace ignore help paste none edit',
+  "msg.667.$yIwm": "view cut copy",
+  "msg.668.rpdu9": 'question information select merge none file replace merge üñïçödé 文字 😀',
+  m669: 'all find close abort all find close',
+  "msg.670.$aH3l": 'error question no cut',
+  "msg.671.hDmEl": "all split no question üñïçödé 文字 😀",
+  m672: 'cut none edit select yes no line open information \u00e9\u4e2d\t\n',
+  "msg.673.tHII7": "line tab warning abort warning // not a comment /* nor this */",
+  "msg.674.gtE1G": 'no tab information redo replace edit replace save redo undo',
+  m675: 'no none view find abort window replace zoom abort warning cut none',
+  "msg.676.mpymc": 'line save // not a comment /* nor this */',
+  "msg.677.am5ty": "no split",
+  m678: 'information select paste select open view close copy help tab edit close \'quoted\'',
+  "msg.679.evc0x": 'edit all none tab open tab save',
+  "msg.680._hHI5": 'question cut line none ignore file redo error \'quoted\'',
+  m681: 'undo replace \u00e9\u4e2d\t\n',
+  "msg.682.aznq3": "retry edit cut column split select split file file find save \u00e9\u4e2d\t\n",
+  "msg.683.kvglI": "all ignore file error line information view \"quoted\"",
+  m684: "none copy \"quoted\"",
+  "msg.685.bovo0": "replace file copy \u00e9\u4e2d\t\n",
+  "msg.686.ajr3q": 'retry save // not a comment /* nor this */',
+  m687: "information view retry view abort cut warning edit paste tab \"quoted\"",
+  "msg.688.tGyhi": 'none information retry open replace ignore undo paste select copy',
+  "msg.689.fJIAB": "find view merge warning redo information",
+  m690: 'redo select split error',
+  "msg.691.jdiDB": "close warning",
+  "msg.692.aI467": "view question zoom redo view warning undo none retry view // not a comment /* nor this */",
+  m693: 'select find',
+  "msg.694.vHjlG": "none select edit save save no replace cut line \u00e9\u4e2d\t\n",
+  "msg.695._Hvx3": 'column open undo file split cut ignore redo tab edit information \'quoted\'',
+  m696: 'cancel undo cut all',
+  "msg.697.f5quJ": "file ignore redo open paste window merge question tab undo open C:\\path\\to\\file",
+  "msg.698.cIkr9": "ignore copy split warning question redo none open find question yes no",
+  m699: 'undo select view redo view retry ignore üñïçödé 文字 😀',
+  "msg.700.dl8fr": 'edit column replace tab column edit column copy // not a comment /* nor this */',
+  "msg.701.ssstH": "copy no zoom close \u00e9\u4e2d\t\n",
+  m702: "undo split close cancel close help undo C:\\path\\to\\file",
+  "msg.703.qE6k8": "file tab save edit help all error cut ignore close merge \"quoted\"",
+  "msg.704.ac9il": "undo save close tab cancel view ignore column copy abort replace",
+  m705: 'error all warning retry',
+  "msg.706.dkCar": 'file tab error view save retry file edit retry window edit // not a comment /* nor this */',
+  "msg.707.wkw2y": 'copy all tab save all warning close merge',
+  m708: 'zoom split split',
+  "msg.709.$BkH3": "file tab all column no error information all split replace paste \u00e9\u4e2d\t\n",
+  "msg.710.nz6ux": "close save",
+  m711: 'help copy select redo cancel window find file open \'quoted\'',
+  "msg.712._xwy1": 'select redo paste retry line cancel undo tab help retry help üñïçödé 文字 😀',
+  "msg.713.l91ns": "cut open \"quoted\"",
+  m714: 'file close paste window tab cancel question ignore // not a comment /* nor this */',
+  "msg.715.$uhlB": 'paste copy \'quoted\'',
+  "msg.716.nxnDa": "abort redo replace",
+  m717: 'retry undo cut close error open cut redo all retry cancel',
+  "msg.718.xBtgF": 'view yes view undo find redo view close ignore retry split',
+  "msg.719.n8fmi": "ignore save question column window yes all tab",
+  m720: "none redo warning replace \u00e9\u4e2d\t\n",
+  "msg.721.dB9I0": "line window help abort replace paste cut error zoom // not a comment /* nor this */",
+  "msg.722.nH3xa": "merge retry paste column",
+  m723: "copy cancel undo no open help // not a comment /* nor this */",
+  "msg.724.$I7sb": "tab split ignore abort select no none replace edit merge merge none // not a comment /* nor this */",
+  "msg.725.ps11s": 'window save paste merge none help cut open',
+  m726: "open edit yes view line yes open all \u00e9\u4e2d\t\n",
+  "msg.727.h37iF": "file ignore window file merge information tab window all C:\\path\\to\\file",
+  "msg.728.egpmC": "ignore edit redo find line split copy no select view",
+  m729: "cancel window window copy no // not a comment /* nor this */",
+  "msg.730.vuBxf": 'open question all split information paste error line cancel',
+  "msg.731.c5Hn3": "question replace file zoom column error undo line redo close line",
+  m732: "ignore warning help line cut line",
+  "msg.733.sxkBF": "window zoom cancel save retry tab yes redo information copy",
+  "msg.734.d1ukD": 'close warning save tab // not a comment /* nor this */',
+  m735: 'cancel warning no view merge line retry zoom none undo üñïçödé 文字 😀',
+  "msg.736.e4zfk": 'information save question information replace find',
+  "msg.737.e7fi1": "cut all \u00e9\u4e2d\t\n",
+  m738: "open cancel \"quoted\"",
+  "msg.739.vdncg": "file close edit file information all error copy undo warning open",
+  "msg.740.gB5fq": 'paste ignore redo open all \'quoted\'',
+  m741: "close find cancel warning paste undo file retry \u00e9\u4e2d\t\n",
+  "msg.742.kAFvC": "split find all copy save close column window file warning \"quoted\"",
+  "msg.743.c6l57": "retry redo copy \"quoted\"",
+  m744: "line cut open \"quoted\"",
+  "msg.745.vrh9G": 'close warning paste open replace all no view \'quoted\'',
+  "msg.746.ax6qG": 'cancel abort replace close zoom C:\\path\\to\\file',
+  m747: "all find line no open",
+  "msg.748.ixsiJ": 'select redo ignore copy help file',
+  "msg.749.bIumw": 'replace merge question warning split column undo \'quoted\'',
+  m750: "select open column file ignore warning column",
+  "msg.751.t5aFt": 'save redo tab help file',
+  "msg.752.udqIC": 'zoom retry close cancel warning question tab information column file zoom split',
+  m753: 'open undo ignore redo help',
+  "msg.754.$oy1m": 'cancel undo column split file select column \'quoted\'',
+  "msg.755.eE1v0": 'copy column yes error window zoom paste zoom open \'quoted\'',
+  m756: 'ignore abort file edit merge merge copy save question save',
+  "msg.757.iks2J": "cancel line error select none abort view tab yes all all \"quoted\"",
+  "msg.758.gE85C": "cut question yes window",
+  m759: 'information question edit select split copy \u00e9\u4e2d\t\n',
+  "msg.760.x3D0o": 'cut ignore retry find',
+  "msg.761.eyesg": "warning view tab line retry cancel cut copy edit find ignore column // not a comment /* nor this */",
+  m762: 'line redo no column',
+  "msg.763.kBb6w": 'none copy redo split information redo view help error \'quoted\'',
+  "msg.764.uCB9D": "redo information warning retry ignore undo replace merge \u00e9\u4e2d\t\n",
+  m765: 'help information retry merge help copy',
+  "msg.766.uHuyo": 'warning copy zoom all copy \u00e9\u4e2d\t\n',
+  "msg.767.ng01x": 'edit warning no retry tab',
+  m768: 'column find file file split copy redo paste all line edit',
+  "msg.769.hl66k": "zoom warning merge zoom none paste",
+  "msg.770.v2c71": 'redo all select cut',
+  m771: 'copy undo select help error information find tab none abort warning C:\\path\\to\\file',
+  "msg.772.om4qH": "retry edit tab abort none cancel cancel paste information C:\\path\\to\\file",
+  "msg.773.wfDim": "find split redo abort save zoom view information find save // not a comment /* nor this */",
+  m774: "line column \"quoted\"",
+  "msg.775.y8C9s": 'line retry open \u00e9\u4e2d\t\n',
+  "msg.776.l9jh6": "tab view line undo save",
+  m777: 'copy abort warning tab',
+  "msg.778.pFi7l": 'tab abort replace paste merge paste yes information merge question column window',
+  "msg.779.fiykH": 'close zoom cancel split edit \u00e9\u4e2d\t\n',
+  m780: "find merge none column paste line view edit \"quoted\"",
+  "msg.781._9gEJ": 'copy retry warning paste information no cut edit window column none // not a comment /* nor this */',
+  "msg.782.nldcx": "select cut find view \"quoted\"",
+  m783: 'close retry tab ignore window column column merge question',
+  "msg.784.njsq9": 'close cancel paste edit no zoom file \u00e9\u4e2d\t\n',
+  "msg.785.yBjyE": "file find information warning cut zoom replace undo question view paste ignore",
+  m786: "split redo view C:\\path\\to\\file",
+  "msg.787.c6bu4": "information error warning file copy merge question edit merge",
+  "msg.788.aB7dD": "yes select error \"quoted\"",
+  m789: 'no view file question no error view abort no paste yes undo \u00e9\u4e2d\t\n',
+  "msg.790.c5uxf": 'file save undo cancel no find üñïçödé 文字 😀',
+  "msg.791.g99ce": "question paste select question",
+  m792: 'no yes close retry copy zoom replace abort',
+  "msg.793.nw8x8": 'error line information',
+  "msg.794.lwzvD": 'column undo select open close merge file edit yes edit no \'quoted\'',
+  m795: "warning ignore information file",
+  "msg.796.iuaBJ": "view find line edit close // not a comment /* nor this */",
+  "msg.797.tulvc": "help error view",
+  m798: "undo save column C:\\path\\to\\file",
+  "msg.799.txqwx": "warning select cancel yes file no",
+  "msg.800.oqmAq": 'edit yes column zoom open close open close paste select retry // not a comment /* nor this */',
+  m801: "cancel find retry view",
+  "msg.802.mm81c": 'zoom cut close \u00e9\u4e2d\t\n',
+  "msg.803.ycnbE": 'information cancel ignore column cancel column question file line abort edit \'quoted\'',
+  m804: "close column close no column view line question view paste view // not a comment /* nor this */",
+  "msg.805.sstEa": 'information retry tab',
+  "msg.806.ysbBl": 'cancel abort',
+  m807: 'no copy ignore copy question yes yes cut error find cut // not a comment /* nor this */',
+  "msg.808.vvGAH": 'ignore paste select copy replace open',
+  "msg.809.y5732": 'file close find file all \'quoted\'',
+  m810: 'line question column redo',
+  "msg.811.th4Do": 'retry all',
+  "msg.812.qwtk9": "yes save select C:\\path\\to\\file",
+  m813: 'window paste question column retry window select \'quoted\'',
+  "msg.814.c1crC": "file warning copy find find redo no column column tab zoom edit \u00e9\u4e2d\t\n",
+  "msg.815.fb72e": "window all C:\\path\\to\\file",
+  m816: 'cut ignore zoom',
+  "msg.817.lBrca": "select redo view none column // not a comment /* nor this */",
+  "msg.818.tF536": "undo none no",
+  m819: 'open open merge warning paste replace replace help none file',
+  "msg.820.yjf6B": "edit cancel replace all view üñïçödé 文字 😀",
+  "msg.821.ifJEs": 'open view cancel undo information error window split yes merge \u00e9\u4e2d\t\n',
+  m822: "find file close",
+  "msg.823.t20l7": "edit ignore window split üñïçödé 文字 😀",
+  "msg.824.fsb6A": "yes paste",
+  m825: "tab all yes all find \"quoted\"",
+  "msg.826._6au4": 'cut warning warning select üñïçödé 文字 😀',
+  "msg.827.kq5ID": "error split view window file question abort select",
+  m828: "save help file all C:\\path\\to\\file",
+  "msg.829.pircF": "open no information merge",
+  "msg.830.pw64c": 'error close cancel none none warning window replace open undo abort no',
+  m831: "information retry tab question abort window \"quoted\"",
+  "msg.832.maf2f": "save help",
+  "msg.833.d2src": 'yes yes',
+  m834: 'copy question select find cancel question file all find find line \'quoted\'',
+  "msg.835.svbrv": 'find paste tab cancel undo cancel \'quoted\'',
+  "msg.836.mGrlg": "line close error all ignore tab merge split paste select \u00e9\u4e2d\t\n",
+  m837: 'window edit line question select no // not a comment /* nor this */',
+  "msg.838.aFwG9": 'question none save',
+  "msg.839.gnd53": 'split merge line line select split undo line edit \'quoted\'',
+  m840: "paste warning view retry select error yes edit question all",
+  "msg.841.gwih3": 'information split close column paste column copy cancel \'quoted\'',
+  "msg.842.dc8H0": "split select help ignore column save retry merge error ignore undo",
+  m843: "information column close cancel paste paste undo tab cancel no file üñïçödé 文字 😀",
+  "msg.844.tndul": "view open no undo tab none copy error copy undo none",
+  "msg.845.d8D3p": 'window none C:\\path\\to\\file',
+  m846: 'retry question tab redo question help error cut // not a comment /* nor this */',
+  "msg.847.bekwG": "cut all find all // not a comment /* nor this */",
+  "msg.848.ayA5y": "window question help information information information üñïçödé 文字 😀",
+  m849: 'information line file copy file error paste warning redo warning abort window // not a comment /* nor this */',
+  "msg.850.u26lk": 'view view close merge retry C:\\path\\to\\file',
+  "msg.851.k0wje": 'no yes close üñïçödé 文字 😀',
+  m852: "undo zoom // not a comment /* nor this */",
+  "msg.853.paF9k": "information file help cut",
+  "msg.854.xlcn2": "close yes all error edit edit",
+  m855: "paste line yes question zoom // not a comment /* nor this */",
+  "msg.856.sHrtf": 'information open view abort zoom // not a comment /* nor this */',
+  "msg.857.o9czw": 'split column line edit merge \u00e9\u4e2d\t\n',
+  m858: "information tab window yes tab undo",
+  "msg.859._jpAq": 'abort select none redo retry information select',
+  "msg.860.y2lel": "save question",
+  m861: 'warning zoom save open \'quoted\'',
+  "msg.862.siphe": 'redo window no find merge abort file',
+  "msg.863.zH5kx": 'zoom question \u00e9\u4e2d\t\n',
+  m864: 'find close find C:\\path\\to\\file',
+  "msg.865.mnEki": "merge redo warning question tab yes cut // not a comment /* nor this */",
+  "msg.866.laihF": "replace abort zoom cancel information // not a comment /* nor this */",
+  m867: "help no paste",
+  "msg.868.ma6GB": 'zoom none zoom close // not a comment /* nor this */',
+  "msg.869.kak2s": "select warning ignore question close ignore find",
+  m870: 'no no yes retry all help column select file',
+  "msg.871.eqrwf": 'cancel zoom yes edit column',
+  "msg.872.oIk55": "warning help open undo undo paste zoom cancel \u00e9\u4e2d\t\n",
+  m873: 'view error cut cut ignore help find tab edit',
+  "msg.874.kz9y6": "copy view replace abort error ignore yes error open tab help C:\\path\\to\\file",
+  "msg.875.m1avx": 'column save abort open paste replace find',
+  m876: 'redo column open tab yes select yes error find view retry none \'quoted\'',
+  "msg.877.fvBx1": "error save split help information all save",
+  "msg.878.pp1Fa": 'save cut',
+  m879: 'question no close window abort window cancel',
+  "msg.880.kfh99": "cancel question line information copy find",
+  "msg.881.d4C06": "warning zoom cut yes \u00e9\u4e2d\t\n",
+  m882: "warning redo",
+  "msg.883.i8qBd": "information all none edit zoom redo no line save \"quoted\"",
+  "msg.884.z4Fxz": "undo column help undo // not a comment /* nor this */",
+  m885: "select retry yes merge question",
+  "msg.886.ujdil": 'warning line line line',
+  "msg.887.a7acb": 'no split open all information error ignore redo line',
+  m888: 'retry split edit ignore abort error',
+  "msg.889.uBx3G": 'column abort help abort line tab none open open abort question',
+  "msg.890.j30E7": "view zoom yes all",
+  m891: 'save zoom error ignore retry all \'quoted\'',
+  "msg.892.qiCfA": 'help find select replace paste split tab \u00e9\u4e2d\t\n',
+  "msg.893.$4b0C": 'yes edit paste tab merge information',
+  m894: "replace undo \u00e9\u4e2d\t\n",
+  "msg.895.dsE4j": "line view file select tab view retry",
+  "msg.896.sai7G": "file no zoom help information",
+  m897: 'find window cancel view column find no \'quoted\'',
+  "msg.898.txg5C": "open copy undo find none none open abort \"quoted\"",
+  "msg.899.bchhp": 'warning ignore C:\\path\\to\\file',
+  m900: 'merge file view file warning yes select replace open help close redo \u00e9\u4e2d\t\n',
+  "msg.901.n5qcD": "open retry replace select",
+  "msg.902.xDpsz": 'cut error undo merge \'quoted\'',
+  m903: 'cancel undo copy cut \'quoted\'',
+  "msg.904.m6q2n": 'cancel replace undo column none view ignore error information',
+  "msg.905.soBAF": "paste abort question ignore save",
+  m906: "retry window column help retry all abort question retry edit column tab",
+  "msg.907.iBrzj": "warning paste edit save // not a comment /* nor this */",
+  "msg.908.o9qif": "no ignore paste replace column",
+  m909: "merge cancel split open copy save copy",
+  "msg.910.byo53": "warning yes error warning question \"quoted\"",
+  "msg.911.taj6A": "close abort line no yes line error edit yes zoom \"quoted\"",
+  m912: "edit ignore window all",
+  "msg.913.qrFyt": "ignore line error // not a comment /* nor this */",
+  "msg.914.zcqAp": "cut copy question edit view help tab tab warning paste select",
+  m915: 'yes yes open information line',
+  "msg.916.o1Jwu": 'ignore close question all line paste column replace replace cut',
+  "msg.917.u9FiE": 'warning select save file none information ignore file edit find C:\\path\\to\\file',
+  m918: "open select line window column select split \u00e9\u4e2d\t\n",
+  "msg.919.$4p4y": 'find replace abort file C:\\path\\to\\file',
+  "msg.920.tdkgo": 'yes view line none find all view view',
+  m921: 'none undo paste column save line redo help error all \u00e9\u4e2d\t\n',
+  "msg.922.jj1se": "all line paste ignore",
+  "msg.923.rskqA": "cut yes no no none zoom tab information help question window",
+  m924: "retry save open copy question merge tab error column paste open",
+  "msg.925.g5mpt": 'edit zoom none ignore view cut question question information merge copy file \'quoted\'',
+  "msg.926.wbgt8": "save information",
+  m927: "zoom yes save \u00e9\u4e2d\t\n",
+  "msg.928.aufsr": 'column open edit warning',
+  "msg.929.dbogE": "replace column warning // not a comment /* nor this */",
+  m930: 'error column replace undo select replace \u00e9\u4e2d\t\n',
+  "msg.931.shhGo": "cancel window window view select view no zoom zoom none C:\\path\\to\\file",
+  "msg.932.iBr2D": "abort split none copy",
+  m933: "replace no edit // not a comment /* nor this */",
+  "msg.934.ai8by": "none undo error redo retry error redo none edit \u00e9\u4e2d\t\n",
+  "msg.935.xD7em": 'all select window merge warning no information replace tab \u00e9\u4e2d\t\n',
+  m936: 'warning edit error retry question window view file all all all help',
+  "msg.937.qgA4I": 'merge help open open column file yes',
+  "msg.938.mkg78": "copy line retry error tab \u00e9\u4e2d\t\n",
+  m939: 'zoom question window',
+  "msg.940.rhlJi": 'zoom line',
+  "msg.941.r2wjj": 'merge cut paste replace question // not a comment /* nor this */',
+  m942: "abort replace line tab replace find merge yes redo line window",
+  "msg.943.bwo8j": 'none window no retry \u00e9\u4e2d\t\n',
+  "msg.944.l6wv5": 'split file question window cut save question',
+  m945: 'line cut tab save tab paste',
+  "msg.946.eucDp": "no help file ignore zoom redo find tab ignore all undo üñïçödé 文字 😀",
+  "msg.947.$8Dsw": "window retry replace redo information window edit",
+  m948: 'tab question replace line undo undo tab zoom undo find',
+  "msg.949.tjJAf": "paste paste abort // not a comment /* nor this */",
+  "msg.950.pm1pj": 'find window warning replace cancel no',
+  m951: "column none yes paste warning line file redo error",
+  "msg.952.$ni5v": 'find zoom replace',
+  "msg.953.gcnyr": 'tab split window help save yes undo close yes cut no \'quoted\'',
+  m954: 'cut window none',
+  "msg.955.q2vq3": 'tab find ignore retry window \u00e9\u4e2d\t\n',
+  "msg.956.vngHk": "error error paste cut column paste undo warning no edit \"quoted\"",
+  m957: 'line no cancel yes window redo cancel',
+  "msg.958._eFml": 'find all information merge redo edit abort abort line edit',
+  "msg.959.adBdl": 'column window replace save replace yes merge ignore redo zoom no retry \u00e9\u4e2d\t\n',
+  m960: 'tab edit none information replace select üñïçödé 文字 😀',
+  "msg.961.sJ2q9": 'abort save undo yes line merge ignore replace help yes \'quoted\'',
+  "msg.962.dCd51": 'help redo view view file abort tab \'quoted\'',
+  m963: "file no column help select find file all retry tab error save",
+  "msg.964._10ev": 'warning tab save',
+  "msg.965.dAdny": 'information select help error save information line warning cut',
+  m966: 'open merge window cut no close column // not a comment /* nor this */',
+  "msg.967.bf6kr": "save ignore abort none merge all no line warning save yes paste \u00e9\u4e2d\t\n",
+  "msg.968.yGfyc": "replace ignore select cut // not a comment /* nor this */",
+  m969: 'tab retry tab edit warning column warning save view error retry paste üñïçödé 文字 😀',
+  "msg.970.qFHI5": 'edit merge retry error select redo help abort merge question undo',
+  "msg.971.nqdj5": "file copy find copy help zoom line merge none find \u00e9\u4e2d\t\n",
+  m972: 'cut merge',
+  "msg.973.mHwp8": 'cancel all select ignore file question view split view cut zoom file \'quoted\'',
+  "msg.974.l5Cah": 'open yes split open tab',
+  m975: "error paste close line split question save",
+  "msg.976.tgEd1": 'question retry paste yes merge file file redo information \u00e9\u4e2d\t\n',
+  "msg.977.dAutu": "abort replace question copy split copy warning \u00e9\u4e2d\t\n",
+  m978: 'abort warning view tab copy information \'quoted\'',
+  "msg.979.hsF0d": 'warning zoom ignore view information close \u00e9\u4e2d\t\n',
+  "msg.980.oxfcB": 'edit abort none view view',
+  m981: "view zoom edit column find select select",
+  "msg.982.unb9z": "file edit information replace warning merge file tab select paste no view",
+  "msg.983.dynsD": "close no paste question",
+  m984: 'information cancel help select find column no copy edit üñïçödé 文字 😀',
+  "msg.985.tIq8i": 'close no error no retry question help close split view split cut \'quoted\'',
+  "msg.986.d5k8J": "edit ignore split close abort no window column \u00e9\u4e2d\t\n",
+  m987: 'line redo none question question cancel redo question \'quoted\'',
+  "msg.988.szm0q": "select help close warning \"quoted\"",
+  "msg.989.rtsgC": "replace find edit merge paste split",
+  m990: "abort select error zoom window error line \"quoted\"",
+  "msg.991.tkwoE": 'warning save file yes üñïçödé 文字 😀',
+  "msg.992.z8fml": 'merge close ignore split C:\\path\\to\\file',
+  m993: 'undo help yes save yes',
+  "msg.994.qntwC": 'cut window yes undo merge information abort retry \'quoted\'',
+  "msg.995.wkGfJ": "question help split undo file close cut help undo",
+  m996: "window none edit tab üñïçödé 文字 😀",
+  "msg.997.dh6x0": 'warning line C:\\path\\to\\file',
+  "msg.998.dlF1r": "paste warning error merge none abort paste \u00e9\u4e2d\t\n",
+  m999: 'abort undo copy zoom',
+  "msg.1000.zAF0l": "ignore information find information save none file retry all information open",
+  "msg.1001.rmCjd": "help undo error open retry all select error redo undo",
+  m1002: 'yes zoom redo',
+  "msg.1003.e6iAo": 'merge abort open yes yes help ignore select close help',
+  "msg.1004.n6fct": 'save merge yes ignore',
+  m1005: "cut copy abort line warning undo information select column select warning close // not a comment /* nor this */",
+  "msg.1006.zs2xC": "file select",
+  "msg.1007.x7aEB": 'window help error question cancel file close',
+  m1008: 'copy abort split abort cut \'quoted\'',
+  "msg.1009.aHJkw": 'none no replace cancel error zoom zoom abort \'quoted\'',
+  "msg.1010.pHqko": 'abort replace edit file help window find edit replace merge paste',
+  m1011: 'error cut select open zoom information zoom retry question zoom \u00e9\u4e2d\t\n',
+  "msg.1012.clip9": 'edit line window close paste',
+  "msg.1013.ceads": "all merge redo paste yes view \u00e9\u4e2d\t\n",
+  m1014: "find yes close retry warning",
+  "msg.1015.tFd2d": 'error select close help view \'quoted\'',
+  "msg.1016.bvfGj": 'find select merge error \'quoted\'',
+  m1017: 'tab save open view select help none abort zoom // not a comment /* nor this */',
+  "msg.1018.b89I4": "no find tab window all open file none warning \"quoted\"",
+  "msg.1019.axGml": "save line paste view replace column \u00e9\u4e2d\t\n",
+  m1020: 'view view warning copy merge abort abort redo ignore cancel line ignore // not a comment /* nor this */',
+  "msg.1021.bGjcj": "copy all zoom paste // not a comment /* nor this */",
+  "msg.1022.wsbfE": 'none copy merge information retry error file tab none retry file',
+  m1023: "select line edit window none open undo merge copy undo paste warning",
+  "msg.1024.oq4Hz": 'tab redo information close save copy paste error split retry',
+  "msg.1025.cmd12": "edit tab yes select merge open information \u00e9\u4e2d\t\n",
+  m1026: "view copy",
+  "msg.1027.pfurd": "help question file column abort find C:\\path\\to\\file",
+  "msg.1028._oqDt": "question all abort view no tab split view",
+  m1029: 'copy error warning file no undo cut retry zoom zoom all C:\\path\\to\\file',
+  "msg.1030.r2Iwk": 'information error',
+  "msg.1031.oIjGi": "abort column file open abort save select cut window \u00e9\u4e2d\t\n",
+  m1032: "all no undo merge find tab undo select column merge cut \"quoted\"",
+  "msg.1033.biH6u": 'split undo paste question copy copy redo question information abort \u00e9\u4e2d\t\n',
+  "msg.1034.zodjb": 'information paste üñïçödé 文字 😀',
+  m1035: 'edit split',
+  "msg.1036.oq1qn": "paste select save save question \"quoted\"",
+  "msg.1037.q8br8": "split edit redo information file zoom information information save \u00e9\u4e2d\t\n",
+  m1038: 'no close paste find select',
+  "msg.1039.xA6Cj": "abort retry information error help tab replace save üñïçödé 文字 😀",
+  "msg.1040.o77pI": 'select save split column find yes save file retry tab abort find',
+  m1041: 'merge error line no all save paste \u00e9\u4e2d\t\n',
+  "msg.1042.wesjh": "no undo none cancel find error \"quoted\"",
+  "msg.1043.$5wgc": "line cancel edit cut warning zoom close save question open \u00e9\u4e2d\t\n",
+  m1044: "select question window error column no paste C:\\path\\to\\file",
+  "msg.1045.jC1xc": "cancel window \u00e9\u4e2d\t\n",
+  "msg.1046.$bih7": 'split warning redo file column replace none error \u00e9\u4e2d\t\n',
+  m1047: "tab window open find retry no warning",
+  last: ""
+};
+var TABLE=[
+"save cancel column close üñïçödé 文字 😀","open cancel window all yes retry view edit \u00e9\u4e2d\t\n",'cut undo','error open edit yes merge redo abort \'quoted\'',"yes no retry no all no",'view close retry warning none ignore save zoom split redo column','replace open open cut all find close yes replace information yes redo // not a comment /* nor this */','cut information open view information question select merge \'quoted\'',
+'ignore cancel window open save none window close ignore retry',"edit redo cut abort replace find select paste cancel \u00e9\u4e2d\t\n","save line",'column tab line save merge copy copy no tab find split \u00e9\u4e2d\t\n',"replace find \u00e9\u4e2d\t\n",'question file warning redo retry split find information open replace \'quoted\'','abort cancel retry tab cancel merge cancel close \'quoted\'',"tab help replace paste yes line help window // not a comment /* nor this */",
+'save cancel replace cut window cancel zoom tab','merge line window zoom yes cut warning cancel paste window close // not a comment /* nor this */',"open select help save none close yes close line line warning","cancel window \u00e9\u4e2d\t\n","warning zoom window question select line all undo help \u00e9\u4e2d\t\n",'view question close line cut select error close C:\\path\\to\\file','zoom no paste üñïçödé 文字 😀',"edit error open yes no save help",
+"line open zoom line no view find column abort yes","find help yes question none information paste select paste information cancel tab",'abort information open redo none redo warning yes open replace undo','cut warning tab tab select copy close ignore line',"none cut find zoom paste question abort undo select retry select paste \u00e9\u4e2d\t\n",'cancel retry abort edit window none','ignore copy find open ignore error column select error \'quoted\'','warning undo none all abort split close yes C:\\path\\to\\file',
+'yes no edit ignore // not a comment /* nor this */','none column information line ignore \u00e9\u4e2d\t\n',"view save information abort question view warning zoom redo none C:\\path\\to\\file",'tab cancel help yes cut error cut paste abort none','save undo ignore none window error',"cut edit file \u00e9\u4e2d\t\n","window retry merge","close redo copy replace",
+'replace no \u00e9\u4e2d\t\n',"select window no cancel replace edit paste find column","copy warning column edit \u00e9\u4e2d\t\n","split select error abort split \"quoted\"","no split no abort information zoom zoom save ignore open cancel abort","copy tab split view edit retry yes cut paste","line cut file C:\\path\\to\\file",'all view',
+'find all cut cut cancel yes','abort error yes no question line yes line all paste merge C:\\path\\to\\file','question undo file retry retry paste undo merge merge replace information abort \u00e9\u4e2d\t\n','retry cancel copy \u00e9\u4e2d\t\n','tab redo warning paste help cut column \'quoted\'','retry view none edit',"replace error retry information none information help C:\\path\\to\\file","warning all yes view redo merge information no none",
+'question line',"error merge paste retry cancel replace abort undo error undo copy warning üñïçödé 文字 😀",'information information retry split redo zoom zoom cancel cut open \u00e9\u4e2d\t\n',"find line // not a comment /* nor this */",'cut window yes merge \u00e9\u4e2d\t\n','view find window open copy no cut undo','question save \'quoted\'','cancel retry retry edit warning yes error',
+"close select edit line edit merge abort warning \u00e9\u4e2d\t\n","retry line redo merge column \"quoted\"",'paste column paste find view replace all merge abort edit edit','window warning redo abort merge ignore open undo none','split close edit warning C:\\path\\to\\file',"close file all copy information yes window file line none ignore","column yes edit window split view zoom column close question \u00e9\u4e2d\t\n","no question none redo undo copy information save copy line edit information",
+'zoom abort','question close question save open split cancel open find save file','find window view edit error',"undo none column select select",'split paste yes \u00e9\u4e2d\t\n','column tab help split zoom help error information undo select column',"zoom information redo merge edit find cancel file window","merge window undo save file open abort file yes",
+'none file no zoom yes abort retry open zoom replace \u00e9\u4e2d\t\n',"yes warning find paste file all column \"quoted\"","all view question replace paste merge","help tab question open no undo all \"quoted\"","help abort yes merge","find none information find file paste undo",'select replace cancel retry merge retry view retry','close redo none abort save',
+"retry zoom edit replace line warning error abort warning replace information error \"quoted\"","help column merge split yes undo abort open save üñïçödé 文字 😀","question window yes edit redo line split undo help file replace \u00e9\u4e2d\t\n",'window yes window cut cancel yes // not a comment /* nor this */','tab warning cancel paste cut paste open','information none window ignore help close \'quoted\'','paste all cut all zoom window',"all line close close redo save window open close line select close",
+'redo select paste \'quoted\'','split copy question view error tab \u00e9\u4e2d\t\n',"copy column zoom column all none all save question column \u00e9\u4e2d\t\n","undo find close replace merge error merge find no none no question","close find merge view undo retry undo","column undo select cut tab view view tab \u00e9\u4e2d\t\n",'view cancel split',"warning no retry redo üñïçödé 文字 😀",
+"save line replace open C:\\path\\to\\file","copy split none help none find retry no line \"quoted\"","split close line column information cancel // not a comment /* nor this */","information merge \u00e9\u4e2d\t\n","ignore edit redo redo all C:\\path\\to\\file",'cut save copy no none zoom all zoom split cancel \'quoted\'','cancel no none window retry paste zoom no column',"warning information cancel ignore help find window edit",
+"find cut redo \"quoted\"","zoom open error edit ignore window // not a comment /* nor this */",'warning zoom error question abort select \'quoted\'',"view column yes line close redo replace column all close none cancel üñïçödé 文字 😀",'warning view \u00e9\u4e2d\t\n','error information cancel','close error warning undo split view save paste tab',"copy yes // not a comment /* nor this */",
+'cancel ignore cancel error column paste','none tab cut ignore find column none information no information \'quoted\'',"zoom cancel merge merge select split open // not a comment /* nor this */","no edit // not a comment /* nor this */",'column line warning redo merge paste help select paste close file warning C:\\path\\to\\file',"information merge paste merge information file paste undo",'cut error zoom redo ignore none \u00e9\u4e2d\t\n',"information select split select split zoom close abort save help \u00e9\u4e2d\t\n",
+'paste cut abort open','information tab','zoom merge cut split merge',"select find edit question save select cancel help",'help select question zoom view column abort zoom all all close // not a comment /* nor this */','window close \u00e9\u4e2d\t\n','replace ignore no edit replace column window column error view yes üñïçödé 文字 😀',"all all tab open yes tab line \u00e9\u4e2d\t\n",
+"tab paste cut select line none all C:\\path\\to\\file",'information error window view undo cancel question window \u00e9\u4e2d\t\n',"column zoom help all edit abort split redo copy",'file yes select file help cancel open file edit error tab // not a comment /* nor this */',"none open retry cancel save tab information üñïçödé 文字 😀",'tab information',"select error replace information none merge error warning undo select üñïçödé 文字 😀",'find save retry find // not a comment /* nor this */',
+"merge split ignore copy","undo retry line yes edit cancel paste split merge","information redo window window üñïçödé 文字 😀","window line ignore split",'ignore paste open edit information open üñïçödé 文字 😀',"none file tab question open question retry edit window open zoom","cancel zoom select open undo question none replace select redo ignore yes // not a comment /* nor this */",'undo split cut redo view ignore merge no close find yes \'quoted\'',
+"retry merge help save C:\\path\\to\\file","select split zoom redo close \"quoted\"","edit save warning","undo abort view \u00e9\u4e2d\t\n",'none save all',"paste find error copy warning \"quoted\"",'information information zoom question','cut cut no information paste help redo retry question',
+'find column tab paste tab window save warning cancel merge zoom file','find retry tab close all cancel column select split',"information find split yes undo paste retry replace merge üñïçödé 文字 😀","column abort all no warning",'close all replace none help edit view none split no find paste \u00e9\u4e2d\t\n','merge no','tab abort find','window retry none open warning view question close',
+'retry copy column question cancel tab none','question yes C:\\path\\to\\file',"save line information",'view select \'quoted\'',"none ignore ignore open all cut no open \"quoted\"","select select warning edit edit all save select yes find file zoom \u00e9\u4e2d\t\n",'redo edit zoom file',"line all zoom edit \"quoted\"",
+'close paste replace','line warning close undo line copy question open column \'quoted\'','cut question retry tab tab edit close cut zoom find no cut',"column line cancel \"quoted\"","undo column merge question zoom yes yes redo redo",'undo tab tab select replace','open copy paste help \'quoted\'','select close file',
+"open redo view close cut no split ignore // not a comment /* nor this */","question split copy \"quoted\"","open cut ignore question cut",'cancel open cut information paste merge \'quoted\'',"question retry error none split open cancel copy C:\\path\\to\\file",'none warning warning // not a comment /* nor this */','question question view replace edit yes window open column select column save C:\\path\\to\\file','zoom yes cancel no question abort',
+"file question file line cancel copy open close view column warning üñïçödé 文字 😀",'merge redo find split split \u00e9\u4e2d\t\n','no cut edit line ignore paste zoom information edit merge column \'quoted\'','file yes \'quoted\'','error all all yes select error line yes üñïçödé 文字 😀','replace redo no error split cut',"help warning window find üñïçödé 文字 😀","redo open none replace select cut merge yes question line",
+"undo question line zoom \u00e9\u4e2d\t\n","copy tab split redo // not a comment /* nor this */","replace redo","window window line file no \"quoted\"",'zoom yes undo merge zoom split all select question open none','redo error undo information information no cancel ignore copy üñïçödé 文字 😀',"all view redo cut replace line cut \"quoted\"","yes none line find C:\\path\\to\\file",
+"cut open edit ignore none",'ignore help column no redo split copy select merge paste none file','open tab column undo paste none redo view üñïçödé 文字 😀',"none zoom tab redo information cancel redo zoom window retry undo \u00e9\u4e2d\t\n","column file retry retry column warning file undo none undo help","redo view yes help save merge yes close window",'column select error save replace help information \u00e9\u4e2d\t\n','cut open zoom warning abort tab error retry find paste',
+'find undo error replace warning // not a comment /* nor this */','help no edit // not a comment /* nor this */',"close warning",'close window replace no retry cut find','error cancel retry redo copy cut üñïçödé 文字 😀',"no column retry abort retry split window yes find paste","line close paste information view tab zoom abort none error undo C:\\path\\to\\file","yes save ignore close help abort open",
+"retry split view find find none open","abort no merge redo file ignore","column error copy select line replace line üñïçödé 文字 😀",'ignore merge line find cut copy ignore cancel all file','find merge select',"close save window redo save find üñïçödé 文字 😀","ignore open information undo tab yes window line zoom error cancel",'open window select all line yes split cut cut find redo \u00e9\u4e2d\t\n',
+"error split no \"quoted\"","close none copy yes abort merge view edit information \"quoted\"","error open \u00e9\u4e2d\t\n",'abort ignore window ignore abort select yes save find copy redo yes C:\\path\\to\\file',"zoom help cancel find paste \"quoted\"",'view column copy window save no zoom question information retry edit error // not a comment /* nor this */',"help paste information split retry copy warning close redo file help // not a comment /* nor this */","file window yes all copy zoom window window",
+'merge column abort close error abort \u00e9\u4e2d\t\n',"cancel error cut warning retry yes yes find retry \"quoted\"","cut question warning edit line no none undo no line",'none redo find // not a comment /* nor this */','view copy select no file none yes zoom undo find \'quoted\'',"retry split cut select cut",'error select cut warning split retry save split paste C:\\path\\to\\file','undo none retry edit split copy line abort open retry cancel \'quoted\'',
+'find find save none none error \'quoted\'','abort close','close warning cut warning find close split column file file zoom window',"abort cut select none line file replace tab save all üñïçödé 文字 😀",'column line abort view cancel zoom save yes window',"save undo üñïçödé 文字 😀","redo select all close undo line undo question edit üñïçödé 文字 😀",'edit line information error none file \u00e9\u4e2d\t\n',
+"cut window \"quoted\"",'warning window all help cut','view error zoom paste merge replace find retry C:\\path\\to\\file','save help view help window column information line copy view no // not a comment /* nor this */',"undo close",'zoom select no warning retry undo \u00e9\u4e2d\t\n',"replace no merge undo paste open \"quoted\"",'cancel retry line edit',
+'help save none error yes merge help warning split yes paste \'quoted\'',"no all line no tab tab column zoom retry undo C:\\path\\to\\file","file yes tab tab tab find \"quoted\"","replace column split undo merge no undo close select üñïçödé 文字 😀","retry window view select paste cancel \u00e9\u4e2d\t\n",'help file line C:\\path\\to\\file','tab no paste yes close file','zoom cut \u00e9\u4e2d\t\n',
+"help merge find view find none column zoom tab cancel","copy tab cancel split C:\\path\\to\\file","all all question close \u00e9\u4e2d\t\n",'paste cancel column paste close close warning copy replace file // not a comment /* nor this */','none error save find merge view',"none zoom close open",'copy no redo abort copy save \u00e9\u4e2d\t\n',"save help paste none warning cancel redo tab all C:\\path\\to\\file",
+"edit redo cut question file none find select yes close \u00e9\u4e2d\t\n","merge view redo split information C:\\path\\to\\file","abort abort üñïçödé 文字 😀",'open file ignore','question edit cancel window // not a comment /* nor this */','yes zoom redo merge information column question no close üñïçödé 文字 😀','window line file merge paste yes yes error question find yes','copy edit question merge error window retry select select information replace redo C:\\path\\to\\file',
+'replace window help column select ignore \u00e9\u4e2d\t\n',"close all cancel find none abort tab undo open window open \"quoted\"","question open replace retry file view line",'line replace question window question replace ignore merge warning save view \u00e9\u4e2d\t\n','question window cut replace redo',"no warning window","paste tab zoom retry edit save edit retry abort merge help","yes column edit retry error file",
+'all select tab close replace cut edit redo','select split yes abort close warning split split','merge no merge none yes copy',"file line column find","column zoom find select find \"quoted\"",'zoom open line merge close merge all view question tab C:\\path\\to\\file',"yes select tab no redo redo warning view replace // not a comment /* nor this */",'error find paste open cut file // not a comment /* nor this */',
+'replace undo retry split \'quoted\'','information save view','column window line tab no error window edit error find information abort üñïçödé 文字 😀',"no paste edit no \u00e9\u4e2d\t\n","all error yes close cut question copy all // not a comment /* nor this */",'edit error tab information abort yes','all tab all all',"warning cut retry error none",
+'help paste tab close warning information file retry','none window abort select retry \u00e9\u4e2d\t\n',"cut tab save column cut warning select retry cut no select","help view merge open open tab redo retry \"quoted\"","line tab yes zoom question window question yes split tab file \"quoted\"",'undo edit yes yes replace view \u00e9\u4e2d\t\n','line information',"select split paste error file üñïçödé 文字 😀",
+'cancel save tab close cut file retry window','tab undo column none error copy merge question ignore warning cancel view \u00e9\u4e2d\t\n',"tab ignore no ignore merge all",'open abort redo paste view zoom error error paste information none cancel',"copy error merge tab warning select yes close yes üñïçödé 文字 😀",'none file ignore copy none tab help file file paste help find \'quoted\'','undo help retry column replace tab column warning abort abort file no üñïçödé 文字 😀','copy none cancel',
+'select redo cut none close C:\\path\\to\\file',"open ignore replace help help information warning abort cut replace üñïçödé 文字 😀","view split save help","abort file","no replace paste save column no replace find question",'error close error cancel merge ignore save tab column warning information find // not a comment /* nor this */','zoom window file help window cut file tab open replace',"question yes file cancel warning find zoom cut view line retry C:\\path\\to\\file",
+"save save information warning question zoom line error no column retry C:\\path\\to\\file","all cut abort open line abort tab tab \"quoted\"",'paste copy zoom tab retry cut select save tab \'quoted\'',"warning file retry undo window error zoom no",'close merge error no paste retry no zoom window replace cut warning','ignore line \'quoted\'','error information error question question warning undo open select file undo','cut window merge open find ignore copy retry merge help window \'quoted\'',
+"ignore information",'close ignore none merge window','file open none copy file find view redo \'quoted\'','copy zoom help // not a comment /* nor this */','information ignore all \'quoted\'','redo error close','edit help open save C:\\path\\to\\file',"select help tab merge copy",
+'file column split yes cut close abort','tab ignore yes cancel split save view open copy retry \u00e9\u4e2d\t\n',"warning paste save split warning abort merge tab yes edit tab save",'cut merge select edit help tab cut redo paste \'quoted\'',"help split replace window cut abort select cut zoom view information all \u00e9\u4e2d\t\n","open edit yes edit line",'copy paste cut find retry help view \u00e9\u4e2d\t\n','none redo find \u00e9\u4e2d\t\n',
+'redo save information close save tab window tab find cut question',"edit abort warning warning save \"quoted\"","replace warning retry select",'redo question split all error','paste merge zoom find error abort redo yes ignore retry redo cancel C:\\path\\to\\file',"find merge column cancel column question copy copy close",'retry select abort question tab','edit yes column undo save select line save cancel none',
+"edit find question undo help none cancel replace copy zoom // not a comment /* nor this */","question zoom copy split split question","tab tab",'copy warning open view zoom',"error none information undo cancel redo information file select copy warning",'abort information zoom','yes close retry replace cancel copy help copy edit // not a comment /* nor this */','edit help view open',
+'copy split error no column view copy save ignore edit zoom','error warning select merge yes cut redo',"copy question view information view abort cancel",'information undo ignore window // not a comment /* nor this */',"information retry ignore yes window save warning","no paste close help redo none warning help zoom file all cut",'merge merge no close select yes no yes \u00e9\u4e2d\t\n','warning undo all copy abort column file open redo undo merge all \'quoted\'',
+'no warning all merge information no ignore close close üñïçödé 文字 😀','close abort \'quoted\'','open tab replace open cut split error',"warning edit find tab paste cut split // not a comment /* nor this */",'warning replace line ignore warning window all split close yes',"window error open save open none retry C:\\path\\to\\file",'warning view view split',"cancel select merge error no // not a comment /* nor this */",
+'all none','no all warning line split question select',"window none none cut merge retry replace warning yes line \"quoted\"","edit cut question column error ignore undo C:\\path\\to\\file","information view merge edit cut copy merge retry retry cancel select","file select","cut open replace no file line paste ignore","ignore replace file find cancel edit file merge help paste retry",
+'cancel merge retry redo paste redo cancel paste paste edit zoom file \u00e9\u4e2d\t\n',"no copy find cut file column open tab zoom \"quoted\"",'tab cut merge line split line close cut none all replace','error all error question cut redo yes replace cut',"redo replace replace select save replace ignore cancel replace select information \"quoted\"","yes replace \u00e9\u4e2d\t\n","save cancel paste replace retry window edit edit none edit open merge üñïçödé 文字 😀",'question zoom zoom split \'quoted\'',
+'copy question window none line split',"question replace line none window none","help yes undo help üñïçödé 文字 😀",'close error window \'quoted\'','zoom select split C:\\path\\to\\file','select error \'quoted\'',"redo information column warning // not a comment /* nor this */",'zoom warning warning \'quoted\'',
+'retry merge tab column redo question paste undo view paste',"cancel line none merge replace","merge zoom warning help no file question redo question save select replace","file zoom","help open",'tab cut',"yes merge tab save file",'question no information \'quoted\'',
+"warning cut close cut tab find","redo retry","line line",'copy merge edit split retry error \u00e9\u4e2d\t\n','question ignore select open \'quoted\'',"ignore file line information paste split","edit line no split replace paste close split yes yes \u00e9\u4e2d\t\n",'question merge ignore ignore file edit abort zoom file zoom undo C:\\path\\to\\file',
+'view line question C:\\path\\to\\file','error view edit no error select \'quoted\'','close column error warning question select \u00e9\u4e2d\t\n','retry zoom window view select zoom window window file C:\\path\\to\\file','information column // not a comment /* nor this */','open column abort no none no replace save redo','edit zoom replace \'quoted\'',"line none // not a comment /* nor this */",
+"close find undo ignore view merge find zoom view",'error ignore tab view üñïçödé 文字 😀','all paste file none none select \u00e9\u4e2d\t\n','tab line tab undo merge help select ignore information information question C:\\path\\to\\file',"split no replace abort view zoom window question find retry cut",'information save question',"cancel error no close abort view column retry \u00e9\u4e2d\t\n",'cut line paste open view copy tab split',
+"retry view save column merge open no",'window cut select all retry \'quoted\'',"ignore edit none help copy close no abort","close error file select open information zoom",'copy close select undo view line none save',"paste select ignore retry ignore zoom replace undo yes // not a comment /* nor this */",'redo no paste information replace close all line window cut tab cancel \'quoted\'','window open cut ignore select help tab retry',
+'find replace',"window file replace error abort question close tab zoom column all","column yes paste cancel copy abort open C:\\path\\to\\file",'window redo',"yes view cut retry cancel ignore abort open no \u00e9\u4e2d\t\n","line question save split window redo // not a comment /* nor this */","undo error","find open paste üñïçödé 文字 😀",
+'all retry retry edit select undo cancel yes file \'quoted\'',"information view find paste undo find file","window cancel view error line ignore cancel yes C:\\path\\to\\file","none error copy cut help line \"quoted\"",'paste split cancel retry retry save zoom redo question no undo file \u00e9\u4e2d\t\n','all close question open','retry edit window paste file close yes tab paste line view',"line error",
+'yes select paste select file copy abort ignore replace','undo cancel file find cancel find no edit replace \u00e9\u4e2d\t\n',"undo split all undo line copy close undo paste \u00e9\u4e2d\t\n",'information select edit select undo yes no window close retry',"cancel none C:\\path\\to\\file",'column select error paste window yes close none error open \'quoted\'','question line none split column error replace close line merge ignore all','save information view replace open window C:\\path\\to\\file',
+'file save cancel yes copy tab view copy help view close split \u00e9\u4e2d\t\n',"redo warning cancel line line open no",'find merge tab no copy zoom merge','column no view all tab cancel warning \u00e9\u4e2d\t\n','ignore line file redo no undo close // not a comment /* nor this */',"error view all open abort edit retry save split no information replace \u00e9\u4e2d\t\n",'cut cut zoom information retry help view // not a comment /* nor this */',"error find redo find merge",
+"redo select retry redo","all redo error find column paste retry abort",'save information yes file error yes none file no',"undo open cancel \"quoted\"",'copy cut yes yes none edit copy question edit find replace information üñïçödé 文字 😀','edit no zoom',"error replace replace merge window all open retry abort","find cancel error warning tab",
+"file zoom \"quoted\"","cut warning select select üñïçödé 文字 😀","ignore replace find no yes zoom save redo replace open cancel C:\\path\\to\\file",'view none warning merge cut help close no \'quoted\'',"no select ignore view all cut window \u00e9\u4e2d\t\n",'replace paste retry all // not a comment /* nor this */',"tab no window C:\\path\\to\\file",'open save merge window',
+"replace replace save open edit window all üñïçödé 文字 😀","split cut all window error tab yes C:\\path\\to\\file",'tab open tab copy undo none \u00e9\u4e2d\t\n','error information warning save',"error open all redo",'line redo abort ignore zoom cancel all window','line view close cut \'quoted\'','none tab view window cancel abort ignore file zoom none paste',
+"all save warning find cut cut abort ignore",'copy all tab warning view undo replace information warning line','cancel replace question column replace find information merge merge \u00e9\u4e2d\t\n',"question help copy all information find zoom tab ignore find select file \u00e9\u4e2d\t\n",'no file file warning warning merge replace line no error close cancel','merge merge save abort replace open view zoom select ignore C:\\path\\to\\file',"select none no yes help save close",'open split error retry retry column none merge column copy view file',
+'edit split split warning','undo edit close edit cancel',"replace edit find open cancel merge split retry üñïçödé 文字 😀",'file tab edit C:\\path\\to\\file','find ignore file split warning yes question','redo line retry information yes','question file information redo no split cut C:\\path\\to\\file',"ignore none ignore copy help paste ignore",
+'close save abort open tab open save edit zoom','find cut window save error tab help information all undo no',"replace copy ignore cancel edit copy üñïçödé 文字 😀",'find ignore','close replace edit merge question redo merge C:\\path\\to\\file',"ignore error cancel paste abort replace replace \"quoted\"",'save yes merge ignore warning tab error',"retry line save close copy cancel cancel retry all copy find none",
+'no zoom line',"paste select cut abort save copy no line","undo cancel column information cut undo yes undo",'column save ignore tab merge abort tab find',"line line",'warning help information no question cancel find close information view C:\\path\\to\\file',"find tab find copy zoom C:\\path\\to\\file","column open help no line help column undo all open",
+"edit help ignore replace split ignore copy close cut",'question help copy cut warning undo file retry ignore information',"zoom question cut information question close paste",'find all merge replace cut find merge none','merge column redo column view line warning information help question all \'quoted\'',"window tab all save line question select all \"quoted\"",'find view select warning copy undo copy none // not a comment /* nor this */','none none none yes information error ignore information select split yes // not a comment /* nor this */',
+"redo view paste view line copy tab column abort no zoom","view ignore none error information view yes none edit \"quoted\"",'paste paste C:\\path\\to\\file','select view find find select warning','copy error cut undo yes information all ignore question none C:\\path\\to\\file',"open view file view open all cancel retry question view save",'file help view zoom retry error error select help line \u00e9\u4e2d\t\n',"edit replace find find question redo file yes all open column // not a comment /* nor this */",
+'copy merge ignore ignore window file no zoom question C:\\path\\to\\file',"zoom line information line error error help window open \u00e9\u4e2d\t\n","help select",'yes window tab paste edit merge retry file','undo ignore all replace split information zoom close question zoom close // not a comment /* nor this */','close all save no split','ignore retry retry cancel edit retry retry zoom cut help C:\\path\\to\\file','edit view',
+"edit select error error merge üñïçödé 文字 😀","error redo",'window yes replace','question yes help cancel column warning paste undo paste \'quoted\'','cut file yes find error cut ignore ignore warning view save redo \'quoted\'',"close view warning abort",'retry find cut copy','file redo all information warning view edit line \'quoted\'',
+'line yes abort no warning error close merge',"select question help none // not a comment /* nor this */","no zoom warning cut information file // not a comment /* nor this */",'redo file cut error no cut split information redo close save close // not a comment /* nor this */',"split no question column information column error edit line \u00e9\u4e2d\t\n",'split undo abort \u00e9\u4e2d\t\n',"warning edit undo line",'ignore open',
+'none line close window information find edit merge tab edit zoom find \u00e9\u4e2d\t\n','no question paste none window select','ignore warning zoom all no question tab',"none column error paste none abort all paste window // not a comment /* nor this */","replace ignore redo C:\\path\\to\\file","retry column retry","all column line information find file copy error column file","line tab \"quoted\"",
+"paste select yes error \"quoted\"","column retry question cancel retry paste column error cancel help all all \u00e9\u4e2d\t\n",'no retry merge paste warning yes copy edit cut cancel \'quoted\'',"paste paste undo ignore help copy all üñïçödé 文字 😀",'window all none line ignore column retry line view ignore error warning','cancel replace error // not a comment /* nor this */','error question edit open tab zoom \u00e9\u4e2d\t\n','paste error // not a comment /* nor this */',
+"split view close üñïçödé 文字 😀",'undo zoom save error merge retry undo all open window abort','copy question question paste replace','close split column',"split column",'view all close copy tab retry cancel ignore \u00e9\u4e2d\t\n','retry retry close redo redo retry yes',"help all column view \u00e9\u4e2d\t\n",
+'error edit','question yes information all ignore \'quoted\'','view information close tab line column error cancel find save error \u00e9\u4e2d\t\n','tab retry \'quoted\'',"file help close column abort",'retry save close edit error merge open \u00e9\u4e2d\t\n',"view undo line open help all select find ignore copy error open","zoom undo cancel zoom none paste close all information information split \u00e9\u4e2d\t\n",
+'warning tab retry no copy abort yes no \'quoted\'',"window line column abort ignore file window error help find yes zoom",'help replace retry tab abort all warning zoom help',"error abort all select line close tab tab merge warning find warning // not a comment /* nor this */",'none abort save open file question merge column window undo paste \u00e9\u4e2d\t\n','information line tab select line line column line redo save help split','line warning warning open copy open save none tab none view split // not a comment /* nor this */','zoom split window column zoom yes yes tab zoom retry warning // not a comment /* nor this */',
+'replace replace merge error tab save information window \'quoted\'','open no ignore C:\\path\\to\\file',"warning none \"quoted\"",'merge line','file close cut tab','yes close ignore redo window question line retry open find copy',"save find retry none redo ignore tab replace paste close \u00e9\u4e2d\t\n","abort close ignore paste",
+'warning split zoom',"cut ignore file no cut split retry file save all","line paste none question ignore tab",'retry warning replace question zoom information retry select split \u00e9\u4e2d\t\n',"window window edit information save \u00e9\u4e2d\t\n","column cut file redo cancel \"quoted\"","column no \"quoted\"",'column abort close question \'quoted\'',
+'cut warning select column abort ignore C:\\path\\to\\file','select edit cancel none save save undo zoom select zoom',"undo retry paste open close window undo split question question retry","redo information",'all open merge undo retry none file replace split no close C:\\path\\to\\file','none window merge none none warning select retry none undo split save \u00e9\u4e2d\t\n',"zoom redo \u00e9\u4e2d\t\n","cut file save abort paste close cancel zoom edit paste // not a comment /* nor this */",
+"help close file find","file find split save view information yes all warning tab \"quoted\"",'zoom warning file undo','column save view find C:\\path\\to\\file','information undo warning error copy edit \'quoted\'','undo redo ignore undo line select merge',"find column no","no cut line redo cut view abort save",
+"cut save retry view view retry select select select window abort",'undo all abort ignore save line undo close cancel help // not a comment /* nor this */','close undo column replace cancel none yes ignore','line close',"file ignore undo cut cut","paste cancel tab ignore zoom redo replace view question \u00e9\u4e2d\t\n",'paste open replace üñïçödé 文字 😀','no ignore close paste redo line paste edit copy window üñïçödé 文字 😀',
+'abort paste all redo paste view none','all all all split save all undo',"copy abort no zoom",'file ignore view merge column save',"close open close select cut yes find save","replace open question close select merge replace find split // not a comment /* nor this */",'ignore none all cancel',"window view merge \"quoted\"",
+'file no find yes cut no // not a comment /* nor this */',"retry select save find retry column split C:\\path\\to\\file",'none find cancel file',"retry information warning copy cut cut cancel \"quoted\"",'window help save C:\\path\\to\\file','window find redo abort replace \'quoted\'',"replace error find none question abort cancel window undo üñïçödé 文字 😀","column redo ignore tab",
+'save no find all cancel column file window file cancel','find undo cancel open',"abort zoom close","edit error undo none error file help tab \u00e9\u4e2d\t\n","file redo file view replace none \u00e9\u4e2d\t\n",'all edit view information line open column none question paste help merge',"cancel yes zoom C:\\path\\to\\file","merge redo none file redo paste edit abort copy question view \u00e9\u4e2d\t\n",
+'copy window select information zoom window retry','warning split \'quoted\'','merge paste save paste edit abort question',"redo error","find warning all yes find line merge none save select",""];
+var LONG="close error select save window find edit undo question cut yes zoom question close find question close edit none line \
+retry cut merge open file yes no select edit error ignore question column none no ignore paste line zoom split \
+none save line close close find tab ignore close none zoom retry question copy tab redo file error warning edit \
+save none question find column paste replace save close redo redo no retry find undo close error copy window tab \
+ignore yes zoom view abort cut split paste undo warning merge select line open tab information none replace window cancel \
+cut replace line ignore undo question select error none cut select retry error zoom none window question replace warning split \
+abort line close split find edit error help information redo all paste warning paste open ignore zoom question help all \
+help window view cancel undo select error information information line abort replace none file none window cancel window view retry \
+cancel redo no abort yes none split yes paste close undo find error column undo open replace open zoom error \
+paste copy view cancel help undo help view view save view cancel edit view open question ignore paste replace redo \
+close cancel column edit view split none warning edit select line select yes line select retry copy none select file \
+none tab information column information view tab view line find column question view error help window redo view edit error \
+find redo split all line abort no retry warning help select view cut none abort save warning retry view tab \
+no question replace split warning view ignore find open retry cancel question question question column retry close paste merge cancel \
+file cancel yes paste redo none none view split question cancel warning help undo undo view cancel retry find retry \
+zoom help edit edit no window all tab warning replace merge line all paste cancel redo cut retry window edit \
+open yes yes open question tab column ignore ignore close merge merge replace abort file error tab merge cancel edit \
+retry tab select undo zoom zoom split save no ignore edit tab select split redo merge all cut copy tab \
+error zoom edit abort merge help retry replace zoom tab ignore line yes retry undo all column replace save tab \
+edit error error information undo paste find save save all cut line merge view window ignore view copy retry abort \
+line copy help line abort cut window redo save close error abort column help all find close redo save abort \
+question close line all undo replace all find yes file retry ignore undo find undo select save zoom abort yes \
+abort replace tab merge tab abort error find cancel line close none all all abort tab open copy question line \
+all edit find line all abort undo cut undo zoom save ignore copy file tab split replace warning merge find \
+copy window zoom cut replace line question cut line column cancel tab abort select line redo warning information copy question \
+replace find open tab paste information open cut replace all all tab open save close tab edit column find question \
+all edit file retry retry yes open all retry find question no open abort yes all abort line column information \
+no cut cut paste split view select ignore edit abort close all no merge find edit cancel undo line split \
+redo undo view warning cancel redo view information paste question file line cancel split no save split copy no save \
+abort undo yes tab window help yes error close split view warning information close find error save replace view cut \
+question window warning undo cut file find none find ignore error column question ignore none ignore warning redo window question \
+yes column column split save view find tab error find yes ignore file help view information select merge close copy \
+save tab split redo undo column open copy cancel warning paste find copy error retry all file yes question yes \
+none copy file line none abort column window merge zoom undo ignore open window retry open copy ignore no cancel \
+copy zoom copy paste help column replace retry redo replace paste merge window copy none select abort find warning no \
+all yes no tab split information question undo warning yes split redo view warning find zoom all ignore replace none \
+open copy error yes all none none abort abort select copy warning warning ignore save open zoom zoom retry no \
+undo split close view edit close merge information retry zoom redo help window zoom information warning merge file error zoom \
+split replace open ignore zoom replace zoom cancel replace line all yes information paste question retry help edit column tab \
+find warning abort paste retry no help split retry error error file cancel select view edit warning column undo find \
+undo copy file paste copy split all copy cancel view file find line none cancel yes tab view save retry \
+split view view no none replace open cancel cut split redo save undo cut cancel redo ignore save yes no \
+question tab abort window window close yes information split no tab column cut help cut window window retry file no \
+copy split merge help question undo save paste cut retry error ignore replace error error abort line retry zoom file \
+cancel zoom column ignore merge view split question cut open tab none question no merge tab abort all find no \
+view replace yes yes ignore replace split split no information ignore save line all ignore none redo yes split select \
+tab error retry cancel edit cut save no open ignore zoom undo view cancel zoom abort error save redo merge \
+split redo save ignore find ignore ignore no zoom zoom retry no view question help save undo information view information \
+edit find retry retry redo find save split abort question undo split yes redo column undo tab tab close ignore \
+copy file redo retry undo cancel line all save view line copy question open paste line save window warning information \
+abort ignore close tab yes line information information copy close help abort error yes save error copy find copy close \
+none select split help merge tab column file view question help tab yes split close redo zoom open information help \
+all merge copy cut column open merge file merge line split redo close merge select select close window open select \
+information cut abort help line edit paste cancel abort all replace line copy none save warning replace abort column yes \
+tab file merge information cut redo line question yes retry error yes question no find abort copy edit paste zoom \
+redo information view retry line paste window warning ignore none tab copy yes cancel undo warning column error retry redo \
+split split merge close view replace copy tab open zoom undo line save select ignore none all question none split \
+replace no select cancel merge edit cut zoom close redo view error line error help information save undo copy column \
+column column all all error view ignore view question abort line retry redo zoom help window zoom line view retry \
+zoom undo replace redo abort file information window yes no paste information cut yes zoom line undo select save zoom \
+redo view none cut column warning find warning open help yes abort help merge column tab redo undo open line \
+cut line edit all split open window warning merge undo view save warning zoom warning replace open column undo none \
+close view undo error paste file select paste line none abort none paste yes help split retry none merge cancel \
+window cancel split column cancel redo cut split edit zoom copy warning view information split ignore save copy no yes \
+yes cut error error undo help edit help redo abort help view merge window cut question ignore none abort find \
+view open paste all all view retry cancel question save warning copy split warning paste line file all column information \
+paste copy no window question cancel replace window select retry cancel tab error cancel edit error merge split column ignore \
+error save retry replace warning copy none replace redo save paste open merge zoom all retry view retry split open \
+no question save view error line find window undo question line retry all question split window tab close line copy \
+column information column save none question select cut yes find tab help column paste warning tab split abort tab error \
+save none zoom replace edit none file find edit split no select error save help split merge tab warning line \
+window column redo save close window merge ignore line replace line all replace column zoom split close retry tab cut \
+copy merge tab paste save window file zoom view no cut edit yes merge tab help view retry all all \
+view paste abort split file ignore view help help cut abort help help question question tab line tab file copy \
+zoom cancel help cut information help error merge paste paste split split cancel none edit paste find column column none \
+select find information window question copy merge cancel cancel replace no question close information paste line column no window cut \
+file warning redo edit merge cut view split all question cut close all cut error view split information undo merge \
+none yes replace file save cut none column none paste find all column split all redo paste error yes paste \
+open redo close no split copy replace edit save cancel split replace abort select window redo help zoom retry file \
+cut save no merge information error information retry undo yes none select ignore undo redo question ignore question paste ignore \
+split zoom warning none tab zoom file edit replace zoom warning tab column retry replace all copy help no retry \
+all question yes select split no find open retry all cancel merge paste edit line zoom ignore copy question all \
+close undo information cut warning ignore split warning help window paste warning error undo copy edit edit redo select save \
+retry yes find no replace line retry undo open file abort find file abort find cut tab column paste save \
+merge retry warning copy window tab cancel abort file abort split select edit cut yes tab merge yes no none \
+abort ignore tab information copy retry window close view edit save split ignore information cut retry tab window warning save \
+select window abort warning cancel file error split cut copy save window merge ignore window replace information zoom yes none \
+yes warning view window replace question split window view open zoom redo abort open cut line open warning cancel save \
+window question zoom select cut ignore zoom merge all ignore no cut window open warning cut edit zoom select cancel \
+question window cut column find column close copy save error close close edit no error error column close column replace \
+yes select window save column replace save open view redo find split find cancel no window open find paste split \
+zoom tab error undo cancel replace error close copy information save cancel abort warning ignore yes save copy cancel edit \
+view close copy view warning help cut no paste error error yes view no find warning help information help merge \
+undo warning close window cancel abort copy column redo no line abort select close zoom zoom warning select warning replace \
+cancel yes merge warning select paste retry help line merge save replace split no yes question merge open all yes \
+yes view view error undo window save merge redo none tab window none split split zoom open undo abort paste \
+open ignore zoom undo ignore tab all question select edit open tab cut warning retry edit merge zoom ignore undo \
+copy none tab yes merge select warning column select window abort ignore replace undo yes select redo close ignore merge \
+replace undo merge cancel split close tab ignore line merge information retry select yes warning question redo line window line \
+retry view question help find none ignore no replace edit abort all line question copy column undo file information cancel \
+cancel all retry cancel question undo zoom replace question undo retry select abort retry replace yes close all close line \
+paste replace find redo paste no information undo retry column none tab merge error replace split tab window undo window \
+";
+var TEMPLATE=`
+  ${MESSAGES.m0} and ${TABLE.length} /* */ // `;
+function t(key,args){var s=MESSAGES[key]||key;return s.replace(/\{(\d+)\}/g,function(m,i){return args[i]})}
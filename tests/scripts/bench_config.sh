@@ -0,0 +1,93 @@
+#!/bin/sh
+
+# configuration file load benchmark for tinyproxy
+#
+# Generates a configuration file with many Allow, Upstream and AddHeader
+# lines and times how long tinyproxy takes to read it and go into the
+# background.  A second run checks that a syntax error is still reported
+# with its line number.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+SCRIPTS_DIR=$(pwd)/$(dirname $0)
+BASEDIR=$SCRIPTS_DIR/../..
+TESTS_DIR=$SCRIPTS_DIR/..
+TESTENV_DIR=$TESTS_DIR/env.bench
+
+# number of lines generated for each of the directives
+BENCH_LINES=${BENCH_LINES:-10000}
+
+TINYPROXY_IP=127.0.0.2
+TINYPROXY_PORT=12323
+TINYPROXY_USER=$(id -un)
+TINYPROXY_PID_FILE=$TESTENV_DIR/tinyproxy.pid
+TINYPROXY_CONF_FILE=$TESTENV_DIR/tinyproxy.conf
+TINYPROXY_BIN=$BASEDIR/src/tinyproxy
+
+provision() {
+	rm -rf $TESTENV_DIR
+	mkdir -p $TESTENV_DIR
+
+	cat >$TINYPROXY_CONF_FILE<<EOF2
+# generated by bench_config.sh
+User $TINYPROXY_USER
+Port $TINYPROXY_PORT
+Listen $TINYPROXY_IP
+Timeout 600
+Logfile "$TESTENV_DIR/tinyproxy.log"
+PidFile "$TINYPROXY_PID_FILE"
+LogLevel Warning
+MaxClients 10
+MinSpareServers 1
+MaxSpareServers 2
+StartServers 1
+EOF2
+
+	for LINE in $(seq 1 $BENCH_LINES) ; do
+		echo "Allow 10.$((LINE / 256 % 256)).$((LINE % 256)).0/24"
+		echo "Upstream proxy$LINE.example.com:3128 \".site$LINE.example.com\""
+		echo "AddHeader \"X-Bench-$LINE\" \"value $LINE\""
+	done >> $TINYPROXY_CONF_FILE
+}
+
+provision
+
+LINES=$(wc -l < $TINYPROXY_CONF_FILE)
+
+START=$(date +%s.%N)
+$TINYPROXY_BIN -c $TINYPROXY_CONF_FILE 2> $TESTENV_DIR/tinyproxy.stderr.log
+END=$(date +%s.%N)
+
+awk "BEGIN { printf \"loaded %d lines in %.3f seconds\\n\", \
+	$LINES, $END - $START }"
+
+FAILED=0
+
+if test -e $TINYPROXY_PID_FILE ; then
+	kill $(cat $TINYPROXY_PID_FILE)
+else
+	echo "ERROR: tinyproxy did not start"
+	FAILED=1
+fi
+
+echo "Port 8888 trailing-garbage" >> $TINYPROXY_CONF_FILE
+$TINYPROXY_BIN -c $TINYPROXY_CONF_FILE > $TESTENV_DIR/syntax.log 2>&1
+if ! grep -q "Syntax error on line $((LINES + 1))" $TESTENV_DIR/syntax.log
+then
+	echo "ERROR: syntax error not reported on line $((LINES + 1))"
+	FAILED=1
+fi
+
+exit $FAILED
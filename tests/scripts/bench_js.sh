@@ -0,0 +1,110 @@
+#!/bin/sh
+
+# JavaScript instrumenter benchmark for tinyproxy
+#
+# Runs "js -b" over the files in tests/js-corpus and prints one
+# tab-separated line per file: parse and insert speed in MB/s, parsed
+# nodes per second, malloc calls and peak heap of one round, and peak
+# resident memory.  Save the output to compare a later run with it:
+#
+#	bench_js.sh > before.tsv
+#	... change src/js.c, rebuild ...
+#	bench_js.sh before.tsv
+#
+# which fails if a file got more than BENCH_TOLERANCE percent slower,
+# needs more than BENCH_TOLERANCE percent more heap, or allocates more
+# often than before.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+SCRIPTS_DIR=$(pwd)/$(dirname $0)
+BASEDIR=$SCRIPTS_DIR/../..
+TESTS_DIR=$SCRIPTS_DIR/..
+CORPUS_DIR=$TESTS_DIR/js-corpus
+JS_BIN=$BASEDIR/src/js
+
+# rounds timed per file, extra js options (such as "-t -m" or "-c 4096")
+# and the slowdown in percent still accepted against a baseline
+BENCH_ROUNDS=${BENCH_ROUNDS:-20}
+BENCH_JS_FLAGS=${BENCH_JS_FLAGS:-}
+BENCH_TOLERANCE=${BENCH_TOLERANCE:-10}
+
+BASELINE=$1
+if test -n "$BASELINE" && ! test -r "$BASELINE" ; then
+	echo "ERROR: can't read baseline $BASELINE" >&2
+	exit 1
+fi
+
+RESULTS=$(mktemp) || exit 1
+
+# one process per file, so that rss_kb is the peak of that file alone
+FIRST=yes
+for FILE in $(cd $CORPUS_DIR && ls *.js) ; do
+	(cd $CORPUS_DIR && $JS_BIN $BENCH_JS_FLAGS -p -b $FILE $BENCH_ROUNDS) \
+		> $RESULTS.one || { rm -f $RESULTS $RESULTS.one ; exit 1 ; }
+	if test "x$FIRST" = "xyes" ; then
+		cat $RESULTS.one
+		FIRST=no
+	else
+		sed 1d $RESULTS.one
+	fi
+done > $RESULTS
+rm -f $RESULTS.one
+
+cat $RESULTS
+
+FAILED=0
+if test -n "$BASELINE" ; then
+	# columns are found by name, so baselines from older versions with
+	# fewer columns still compare
+	awk -F '\t' -v tolerance=$BENCH_TOLERANCE '
+		FNR == 1 { for (i = 1; i <= NF; i++) col[FILENAME, $i] = i; next }
+		FILENAME == ARGV[1] {
+			for (i = 1; i <= NF; i++) old[$1, i] = $i
+			seen[$1] = 1
+			next
+		}
+		!($1 in seen) { next }
+		{
+			n = split("parse_mb_s insert_mb_s parse_allocs insert_allocs parse_heap_kb insert_heap_kb", names, " ")
+			for (i = 1; i <= n; i++) {
+				name = names[i]
+				if (!((ARGV[1], name) in col) || !((FILENAME, name) in col))
+					continue
+				before = old[$1, col[ARGV[1], name]] + 0
+				after = $col[FILENAME, name] + 0
+				if (before < 0 || after < 0)
+					continue
+				if (name ~ /_mb_s$/)
+					bad = after < before * (1 - tolerance / 100)
+				else if (name ~ /_allocs$/)
+					bad = after > before
+				else
+					bad = after > before * (1 + tolerance / 100)
+				if (bad) {
+					printf "REGRESSION: %s %s %s -> %s\n", $1, name, before, after
+					failed = 1
+				}
+			}
+		}
+		END { exit failed }
+	' "$BASELINE" $RESULTS || FAILED=1
+fi
+
+rm -f $RESULTS
+
+test "x$FAILED" = "x0" || echo "ERROR: slower or bigger than $BASELINE"
+
+exit $FAILED
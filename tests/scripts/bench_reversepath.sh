@@ -0,0 +1,102 @@
+#!/bin/sh
+
+# reverse proxy path lookup benchmark for tinyproxy
+#
+# Starts tinyproxy with a large number of ReversePath rules and times a
+# series of requests that have to be matched against them.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+SCRIPTS_DIR=$(pwd)/$(dirname $0)
+BASEDIR=$SCRIPTS_DIR/../..
+TESTS_DIR=$SCRIPTS_DIR/..
+TESTENV_DIR=$TESTS_DIR/env.bench
+LOG_DIR=$TESTENV_DIR/var/log
+
+# number of ReversePath rules and of requests to time
+BENCH_RULES=${BENCH_RULES:-10000}
+BENCH_REQUESTS=${BENCH_REQUESTS:-500}
+
+TINYPROXY_IP=127.0.0.2
+TINYPROXY_PORT=12322
+TINYPROXY_USER=$(id -un)
+TINYPROXY_PID_FILE=$TESTENV_DIR/tinyproxy.pid
+TINYPROXY_CONF_FILE=$TESTENV_DIR/tinyproxy.conf
+TINYPROXY_BIN=$BASEDIR/src/tinyproxy
+
+WEBSERVER_IP=127.0.0.3
+WEBSERVER_PORT=32124
+WEBSERVER_PID_FILE=$TESTENV_DIR/webserver.pid
+WEBSERVER_BIN=$SCRIPTS_DIR/webserver.pl
+
+WEBCLIENT_BIN=$SCRIPTS_DIR/webclient.pl
+
+provision() {
+	rm -rf $TESTENV_DIR
+	mkdir -p $LOG_DIR
+
+	cat >$TINYPROXY_CONF_FILE<<EOF2
+User $TINYPROXY_USER
+Port $TINYPROXY_PORT
+Listen $TINYPROXY_IP
+Timeout 600
+Logfile "$LOG_DIR/tinyproxy.log"
+PidFile "$TINYPROXY_PID_FILE"
+LogLevel Warning
+MaxClients 10
+MinSpareServers 2
+MaxSpareServers 5
+StartServers 2
+Allow 127.0.0.0/8
+ReverseOnly Yes
+EOF2
+
+	for RULE in $(seq 1 $BENCH_RULES) ; do
+		echo "ReversePath \"/bench/$RULE/\" \"http://$WEBSERVER_IP:$WEBSERVER_PORT/\""
+	done >> $TINYPROXY_CONF_FILE
+}
+
+# time_requests <label> <path>
+time_requests() {
+	START=$(date +%s.%N)
+	for COUNT in $(seq 1 $BENCH_REQUESTS) ; do
+		$WEBCLIENT_BIN "$TINYPROXY_IP:$TINYPROXY_PORT" "$2" \
+			> /dev/null 2>&1 || return 1
+	done
+	END=$(date +%s.%N)
+
+	awk "BEGIN { printf \"%s: %d requests in %.3f seconds\\n\", \
+		\"$1\", $BENCH_REQUESTS, $END - $START }"
+}
+
+provision
+
+$WEBSERVER_BIN --port $WEBSERVER_PORT --log-dir $LOG_DIR \
+	--pid-file $WEBSERVER_PID_FILE
+$TINYPROXY_BIN -c $TINYPROXY_CONF_FILE 2> $LOG_DIR/tinyproxy.stderr.log
+sleep 3
+
+FAILED=0
+
+echo "$BENCH_RULES ReversePath rules"
+time_requests "first rule" "/bench/1/" || FAILED=1
+time_requests "last rule" "/bench/$BENCH_RULES/" || FAILED=1
+
+kill $(cat $TINYPROXY_PID_FILE)
+kill $(cat $WEBSERVER_PID_FILE)
+
+test "x$FAILED" = "x0" || echo "ERROR: request through tinyproxy failed"
+
+exit $FAILED
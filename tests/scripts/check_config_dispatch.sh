@@ -0,0 +1,36 @@
+#!/bin/sh
+
+# configuration directive dispatch check for tinyproxy
+#
+# Runs the lines of tests/config-corpus through src/conf-dispatch, which
+# looks each one up both in the keyword dispatch table and by trying the
+# directive regexes in table order, and fails if the two pick a different
+# directive for any line.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+# run from run_tests.sh with an absolute path
+SCRIPTS_DIR=$(cd $(dirname $0) && pwd)
+BASEDIR=$SCRIPTS_DIR/../..
+TESTS_DIR=$SCRIPTS_DIR/..
+
+CONF_DISPATCH_BIN=$BASEDIR/src/conf-dispatch
+
+if ! test -x $CONF_DISPATCH_BIN ; then
+	echo "$CONF_DISPATCH_BIN not found, run make first"
+	exit 2
+fi
+
+$CONF_DISPATCH_BIN $TESTS_DIR/config-corpus/*.conf
@@ -0,0 +1,92 @@
+#!/bin/sh
+
+# chunked transfer coding test for tinyproxy
+#
+# Starts tinyproxy with a rewrite rule and runs chunkedtest.pl against
+# it, which serves chunked bodies of various shapes through the proxy:
+# size lines split across reads, chunk extensions, bare LF line ends,
+# trailers up to and over the limit, and malformed or overflowing sizes.
+# Chunked request bodies are sent the other way.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+# run from run_tests.sh with an absolute path
+SCRIPTS_DIR=$(cd $(dirname $0) && pwd)
+BASEDIR=$SCRIPTS_DIR/../..
+TESTS_DIR=$SCRIPTS_DIR/..
+TESTENV_DIR=$TESTS_DIR/env.chunked
+
+TINYPROXY_IP=127.0.0.1
+TINYPROXY_PORT=12324
+TINYPROXY_USER=$(id -un)
+TINYPROXY_PID_FILE=$TESTENV_DIR/tinyproxy.pid
+TINYPROXY_CONF_FILE=$TESTENV_DIR/tinyproxy.conf
+TINYPROXY_LOG_FILE=$TESTENV_DIR/tinyproxy.log
+TINYPROXY_BIN=$BASEDIR/src/tinyproxy
+
+WEBSERVER_PORT=32124
+
+CHUNKEDTEST_BIN=$SCRIPTS_DIR/chunkedtest.pl
+
+provision() {
+	rm -rf $TESTENV_DIR
+	mkdir -p $TESTENV_DIR
+
+	cat >$TINYPROXY_CONF_FILE<<EOF2
+User $TINYPROXY_USER
+Port $TINYPROXY_PORT
+Listen $TINYPROXY_IP
+Timeout 600
+Logfile "$TINYPROXY_LOG_FILE"
+PidFile "$TINYPROXY_PID_FILE"
+LogLevel Info
+MaxClients 20
+MinSpareServers 2
+MaxSpareServers 10
+StartServers 4
+Allow 127.0.0.0/8
+RewriteReplace "/rewrite/" "hello" "HELLO"
+EOF2
+}
+
+start_tinyproxy() {
+	echo -n "starting tinyproxy..."
+	$VALGRIND $TINYPROXY_BIN -c $TINYPROXY_CONF_FILE
+	echo " done (listening on $TINYPROXY_IP:$TINYPROXY_PORT)"
+}
+
+stop_tinyproxy() {
+	echo -n "killing tinyproxy..."
+	kill $(cat $TINYPROXY_PID_FILE)
+	if test "x$?" = "x0" ; then
+		echo " ok"
+	else
+		echo " error"
+	fi
+}
+
+# "main"
+
+provision
+start_tinyproxy
+sleep 1
+
+$CHUNKEDTEST_BIN --proxy $TINYPROXY_IP:$TINYPROXY_PORT \
+	--server-port $WEBSERVER_PORT --log $TINYPROXY_LOG_FILE
+FAILED=$?
+
+stop_tinyproxy
+
+exit $FAILED
@@ -0,0 +1,494 @@
+#!/usr/bin/perl -w
+
+# Chunked transfer coding test for tinyproxy.
+#
+# Starts a web server that answers with chunked bodies of various shapes,
+# requests them through the proxy and compares what comes out with what
+# the server sent.  Chunked request bodies are sent the other way, to a
+# resource that echoes the bytes it got.
+#
+# This program is free software; you can redistribute it and/or modify it
+# under the terms of the GNU General Public License as published by the Free
+# Software Foundation; either version 2 of the License, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+# more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, see <http://www.gnu.org/licenses/>.
+
+
+use strict;
+
+use IO::Socket;
+use IO::Select;
+use Time::HiRes qw(sleep time);
+use Getopt::Long;
+use Pod::Usage;
+
+my $EOL = "\015\012";
+
+my $proxy = "127.0.0.1:12324";
+my $server_port = 32124;
+my $log_file;
+my $help = 0;
+
+# how long the server keeps a connection open after a chunked body: the
+# proxy has to see the end of the body in the framing well before that
+my $linger = 3;
+my $timeout = 2;
+
+my $text = "hello world";
+
+# The response bodies, as the server sends them.  "split" goes out a
+# byte at a time, so every size line and CRLF is cut across reads.
+my %responses = (
+	split => "5${EOL}hello${EOL}6${EOL} world${EOL}0${EOL}${EOL}",
+	extension => "5;name=value${EOL}hello${EOL}"
+		. "6 ; q=\"a;b\"${EOL} world${EOL}0;last${EOL}${EOL}",
+	bare_lf => "5\nhello\n6\n world\n0\n\n",
+	trailers => "5${EOL}hello${EOL}6${EOL} world${EOL}0${EOL}"
+		. "X-Checksum: 1234${EOL}X-Other: two\n${EOL}",
+	trailers_8000 => "5${EOL}hello${EOL}6${EOL} world${EOL}0${EOL}"
+		. "X-Pad: " . ("a" x 8000) . "${EOL}${EOL}",
+	trailers_9000 => "5${EOL}hello${EOL}6${EOL} world${EOL}0${EOL}"
+		. "X-Pad: " . ("a" x 9000) . "${EOL}${EOL}",
+	trailers_100000 => "5${EOL}hello${EOL}6${EOL} world${EOL}0${EOL}"
+		. join("", map { "X-Pad-$_: " . ("a" x 1000) . $EOL } (1 .. 100))
+		. $EOL,
+	bad_size => "5${EOL}hello${EOL}zz${EOL} world${EOL}0${EOL}${EOL}",
+	overflow => "5${EOL}hello${EOL}1" . ("0" x 16)
+		. "${EOL} world${EOL}0${EOL}${EOL}",
+);
+
+my %trailers = (
+	trailers => "X-Checksum: 1234${EOL}X-Other: two${EOL}",
+	trailers_8000 => "X-Pad: " . ("a" x 8000) . $EOL,
+);
+
+my @broken = qw(bad_size overflow);
+
+# Bodies relayed as they are keep their trailers whatever the size, but
+# only 8192 bytes of them are kept when the framing comes off.
+my @broken_decoded = (@broken, qw(trailers_9000 trailers_100000));
+
+sub process_options() {
+	my $result = GetOptions("help|?" => \$help,
+				"proxy=s" => \$proxy,
+				"server-port=s" => \$server_port,
+				"log=s" => \$log_file);
+	die "Error reading cmdline options! $!" unless $result;
+
+	pod2usage(1) if $help;
+}
+
+# The chunked decoder of the client: returns the data, the trailer fields
+# with CRLF line ends, and whether the last chunk was seen.
+sub dechunk($) {
+	my $body = shift;
+	my ($data, $trailers) = ("", "");
+
+	while ($body =~ s/^([0-9a-fA-F]+)[^\n]*\n//) {
+		my $size = hex($1);
+		if ($size == 0) {
+			while ($body =~ s/^([^\r\n][^\n]*?)\r?\n//) {
+				$trailers .= "$1$EOL";
+			}
+			return ($data, $trailers, $body =~ /^\r?\n$/);
+		}
+		return ($data, $trailers, 0) if length($body) < $size;
+		$data .= substr($body, 0, $size, "");
+		$body =~ s/^\r?\n// or return ($data, $trailers, 0);
+	}
+	return ($data, $trailers, 0);
+}
+
+# server
+
+# What the server has read from its client but not used yet
+my $input = "";
+
+# Read up to and including the next LF, or to the end of the input.
+sub read_line($) {
+	my $client = shift;
+
+	while ($input !~ /\n/) {
+		sysread($client, $input, 4096, length($input)) or last;
+	}
+	$input =~ s/^([^\n]*\n?)// or return undef;
+	return length($1) ? $1 : undef;
+}
+
+sub read_bytes($$) {
+	my ($client, $len) = @_;
+
+	while (length($input) < $len) {
+		sysread($client, $input, 4096, length($input)) or last;
+	}
+	return substr($input, 0, $len, "");
+}
+
+sub read_headers($) {
+	my $client = shift;
+	my $headers = "";
+
+	while (defined(my $line = read_line($client))) {
+		$headers .= $line;
+		last if $line eq $EOL;
+	}
+	return $headers;
+}
+
+# Read a chunked body a line and a chunk at a time and return it with
+# its framing.
+sub read_chunked($) {
+	my $client = shift;
+	my $raw = "";
+
+	while (defined(my $line = read_line($client))) {
+		$raw .= $line;
+		my ($size) = $line =~ /^([0-9a-fA-F]+)/ or last;
+		if (hex($size) == 0) {
+			while (defined($line = read_line($client))) {
+				$raw .= $line;
+				last if $line =~ /^\r?\n$/;
+			}
+			last;
+		}
+		$raw .= read_bytes($client, hex($size));
+		$line = read_line($client);
+		$raw .= $line if defined($line);
+	}
+	return $raw;
+}
+
+sub serve($) {
+	my $client = shift;
+
+	my $headers = read_headers($client);
+	my ($method, $path) = $headers =~ /^(\S+) (?:http:\/\/[^\/]*)?(\S+)/;
+	$path = "" unless defined($path);
+	$path =~ s/^\/rewrite//;
+	$path =~ s/^\///;
+
+	if ($method eq "POST" && $path eq "echo") {
+		my $raw = read_chunked($client);
+		my $length = $headers =~ /^content-length:/im ? "yes" : "no";
+
+		# The proxy relays what the client sent after the body once
+		# the response headers are in, so they go first.
+		print $client "HTTP/1.0 200 OK$EOL"
+			. "Content-Type: application/octet-stream$EOL"
+			. "X-Content-Length: $length$EOL$EOL";
+
+		my $after = $input;
+		my $select = IO::Select->new($client);
+		while ($select->can_read($after eq "" ? $timeout : 0.1)) {
+			sysread($client, $after, 4096, length($after)) or last;
+		}
+		print $client "$after$EOL$raw";
+		return;
+	}
+
+	unless (exists $responses{$path}) {
+		print $client "HTTP/1.0 404 Not Found$EOL$EOL";
+		return;
+	}
+
+	print $client "HTTP/1.1 200 OK$EOL"
+		. "Content-Type: text/plain$EOL"
+		. "Transfer-Encoding: chunked$EOL$EOL";
+	if ($path eq "split") {
+		foreach my $byte (split(//, $responses{$path})) {
+			syswrite($client, $byte);
+			sleep(0.01);
+		}
+	} else {
+		print $client $responses{$path};
+	}
+	sleep($linger);
+}
+
+sub start_server() {
+	my $server = IO::Socket::INET->new(Proto => "tcp",
+					   LocalAddr => "127.0.0.1",
+					   LocalPort => $server_port,
+					   Listen => SOMAXCONN,
+					   Reuse => 1)
+		or die "cannot listen on port $server_port: $!";
+
+	my $pid = fork();
+	die "cannot fork: $!" unless defined($pid);
+	if ($pid) {
+		close $server;
+		return $pid;
+	}
+
+	$SIG{CHLD} = 'IGNORE';
+	while (1) {
+		my $client = $server->accept() or next;
+		$client->autoflush(1);
+		unless (fork()) {
+			close $server;
+			serve($client);
+			close $client;
+			exit(0);
+		}
+		close $client;
+	}
+}
+
+# client
+
+# Send "request" through the proxy, in the given pieces if it is an
+# array, and return the status line and headers, the body and how long
+# the response took.
+sub fetch($) {
+	my $request = shift;
+	my ($host, $port) = split(/:/, $proxy);
+	my $response = "";
+	my $start = time();
+
+	my $remote = IO::Socket::INET->new(Proto => "tcp",
+					   PeerAddr => $host,
+					   PeerPort => $port)
+		or die "cannot connect to the proxy at $proxy";
+	$remote->autoflush(1);
+
+	foreach my $piece (ref($request) ? @$request : ($request)) {
+		syswrite($remote, $piece);
+		sleep(0.01) if ref($request);
+	}
+
+	eval {
+		local $SIG{ALRM} = sub { die "timeout\n" };
+		alarm($linger + 2);
+		while (sysread($remote, $response, 65536, length($response))) {
+		}
+		alarm(0);
+	};
+	close $remote;
+
+	my ($head, $body) = split(/$EOL$EOL/, $response, 2);
+	$body = "" unless defined($body);
+	return ($head, $body, time() - $start);
+}
+
+sub get($$) {
+	my ($path, $version) = @_;
+	my ($host, $port) = ("127.0.0.1", $server_port);
+
+	return fetch("GET http://$host:$port$path HTTP/$version$EOL"
+		     . "Host: $host:$port$EOL"
+		     . "Connection: close$EOL$EOL");
+}
+
+my $failed = 0;
+
+sub check($$) {
+	my ($name, $error) = @_;
+
+	print "$name...";
+	if ($error) {
+		print " ERROR ($error)\n";
+		$failed++;
+	} else {
+		print " ok\n";
+	}
+}
+
+sub in_time($) {
+	my $elapsed = shift;
+	return $elapsed < $timeout ? ""
+		: sprintf("took %.1fs, the end of the body was missed",
+			  $elapsed);
+}
+
+# The body is relayed with its framing to an HTTP/1.1 client.
+sub test_relayed($) {
+	my $case = shift;
+	my ($head, $body, $elapsed) = get("/$case", "1.1");
+	my $error = in_time($elapsed);
+	my ($data, $trailers, $complete) = dechunk($body);
+
+	if ($head !~ /^transfer-encoding: chunked\r?$/im) {
+		$error = "no Transfer-Encoding: chunked";
+	} elsif (grep { $_ eq $case } @broken) {
+		$error ||= "the broken body was passed on whole" if $complete;
+	} elsif ($body ne $responses{$case}) {
+		$error = "the body was changed";
+	}
+	check("relaying $case to an HTTP/1.1 client", $error);
+}
+
+# The framing is taken off for an HTTP/1.0 client.
+sub test_dechunked($) {
+	my $case = shift;
+	my ($head, $body, $elapsed) = get("/$case", "1.0");
+	my $error = in_time($elapsed);
+
+	if ($head =~ /^transfer-encoding:/im) {
+		$error = "Transfer-Encoding was kept";
+	} elsif (grep { $_ eq $case } @broken_decoded) {
+		$error ||= "got '$body'" if index($text, $body) != 0;
+	} elsif ($body ne $text) {
+		$error = "got '$body'";
+	}
+	check("dechunking $case for an HTTP/1.0 client", $error);
+}
+
+# The body is rewritten and framed again, with the trailers after it.
+sub test_rewritten($) {
+	my $case = shift;
+	my ($head, $body, $elapsed) = get("/rewrite/$case", "1.1");
+	my $error = in_time($elapsed);
+	my ($data, $trailers, $complete) = dechunk($body);
+	my $want = $trailers{$case} || "";
+
+	if ($head !~ /^transfer-encoding: chunked\r?$/im) {
+		$error = "no Transfer-Encoding: chunked";
+	} elsif (grep { $_ eq $case } @broken_decoded) {
+		$error ||= "the broken body was passed on whole" if $complete;
+	} elsif (!$complete) {
+		$error = "the body has no last chunk";
+	} elsif ($data ne "HELLO world") {
+		$error = "got '$data'";
+	} elsif ($trailers ne $want) {
+		$error = "the trailers were changed";
+	}
+	check("rewriting $case", $error);
+}
+
+# A chunked request body goes to the server as it is, and the bytes
+# after it are relayed.  "pieces" are written with a pause in between.
+sub test_request($@) {
+	my ($name, @pieces) = @_;
+	my $request = join("", @pieces);
+	my ($headers, $sent) = split(/$EOL$EOL/, $request, 2);
+	$sent =~ s/after$//;
+
+	my ($head, $body, $elapsed) = fetch(\@pieces);
+	my ($after, $echoed) = split(/$EOL/, $body, 2);
+	my $error;
+	if ($head !~ /^HTTP\/1\.\d 200/) {
+		$error = "no response";
+	} elsif (!defined($echoed) || $echoed ne $sent) {
+		$error = "the body was changed";
+	} elsif ($head !~ /^X-Content-Length: no\r?$/m) {
+		$error = "Content-Length was passed on";
+	} elsif ($after ne "after") {
+		$error = "the bytes after the body were lost";
+	}
+	check("sending a chunked request body $name", $error);
+}
+
+sub post($) {
+	my $extra = shift;
+	return "POST http://127.0.0.1:$server_port/echo HTTP/1.1$EOL"
+		. "Host: 127.0.0.1:$server_port$EOL"
+		. $extra
+		. "Transfer-Encoding: chunked$EOL$EOL";
+}
+
+# main
+
+$| = 1;
+
+process_options();
+
+my $server_pid = start_server();
+
+foreach my $case (sort keys %responses) {
+	test_relayed($case);
+	test_dechunked($case);
+	test_rewritten($case);
+}
+
+# The proxy peeks at the socket and reads no further than the end of the
+# body, so these are all written in the one piece with what follows.
+test_request("in one piece",
+	     post("") . "5${EOL}hello${EOL}6;x=y${EOL} world${EOL}0${EOL}"
+	     . "X-Checksum: 1234${EOL}${EOL}after");
+test_request("with bare LF", post("") . "5\nhello\n0\n\nafter");
+test_request("with a Content-Length",
+	     post("Content-Length: 3$EOL") . "5${EOL}hello${EOL}0${EOL}${EOL}"
+	     . "after");
+test_request("split across reads",
+	     post(""), "1", "0${EOL}0123456789", "abcdef${EOL}",
+	     "5", ";ext", "${EOL}hello", "${EOL}0", "${EOL}${EOL}after");
+test_request("larger than the read buffer",
+	     post("") . "30d40${EOL}" . ("x" x 200000) . "${EOL}"
+	     . "0${EOL}${EOL}after");
+
+if ($log_file) {
+	open(LOG, "< $log_file") or die "cannot read $log_file: $!";
+	my $log = join("", <LOG>);
+	close(LOG);
+
+	check("logging the trailer limit",
+	      $log =~ /more than 8192 bytes of trailers/ ? ""
+	      : "not in the log");
+	check("logging malformed bodies",
+	      $log =~ /Malformed chunked body/ ? "" : "not in the log");
+}
+
+kill("TERM", $server_pid);
+waitpid($server_pid, 0);
+
+print "$failed errors\n";
+
+exit($failed);
+
+__END__
+
+=head1 chunkedtest.pl
+
+Tests the chunked transfer coding through a proxy.
+
+=head1 SYNOPSIS
+
+chunkedtest.pl [options]
+
+=head1 OPTIONS
+
+=over 8
+
+=item B<--help>
+
+Print a brief help message and exit.
+
+=item B<--proxy>
+
+The host:port of the proxy to test. Default is 127.0.0.1:12324.
+
+=item B<--server-port>
+
+The port for the test web server to listen on, on 127.0.0.1.
+
+=item B<--log>
+
+The log file of the proxy, checked for the errors the broken bodies
+should cause.
+
+=back
+
+=head1 DESCRIPTION
+
+The proxy is expected to relay the chunked bodies as they are to HTTP/1.1
+clients, take the framing off for HTTP/1.0 clients, and rewrite the bodies
+of URLs containing "/rewrite/" with
+
+    RewriteReplace "/rewrite/" "hello" "HELLO"
+
+Bodies with broken framing must not be passed on whole, nor bodies with
+more than 8192 bytes of trailers that are dechunked or rewritten.
+
+=head1 COPYRIGHT
+
+This program is distributed under the terms of the GNU General Public License
+version 2 or above. See the COPYING file for additional information.
+
+=cut
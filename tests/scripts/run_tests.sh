@@ -167,6 +167,20 @@ run_basic_webclient_request() {
 	return $WEBCLIENT_EXIT_CODE
 }
 
+run_script_test() {
+	$SCRIPTS_DIR/$1 > $LOG_DIR/$1.log 2>&1
+	SCRIPT_EXIT_CODE=$?
+	if test "x$SCRIPT_EXIT_CODE" = "x0" ; then
+		echo " ok"
+	else
+		echo "ERROR ($SCRIPT_EXIT_CODE)"
+		echo "$1 output:"
+		cat $LOG_DIR/$1.log
+	fi
+
+	return $SCRIPT_EXIT_CODE
+}
+
 # "main"
 
 provision_initial
@@ -192,6 +206,14 @@ echo -n "requesting statspage via stathost url..."
 run_basic_webclient_request "$TINYPROXY_IP:$TINYPROXY_PORT" "http://$TINYPROXY_STATHOST_IP"
 test "x$?" = "x0" || FAILED=$((FAILED + 1))
 
+echo -n "relaying chunked bodies..."
+run_script_test chunked_tests.sh
+test "x$?" = "x0" || FAILED=$((FAILED + 1))
+
+echo -n "matching configuration directives..."
+run_script_test check_config_dispatch.sh
+test "x$?" = "x0" || FAILED=$((FAILED + 1))
+
 echo "$FAILED errors"
 
 if test "x$TINYPROXY_TESTS_WAIT" = "xyes"; then